@@ -0,0 +1,542 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BenchCommand.h"
+
+#include <app/AttributePathParams.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <lib/core/CHIPCallback.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <transport/Session.h>
+
+#include <inttypes.h>
+
+using namespace chip;
+using namespace chip::System::Clock;
+
+namespace {
+
+constexpr Milliseconds32 kTickInterval   = Milliseconds32(10);
+constexpr Milliseconds64 kReconnectDelay = Milliseconds64(1000);
+constexpr uint16_t kDefaultDurationSecs  = 10;
+constexpr uint16_t kDefaultMaxInFlight   = 4;
+constexpr uint16_t kDefaultTimeoutSecs   = 20;
+constexpr uint32_t kWaitMarginSecs       = 10;
+
+Microseconds64 Now()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64();
+}
+
+} // namespace
+
+class BenchCommand::Node
+{
+public:
+    Node(BenchCommand & command, NodeId nodeId) :
+        mCommand(command), mNodeId(nodeId), mOnConnectedCallback(OnConnectedFn, this),
+        mOnConnectionFailureCallback(OnConnectionFailureFn, this)
+    {}
+
+    static void OnConnectedFn(void * context, Messaging::ExchangeManager & exchangeMgr, SessionHandle & sessionHandle)
+    {
+        auto * node = static_cast<Node *>(context);
+        node->mCommand.OnNodeConnected(*node, exchangeMgr, sessionHandle);
+    }
+
+    static void OnConnectionFailureFn(void * context, const ScopedNodeId & peerId, CHIP_ERROR error)
+    {
+        auto * node = static_cast<Node *>(context);
+        node->mCommand.OnNodeConnectionFailure(*node, error);
+    }
+
+    BenchCommand & mCommand;
+    const NodeId mNodeId;
+    NodeState mState                          = NodeState::kDisconnected;
+    Messaging::ExchangeManager * mExchangeMgr = nullptr;
+    SessionHolder mSession;
+    Microseconds64 mConnectStartTime;
+
+    // Interactions started, dropped or skipped so far, which is the index of the next interaction to start.
+    uint64_t mIssuedCount       = 0;
+    uint64_t mStartedCount      = 0;
+    uint64_t mFailedCount       = 0;
+    uint64_t mDroppedCount      = 0;
+    uint64_t mSkippedCount      = 0;
+    uint32_t mInFlightCount     = 0;
+    uint32_t mSubscriptionCount = 0;
+    uint32_t mConnectCount      = 0;
+
+    Callback::Callback<OnDeviceConnected> mOnConnectedCallback;
+    Callback::Callback<OnDeviceConnectionFailure> mOnConnectionFailureCallback;
+};
+
+/*
+ * An interaction started with a node.  It is completed when its response is received, or when it fails: a
+ * subscription is completed once it is established.  It is done once its client is done, and can be destroyed.
+ *
+ * An established subscription that is lost is re-established by its client, until the end of the run.
+ */
+class BenchCommand::PendingInteraction
+{
+public:
+    PendingInteraction(BenchCommand & command, Node & node, const BenchInteraction & interaction) :
+        mCommand(command), mNode(node), mInteraction(interaction), mStartTime(Now())
+    {}
+    virtual ~PendingInteraction() {}
+
+    virtual CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) = 0;
+
+    bool IsCompleted() const { return mIsCompleted; }
+    bool IsDone() const { return mIsDone; }
+
+    // Called when the run is over.  The interaction is destroyed right after.
+    void Abort() { Complete(CHIP_ERROR_TIMEOUT); }
+
+protected:
+    friend class BenchCommand;
+
+    void Complete(CHIP_ERROR error)
+    {
+        VerifyOrReturn(!mIsCompleted);
+        mIsCompleted = true;
+        mCommand.OnInteractionCompleted(*this, error);
+    }
+
+    void SetDone() { mIsDone = true; }
+
+    BenchCommand & mCommand;
+    Node & mNode;
+    const BenchInteraction & mInteraction;
+    const Microseconds64 mStartTime;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+
+private:
+    bool mIsCompleted = false;
+    bool mIsDone      = false;
+};
+
+class BenchCommand::ReadInteraction : public BenchCommand::PendingInteraction, public app::ReadClient::Callback
+{
+public:
+    using PendingInteraction::PendingInteraction;
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) override
+    {
+        bool isSubscription = (mInteraction.mKind == BenchKind::kSubscribe);
+
+        mPath = app::AttributePathParams(mInteraction.mEndpointId, mInteraction.mClusterId, mInteraction.mAttributeId);
+        app::ReadPrepareParams params(sessionHandle);
+        params.mpAttributePathParamsList    = &mPath;
+        params.mAttributePathParamsListSize = 1;
+        if (isSubscription)
+        {
+            params.mMinIntervalFloorSeconds   = mInteraction.mMinIntervalSeconds;
+            params.mMaxIntervalCeilingSeconds = mInteraction.mMaxIntervalSeconds;
+            // Every subscription started with a node lasts until the end of the run.
+            params.mKeepSubscriptions = true;
+        }
+
+        mClient = std::make_unique<app::ReadClient>(app::InteractionModelEngine::GetInstance(), &exchangeMgr, *this,
+                                                    isSubscription ? app::ReadClient::InteractionType::Subscribe
+                                                                   : app::ReadClient::InteractionType::Read);
+        if (isSubscription)
+        {
+            // The path outlives the client, so there is nothing to free in OnDeallocatePaths.
+            return mClient->SendAutoResubscribeRequest(std::move(params));
+        }
+        return mClient->SendRequest(params);
+    }
+
+    /////////// ReadClient Callback Interface /////////
+    void OnAttributeData(const app::ConcreteDataAttributePath & path, TLV::TLVReader * data, const app::StatusIB & status) override
+    {
+        if (!status.IsSuccess() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnReportEnd() override
+    {
+        if (IsCompleted())
+        {
+            mCommand.mStats.OnSubscriptionReport();
+        }
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId subscriptionId) override
+    {
+        if (mIsResubscribing)
+        {
+            mCommand.mStats.OnSubscriptionRestored();
+            mIsResubscribing = false;
+        }
+        Complete(mError);
+        mError = CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnResubscriptionNeeded(app::ReadClient * client, CHIP_ERROR terminationCause) override
+    {
+        // A subscription that was never established fails like any other interaction.
+        VerifyOrReturnError(IsCompleted(), terminationCause);
+
+        mCommand.mStats.OnSubscriptionLost(terminationCause);
+        mIsResubscribing = true;
+        return app::ReadClient::Callback::OnResubscriptionNeeded(client, terminationCause);
+    }
+
+    void OnError(CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(app::ReadClient * client) override
+    {
+        if (!IsCompleted())
+        {
+            Complete(mError);
+        }
+        if (mInteraction.mKind == BenchKind::kSubscribe)
+        {
+            mNode.mSubscriptionCount--;
+        }
+        SetDone();
+    }
+
+private:
+    app::AttributePathParams mPath;
+    std::unique_ptr<app::ReadClient> mClient;
+    bool mIsResubscribing = false;
+};
+
+class BenchCommand::InvokeInteraction : public BenchCommand::PendingInteraction, public app::CommandSender::Callback
+{
+public:
+    using PendingInteraction::PendingInteraction;
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle) override
+    {
+        VerifyOrReturnError(mInteraction.mPayload != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+        app::CommandPathParams path(mInteraction.mEndpointId, 0 /* groupId */, mInteraction.mClusterId, mInteraction.mCommandId,
+                                    app::CommandPathFlags::kEndpointIdValid);
+
+        mSender = std::make_unique<app::CommandSender>(this, &exchangeMgr);
+        ReturnErrorOnFailure(mSender->AddRequestDataNoTimedCheck(path, *mInteraction.mPayload, NullOptional));
+        return mSender->SendCommandRequest(sessionHandle);
+    }
+
+    /////////// CommandSender Callback Interface /////////
+    void OnResponse(app::CommandSender * sender, const app::ConcreteCommandPath & path, const app::StatusIB & status,
+                    TLV::TLVReader * data) override
+    {
+        if (!status.IsSuccess() && mError == CHIP_NO_ERROR)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(const app::CommandSender * sender, CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(app::CommandSender * sender) override
+    {
+        Complete(mError);
+        SetDone();
+    }
+
+private:
+    std::unique_ptr<app::CommandSender> mSender;
+};
+
+// The constructor and destructor are out of line, as they need the definitions of the nodes and the interactions.
+BenchCommand::BenchCommand(const char * commandName, CredentialIssuerCommands * credsIssuerConfig, const char * helpText) :
+    CHIPCommand(commandName, credsIssuerConfig, helpText)
+{}
+
+BenchCommand::~BenchCommand() {}
+
+void BenchCommand::AddArguments()
+{
+    AddArgument("node-ids", 0, UINT64_MAX, &mNodeIds, "Comma-separated list of the ids of the nodes to put the load on.");
+    AddArgument("duration", 1, UINT16_MAX, &mDurationSecs,
+                "Duration of the run, in seconds, not counting the connection to the nodes.  If not provided, 10.");
+    AddArgument("max-in-flight", 1, UINT16_MAX, &mMaxInFlight,
+                "Maximum number of interactions in flight with each node.  The interactions a node is too far behind to start "
+                "in time are dropped.  If not provided, 4.");
+    AddArgument("timeout", 1, UINT16_MAX, &mTimeoutSecs,
+                "Time, in seconds, given to the nodes to connect before the run, and to the interactions in flight to complete "
+                "after it.  If not provided, 20.");
+}
+
+Timeout BenchCommand::GetWaitDuration() const
+{
+    uint32_t timeoutSecs = mTimeoutSecs.ValueOr(kDefaultTimeoutSecs);
+    return Seconds32(mDurationSecs.ValueOr(kDefaultDurationSecs) + 2 * timeoutSecs + kWaitMarginSecs);
+}
+
+CHIP_ERROR BenchCommand::RunCommand()
+{
+    VerifyOrReturnError(!mNodeIds.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(PrepareRun());
+
+    mStats.Clear();
+    mInteractions.clear();
+    mNodes.clear();
+    mRunDuration = Milliseconds64::zero();
+    for (NodeId nodeId : mNodeIds)
+    {
+        mNodes.push_back(std::make_unique<Node>(*this, nodeId));
+    }
+
+    SetPhase(Phase::kConnecting);
+    ReturnErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(kTickInterval, OnTick, this));
+
+    ChipLogProgress(chipTool, "Connecting to %u node(s)", static_cast<unsigned>(mNodes.size()));
+    for (auto & node : mNodes)
+    {
+        Connect(*node);
+    }
+    return CHIP_NO_ERROR;
+}
+
+void BenchCommand::Shutdown()
+{
+    DeviceLayer::SystemLayer().CancelTimer(OnTick, this);
+    mInteractions.clear();
+    mNodes.clear();
+
+    CHIPCommand::Shutdown();
+}
+
+void BenchCommand::Connect(Node & node)
+{
+    node.mState            = NodeState::kConnecting;
+    node.mConnectStartTime = Now();
+    node.mConnectCount++;
+    mStats.OnStarted(BenchKind::kConnect);
+
+    CHIP_ERROR err =
+        CurrentCommissioner().GetConnectedDevice(node.mNodeId, &node.mOnConnectedCallback, &node.mOnConnectionFailureCallback);
+    if (err != CHIP_NO_ERROR)
+    {
+        OnNodeConnectionFailure(node, err);
+    }
+}
+
+void BenchCommand::OnNodeConnected(Node & node, Messaging::ExchangeManager & exchangeMgr, const SessionHandle & sessionHandle)
+{
+    mStats.OnSucceeded(BenchKind::kConnect, Now() - node.mConnectStartTime);
+
+    node.mState       = NodeState::kConnected;
+    node.mExchangeMgr = &exchangeMgr;
+    node.mSession.Grab(sessionHandle);
+}
+
+void BenchCommand::OnNodeConnectionFailure(Node & node, CHIP_ERROR error)
+{
+    ChipLogError(chipTool, "Failed to connect to node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT, ChipLogValueX64(node.mNodeId),
+                 error.Format());
+    mStats.OnFailed(BenchKind::kConnect, error);
+
+    // The node is connected to again after a while, once the run is started.
+    node.mState = NodeState::kDisconnected;
+}
+
+void BenchCommand::OnTick(System::Layer * systemLayer, void * context)
+{
+    static_cast<BenchCommand *>(context)->Tick();
+}
+
+void BenchCommand::Tick()
+{
+    // The clients of the interactions may only be destroyed once they are done calling back.
+    mInteractions.remove_if([](const auto & interaction) { return interaction->IsDone(); });
+
+    Milliseconds64 elapsed = std::chrono::duration_cast<Milliseconds64>(Now() - mPhaseStartTime);
+    Milliseconds64 timeout = Seconds16(mTimeoutSecs.ValueOr(kDefaultTimeoutSecs));
+
+    switch (mPhase)
+    {
+    case Phase::kConnecting:
+        if (GetNodeCount(NodeState::kConnecting) == 0 || elapsed >= timeout)
+        {
+            size_t connectedCount = GetNodeCount(NodeState::kConnected);
+            ChipLogProgress(chipTool, "Connected to %u of %u node(s)", static_cast<unsigned>(connectedCount),
+                            static_cast<unsigned>(mNodes.size()));
+            VerifyOrReturn(connectedCount != 0, Finish(CHIP_ERROR_NOT_CONNECTED));
+            SetPhase(Phase::kRunning);
+        }
+        break;
+
+    case Phase::kRunning:
+        if (elapsed >= Seconds16(mDurationSecs.ValueOr(kDefaultDurationSecs)))
+        {
+            mRunDuration = elapsed;
+            ChipLogProgress(chipTool, "Run over, waiting for %" PRIu64 " interaction(s) in flight", GetInFlightCount());
+            SetPhase(Phase::kDraining);
+            break;
+        }
+        for (auto & node : mNodes)
+        {
+            StartInteractions(*node, elapsed);
+        }
+        break;
+
+    case Phase::kDraining:
+        VerifyOrReturn(GetInFlightCount() != 0 && elapsed < timeout, Finish(CHIP_NO_ERROR));
+        break;
+    }
+
+    LogErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(kTickInterval, OnTick, this));
+}
+
+void BenchCommand::SetPhase(Phase phase)
+{
+    mPhase          = phase;
+    mPhaseStartTime = Now();
+}
+
+void BenchCommand::StartInteractions(Node & node, Milliseconds64 elapsed)
+{
+    if (node.mState == NodeState::kConnected && !node.mSession)
+    {
+        ChipLogError(chipTool, "Lost the session with node 0x" ChipLogFormatX64, ChipLogValueX64(node.mNodeId));
+        Connect(node);
+    }
+    else if (node.mState == NodeState::kDisconnected && Now() - node.mConnectStartTime >= kReconnectDelay)
+    {
+        Connect(node);
+    }
+
+    uint64_t dueCount    = GetDueCount(elapsed);
+    uint16_t maxInFlight = mMaxInFlight.ValueOr(kDefaultMaxInFlight);
+
+    // A node that falls behind may catch up with as many interactions as it could have in flight, but no more.
+    while (dueCount > node.mIssuedCount + maxInFlight)
+    {
+        mStats.OnDropped(GetInteraction(node.mIssuedCount++).mKind);
+        node.mDroppedCount++;
+    }
+
+    while (node.mState == NodeState::kConnected && node.mIssuedCount < dueCount && node.mInFlightCount < maxInFlight)
+    {
+        const BenchInteraction & interaction = GetInteraction(node.mIssuedCount++);
+        if (interaction.mKind == BenchKind::kSubscribe && node.mSubscriptionCount >= GetMaxSubscriptionCount())
+        {
+            node.mSkippedCount++;
+            continue;
+        }
+        StartInteraction(node, interaction);
+    }
+}
+
+void BenchCommand::StartInteraction(Node & node, const BenchInteraction & interaction)
+{
+    std::unique_ptr<PendingInteraction> pendingInteraction;
+    if (interaction.mKind == BenchKind::kInvoke)
+    {
+        pendingInteraction = std::make_unique<InvokeInteraction>(*this, node, interaction);
+    }
+    else
+    {
+        pendingInteraction = std::make_unique<ReadInteraction>(*this, node, interaction);
+    }
+
+    mStats.OnStarted(interaction.mKind);
+    node.mStartedCount++;
+
+    CHIP_ERROR err = pendingInteraction->Start(*node.mExchangeMgr, node.mSession.Get().Value());
+    if (err != CHIP_NO_ERROR)
+    {
+        mStats.OnFailed(interaction.mKind, err);
+        node.mFailedCount++;
+        return;
+    }
+
+    node.mInFlightCount++;
+    if (interaction.mKind == BenchKind::kSubscribe)
+    {
+        node.mSubscriptionCount++;
+    }
+    mInteractions.push_back(std::move(pendingInteraction));
+}
+
+void BenchCommand::OnInteractionCompleted(PendingInteraction & interaction, CHIP_ERROR error)
+{
+    Node & node = interaction.mNode;
+    node.mInFlightCount--;
+
+    if (error == CHIP_NO_ERROR)
+    {
+        mStats.OnSucceeded(interaction.mInteraction.mKind, Now() - interaction.mStartTime);
+    }
+    else
+    {
+        mStats.OnFailed(interaction.mInteraction.mKind, error);
+        node.mFailedCount++;
+    }
+}
+
+size_t BenchCommand::GetNodeCount(NodeState state) const
+{
+    size_t count = 0;
+    for (const auto & node : mNodes)
+    {
+        count += (node->mState == state) ? 1 : 0;
+    }
+    return count;
+}
+
+uint64_t BenchCommand::GetInFlightCount() const
+{
+    uint64_t count = 0;
+    for (const auto & node : mNodes)
+    {
+        count += node->mInFlightCount;
+    }
+    return count;
+}
+
+void BenchCommand::Finish(CHIP_ERROR error)
+{
+    // The interactions still in flight are counted as timed out, and the subscriptions are torn down.
+    for (auto & interaction : mInteractions)
+    {
+        interaction->Abort();
+    }
+    mInteractions.clear();
+
+    LogResults();
+    SetCommandExitStatus(error);
+}
+
+void BenchCommand::LogResults() const
+{
+    ChipLogProgress(chipTool, "Results over %.3f s:", static_cast<double>(mRunDuration.count()) / 1000);
+    mStats.Log(mRunDuration);
+
+    for (const auto & node : mNodes)
+    {
+        ChipLogProgress(chipTool,
+                        "node 0x" ChipLogFormatX64 ": %" PRIu64 " started, %" PRIu64 " failed, %" PRIu64 " dropped, %" PRIu64
+                        " skipped, %u connection attempt(s)%s",
+                        ChipLogValueX64(node->mNodeId), node->mStartedCount, node->mFailedCount, node->mDroppedCount,
+                        node->mSkippedCount, static_cast<unsigned>(node->mConnectCount),
+                        node->mState == NodeState::kConnected ? "" : ", not connected");
+    }
+}
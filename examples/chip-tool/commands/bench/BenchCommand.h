@@ -0,0 +1,133 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../clusters/CustomArgument.h"
+#include "../common/CHIPCommand.h"
+#include "BenchStats.h"
+
+#include <lib/core/DataModelTypes.h>
+#include <system/SystemClock.h>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+/*
+ * An interaction that a bench command starts with the nodes it targets.
+ */
+struct BenchInteraction
+{
+    BenchKind mKind                 = BenchKind::kRead;
+    chip::EndpointId mEndpointId    = 0;
+    chip::ClusterId mClusterId      = 0;
+    chip::AttributeId mAttributeId  = 0;
+    chip::CommandId mCommandId      = 0;
+    uint16_t mMinIntervalSeconds    = 0;
+    uint16_t mMaxIntervalSeconds    = 0;
+    const CustomArgument * mPayload = nullptr;
+};
+
+/*
+ * Base class of the commands that put a sustained load on a set of nodes.
+ *
+ * The command opens a CASE session with each of the nodes, then starts interactions with all of them
+ * concurrently for the duration of the run, at the pace set by the subclass.  A node has at most max-in-flight
+ * interactions in flight: when a node falls further behind the pace, the interactions it missed are dropped,
+ * rather than started in a burst once it catches up.  The subscriptions stay established until the end of the
+ * run: a lost subscription is re-established, and a node that loses its session is connected to again.  A
+ * subscription that comes due while its node already holds as many as allowed is skipped.
+ *
+ * Once the interactions in flight are done, or the timeout expires, the command logs the latency histogram and
+ * the error breakdown of each kind of interaction, followed by the counts of each node.
+ */
+class BenchCommand : public CHIPCommand
+{
+public:
+    BenchCommand(const char * commandName, CredentialIssuerCommands * credsIssuerConfig, const char * helpText = nullptr);
+    ~BenchCommand() override;
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override;
+    void Shutdown() override;
+
+protected:
+    // Add the node-ids argument, and the options shared by all the bench commands.
+    void AddArguments();
+
+    // Called before connecting to the nodes.
+    virtual CHIP_ERROR PrepareRun() { return CHIP_NO_ERROR; }
+
+    // Number of interactions that should have been started with each node, the given time after the start of the run.
+    virtual uint64_t GetDueCount(chip::System::Clock::Milliseconds64 elapsed) const = 0;
+
+    // Interaction to start as the interaction of the given index with a node.
+    virtual const BenchInteraction & GetInteraction(uint64_t index) const = 0;
+
+    // Most subscriptions a node may hold at a time.
+    virtual uint32_t GetMaxSubscriptionCount() const { return UINT32_MAX; }
+
+private:
+    class Node;
+    class PendingInteraction;
+    class ReadInteraction;
+    class InvokeInteraction;
+
+    enum class Phase : uint8_t
+    {
+        kConnecting,
+        kRunning,
+        kDraining,
+    };
+
+    enum class NodeState : uint8_t
+    {
+        kDisconnected,
+        kConnecting,
+        kConnected,
+    };
+
+    void Connect(Node & node);
+    void OnNodeConnected(Node & node, chip::Messaging::ExchangeManager & exchangeMgr, const chip::SessionHandle & sessionHandle);
+    void OnNodeConnectionFailure(Node & node, CHIP_ERROR error);
+
+    static void OnTick(chip::System::Layer * systemLayer, void * context);
+    void Tick();
+    void SetPhase(Phase phase);
+    void StartInteractions(Node & node, chip::System::Clock::Milliseconds64 elapsed);
+    void StartInteraction(Node & node, const BenchInteraction & interaction);
+    void OnInteractionCompleted(PendingInteraction & interaction, CHIP_ERROR error);
+    size_t GetNodeCount(NodeState state) const;
+    uint64_t GetInFlightCount() const;
+    void Finish(CHIP_ERROR error);
+    void LogResults() const;
+
+    std::vector<chip::NodeId> mNodeIds;
+    chip::Optional<uint16_t> mDurationSecs;
+    chip::Optional<uint16_t> mMaxInFlight;
+    chip::Optional<uint16_t> mTimeoutSecs;
+
+    std::vector<std::unique_ptr<Node>> mNodes;
+    std::list<std::unique_ptr<PendingInteraction>> mInteractions;
+    BenchStats mStats;
+    Phase mPhase = Phase::kConnecting;
+    chip::System::Clock::Microseconds64 mPhaseStartTime;
+    chip::System::Clock::Milliseconds64 mRunDuration;
+};
@@ -0,0 +1,39 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BenchRateCommand.h"
+
+using namespace chip::System::Clock;
+
+namespace {
+
+constexpr double kDefaultRate                   = 1;
+constexpr uint16_t kDefaultSubscriptionsPerNode = 1;
+
+} // namespace
+
+uint64_t BenchRateCommand::GetDueCount(Milliseconds64 elapsed) const
+{
+    // The first interaction is started right away.
+    return static_cast<uint64_t>(static_cast<double>(elapsed.count()) * mRate.ValueOr(kDefaultRate) / 1000) + 1;
+}
+
+uint32_t BenchRateCommand::GetMaxSubscriptionCount() const
+{
+    return mSubscriptionsPerNode.ValueOr(kDefaultSubscriptionsPerNode);
+}
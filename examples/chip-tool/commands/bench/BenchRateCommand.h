@@ -0,0 +1,75 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "BenchCommand.h"
+
+/*
+ * Starts the same interaction with each of the nodes, at a fixed rate.
+ *
+ * Subscriptions stop being started with a node once it holds subscriptions-per-node of them, and start again at
+ * the given rate if it comes to hold fewer, when one fails for good.
+ */
+class BenchRateCommand : public BenchCommand
+{
+public:
+    BenchRateCommand(const char * commandName, BenchKind kind, CredentialIssuerCommands * credsIssuerConfig) :
+        BenchCommand(commandName, credsIssuerConfig)
+    {
+        mInteraction.mKind = kind;
+
+        AddArgument("cluster-id", 0, UINT32_MAX, &mInteraction.mClusterId);
+        if (kind == BenchKind::kInvoke)
+        {
+            AddArgument("command-id", 0, UINT32_MAX, &mInteraction.mCommandId);
+            AddArgument("payload", &mPayload);
+            mInteraction.mPayload = &mPayload;
+        }
+        else
+        {
+            AddArgument("attribute-id", 0, UINT32_MAX, &mInteraction.mAttributeId);
+        }
+        if (kind == BenchKind::kSubscribe)
+        {
+            AddArgument("min-interval", 0, UINT16_MAX, &mInteraction.mMinIntervalSeconds,
+                        "Server should not send a new report if less than this number of seconds has elapsed since the last "
+                        "report.");
+            AddArgument("max-interval", 0, UINT16_MAX, &mInteraction.mMaxIntervalSeconds,
+                        "Server must send a report if this number of seconds has elapsed since the last report.");
+            AddArgument("subscriptions-per-node", 1, UINT16_MAX, &mSubscriptionsPerNode,
+                        "Number of subscriptions to establish with each node.  If not provided, 1.");
+        }
+        AddArguments();
+        AddArgument("endpoint-id", 0, UINT16_MAX, &mInteraction.mEndpointId);
+        AddArgument("rate", 0.0, 1000000.0, &mRate,
+                    "Number of interactions started with each node per second.  If not provided, 1.");
+    }
+
+protected:
+    /////////// BenchCommand Interface /////////
+    uint64_t GetDueCount(chip::System::Clock::Milliseconds64 elapsed) const override;
+    const BenchInteraction & GetInteraction(uint64_t index) const override { return mInteraction; }
+    uint32_t GetMaxSubscriptionCount() const override;
+
+private:
+    BenchInteraction mInteraction;
+    CustomArgument mPayload;
+    chip::Optional<double> mRate;
+    chip::Optional<uint16_t> mSubscriptionsPerNode;
+};
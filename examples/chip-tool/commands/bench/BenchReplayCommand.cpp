@@ -0,0 +1,177 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BenchReplayCommand.h"
+
+#include <lib/support/SafeInt.h>
+
+#include <algorithm>
+#include <fstream>
+#include <inttypes.h>
+
+using namespace chip;
+using namespace chip::System::Clock;
+
+namespace {
+
+constexpr double kDefaultSpeed   = 1;
+constexpr char kDefaultPayload[] = "{}";
+
+template <typename T>
+CHIP_ERROR GetUnsigned(const Json::Value & value, const char * name, T & field)
+{
+    const Json::Value & member = value[name];
+    VerifyOrReturnError(member.isUInt64() && CanCastTo<T>(member.asUInt64()), CHIP_ERROR_INVALID_ARGUMENT);
+    field = static_cast<T>(member.asUInt64());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR GetKind(const Json::Value & value, BenchKind & kind)
+{
+    const Json::Value & type = value["type"];
+    VerifyOrReturnError(type.isString(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (type.asString() == "read")
+    {
+        kind = BenchKind::kRead;
+    }
+    else if (type.asString() == "subscribe")
+    {
+        kind = BenchKind::kSubscribe;
+    }
+    else if (type.asString() == "invoke")
+    {
+        kind = BenchKind::kInvoke;
+    }
+    else
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void BenchReplayCommand::Shutdown()
+{
+    // The interactions in flight refer to the entries: they are gone once the command is shut down.
+    BenchCommand::Shutdown();
+
+    mEntries.clear();
+    mPayloads.clear();
+}
+
+CHIP_ERROR BenchReplayCommand::PrepareRun()
+{
+    mEntries.clear();
+    mPayloads.clear();
+    mSubscriptionCount = 0;
+
+    std::ifstream file(mMixPath);
+    if (!file.is_open())
+    {
+        ChipLogError(chipTool, "Failed to open the interaction mix %s", mMixPath);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    Json::CharReaderBuilder readerBuilder;
+    Json::Value mix;
+    std::string errors;
+    if (!Json::parseFromStream(readerBuilder, file, &mix, &errors))
+    {
+        ChipLogError(chipTool, "Failed to parse the interaction mix %s: %s", mMixPath, errors.c_str());
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    CHIP_ERROR err = LoadMix(mix);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Invalid interaction mix %s: %" CHIP_ERROR_FORMAT, mMixPath, err.Format());
+        return err;
+    }
+
+    ChipLogProgress(chipTool, "Replaying %u interaction(s) recorded over %" PRIu64 " ms", static_cast<unsigned>(mEntries.size()),
+                    mDurationMs);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchReplayCommand::LoadMix(const Json::Value & mix)
+{
+    VerifyOrReturnError(mix.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(GetUnsigned(mix, "durationMs", mDurationMs));
+    VerifyOrReturnError(mDurationMs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const Json::Value & interactions = mix["interactions"];
+    VerifyOrReturnError(interactions.isArray() && !interactions.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (const auto & value : interactions)
+    {
+        Entry entry;
+        ReturnErrorOnFailure(LoadEntry(value, entry));
+        VerifyOrReturnError(entry.mOffsetMs < mDurationMs, CHIP_ERROR_INVALID_ARGUMENT);
+        mEntries.push_back(entry);
+        mSubscriptionCount += (entry.mInteraction.mKind == BenchKind::kSubscribe) ? 1 : 0;
+    }
+
+    std::stable_sort(mEntries.begin(), mEntries.end(), [](const Entry & a, const Entry & b) { return a.mOffsetMs < b.mOffsetMs; });
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchReplayCommand::LoadEntry(const Json::Value & value, Entry & entry)
+{
+    BenchInteraction & interaction = entry.mInteraction;
+
+    VerifyOrReturnError(value.isObject(), CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(GetUnsigned(value, "offsetMs", entry.mOffsetMs));
+    ReturnErrorOnFailure(GetKind(value, interaction.mKind));
+    ReturnErrorOnFailure(GetUnsigned(value, "endpointId", interaction.mEndpointId));
+    ReturnErrorOnFailure(GetUnsigned(value, "clusterId", interaction.mClusterId));
+
+    if (interaction.mKind == BenchKind::kInvoke)
+    {
+        ReturnErrorOnFailure(GetUnsigned(value, "commandId", interaction.mCommandId));
+
+        const Json::Value & payloadValue = value.get("payload", kDefaultPayload);
+        VerifyOrReturnError(payloadValue.isString(), CHIP_ERROR_INVALID_ARGUMENT);
+
+        auto payload = std::make_unique<CustomArgument>();
+        ReturnErrorOnFailure(payload->Parse("payload", payloadValue.asCString()));
+        interaction.mPayload = payload.get();
+        mPayloads.push_back(std::move(payload));
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(GetUnsigned(value, "attributeId", interaction.mAttributeId));
+    if (interaction.mKind == BenchKind::kSubscribe)
+    {
+        ReturnErrorOnFailure(GetUnsigned(value, "minIntervalSeconds", interaction.mMinIntervalSeconds));
+        ReturnErrorOnFailure(GetUnsigned(value, "maxIntervalSeconds", interaction.mMaxIntervalSeconds));
+    }
+    return CHIP_NO_ERROR;
+}
+
+uint64_t BenchReplayCommand::GetDueCount(Milliseconds64 elapsed) const
+{
+    auto replayedMs = static_cast<uint64_t>(static_cast<double>(elapsed.count()) * mSpeed.ValueOr(kDefaultSpeed));
+    uint64_t loops  = replayedMs / mDurationMs;
+    uint64_t offset = replayedMs % mDurationMs;
+
+    auto next = std::upper_bound(mEntries.begin(), mEntries.end(), offset,
+                                 [](uint64_t offsetMs, const Entry & entry) { return offsetMs < entry.mOffsetMs; });
+    return loops * mEntries.size() + static_cast<uint64_t>(next - mEntries.begin());
+}
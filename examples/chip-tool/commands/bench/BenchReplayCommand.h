@@ -0,0 +1,87 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "BenchCommand.h"
+
+#include <json/json.h>
+
+/*
+ * Replays a recorded mix of interactions with each of the nodes.
+ *
+ * The mix is a JSON file of the following form, where the interactions were started at the given offsets
+ * within a recording of durationMs:
+ *
+ *   {
+ *     "durationMs": 1000,
+ *     "interactions": [
+ *       { "offsetMs": 0, "type": "read", "endpointId": 1, "clusterId": 6, "attributeId": 0 },
+ *       { "offsetMs": 250, "type": "invoke", "endpointId": 1, "clusterId": 6, "commandId": 2, "payload": "{}" },
+ *       { "offsetMs": 500, "type": "subscribe", "endpointId": 1, "clusterId": 8, "attributeId": 0,
+ *         "minIntervalSeconds": 0, "maxIntervalSeconds": 10 }
+ *     ]
+ *   }
+ *
+ * The payload of an invoke has the syntax of the payload argument of the command-by-id commands, and defaults
+ * to an empty structure.  The recording is replayed in a loop for the duration of the run, sped up by the
+ * given factor.  A node holds at most as many subscriptions as one loop of the mix starts: the subscriptions
+ * of the following loops are skipped while those are established.
+ */
+class BenchReplayCommand : public BenchCommand
+{
+public:
+    BenchReplayCommand(CredentialIssuerCommands * credsIssuerConfig) : BenchCommand("replay", credsIssuerConfig)
+    {
+        AddArgument("mix-path", &mMixPath, "Path to the JSON file of the recorded interaction mix.");
+        AddArguments();
+        AddArgument("speed", 0.001, 1000.0, &mSpeed, "Factor by which the recording is sped up.  If not provided, 1.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    void Shutdown() override;
+
+protected:
+    /////////// BenchCommand Interface /////////
+    CHIP_ERROR PrepareRun() override;
+    uint64_t GetDueCount(chip::System::Clock::Milliseconds64 elapsed) const override;
+    const BenchInteraction & GetInteraction(uint64_t index) const override
+    {
+        return mEntries[static_cast<size_t>(index % mEntries.size())].mInteraction;
+    }
+    uint32_t GetMaxSubscriptionCount() const override { return mSubscriptionCount; }
+
+private:
+    struct Entry
+    {
+        uint64_t mOffsetMs;
+        BenchInteraction mInteraction;
+    };
+
+    CHIP_ERROR LoadMix(const Json::Value & mix);
+    CHIP_ERROR LoadEntry(const Json::Value & value, Entry & entry);
+
+    char * mMixPath;
+    chip::Optional<double> mSpeed;
+
+    // Sorted by offset.
+    std::vector<Entry> mEntries;
+    std::vector<std::unique_ptr<CustomArgument>> mPayloads;
+    uint64_t mDurationMs        = 0;
+    uint32_t mSubscriptionCount = 0;
+};
@@ -0,0 +1,223 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "BenchStats.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <inttypes.h>
+
+using namespace chip;
+using namespace chip::System::Clock;
+
+namespace {
+
+// The histogram buckets double in width, starting from [0, 0.125) ms: the last one holds everything above 32.768 s.
+constexpr uint64_t kFirstBucketUpperBoundUs = 125;
+constexpr size_t kHistogramBucketCount      = 20;
+constexpr size_t kHistogramBarWidth         = 40;
+
+double ToMilliseconds(uint64_t us)
+{
+    return static_cast<double>(us) / 1000;
+}
+
+double ToRate(uint64_t count, Milliseconds64 duration)
+{
+    return duration.count() == 0 ? 0 : static_cast<double>(count) * 1000 / static_cast<double>(duration.count());
+}
+
+// The latencies must be sorted, and not empty.
+uint32_t GetPercentile(const std::vector<uint32_t> & latenciesUs, uint8_t percentile)
+{
+    size_t rank = (latenciesUs.size() * percentile + 99) / 100;
+    return latenciesUs[rank == 0 ? 0 : rank - 1];
+}
+
+} // namespace
+
+void BenchStats::Clear()
+{
+    for (auto & stats : mStats)
+    {
+        stats = KindStats();
+    }
+    mSubscriptionReports   = 0;
+    mSubscriptionsLost     = 0;
+    mSubscriptionsRestored = 0;
+    mSubscriptionErrors.clear();
+}
+
+void BenchStats::OnStarted(BenchKind kind)
+{
+    GetStats(kind).mStarted++;
+}
+
+void BenchStats::OnSucceeded(BenchKind kind, Microseconds64 latency)
+{
+    KindStats & stats = GetStats(kind);
+    stats.mSucceeded++;
+    stats.mLatenciesUs.push_back(static_cast<uint32_t>(std::min<uint64_t>(latency.count(), UINT32_MAX)));
+}
+
+void BenchStats::OnFailed(BenchKind kind, CHIP_ERROR error)
+{
+    KindStats & stats = GetStats(kind);
+    stats.mFailed++;
+    AddError(stats.mErrors, error);
+}
+
+void BenchStats::OnDropped(BenchKind kind)
+{
+    GetStats(kind).mDropped++;
+}
+
+void BenchStats::OnSubscriptionReport()
+{
+    mSubscriptionReports++;
+}
+
+void BenchStats::OnSubscriptionLost(CHIP_ERROR error)
+{
+    mSubscriptionsLost++;
+    AddError(mSubscriptionErrors, error);
+}
+
+void BenchStats::OnSubscriptionRestored()
+{
+    mSubscriptionsRestored++;
+}
+
+void BenchStats::Log(Milliseconds64 duration) const
+{
+    for (size_t i = 0; i < kKindCount; i++)
+    {
+        const auto kind         = static_cast<BenchKind>(i);
+        const KindStats & stats = mStats[i];
+        if (stats.mStarted == 0 && stats.mDropped == 0)
+        {
+            continue;
+        }
+
+        ChipLogProgress(chipTool,
+                        "%s: %" PRIu64 " started, %" PRIu64 " succeeded, %" PRIu64 " failed, %" PRIu64 " dropped, %.2f succeeded/s",
+                        GetKindName(kind), stats.mStarted, stats.mSucceeded, stats.mFailed, stats.mDropped,
+                        ToRate(stats.mSucceeded, duration));
+        LogLatencies(stats.mLatenciesUs);
+        LogErrors(stats.mErrors);
+
+        if (kind == BenchKind::kSubscribe)
+        {
+            ChipLogProgress(chipTool,
+                            "  %" PRIu64 " reports on established subscriptions, %" PRIu64 " subscriptions lost, %" PRIu64
+                            " re-established",
+                            mSubscriptionReports, mSubscriptionsLost, mSubscriptionsRestored);
+            LogErrors(mSubscriptionErrors);
+        }
+    }
+}
+
+const char * BenchStats::GetKindName(BenchKind kind)
+{
+    switch (kind)
+    {
+    case BenchKind::kConnect:
+        return "connect";
+    case BenchKind::kRead:
+        return "read";
+    case BenchKind::kSubscribe:
+        return "subscribe";
+    case BenchKind::kInvoke:
+        return "invoke";
+    }
+    return "unknown";
+}
+
+void BenchStats::AddError(std::map<std::string, uint64_t> & errors, CHIP_ERROR error)
+{
+    errors[ErrorStr(error)]++;
+}
+
+void BenchStats::LogErrors(const std::map<std::string, uint64_t> & errors)
+{
+    std::vector<std::pair<std::string, uint64_t>> sortedErrors(errors.begin(), errors.end());
+    std::stable_sort(sortedErrors.begin(), sortedErrors.end(),
+                     [](const auto & a, const auto & b) { return a.second > b.second; });
+
+    for (const auto & error : sortedErrors)
+    {
+        ChipLogProgress(chipTool, "  %8" PRIu64 " x %s", error.second, error.first.c_str());
+    }
+}
+
+void BenchStats::LogLatencies(std::vector<uint32_t> latenciesUs)
+{
+    VerifyOrReturn(!latenciesUs.empty());
+    std::sort(latenciesUs.begin(), latenciesUs.end());
+
+    uint64_t totalUs                       = 0;
+    uint64_t counts[kHistogramBucketCount] = {};
+    for (uint32_t latencyUs : latenciesUs)
+    {
+        size_t bucket = 0;
+        for (uint64_t bound = kFirstBucketUpperBoundUs; latencyUs >= bound && bucket < kHistogramBucketCount - 1; bound *= 2)
+        {
+            bucket++;
+        }
+        counts[bucket]++;
+        totalUs += latencyUs;
+    }
+
+    ChipLogProgress(chipTool, "  latency (ms): min %.3f, mean %.3f, p50 %.3f, p90 %.3f, p99 %.3f, max %.3f",
+                    ToMilliseconds(latenciesUs.front()), ToMilliseconds(totalUs / latenciesUs.size()),
+                    ToMilliseconds(GetPercentile(latenciesUs, 50)), ToMilliseconds(GetPercentile(latenciesUs, 90)),
+                    ToMilliseconds(GetPercentile(latenciesUs, 99)), ToMilliseconds(latenciesUs.back()));
+
+    size_t first = 0;
+    size_t last  = kHistogramBucketCount - 1;
+    while (counts[first] == 0)
+    {
+        first++;
+    }
+    while (counts[last] == 0)
+    {
+        last--;
+    }
+    uint64_t maxCount = *std::max_element(counts, counts + kHistogramBucketCount);
+
+    for (size_t bucket = first; bucket <= last; bucket++)
+    {
+        uint64_t lowerUs = (bucket == 0) ? 0 : kFirstBucketUpperBoundUs << (bucket - 1);
+        uint64_t upperUs = kFirstBucketUpperBoundUs << bucket;
+        size_t barWidth  = static_cast<size_t>((counts[bucket] * kHistogramBarWidth + maxCount - 1) / maxCount);
+        std::string bar(barWidth, '#');
+
+        if (bucket == kHistogramBucketCount - 1)
+        {
+            ChipLogProgress(chipTool, "  [%10.3f, %10s) %10" PRIu64 " %s", ToMilliseconds(lowerUs), "inf", counts[bucket],
+                            bar.c_str());
+        }
+        else
+        {
+            ChipLogProgress(chipTool, "  [%10.3f, %10.3f) %10" PRIu64 " %s", ToMilliseconds(lowerUs), ToMilliseconds(upperUs),
+                            counts[bucket], bar.c_str());
+        }
+    }
+}
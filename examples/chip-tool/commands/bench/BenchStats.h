@@ -0,0 +1,93 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+enum class BenchKind : uint8_t
+{
+    kConnect,
+    kRead,
+    kSubscribe,
+    kInvoke,
+};
+
+/*
+ * Counts, latencies and errors of what a bench command did, per kind of operation.
+ *
+ * The latency of an operation runs from the moment it is started to the moment it completes: the
+ * reception of the last report for reads, of the priming report for subscriptions, of the response for
+ * invokes, and the establishment of the session for connections.
+ */
+class BenchStats
+{
+public:
+    static constexpr size_t kKindCount = 4;
+
+    void Clear();
+
+    void OnStarted(BenchKind kind);
+    void OnSucceeded(BenchKind kind, chip::System::Clock::Microseconds64 latency);
+    void OnFailed(BenchKind kind, CHIP_ERROR error);
+
+    // The operation was not started, as its node was too far behind the requested rate.
+    void OnDropped(BenchKind kind);
+
+    // A report received on an established subscription, the loss of such a subscription, or its re-establishment.
+    void OnSubscriptionReport();
+    void OnSubscriptionLost(CHIP_ERROR error);
+    void OnSubscriptionRestored();
+
+    uint64_t GetStartedCount(BenchKind kind) const { return GetStats(kind).mStarted; }
+    uint64_t GetFailedCount(BenchKind kind) const { return GetStats(kind).mFailed; }
+
+    // Log the stats of every kind of operation that was started, over a run of the given duration.
+    void Log(chip::System::Clock::Milliseconds64 duration) const;
+
+    static const char * GetKindName(BenchKind kind);
+
+private:
+    struct KindStats
+    {
+        uint64_t mStarted   = 0;
+        uint64_t mSucceeded = 0;
+        uint64_t mFailed    = 0;
+        uint64_t mDropped   = 0;
+        std::vector<uint32_t> mLatenciesUs;
+        std::map<std::string, uint64_t> mErrors;
+    };
+
+    KindStats & GetStats(BenchKind kind) { return mStats[static_cast<size_t>(kind)]; }
+    const KindStats & GetStats(BenchKind kind) const { return mStats[static_cast<size_t>(kind)]; }
+
+    static void AddError(std::map<std::string, uint64_t> & errors, CHIP_ERROR error);
+    static void LogErrors(const std::map<std::string, uint64_t> & errors);
+    static void LogLatencies(std::vector<uint32_t> latenciesUs);
+
+    KindStats mStats[kKindCount];
+    uint64_t mSubscriptionReports   = 0;
+    uint64_t mSubscriptionsLost     = 0;
+    uint64_t mSubscriptionsRestored = 0;
+    std::map<std::string, uint64_t> mSubscriptionErrors;
+};
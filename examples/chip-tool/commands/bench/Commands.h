@@ -0,0 +1,59 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "commands/bench/BenchRateCommand.h"
+#include "commands/bench/BenchReplayCommand.h"
+#include "commands/common/Commands.h"
+
+#include <commands/common/CredentialIssuerCommands.h>
+
+class BenchRead : public BenchRateCommand
+{
+public:
+    BenchRead(CredentialIssuerCommands * credsIssuerConfig) : BenchRateCommand("read", BenchKind::kRead, credsIssuerConfig) {}
+};
+
+class BenchSubscribe : public BenchRateCommand
+{
+public:
+    BenchSubscribe(CredentialIssuerCommands * credsIssuerConfig) :
+        BenchRateCommand("subscribe", BenchKind::kSubscribe, credsIssuerConfig)
+    {}
+};
+
+class BenchInvoke : public BenchRateCommand
+{
+public:
+    BenchInvoke(CredentialIssuerCommands * credsIssuerConfig) : BenchRateCommand("invoke", BenchKind::kInvoke, credsIssuerConfig) {}
+};
+
+void registerCommandsBench(Commands & commands, CredentialIssuerCommands * credsIssuerConfig)
+{
+    const char * clusterName = "Bench";
+
+    commands_list clusterCommands = {
+        make_unique<BenchRead>(credsIssuerConfig),
+        make_unique<BenchSubscribe>(credsIssuerConfig),
+        make_unique<BenchInvoke>(credsIssuerConfig),
+        make_unique<BenchReplayCommand>(credsIssuerConfig),
+    };
+
+    commands.Register(clusterName, clusterCommands);
+}
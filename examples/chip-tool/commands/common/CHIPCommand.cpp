@@ -75,6 +75,15 @@ const CHIP_ERROR GetAttestationTrustStore(const char * paaTrustStorePath,
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
+#if defined(__linux__)
+    // In interactive mode, PAAs added to or removed from the directory are picked up without restarting chip-tool.
+    static const CHIP_ERROR watchError = attestationTrustStore.StartWatching();
+    if (watchError != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Failed to watch the PAA trust store: %" CHIP_ERROR_FORMAT, watchError.Format());
+    }
+#endif // defined(__linux__)
+
     *trustStore = &attestationTrustStore;
     return CHIP_NO_ERROR;
 }
@@ -249,7 +249,8 @@ bool Command::InitArgument(size_t argIndex, char * argValue)
     }
 
     case ArgumentType::Vector16:
-    case ArgumentType::Vector32: {
+    case ArgumentType::Vector32:
+    case ArgumentType::Vector64: {
         std::vector<uint64_t> values;
         uint64_t min = chip::CanCastTo<uint64_t>(arg.min) ? static_cast<uint64_t>(arg.min) : 0;
         uint64_t max = arg.max;
@@ -297,6 +298,11 @@ bool Command::InitArgument(size_t argIndex, char * argValue)
             auto optionalArgument = static_cast<chip::Optional<std::vector<uint32_t>> *>(arg.value);
             optionalArgument->SetValue(vectorArgument);
         }
+        else if (arg.type == ArgumentType::Vector64)
+        {
+            auto vectorArgument = static_cast<std::vector<uint64_t> *>(arg.value);
+            vectorArgument->insert(vectorArgument->end(), values.begin(), values.end());
+        }
         else
         {
             return false;
@@ -662,6 +668,20 @@ size_t Command::AddArgument(const char * name, int64_t min, uint64_t max, std::v
     return AddArgumentToList(std::move(arg));
 }
 
+size_t Command::AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint64_t> * value, const char * desc)
+{
+    Argument arg;
+    arg.type  = ArgumentType::Vector64;
+    arg.name  = name;
+    arg.value = static_cast<void *>(value);
+    arg.min   = min;
+    arg.max   = max;
+    arg.flags = 0;
+    arg.desc  = desc;
+
+    return AddArgumentToList(std::move(arg));
+}
+
 size_t Command::AddArgument(const char * name, int64_t min, uint64_t max, chip::Optional<std::vector<uint32_t>> * value,
                             const char * desc)
 {
@@ -910,6 +930,11 @@ void Command::ResetArguments()
                 ResetOptionalArg<std::vector<uint32_t>>(arg);
                 break;
             }
+            case ArgumentType::Vector64: {
+                // No optional Vector64 arguments so far.
+                VerifyOrDie(false);
+                break;
+            }
             case ArgumentType::VectorCustom: {
                 // No optional VectorCustom arguments so far.
                 VerifyOrDie(false);
@@ -996,6 +1021,11 @@ void Command::ResetArguments()
                 auto vectorArgument = static_cast<std::vector<uint32_t> *>(arg.value);
                 vectorArgument->clear();
             }
+            else if (type == ArgumentType::Vector64)
+            {
+                auto vectorArgument = static_cast<std::vector<uint64_t> *>(arg.value);
+                vectorArgument->clear();
+            }
             else if (type == ArgumentType::VectorCustom)
             {
                 auto vectorArgument = static_cast<std::vector<CustomArgument *> *>(arg.value);
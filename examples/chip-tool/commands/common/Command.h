@@ -73,6 +73,7 @@ enum ArgumentType
     VectorBool,
     Vector16,
     Vector32,
+    Vector64,
     VectorCustom,
 };
 
@@ -181,6 +182,7 @@ public:
 
     size_t AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint16_t> * value, const char * desc = "");
     size_t AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint32_t> * value, const char * desc = "");
+    size_t AddArgument(const char * name, int64_t min, uint64_t max, std::vector<uint64_t> * value, const char * desc = "");
     size_t AddArgument(const char * name, std::vector<CustomArgument *> * value, const char * desc = "");
     size_t AddArgument(const char * name, int64_t min, uint64_t max, chip::Optional<std::vector<bool>> * value,
                        const char * desc = "");
@@ -248,6 +250,11 @@ public:
         return AddArgument(name, min, max, reinterpret_cast<double *>(value), desc, flags | Argument::kNullable);
     }
 
+    size_t AddArgument(const char * name, double min, double max, chip::Optional<double> * value, const char * desc = "")
+    {
+        return AddArgument(name, min, max, reinterpret_cast<double *>(value), desc, Argument::kOptional);
+    }
+
     void ResetArguments();
 
     virtual CHIP_ERROR Run() = 0;
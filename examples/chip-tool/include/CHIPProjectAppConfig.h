@@ -62,6 +62,9 @@
 
 #define CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY 1
 
+// Skip PBKDF2 when establishing PASE again with the same passcode, e.g. when retrying a pairing.
+#define CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE 4
+
 // Enable some test-only interaction model APIs.
 #define CONFIG_BUILD_FOR_HOST_UNIT_TEST 1
 
@@ -19,6 +19,7 @@
 #include "commands/common/Commands.h"
 #include "commands/example/ExampleCredentialIssuerCommands.h"
 
+#include "commands/bench/Commands.h"
 #include "commands/discover/Commands.h"
 #include "commands/group/Commands.h"
 #include "commands/interactive/Commands.h"
@@ -44,6 +45,7 @@ int main(int argc, char * argv[])
     registerCommandsGroup(commands, &credIssuerCommands);
     registerClusters(commands, &credIssuerCommands);
     registerCommandsStorage(commands);
+    registerCommandsBench(commands, &credIssuerCommands);
 
     return commands.Run(argc, argv);
 }
@@ -72,6 +72,7 @@
 #endif
 
 #include <signal.h>
+#include <string>
 
 #include "AppMain.h"
 #include "CommissionableInit.h"
@@ -291,6 +292,14 @@ void ChipLinuxAppMainLoop()
 
     initParams.interfaceId = LinuxDeviceOptions::GetInstance().interfaceId;
 
+    // Instances started with their own key-value store also keep their own events.
+    std::string eventLogStoragePath;
+    if (LinuxDeviceOptions::GetInstance().KVS != nullptr)
+    {
+        eventLogStoragePath            = std::string(LinuxDeviceOptions::GetInstance().KVS) + "-events";
+        initParams.eventLogStoragePath = eventLogStoragePath.c_str();
+    }
+
     if (LinuxDeviceOptions::GetInstance().mCSRResponseOptions.csrExistingKeyPair)
     {
         LinuxDeviceOptions::GetInstance().mCSRResponseOptions.badCsrOperationalKeyStoreForTest.Init(
@@ -131,10 +131,42 @@ public:
         AttributeValueEncoder & mAttributeValueEncoder;
     };
 
+    /**
+     * The encoder handed to the generator of EncodeListFrom.  Each list item is encoded along with its index in the list of the
+     * generator, which is where the next chunk resumes from if the item is the last one that fits.
+     */
+    class ListCursorEncodeHelper
+    {
+    public:
+        ListCursorEncodeHelper(AttributeValueEncoder & encoder) : mAttributeValueEncoder(encoder) {}
+
+        template <typename T, std::enable_if_t<DataModel::IsFabricScoped<T>::value, bool> = true>
+        CHIP_ERROR Encode(ListIndex aSourceIndex, T && aArg) const
+        {
+            VerifyOrReturnError(aArg.GetFabricIndex() != kUndefinedFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
+
+            // Items filtered out are not recorded as encoded; resuming from the last encoded item just skips them again.
+            VerifyOrReturnError(!mAttributeValueEncoder.mIsFabricFiltered ||
+                                    aArg.GetFabricIndex() == mAttributeValueEncoder.mAccessingFabricIndex,
+                                CHIP_NO_ERROR);
+            return mAttributeValueEncoder.EncodeListItemAt(aSourceIndex, mAttributeValueEncoder.mAccessingFabricIndex,
+                                                           std::forward<T>(aArg));
+        }
+
+        template <typename T, std::enable_if_t<!DataModel::IsFabricScoped<T>::value, bool> = true>
+        CHIP_ERROR Encode(ListIndex aSourceIndex, T && aArg) const
+        {
+            return mAttributeValueEncoder.EncodeListItemAt(aSourceIndex, std::forward<T>(aArg));
+        }
+
+    private:
+        AttributeValueEncoder & mAttributeValueEncoder;
+    };
+
     class AttributeEncodeState
     {
     public:
-        AttributeEncodeState() : mAllowPartialData(false), mCurrentEncodingListIndex(kInvalidListIndex) {}
+        AttributeEncodeState() : mAllowPartialData(false), mCurrentEncodingListIndex(kInvalidListIndex), mNextSourceIndex(0) {}
         bool AllowPartialData() const { return mAllowPartialData; }
 
     private:
@@ -160,6 +192,11 @@ public:
          * encoded (i.e. the count of items encoded so far).
          */
         ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
+        /**
+         * When encoding with EncodeListFrom, the index in the list of the generator of the first item that has not been
+         * encoded yet.
+         */
+        ListIndex mNextSourceIndex = 0;
     };
 
     AttributeValueEncoder(AttributeReportIBs::Builder & aAttributeReportIBsBuilder, FabricIndex aAccessingFabricIndex,
@@ -230,6 +267,30 @@ public:
         return CHIP_NO_ERROR;
     }
 
+    /**
+     * Like EncodeList, for generators able to start from any item of their list, so that encoding a list over K chunks does not
+     * go through the items of the previous chunks K times.
+     *
+     * aCallback is expected to take a ListIndex and a const auto & argument.  It must Encode(index, item) the items of its list
+     * one by one starting from the one at that index, passing the index of each item in its list, which must increase from one
+     * item to the next.  The indices are only meaningful to the generator: they can skip values, for instance for items it does
+     * not report.
+     *
+     * The rules of EncodeList about errors apply.
+     */
+    template <typename ListGenerator>
+    CHIP_ERROR EncodeListFrom(ListGenerator aCallback)
+    {
+        mTriedEncode = true;
+        ReturnErrorOnFailure(EnsureListStarted());
+        // The generator starts from the first item not encoded yet, so none of the items it encodes need to be skipped.
+        mCurrentEncodingListIndex = mEncodeState.mCurrentEncodingListIndex;
+        ReturnErrorOnFailure(aCallback(mEncodeState.mNextSourceIndex, ListCursorEncodeHelper(*this)));
+        // The Encode procedure finished without any error, clear the state.
+        mEncodeState = AttributeEncodeState();
+        return CHIP_NO_ERROR;
+    }
+
     bool TriedEncode() const { return mTriedEncode; }
 
     /**
@@ -245,6 +306,15 @@ public:
 private:
     // We made EncodeListItem() private, and ListEncoderHelper will expose it by Encode()
     friend class ListEncodeHelper;
+    friend class ListCursorEncodeHelper;
+
+    template <typename... Ts>
+    CHIP_ERROR EncodeListItemAt(ListIndex aSourceIndex, Ts &&... aArgs)
+    {
+        ReturnErrorOnFailure(EncodeListItem(std::forward<Ts>(aArgs)...));
+        mEncodeState.mNextSourceIndex = static_cast<ListIndex>(aSourceIndex + 1);
+        return CHIP_NO_ERROR;
+    }
 
     template <typename... Ts>
     CHIP_ERROR EncodeListItem(Ts &&... aArgs)
@@ -19,59 +19,138 @@
 #include "system/SystemPacketBuffer.h"
 #include <app/ClusterStateCache.h>
 #include <app/InteractionModelEngine.h>
+#include <string.h>
 #include <tuple>
 
 namespace chip {
 namespace app {
 
-CHIP_ERROR ClusterStateCache::GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize)
+namespace {
+
+// Bounds of the size of a new arena block.  Each new block is as large as all the previous ones together, so the
+// arena grows geometrically, up to blocks of the maximum size; larger values get a block of their own.
+constexpr uint32_t kMinArenaBlockSize = 1024;
+constexpr uint32_t kMaxArenaBlockSize = 64 * 1024;
+
+} // namespace
+
+CHIP_ERROR ClusterStateCache::AppendToArena(TLV::TLVReader & aReader, AttributeState & aState)
 {
-    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-    TLV::TLVReader reader;
-    reader.Init(*apData);
-    size_t totalBufSize = reader.GetTotalLength();
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
-    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    aSize = writer.GetLengthWritten();
-    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+    TLV::TLVWriter writer;
+
+    //
+    // The element is copied with an anonymous tag, so it takes at most the size of the buffer it is read from.
+    //
+    const uint32_t maxSize = aReader.GetTotalLength();
+
+    if (mArenaBlocks.empty() || mArenaBlocks[mCurrentArenaBlock].mCapacity - mArenaBlocks[mCurrentArenaBlock].mUsed < maxSize)
+    {
+        size_t arenaCapacity = 0;
+        size_t freeBlock     = mArenaBlocks.size();
+        for (size_t i = 0; i < mArenaBlocks.size(); i++)
+        {
+            arenaCapacity += mArenaBlocks[i].mCapacity;
+            if (mArenaBlocks[i].mCapacity == 0 && freeBlock == mArenaBlocks.size())
+            {
+                freeBlock = i;
+            }
+        }
+        VerifyOrReturnError(freeBlock <= UINT32_MAX, CHIP_ERROR_NO_MEMORY);
+
+        const size_t grownSize   = std::min<size_t>(std::max<size_t>(arenaCapacity, kMinArenaBlockSize), kMaxArenaBlockSize);
+        const uint32_t blockSize = std::max(maxSize, static_cast<uint32_t>(grownSize));
+        ArenaBlock block;
+        block.mData.Alloc(blockSize);
+        VerifyOrReturnError(block.mData.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+        block.mCapacity = blockSize;
+
+        if (freeBlock == mArenaBlocks.size())
+        {
+            mArenaBlocks.push_back(std::move(block));
+        }
+        else
+        {
+            mArenaBlocks[freeBlock] = std::move(block);
+        }
+
+        // The previous block keeps its values, and its unused tail is given up.  It is released right away if
+        // none of its values are current.
+        const uint32_t previousBlock = mCurrentArenaBlock;
+        mCurrentArenaBlock           = static_cast<uint32_t>(freeBlock);
+        if (previousBlock != mCurrentArenaBlock && previousBlock < mArenaBlocks.size())
+        {
+            ReleaseArenaBytes(previousBlock, 0);
+        }
+    }
+
+    ArenaBlock & block = mArenaBlocks[mCurrentArenaBlock];
+    writer.Init(block.mData.Get() + block.mUsed, maxSize);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aReader));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    aState.mDataBlock  = mCurrentArenaBlock;
+    aState.mDataOffset = block.mUsed;
+    aState.mDataLength = writer.GetLengthWritten();
+    block.mUsed += aState.mDataLength;
+    block.mLive += aState.mDataLength;
     return CHIP_NO_ERROR;
 }
 
+void ClusterStateCache::ReleaseArenaBytes(uint32_t aBlock, uint32_t aLength)
+{
+    ArenaBlock & block = mArenaBlocks[aBlock];
+    block.mLive -= aLength;
+    if (block.mLive != 0)
+    {
+        return;
+    }
+
+    // Nothing in the block is current: start it over if values are still being appended to it, free it otherwise.
+    block.mUsed = 0;
+    if (aBlock != mCurrentArenaBlock)
+    {
+        block.mData.Free();
+        block.mCapacity = 0;
+    }
+}
+
+ClusterStateCache::ClusterState & ClusterStateCache::GetOrAddClusterState(EndpointId endpointId, ClusterId clusterId)
+{
+    const ClusterKey key = MakeClusterKey(endpointId, clusterId);
+    auto clusterIter     = FindCluster(key);
+
+    if (clusterIter == mClusters.end() || clusterIter->mKey != key)
+    {
+        ClusterState clusterState;
+        clusterState.mKey = key;
+        clusterIter       = mClusters.insert(clusterIter, clusterState);
+    }
+
+    return mClusters[static_cast<size_t>(clusterIter - mClusters.cbegin())];
+}
+
 CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                                           const StatusIB & aStatus)
 {
     AttributeState state;
-    bool endpointIsNew = false;
 
-    if (mCache.find(aPath.mEndpointId) == mCache.end())
-    {
-        //
-        // Since we might potentially be creating a new entry at mCache[aPath.mEndpointId][aPath.mClusterId] that
-        // wasn't there before, we need to check if an entry didn't exist there previously and remember that so that
-        // we can appropriately notify our clients of the addition of a new endpoint.
-        //
-        endpointIsNew = true;
-    }
+    //
+    // Since we might potentially be creating a new cluster entry for an endpoint that had none before, we need to check
+    // if the endpoint didn't exist previously and remember that so that we can appropriately notify our clients of the
+    // addition of a new endpoint.
+    //
+    auto endpointIter  = FindCluster(MakeClusterKey(aPath.mEndpointId, 0));
+    bool endpointIsNew = (endpointIter == mClusters.end() || GetEndpointId(endpointIter->mKey) != aPath.mEndpointId);
+
+    state.mClusterKey  = MakeClusterKey(aPath.mEndpointId, aPath.mClusterId);
+    state.mAttributeId = aPath.mAttributeId;
+    state.mDataBlock   = 0;
+    state.mDataOffset  = 0;
+    state.mDataLength  = 0;
 
     if (apData)
     {
-        size_t elementSize = 0;
-        ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
-        Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-        backingBuffer.Calloc(elementSize);
-        VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-        TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-        ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-        state.Set<Platform::ScopedMemoryBufferWithSize<uint8_t>>(std::move(backingBuffer));
-        //
-        // Clear out the committed data version and only set it again once we have received all data for this cluster.
-        // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
-        //
-        mCache[aPath.mEndpointId][aPath.mClusterId].mCommittedDataVersion.ClearValue();
+        ReturnErrorOnFailure(AppendToArena(*apData, state));
 
         // This commits a pending data version if the last report path is valid and it is different from the current path.
         if (mLastReportDataPath.IsValidConcreteClusterPath() && mLastReportDataPath != aPath)
@@ -79,6 +158,13 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
             CommitPendingDataVersion();
         }
 
+        //
+        // Clear out the committed data version and only set it again once we have received all data for this cluster.
+        // Otherwise, we may have incomplete data that looks like it's complete since it has a valid data version.
+        //
+        ClusterState & clusterState = GetOrAddClusterState(aPath.mEndpointId, aPath.mClusterId);
+        clusterState.mCommittedDataVersion.ClearValue();
+
         bool foundEncompassingWildcardPath = false;
         for (const auto & path : mRequestPathSet)
         {
@@ -92,14 +178,15 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         // if this data item is encompassed by a wildcard path, let's go ahead and update its pending data version.
         if (foundEncompassingWildcardPath)
         {
-            mCache[aPath.mEndpointId][aPath.mClusterId].mPendingDataVersion = aPath.mDataVersion;
+            clusterState.mPendingDataVersion = aPath.mDataVersion;
         }
 
         mLastReportDataPath = aPath;
     }
     else
     {
-        state.Set<StatusIB>(aStatus);
+        GetOrAddClusterState(aPath.mEndpointId, aPath.mClusterId);
+        state.mStatus = aStatus;
     }
 
     //
@@ -111,7 +198,36 @@ CHIP_ERROR ClusterStateCache::UpdateCache(const ConcreteDataAttributePath & aPat
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    auto attributeIter = FindAttribute(state.mClusterKey, state.mAttributeId);
+    if (attributeIter == mAttributes.end() || attributeIter->mClusterKey != state.mClusterKey ||
+        attributeIter->mAttributeId != state.mAttributeId)
+    {
+        mAttributes.insert(attributeIter, state);
+    }
+    else
+    {
+        AttributeState & previousState = mAttributes[static_cast<size_t>(attributeIter - mAttributes.cbegin())];
+
+        if (!previousState.IsStatus() && !state.IsStatus() && state.mDataLength <= previousState.mDataLength)
+        {
+            // The new value fits where the previous one was: move it there rather than leaving a hole in the arena.
+            ArenaBlock & block = mArenaBlocks[state.mDataBlock];
+            memmove(mArenaBlocks[previousState.mDataBlock].mData.Get() + previousState.mDataOffset,
+                    block.mData.Get() + state.mDataOffset, state.mDataLength);
+            block.mUsed -= state.mDataLength;
+            block.mLive -= state.mDataLength;
+            ReleaseArenaBytes(previousState.mDataBlock, previousState.mDataLength - state.mDataLength);
+            state.mDataBlock  = previousState.mDataBlock;
+            state.mDataOffset = previousState.mDataOffset;
+        }
+        else if (!previousState.IsStatus())
+        {
+            ReleaseArenaBytes(previousState.mDataBlock, previousState.mDataLength);
+        }
+
+        previousState = state;
+    }
+
     mChangedAttributeSet.insert(aPath);
     return CHIP_NO_ERROR;
 }
@@ -173,7 +289,7 @@ void ClusterStateCache::CommitPendingDataVersion()
         return;
     }
 
-    auto & lastClusterInfo = mCache[mLastReportDataPath.mEndpointId][mLastReportDataPath.mClusterId];
+    auto & lastClusterInfo = GetOrAddClusterState(mLastReportDataPath.mEndpointId, mLastReportDataPath.mClusterId);
     if (lastClusterInfo.mPendingDataVersion.HasValue())
     {
         lastClusterInfo.mCommittedDataVersion = lastClusterInfo.mPendingDataVersion;
@@ -215,13 +331,12 @@ CHIP_ERROR ClusterStateCache::Get(const ConcreteAttributePath & path, TLV::TLVRe
     CHIP_ERROR err;
     auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
-    if (attributeState->Is<StatusIB>())
+    if (attributeState->IsStatus())
     {
         return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
     }
 
-    reader.Init(attributeState->Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().Get(),
-                attributeState->Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().AllocatedSize());
+    reader.Init(mArenaBlocks[attributeState->mDataBlock].mData.Get() + attributeState->mDataOffset, attributeState->mDataLength);
     return reader.Next();
 }
 
@@ -241,57 +356,34 @@ CHIP_ERROR ClusterStateCache::Get(EventNumber eventNumber, TLV::TLVReader & read
     return CHIP_NO_ERROR;
 }
 
-const ClusterStateCache::EndpointState * ClusterStateCache::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
-{
-    auto endpointIter = mCache.find(endpointId);
-    if (endpointIter == mCache.end())
-    {
-        err = CHIP_ERROR_KEY_NOT_FOUND;
-        return nullptr;
-    }
-
-    err = CHIP_NO_ERROR;
-    return &endpointIter->second;
-}
-
 const ClusterStateCache::ClusterState * ClusterStateCache::GetClusterState(EndpointId endpointId, ClusterId clusterId,
                                                                            CHIP_ERROR & err) const
 {
-    auto endpointState = GetEndpointState(endpointId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto clusterState = endpointState->find(clusterId);
-    if (clusterState == endpointState->end())
+    const ClusterKey key = MakeClusterKey(endpointId, clusterId);
+    auto clusterState    = FindCluster(key);
+    if (clusterState == mClusters.end() || clusterState->mKey != key)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &clusterState->second;
+    return &(*clusterState);
 }
 
 const ClusterStateCache::AttributeState * ClusterStateCache::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
                                                                                AttributeId attributeId, CHIP_ERROR & err) const
 {
-    auto clusterState = GetClusterState(endpointId, clusterId, err);
-    if (err != CHIP_NO_ERROR)
-    {
-        return nullptr;
-    }
-
-    auto attributeState = clusterState->mAttributes.find(attributeId);
-    if (attributeState == clusterState->mAttributes.end())
+    const ClusterKey key = MakeClusterKey(endpointId, clusterId);
+    auto attributeState  = FindAttribute(key, attributeId);
+    if (attributeState == mAttributes.end() || attributeState->mClusterKey != key || attributeState->mAttributeId != attributeId)
     {
         err = CHIP_ERROR_KEY_NOT_FOUND;
         return nullptr;
     }
 
     err = CHIP_NO_ERROR;
-    return &attributeState->second;
+    return &(*attributeState);
 }
 
 const ClusterStateCache::EventData * ClusterStateCache::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
@@ -371,12 +463,12 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteAttributePath & path, Stat
     auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
     ReturnErrorOnFailure(err);
 
-    if (!attributeState->Is<StatusIB>())
+    if (!attributeState->IsStatus())
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    status = attributeState->Get<StatusIB>();
+    status = attributeState->mStatus;
     return CHIP_NO_ERROR;
 }
 
@@ -394,54 +486,42 @@ CHIP_ERROR ClusterStateCache::GetStatus(const ConcreteEventPath & path, StatusIB
 
 void ClusterStateCache::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
-    for (auto const & endpointIter : mCache)
+    for (auto const & clusterState : mClusters)
     {
-        EndpointId endpointId = endpointIter.first;
-        for (auto const & clusterIter : endpointIter.second)
+        if (!clusterState.mCommittedDataVersion.HasValue())
         {
-            if (!clusterIter.second.mCommittedDataVersion.HasValue())
-            {
-                continue;
-            }
-            DataVersion dataVersion = clusterIter.second.mCommittedDataVersion.Value();
-            uint32_t clusterSize    = 0;
-            ClusterId clusterId     = clusterIter.first;
+            continue;
+        }
+        DataVersion dataVersion = clusterState.mCommittedDataVersion.Value();
+        uint32_t clusterSize    = 0;
 
-            for (auto const & attributeIter : clusterIter.second.mAttributes)
+        for (auto attributeIter = FindAttribute(clusterState.mKey);
+             attributeIter != mAttributes.end() && attributeIter->mClusterKey == clusterState.mKey; ++attributeIter)
+        {
+            if (attributeIter->IsStatus())
             {
-                if (attributeIter.second.Is<StatusIB>())
+                clusterSize += 5; // 1 byte: anonymous tag control byte for struct. 1 byte: control byte for uint8 value. 1 byte:
+                                  // context-specific tag for uint8 value.1 byte: the uint8 value. 1 byte: end of container.
+                if (attributeIter->mStatus.mClusterStatus.HasValue())
                 {
-                    clusterSize +=
-                        5; // 1 byte: anonymous tag control byte for struct. 1 byte: control byte for uint8 value. 1 byte:
-                           // context-specific tag for uint8 value.1 byte: the uint8 value. 1 byte: end of container.
-                    if (attributeIter.second.Get<StatusIB>().mClusterStatus.HasValue())
-                    {
-                        clusterSize += 3; // 1 byte: control byte for uint8 value. 1 byte: context-specific tag for uint8 value. 1
-                                          // byte: the uint8 value.
-                    }
-                }
-                else
-                {
-                    TLV::TLVReader bufReader;
-                    bufReader.Init(attributeIter.second.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().Get(),
-                                   attributeIter.second.Get<Platform::ScopedMemoryBufferWithSize<uint8_t>>().AllocatedSize());
-                    ReturnOnFailure(bufReader.Next());
-                    // Skip to the end of the element.
-                    ReturnOnFailure(bufReader.Skip());
-
-                    // Compute the amount of value data
-                    clusterSize += bufReader.GetLengthRead();
+                    clusterSize += 3; // 1 byte: control byte for uint8 value. 1 byte: context-specific tag for uint8 value. 1
+                                      // byte: the uint8 value.
                 }
             }
-            if (clusterSize == 0)
+            else
             {
-                continue;
+                // The cached element is exactly the value data.
+                clusterSize += attributeIter->mDataLength;
             }
+        }
+        if (clusterSize == 0)
+        {
+            continue;
+        }
 
-            DataVersionFilter filter(endpointId, clusterId, dataVersion);
+        DataVersionFilter filter(GetEndpointId(clusterState.mKey), GetClusterId(clusterState.mKey), dataVersion);
 
-            aVector.push_back(std::make_pair(filter, clusterSize));
-        }
+        aVector.push_back(std::make_pair(filter, clusterSize));
     }
     std::sort(aVector.begin(), aVector.end(),
               [](const std::pair<DataVersionFilter, size_t> & x, const std::pair<DataVersionFilter, size_t> & y) {
@@ -532,5 +612,21 @@ exit:
     return err;
 }
 
+ClusterStateCache::MemoryUsage ClusterStateCache::GetMemoryUsage() const
+{
+    MemoryUsage usage;
+
+    usage.mClusterCount   = mClusters.size();
+    usage.mAttributeCount = mAttributes.size();
+    usage.mIndexBytes     = mClusters.capacity() * sizeof(ClusterState) + mAttributes.capacity() * sizeof(AttributeState);
+    for (const auto & block : mArenaBlocks)
+    {
+        usage.mDataBytes += block.mLive;
+        usage.mStaleBytes += block.mUsed - block.mLive;
+        usage.mArenaBytes += block.mCapacity;
+    }
+    return usage;
+}
+
 } // namespace app
 } // namespace chip
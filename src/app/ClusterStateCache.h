@@ -26,7 +26,8 @@
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
-#include <lib/support/Variant.h>
+#include <lib/support/ScopedBuffer.h>
+#include <algorithm>
 #include <list>
 #include <map>
 #include <queue>
@@ -55,6 +56,11 @@ namespace app {
  * The data is stored internally in the cache as TLV. This permits re-use of the existing cluster objects
  * to de-serialize the state on-demand.
  *
+ * To scale to controllers caching the state of many nodes, attributes are kept in flat arrays sorted by path, and
+ * their TLV is stored back to back in a single arena owned by the cache, each value taking exactly its encoded size.
+ * Values made stale by updates are reclaimed by compacting the arena once they take up a significant part of it.
+ * GetMemoryUsage() reports the memory the cache holds.
+ *
  * The cache serves as a callback adapter as well in that it 'forwards' the ReadClient::Callback calls transparently
  * through to a registered callback. In addition, it provides its own enhancements to the base ReadClient::Callback
  * to make it easier to know what has changed in the cache.
@@ -332,12 +338,14 @@ public:
     {
         CHIP_ERROR err;
 
-        auto clusterState = GetClusterState(endpointId, clusterId, err);
+        GetClusterState(endpointId, clusterId, err);
         ReturnErrorOnFailure(err);
 
-        for (auto & attributeIter : clusterState->mAttributes)
+        const ClusterKey key = MakeClusterKey(endpointId, clusterId);
+        for (auto attributeIter = FindAttribute(key); attributeIter != mAttributes.end() && attributeIter->mClusterKey == key;
+             ++attributeIter)
         {
-            const ConcreteAttributePath path(endpointId, clusterId, attributeIter.first);
+            const ConcreteAttributePath path(endpointId, clusterId, attributeIter->mAttributeId);
             ReturnErrorOnFailure(func(path));
         }
 
@@ -360,18 +368,12 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachAttribute(ClusterId clusterId, IteratorFunc func) const
     {
-        for (auto & endpointIter : mCache)
+        for (auto & attributeIter : mAttributes)
         {
-            for (auto & clusterIter : endpointIter.second)
+            if (GetClusterId(attributeIter.mClusterKey) == clusterId)
             {
-                if (clusterIter.first == clusterId)
-                {
-                    for (auto & attributeIter : clusterIter.second.mAttributes)
-                    {
-                        const ConcreteAttributePath path(endpointIter.first, clusterId, attributeIter.first);
-                        ReturnErrorOnFailure(func(path));
-                    }
-                }
+                const ConcreteAttributePath path(GetEndpointId(attributeIter.mClusterKey), clusterId, attributeIter.mAttributeId);
+                ReturnErrorOnFailure(func(path));
             }
         }
         return CHIP_NO_ERROR;
@@ -393,13 +395,10 @@ public:
     template <typename IteratorFunc>
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
-        auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        for (auto clusterIter = FindCluster(MakeClusterKey(endpointId, 0));
+             clusterIter != mClusters.end() && GetEndpointId(clusterIter->mKey) == endpointId; ++clusterIter)
         {
-            for (auto & clusterIter : endpointIter->second)
-            {
-                ReturnErrorOnFailure(func(clusterIter.first));
-            }
+            ReturnErrorOnFailure(func(GetClusterId(clusterIter->mKey)));
         }
         return CHIP_NO_ERROR;
     }
@@ -483,8 +482,36 @@ public:
         mEventStatusCache.clear();
     }
 
+    /*
+     * Breakdown of the memory held by the attribute cache.
+     */
+    struct MemoryUsage
+    {
+        size_t mClusterCount   = 0;
+        size_t mAttributeCount = 0;
+        // Bytes allocated for the sorted arrays of clusters and attributes.
+        size_t mIndexBytes = 0;
+        // Bytes of the arena holding the TLV of the current attribute values.
+        size_t mDataBytes = 0;
+        // Bytes of the arena holding values that have since been updated, until their block is released.
+        size_t mStaleBytes = 0;
+        // Bytes allocated for the arena, including the capacity not used yet.
+        size_t mArenaBytes = 0;
+    };
+
+    MemoryUsage GetMemoryUsage() const;
+
 private:
-    using AttributeState = Variant<Platform::ScopedMemoryBufferWithSize<uint8_t>, StatusIB>;
+    // Packed (endpoint, cluster) pair, which sorts by endpoint first and then by cluster.
+    using ClusterKey = uint64_t;
+
+    static ClusterKey MakeClusterKey(EndpointId endpointId, ClusterId clusterId)
+    {
+        return (static_cast<ClusterKey>(endpointId) << 32) | clusterId;
+    }
+    static EndpointId GetEndpointId(ClusterKey key) { return static_cast<EndpointId>(key >> 32); }
+    static ClusterId GetClusterId(ClusterKey key) { return static_cast<ClusterId>(key); }
+
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
@@ -492,12 +519,36 @@ private:
     // and we must not be in the middle of receiving reports for that cluster.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        ClusterKey mKey;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+
+    // Either the TLV of the value of an attribute, at mDataOffset in mArenaBlocks[mDataBlock], or the status received
+    // instead of data when mDataLength is 0, as an encoded TLV element is never empty.
+    struct AttributeState
+    {
+        ClusterKey mClusterKey;
+        AttributeId mAttributeId;
+        uint32_t mDataBlock;
+        uint32_t mDataOffset;
+        uint32_t mDataLength;
+        StatusIB mStatus;
+
+        bool IsStatus() const { return mDataLength == 0; }
+    };
+
+    // A block of the arena.  Values are appended to the current block and never move afterwards, so that readers
+    // of a value stay valid until that attribute is updated.  A block is released once none of its values are
+    // current any more.
+    struct ArenaBlock
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> mData;
+        uint32_t mCapacity = 0;
+        // Bytes handed out from the start of the block, and how many of them hold current values.
+        uint32_t mUsed = 0;
+        uint32_t mLive = 0;
+    };
 
     struct Comparator
     {
@@ -533,13 +584,48 @@ private:
      *        CHIP_ERROR_KEY_NOT_FOUND shall be returned.
      *
      */
-    const EndpointState * GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const;
     const ClusterState * GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const;
     const AttributeState * GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
                                              CHIP_ERROR & err) const;
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
+    /*
+     * Return the first cluster with a key not less than 'key', and the first attribute with a path not less than
+     * ('key', 'attributeId'), respectively.
+     */
+    std::vector<ClusterState>::const_iterator FindCluster(ClusterKey key) const
+    {
+        return std::lower_bound(mClusters.begin(), mClusters.end(), key,
+                                [](const ClusterState & cluster, ClusterKey aKey) { return cluster.mKey < aKey; });
+    }
+    std::vector<AttributeState>::const_iterator FindAttribute(ClusterKey key, AttributeId attributeId = 0) const
+    {
+        return std::lower_bound(mAttributes.begin(), mAttributes.end(), std::make_pair(key, attributeId),
+                                [](const AttributeState & attribute, const std::pair<ClusterKey, AttributeId> & path) {
+                                    return attribute.mClusterKey < path.first ||
+                                        (attribute.mClusterKey == path.first && attribute.mAttributeId < path.second);
+                                });
+    }
+
+    /*
+     * Return the state of a cluster, adding it if it is not in the cache yet.  The reference is only valid until
+     * the next cluster is added.
+     */
+    ClusterState & GetOrAddClusterState(EndpointId endpointId, ClusterId clusterId);
+
+    /*
+     * Copy the element of a reader to the end of the current arena block, starting a new block if it does not fit,
+     * and record where it went in the attribute state.
+     */
+    CHIP_ERROR AppendToArena(TLV::TLVReader & aReader, AttributeState & aState);
+
+    /*
+     * Account for 'aLength' bytes of a block no longer holding a current value, releasing the block once it has
+     * none left.
+     */
+    void ReleaseArenaBytes(uint32_t aBlock, uint32_t aLength);
+
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
      * with the provided status.
@@ -598,10 +684,12 @@ private:
     // on the wire if not all filters can be applied.
     void GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const;
 
-    CHIP_ERROR GetElementTLVSize(TLV::TLVReader * apData, size_t & aSize);
-
     Callback & mCallback;
-    NodeState mCache;
+    // Sorted by key, and by attribute ID within a cluster.
+    std::vector<ClusterState> mClusters;
+    std::vector<AttributeState> mAttributes;
+    std::vector<ArenaBlock> mArenaBlocks;
+    uint32_t mCurrentArenaBlock = 0;
     std::set<ConcreteAttributePath> mChangedAttributeSet;
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
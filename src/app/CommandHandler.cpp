@@ -53,7 +53,16 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
         System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
         VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
 
+        // Always limit the size of the response to fit within kMaxSecureSduLengthBytes regardless of the available buffer
+        // capacity, and keep room for the MIC and for closing the message.
+        uint32_t reservedSize = Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES + kReservedSizeForTLVEncodingOverhead;
+        if (commandPacket->AvailableDataLength() > kMaxSecureSduLengthBytes)
+        {
+            reservedSize += static_cast<uint32_t>(commandPacket->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        }
+
         mCommandMessageWriter.Init(std::move(commandPacket));
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(reservedSize));
         ReturnErrorOnFailure(mInvokeResponseBuilder.Init(&mCommandMessageWriter));
 
         mInvokeResponseBuilder.SuppressResponse(mSuppressResponse);
@@ -115,11 +124,15 @@ Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payloa
     invokeRequests.GetReader(&invokeRequestsReader);
 
     {
-        // We don't support handling multiple commands but the protocol is ready to support it in the future, reject all of them and
-        // IM Engine will send a status response.
+        // Reject requests with more commands than we can route the responses of, and IM Engine will send a status response.
         size_t commandCount = 0;
         TLV::Utilities::Count(invokeRequestsReader, commandCount, false /* recurse */);
-        VerifyOrReturnError(commandCount == 1, Status::InvalidAction);
+        VerifyOrReturnError(commandCount > 0 && commandCount <= CHIP_IM_MAX_COMMANDS_PER_INVOKE, Status::InvalidAction);
+    }
+
+    {
+        Status status = ProcessCommandRefs(invokeRequestMessage, invokeRequestsReader);
+        VerifyOrReturnError(status == Status::Success, status);
     }
 
     while (CHIP_NO_ERROR == (err = invokeRequestsReader.Next()))
@@ -152,12 +165,122 @@ Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payloa
     return Status::Success;
 }
 
+Status CommandHandler::ProcessCommandRefs(const InvokeRequestMessage::Parser & aInvokeRequestMessage,
+                                          TLV::TLVReader aInvokeRequestsReader)
+{
+    CHIP_ERROR err      = CHIP_NO_ERROR;
+    size_t commandCount = 0;
+    bool isGroupRequest = mExchangeCtx->IsGroupExchangeContext();
+
+    mCommandRefCount = 0;
+    while (CHIP_NO_ERROR == (err = aInvokeRequestsReader.Next()))
+    {
+        CommandDataIB::Parser commandData;
+        CommandPathIB::Parser commandPath;
+        CommandRef commandRef;
+        uint16_t ref;
+
+        VerifyOrReturnError(commandCount++ < CHIP_IM_MAX_COMMANDS_PER_INVOKE, Status::InvalidAction);
+        VerifyOrReturnError(TLV::AnonymousTag() == aInvokeRequestsReader.GetTag(), Status::InvalidAction);
+        VerifyOrReturnError(commandData.Init(aInvokeRequestsReader) == CHIP_NO_ERROR, Status::InvalidAction);
+        VerifyOrReturnError(commandData.GetPath(&commandPath) == CHIP_NO_ERROR, Status::InvalidAction);
+        VerifyOrReturnError(commandPath.GetClusterId(&commandRef.mRequestPath.mClusterId) == CHIP_NO_ERROR, Status::InvalidAction);
+        VerifyOrReturnError(commandPath.GetCommandId(&commandRef.mRequestPath.mCommandId) == CHIP_NO_ERROR, Status::InvalidAction);
+        if (isGroupRequest)
+        {
+            // Group commands have no endpoint in their path, and get no response.
+            continue;
+        }
+        VerifyOrReturnError(commandPath.GetEndpointId(&commandRef.mRequestPath.mEndpointId) == CHIP_NO_ERROR,
+                            Status::InvalidAction);
+
+        err = commandData.GetRef(&ref);
+        if (err == CHIP_NO_ERROR)
+        {
+            commandRef.mRef.SetValue(ref);
+        }
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, Status::InvalidAction);
+
+        // The responses are matched with their commands by path, or by reference: neither can appear twice in a request.
+        for (size_t i = 0; i < mCommandRefCount; i++)
+        {
+            VerifyOrReturnError(!(mCommandRefs[i].mRequestPath == commandRef.mRequestPath), Status::InvalidAction);
+            VerifyOrReturnError(!(commandRef.mRef.HasValue() && mCommandRefs[i].mRef == commandRef.mRef), Status::InvalidAction);
+        }
+        mCommandRefs[mCommandRefCount++] = commandRef;
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, Status::InvalidAction);
+
+    // The message must be complete too: a truncated request is rejected before any of its commands is dispatched.
+    InvokeRequestMessage::Parser invokeRequestMessage = aInvokeRequestMessage;
+    VerifyOrReturnError(invokeRequestMessage.ExitContainer() == CHIP_NO_ERROR, Status::InvalidAction);
+    return Status::Success;
+}
+
+CHIP_ERROR CommandHandler::GetCommandRef(const ConcreteCommandPath & aRequestCommandPath, Optional<uint16_t> & aCommandRef) const
+{
+    aCommandRef.ClearValue();
+    // Without a unicast request, there is no command to echo the reference of.
+    VerifyOrReturnError(mCommandRefCount > 0, CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < mCommandRefCount; i++)
+    {
+        if (mCommandRefs[i].mRequestPath == aRequestCommandPath)
+        {
+            aCommandRef = mCommandRefs[i].mRef;
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_INVALID_ARGUMENT;
+}
+
 CHIP_ERROR CommandHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                              System::PacketBufferHandle && aPayload)
 {
-    ChipLogDetail(DataManagement, "CommandHandler: Unexpected message type %d", aPayloadHeader.GetMessageType());
-    StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
-    return CHIP_ERROR_INVALID_MESSAGE_TYPE;
+    CHIP_ERROR err         = CHIP_NO_ERROR;
+    CHIP_ERROR statusError = CHIP_NO_ERROR;
+
+    if (mState != State::CommandSent || mChunks.IsNull())
+    {
+        ChipLogDetail(DataManagement, "CommandHandler: Unexpected message type %d", aPayloadHeader.GetMessageType());
+        StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
+        return CHIP_ERROR_INVALID_MESSAGE_TYPE;
+    }
+
+    // The client got an InvokeResponse that did not hold all the responses: send the next one.
+    VerifyOrExit(aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse),
+                 err = CHIP_ERROR_INVALID_MESSAGE_TYPE);
+    SuccessOrExit(err = StatusResponse::ProcessStatusResponse(std::move(aPayload), statusError));
+    SuccessOrExit(err = statusError);
+    SuccessOrExit(err = SendNextResponseMessage());
+
+    if (!mChunks.IsNull())
+    {
+        return CHIP_NO_ERROR;
+    }
+
+exit:
+    if (err == CHIP_ERROR_INVALID_MESSAGE_TYPE)
+    {
+        StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to send the next invoke response: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    Close();
+    return err;
+}
+
+void CommandHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    //
+    // We only expect responses on this EC between the InvokeResponse messages of responses sent in several of them.
+    //
+    ChipLogProgress(DataManagement, "Time out! Failed to receive status response from Exchange: " ChipLogFormatExchange,
+                    ChipLogValueExchange(apExchangeContext));
+    Close();
 }
 
 void CommandHandler::Close()
@@ -205,6 +328,11 @@ void CommandHandler::DecrementHoldOff()
             {
                 ChipLogError(DataManagement, "Failed to send command response: %" CHIP_ERROR_FORMAT, err.Format());
             }
+            else if (!mChunks.IsNull())
+            {
+                // The rest of the responses are sent once the client acknowledges the first message.
+                return;
+            }
         }
     }
 
@@ -213,17 +341,26 @@ void CommandHandler::DecrementHoldOff()
 
 CHIP_ERROR CommandHandler::SendCommandResponse()
 {
-    System::PacketBufferHandle commandPacket;
-
     VerifyOrReturnError(mPendingWork == 0, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::AddedCommand || (mState == State::Idle && !mChunks.IsNull()), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mExchangeCtx, CHIP_ERROR_INCORRECT_STATE);
 
-    ReturnErrorOnFailure(Finalize(commandPacket));
-    ReturnErrorOnFailure(
-        mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse, std::move(commandPacket)));
-    // The ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily dangling, but in
-    // all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
+    ReturnErrorOnFailure(FinalizeInvokeResponseMessage(/* aHasMoreChunks = */ false));
+    return SendNextResponseMessage();
+}
+
+CHIP_ERROR CommandHandler::SendNextResponseMessage()
+{
+    using namespace Messaging;
+
+    System::PacketBufferHandle commandPacket = mChunks.PopHead();
+    bool hasMoreChunks                       = !mChunks.IsNull();
+
+    ReturnErrorOnFailure(mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse,
+                                                   std::move(commandPacket),
+                                                   hasMoreChunks ? SendMessageFlags::kExpectResponse : SendMessageFlags::kNone));
+    // When this is the last message, the ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily
+    // dangling, but in all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
 
     MoveToState(State::CommandSent);
 
@@ -453,6 +590,27 @@ Status CommandHandler::ProcessGroupCommandDataIB(CommandDataIB::Parser & aComman
 }
 
 CHIP_ERROR CommandHandler::AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
+{
+    CHIP_ERROR err = TryAddStatusInternal(aCommandPath, aStatus);
+    if (err != CHIP_NO_ERROR)
+    {
+        RollbackResponse();
+
+        // The status may not fit next to the responses to the other commands of the request: try again in a message of its
+        // own.
+        if (StartNewResponseMessage(err))
+        {
+            err = TryAddStatusInternal(aCommandPath, aStatus);
+            if (err != CHIP_NO_ERROR)
+            {
+                RollbackResponse();
+            }
+        }
+    }
+    return err;
+}
+
+CHIP_ERROR CommandHandler::TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
 {
     ReturnErrorOnFailure(PrepareStatus(aCommandPath));
     CommandStatusIB::Builder & commandStatus = mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus();
@@ -480,13 +638,31 @@ CHIP_ERROR CommandHandler::AddClusterSpecificFailure(const ConcreteCommandPath &
 
 CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPath, bool aStartDataStruct)
 {
+    // Without the path of the command it answers, a response can only be matched with the single command of a request.
+    VerifyOrReturnError(mCommandRefCount <= 1, CHIP_ERROR_INCORRECT_STATE);
+    return PrepareInvokeResponseCommand(mCommandRefCount == 1 ? mCommandRefs[0].mRequestPath : aCommandPath, aCommandPath,
+                                        aStartDataStruct);
+}
+
+CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aRequestCommandPath,
+                                          const ConcreteCommandPath & aResponseCommandPath, bool aStartDataStruct)
+{
+    return PrepareInvokeResponseCommand(aRequestCommandPath, aResponseCommandPath, aStartDataStruct);
+}
+
+CHIP_ERROR CommandHandler::PrepareInvokeResponseCommand(const ConcreteCommandPath & aRequestCommandPath,
+                                                        const ConcreteCommandPath & aResponseCommandPath, bool aStartDataStruct)
+{
+    Optional<uint16_t> commandRef;
+    ReturnErrorOnFailure(GetCommandRef(aRequestCommandPath, commandRef));
     ReturnErrorOnFailure(AllocateBuffer());
 
-    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
+    mBackupState = mState;
     MoveToState(State::Preparing);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
@@ -496,7 +672,8 @@ CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPa
     ReturnErrorOnFailure(commandData.GetError());
     CommandPathIB::Builder & path = commandData.CreatePath();
     ReturnErrorOnFailure(commandData.GetError());
-    ReturnErrorOnFailure(path.Encode(aCommandPath));
+    ReturnErrorOnFailure(path.Encode(aResponseCommandPath));
+    mPreparedCommandRef = commandRef;
     if (aStartDataStruct)
     {
         ReturnErrorOnFailure(commandData.GetWriter()->StartContainer(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kFields)),
@@ -514,21 +691,28 @@ CHIP_ERROR CommandHandler::FinishCommand(bool aStartDataStruct)
     {
         ReturnErrorOnFailure(commandData.GetWriter()->EndContainer(mDataElementContainerType));
     }
+    // The reference follows the fields, as the elements of the CommandDataIB are in tag order.
+    if (mPreparedCommandRef.HasValue())
+    {
+        ReturnErrorOnFailure(commandData.Ref(mPreparedCommandRef.Value()).GetError());
+    }
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPath)
 {
+    Optional<uint16_t> commandRef;
+    ReturnErrorOnFailure(GetCommandRef(aCommandPath, commandRef));
     ReturnErrorOnFailure(AllocateBuffer());
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
+    mBackupState = mState;
     MoveToState(State::Preparing);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
@@ -538,6 +722,7 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
     CommandPathIB::Builder & path = commandStatus.CreatePath();
     ReturnErrorOnFailure(commandStatus.GetError());
     ReturnErrorOnFailure(path.Encode(aCommandPath));
+    mPreparedCommandRef = commandRef;
     MoveToState(State::AddingCommand);
     return CHIP_NO_ERROR;
 }
@@ -545,11 +730,13 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
 CHIP_ERROR CommandHandler::FinishStatus()
 {
     VerifyOrReturnError(mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
-    ReturnErrorOnFailure(
-        mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB().GetError());
+    CommandStatusIB::Builder & commandStatus = mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus();
+    if (mPreparedCommandRef.HasValue())
+    {
+        ReturnErrorOnFailure(commandStatus.Ref(mPreparedCommandRef.Value()).GetError());
+    }
+    ReturnErrorOnFailure(commandStatus.EndOfCommandStatusIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -559,9 +746,46 @@ CHIP_ERROR CommandHandler::RollbackResponse()
     VerifyOrReturnError(mState == State::Preparing || mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
     mInvokeResponseBuilder.Rollback(mBackupWriter);
     mInvokeResponseBuilder.ResetError();
-    // Note: We only support one command per request, so we reset the state to Idle here, need to review the states when adding
-    // supports of having multiple requests in the same transaction.
+    mInvokeResponseBuilder.GetInvokeResponses().ResetError();
+    // Back to Idle or AddedCommand, depending on whether the message holds responses to other commands.
+    MoveToState(mBackupState);
+    return CHIP_NO_ERROR;
+}
+
+bool CommandHandler::StartNewResponseMessage(CHIP_ERROR aError)
+{
+    // Responses that do not fit in an empty message cannot be sent at all.
+    VerifyOrReturnValue(aError == CHIP_ERROR_NO_MEMORY || aError == CHIP_ERROR_BUFFER_TOO_SMALL, false);
+    VerifyOrReturnValue(mState == State::AddedCommand, false);
+
+    CHIP_ERROR err = FinalizeInvokeResponseMessage(/* aHasMoreChunks = */ true);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to finalize invoke response: %" CHIP_ERROR_FORMAT, err.Format());
+        return false;
+    }
+
     MoveToState(State::Idle);
+    return true;
+}
+
+CHIP_ERROR CommandHandler::FinalizeInvokeResponseMessage(bool aHasMoreChunks)
+{
+    System::PacketBufferHandle commandPacket;
+
+    // The last message may have no response in it, when the last response did not fit in a message of its own.
+    ReturnErrorOnFailure(AllocateBuffer());
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
+    if (aHasMoreChunks)
+    {
+        ReturnErrorOnFailure(mInvokeResponseBuilder.MoreChunkedMessages(true).GetError());
+    }
+    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
+    ReturnErrorOnFailure(mCommandMessageWriter.Finalize(&commandPacket));
+
+    mChunks.AddToEnd(std::move(commandPacket));
+    mBufferAllocated = false;
     return CHIP_NO_ERROR;
 }
 
@@ -614,7 +838,9 @@ CommandHandler::Handle::Handle(CommandHandler * handle)
 CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
-    return mCommandMessageWriter.Finalize(&commandPacket);
+    ReturnErrorOnFailure(FinalizeInvokeResponseMessage(/* aHasMoreChunks = */ false));
+    commandPacket = mChunks.PopHead();
+    return CHIP_NO_ERROR;
 }
 
 const char * CommandHandler::GetStateStr() const
@@ -35,6 +35,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/core/CHIPTLVDebug.hpp>
+#include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
@@ -161,8 +162,13 @@ public:
     /*
      * Main entrypoint for this class to handle an invoke request.
      *
+     * The request may hold up to CHIP_IM_MAX_COMMANDS_PER_INVOKE commands, with different paths, which are dispatched in
+     * order.  Their responses are sent together once all of them are handled: when they do not fit in a single
+     * InvokeResponse message, they are sent in several, each of them but the last one flagged with MoreChunkedMessages
+     * and acknowledged by the client with a StatusResponse.
+     *
      * This function will always call the OnDone function above on the registered callback
-     * before returning.
+     * before returning, unless the responses are sent in several messages.
      *
      * isTimedInvoke is true if and only if this is part of a Timed Invoke
      * transaction (i.e. was preceded by a Timed Request).  If we reach here,
@@ -177,7 +183,19 @@ public:
     CHIP_ERROR AddClusterSpecificFailure(const ConcreteCommandPath & aCommandPath, ClusterStatus aClusterStatus);
 
     Protocols::InteractionModel::Status ProcessInvokeRequest(System::PacketBufferHandle && payload, bool isTimedInvoke);
+    /**
+     * Start encoding a response command with the given path.  This can only be used when the request has a single command,
+     * as the response is matched with that command: use the overload taking the path of the command the response is for
+     * otherwise.
+     */
     CHIP_ERROR PrepareCommand(const ConcreteCommandPath & aCommandPath, bool aStartDataStruct = true);
+
+    /**
+     * Start encoding the response command with path aResponseCommandPath to the command of the request with path
+     * aRequestCommandPath.  Fails with CHIP_ERROR_INVALID_ARGUMENT if the request has no command with that path.
+     */
+    CHIP_ERROR PrepareCommand(const ConcreteCommandPath & aRequestCommandPath, const ConcreteCommandPath & aResponseCommandPath,
+                              bool aStartDataStruct = true);
     CHIP_ERROR FinishCommand(bool aEndDataStruct = true);
     CHIP_ERROR PrepareStatus(const ConcreteCommandPath & aCommandPath);
     CHIP_ERROR FinishStatus();
@@ -204,6 +222,17 @@ public:
             // The state guarantees that either we can rollback or we don't have to rollback the buffer, so we don't care about the
             // return value of RollbackResponse.
             RollbackResponse();
+
+            // The response may not fit next to the responses to the other commands of the request: try again in a message of
+            // its own.
+            if (StartNewResponseMessage(err))
+            {
+                err = TryAddResponseData(aRequestCommandPath, aData);
+                if (err != CHIP_NO_ERROR)
+                {
+                    RollbackResponse();
+                }
+            }
         }
         return err;
     }
@@ -281,13 +310,7 @@ private:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
 
-    void OnResponseTimeout(Messaging::ExchangeContext * ec) override
-    {
-        //
-        // We're not expecting responses to any messages we send out on this EC.
-        //
-        VerifyOrDie(false);
-    }
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override;
 
     enum class State
     {
@@ -307,6 +330,20 @@ private:
      */
     CHIP_ERROR RollbackResponse();
 
+    /**
+     * Called once a response that failed to encode with aError has been rolled back.  If the response did not fit in the
+     * InvokeResponse message next to the responses already in it, this finishes the message, so that the response can be
+     * added to the next one.
+     *
+     * @return true if a new message was started, and the response should be encoded again.
+     */
+    bool StartNewResponseMessage(CHIP_ERROR aError);
+
+    /**
+     * Close the InvokeResponse message being encoded and queue it for sending.
+     */
+    CHIP_ERROR FinalizeInvokeResponseMessage(bool aHasMoreChunks);
+
     /*
      * This forcibly closes the exchange context if a valid one is pointed to. Such a situation does
      * not arise during normal message processing flows that all normally call Close() above. This can only
@@ -357,8 +394,27 @@ private:
      * It doesn't need the endpointId in it's command path since it uses the GroupId in message metadata to find it
      */
     Protocols::InteractionModel::Status ProcessGroupCommandDataIB(CommandDataIB::Parser & aCommandElement);
+    /**
+     * Check the whole invoke request before any of its commands is handled: every command must be well-formed and the
+     * message complete.  The paths of the commands of a unicast request must all be different, and so must their
+     * references when they have some.  This records the reference of each command, to echo it in the responses to the
+     * command.
+     */
+    Protocols::InteractionModel::Status ProcessCommandRefs(const InvokeRequestMessage::Parser & aInvokeRequestMessage,
+                                                           TLV::TLVReader aInvokeRequestsReader);
+
+    /**
+     * Get the reference of the command of the request with the given path, if it has any.  Fails with
+     * CHIP_ERROR_INVALID_ARGUMENT if the request has no command with this path.
+     */
+    CHIP_ERROR GetCommandRef(const ConcreteCommandPath & aRequestCommandPath, Optional<uint16_t> & aCommandRef) const;
+
+    CHIP_ERROR PrepareInvokeResponseCommand(const ConcreteCommandPath & aRequestCommandPath,
+                                            const ConcreteCommandPath & aResponseCommandPath, bool aStartDataStruct);
     CHIP_ERROR SendCommandResponse();
+    CHIP_ERROR SendNextResponseMessage();
     CHIP_ERROR AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
+    CHIP_ERROR TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
 
     /**
      * If this function fails, it may leave our TLV buffer in an inconsistent state.  Callers should snapshot as needed before
@@ -372,7 +428,7 @@ private:
     CHIP_ERROR TryAddResponseData(const ConcreteCommandPath & aRequestCommandPath, const CommandData & aData)
     {
         ConcreteCommandPath path = { aRequestCommandPath.mEndpointId, aRequestCommandPath.mClusterId, CommandData::GetCommandId() };
-        ReturnErrorOnFailure(PrepareCommand(path, false));
+        ReturnErrorOnFailure(PrepareInvokeResponseCommand(aRequestCommandPath, path, false));
         TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
         VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
         ReturnErrorOnFailure(DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kFields)), aData));
@@ -390,10 +446,45 @@ private:
 
     bool mSentStatusResponse = false;
 
-    State mState = State::Idle;
+    /**
+     * The overhead of closing an InvokeResponse message, which is kept free while responses are added:
+     *
+     *  InvokeResponseMessage =
+     *  {
+     *    suppressResponse = false,
+     *    invokeResponses = [
+     *      (...)
+     *    ],                             <-- 1 byte  "end of InvokeResponseIBs" (end of container)
+     *    moreChunkedMessages = true,    <-- 2 bytes "kReservedSizeForMoreChunksFlag"
+     *    InteractionModelRevision = 1,  <-- 3 bytes "kReservedSizeForIMRevision"
+     *  }                                <-- 1 byte  "end of InvokeResponseMessage" (end of container)
+     */
+    static constexpr uint16_t kReservedSizeForMoreChunksFlag = 1 + 1;
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    static constexpr uint16_t kReservedSizeForIMRevision     = 1 + 1 + 1;
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead = kReservedSizeForEndOfContainer +
+        kReservedSizeForMoreChunksFlag + kReservedSizeForIMRevision + kReservedSizeForEndOfContainer;
+
+    struct CommandRef
+    {
+        ConcreteCommandPath mRequestPath = ConcreteCommandPath(0, 0, 0);
+        Optional<uint16_t> mRef;
+    };
+
+    State mState       = State::Idle;
+    State mBackupState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     TLV::TLVWriter mBackupWriter;
     bool mBufferAllocated = false;
+
+    // InvokeResponse messages that are complete and wait to be sent, in order.
+    System::PacketBufferHandle mChunks;
+
+    // The commands of the request.
+    CommandRef mCommandRefs[CHIP_IM_MAX_COMMANDS_PER_INVOKE];
+    size_t mCommandRefCount = 0;
+    // The reference of the command the response or status being added answers, written once it is complete.
+    Optional<uint16_t> mPreparedCommandRef;
 };
 
 } // namespace app
@@ -46,7 +46,16 @@ CHIP_ERROR CommandSender::AllocateBuffer()
         System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
         VerifyOrReturnError(!commandPacket.IsNull(), CHIP_ERROR_NO_MEMORY);
 
+        // Always limit the size of the request to fit within kMaxSecureSduLengthBytes regardless of the available buffer
+        // capacity, and keep room for the MIC and for closing the message.
+        uint32_t reservedSize = Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES + kReservedSizeForTLVEncodingOverhead;
+        if (commandPacket->AvailableDataLength() > kMaxSecureSduLengthBytes)
+        {
+            reservedSize += static_cast<uint32_t>(commandPacket->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        }
+
         mCommandMessageWriter.Init(std::move(commandPacket));
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(reservedSize));
         ReturnErrorOnFailure(mInvokeRequestBuilder.Init(&mCommandMessageWriter));
 
         mInvokeRequestBuilder.SuppressResponse(mSuppressResponse).TimedRequest(mTimedRequest);
@@ -162,9 +171,16 @@ CHIP_ERROR CommandSender::OnMessageReceived(Messaging::ExchangeContext * apExcha
 
     if (aPayloadHeader.HasMessageType(MsgType::InvokeCommandResponse))
     {
-        err = ProcessInvokeResponse(std::move(aPayload));
+        bool moreChunkedMessages = false;
+        err                      = ProcessInvokeResponse(std::move(aPayload), moreChunkedMessages);
         SuccessOrExit(err);
         sendStatusResponse = false;
+        if (moreChunkedMessages)
+        {
+            // The responses did not fit in a single message: ask for the next one.
+            SuccessOrExit(err = StatusResponse::Send(Status::Success, apExchangeContext, true /*aExpectResponse*/));
+            MoveToState(State::CommandSent);
+        }
     }
     else if (aPayloadHeader.HasMessageType(MsgType::StatusResponse))
     {
@@ -196,12 +212,12 @@ exit:
     {
         Close();
     }
-    // Else we got a response to a Timed Request and just sent the invoke.
+    // Else we got a response to a Timed Request and just sent the invoke, or we are waiting for more responses.
 
     return err;
 }
 
-CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && payload)
+CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & aMoreChunkedMessages)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader reader;
@@ -221,6 +237,10 @@ CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && pa
     ReturnErrorOnFailure(invokeResponseMessage.GetInvokeResponses(&invokeResponses));
     invokeResponses.GetReader(&invokeResponsesReader);
 
+    aMoreChunkedMessages = false;
+    err                  = invokeResponseMessage.GetMoreChunkedMessages(&aMoreChunkedMessages);
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+
     while (CHIP_NO_ERROR == (err = invokeResponsesReader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == invokeResponsesReader.GetTag(), CHIP_ERROR_INVALID_TLV_TAG);
@@ -271,6 +291,7 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
     EndpointId endpointId;
     // Default to success when an invoke response is received.
     StatusIB statusIB;
+    Optional<uint16_t> commandRef;
 
     {
         bool hasDataResponse = false;
@@ -289,6 +310,15 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
             StatusIB::Parser status;
             commandStatus.GetErrorStatus(&status);
             ReturnErrorOnFailure(status.DecodeStatusIB(statusIB));
+
+            uint16_t ref;
+            err = commandStatus.GetRef(&ref);
+            if (CHIP_NO_ERROR == err)
+            {
+                commandRef.SetValue(ref);
+            }
+            VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+            err = CHIP_NO_ERROR;
         }
         else if (CHIP_END_OF_TLV == err)
         {
@@ -300,6 +330,14 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
             ReturnErrorOnFailure(commandPath.GetClusterId(&clusterId));
             ReturnErrorOnFailure(commandPath.GetCommandId(&commandId));
             commandData.GetFields(&commandDataReader);
+
+            uint16_t ref;
+            err = commandData.GetRef(&ref);
+            if (CHIP_NO_ERROR == err)
+            {
+                commandRef.SetValue(ref);
+            }
+            VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
             err             = CHIP_NO_ERROR;
             hasDataResponse = true;
         }
@@ -328,32 +366,47 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
         }
         ReturnErrorOnFailure(err);
 
-        if (mpCallback != nullptr)
+        Callback * callback = GetResponseCallback(commandRef);
+        if (callback != nullptr)
         {
             if (statusIB.IsSuccess())
             {
-                mpCallback->OnResponse(this, ConcreteCommandPath(endpointId, clusterId, commandId), statusIB,
-                                       hasDataResponse ? &commandDataReader : nullptr);
+                callback->OnResponse(this, ConcreteCommandPath(endpointId, clusterId, commandId), statusIB,
+                                     hasDataResponse ? &commandDataReader : nullptr);
             }
             else
             {
-                mpCallback->OnError(this, statusIB.ToChipError());
+                callback->OnError(this, statusIB.ToChipError());
             }
         }
     }
     return CHIP_NO_ERROR;
 }
 
+CommandSender::Callback * CommandSender::GetResponseCallback(const Optional<uint16_t> & aCommandRef) const
+{
+    if (aCommandRef.HasValue() && aCommandRef.Value() < mCommandCount && mpCommandCallbacks[aCommandRef.Value()] != nullptr)
+    {
+        return mpCommandCallbacks[aCommandRef.Value()];
+    }
+    return mpCallback;
+}
+
 CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathParams, bool aStartDataStruct)
 {
     ReturnErrorOnFailure(AllocateBuffer());
 
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent one.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mCommandCount < CHIP_IM_MAX_COMMANDS_PER_INVOKE, CHIP_ERROR_NO_MEMORY);
+
     InvokeRequests::Builder & invokeRequests = mInvokeRequestBuilder.GetInvokeRequests();
-    CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
+    invokeRequests.Checkpoint(mBackupWriter);
+    mBackupState = mState;
+
+    CommandDataIB::Builder & invokeRequest = invokeRequests.CreateCommandData();
     ReturnErrorOnFailure(invokeRequests.GetError());
     CommandPathIB::Builder & path = invokeRequest.CreatePath();
     ReturnErrorOnFailure(invokeRequest.GetError());
@@ -369,6 +422,15 @@ CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandSender::RollbackRequest()
+{
+    VerifyOrReturnError(mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeRequestBuilder.GetInvokeRequests().Rollback(mBackupWriter);
+    mInvokeRequestBuilder.GetInvokeRequests().ResetError();
+    MoveToState(mBackupState);
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CommandSender::FinishCommand(bool aEndDataStruct)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -382,10 +444,12 @@ CHIP_ERROR CommandSender::FinishCommand(bool aEndDataStruct)
         ReturnErrorOnFailure(commandData.GetWriter()->EndContainer(mDataElementContainerType));
     }
 
+    // The reference follows the fields, as the elements of the CommandDataIB are in tag order.
+    ReturnErrorOnFailure(commandData.Ref(mCommandCount).GetError());
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
 
+    mpCommandCallbacks[mCommandCount] = nullptr;
+    mCommandCount++;
     MoveToState(State::AddedCommand);
 
     return CHIP_NO_ERROR;
@@ -419,6 +483,9 @@ CHIP_ERROR CommandSender::FinishCommand(const Optional<uint16_t> & aTimedInvokeT
 CHIP_ERROR CommandSender::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
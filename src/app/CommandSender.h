@@ -122,6 +122,12 @@ public:
      * If callbacks are passed the only one that will be called in a group sesttings is the onDone
      */
     CommandSender(Callback * apCallback, Messaging::ExchangeManager * apExchangeMgr, bool aIsTimedRequest = false);
+
+    /*
+     * Start encoding a command.  Up to CHIP_IM_MAX_COMMANDS_PER_INVOKE commands can be added, one after the other, before
+     * the request is sent: they are all sent in the same InvokeRequest, and each of them carries a reference that the
+     * node echoes in its responses.  The commands of a request must all have different paths.
+     */
     CHIP_ERROR PrepareCommand(const CommandPathParams & aCommandPathParams, bool aStartDataStruct = true);
     CHIP_ERROR FinishCommand(bool aEndDataStruct = true);
     TLV::TLVWriter * GetCommandDataIBTLVWriter();
@@ -154,8 +160,36 @@ public:
         return AddRequestDataInternal(aCommandPath, aData, aTimedInvokeTimeoutMs);
     }
 
+    /**
+     * API for adding a data request to a request holding several commands, with the responses to this command delivered
+     * to aResponseCallback instead of the callback of the CommandSender.  OnResponse is called on aResponseCallback for the
+     * successful responses to the command, and OnError for the failures reported for it; the other calls, including
+     * OnDone, are only made on the callback of the CommandSender.
+     *
+     * If the command does not fit in the InvokeRequest anymore, this returns CHIP_ERROR_NO_MEMORY or
+     * CHIP_ERROR_BUFFER_TOO_SMALL and leaves the commands added before in place: the request can still be sent, and the
+     * command added to another one.
+     *
+     * aResponseCallback has to outlive this CommandSender object.
+     */
+    template <typename CommandDataT>
+    CHIP_ERROR AddRequestData(const CommandPathParams & aCommandPath, const CommandDataT & aData, Callback & aResponseCallback,
+                              const Optional<uint16_t> & aTimedInvokeTimeoutMs = NullOptional)
+    {
+        VerifyOrReturnError(!CommandDataT::MustUseTimedInvoke() || aTimedInvokeTimeoutMs.HasValue(), CHIP_ERROR_INVALID_ARGUMENT);
+
+        ReturnErrorOnFailure(AddRequestDataInternal(aCommandPath, aData, aTimedInvokeTimeoutMs));
+        mpCommandCallbacks[mCommandCount - 1] = &aResponseCallback;
+        return CHIP_NO_ERROR;
+    }
+
     CHIP_ERROR FinishCommand(const Optional<uint16_t> & aTimedInvokeTimeoutMs);
 
+    /**
+     * Number of commands added to the request so far.
+     */
+    uint16_t GetCommandCount() const { return mCommandCount; }
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     /**
      * Version of AddRequestData that allows sending a message that is
@@ -175,6 +209,20 @@ private:
     template <typename CommandDataT>
     CHIP_ERROR AddRequestDataInternal(const CommandPathParams & aCommandPath, const CommandDataT & aData,
                                       const Optional<uint16_t> & aTimedInvokeTimeoutMs)
+    {
+        CHIP_ERROR err = TryAddRequestData(aCommandPath, aData, aTimedInvokeTimeoutMs);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Leave the commands added before in place, so that the request can still be sent.  We don't care about the
+            // return value of RollbackRequest: there is nothing to roll back if PrepareCommand failed on the state.
+            RollbackRequest();
+        }
+        return err;
+    }
+
+    template <typename CommandDataT>
+    CHIP_ERROR TryAddRequestData(const CommandPathParams & aCommandPath, const CommandDataT & aData,
+                                 const Optional<uint16_t> & aTimedInvokeTimeoutMs)
     {
         ReturnErrorOnFailure(PrepareCommand(aCommandPath, /* aStartDataStruct = */ false));
         TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
@@ -183,6 +231,11 @@ private:
         return FinishCommand(aTimedInvokeTimeoutMs);
     }
 
+    /**
+     * Rollback the request to before the command being added (before calling PrepareCommand).
+     */
+    CHIP_ERROR RollbackRequest();
+
 public:
     // Sends a queued up command request to the target encapsulated by the secureSession handle.
     //
@@ -256,15 +309,27 @@ private:
      */
     void Abort();
 
-    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload);
+    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & aMoreChunkedMessages);
     CHIP_ERROR ProcessInvokeResponseIB(InvokeResponseIB::Parser & aInvokeResponse);
 
+    /*
+     * The callback for the responses to the command with the given reference.
+     */
+    Callback * GetResponseCallback(const Optional<uint16_t> & aCommandRef) const;
+
     // Send our queued-up Invoke Request message.  Assumes the exchange is ready
     // and mPendingInvokeData is populated.
     CHIP_ERROR SendInvokeRequest();
 
     CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket);
 
+    // End of InvokeRequests (end of container), InteractionModelRevision and end of InvokeRequestMessage (another end of
+    // container): this is kept free while commands are added, so that the message can always be closed.
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    static constexpr uint16_t kReservedSizeForIMRevision     = 1 + 1 + 1;
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead =
+        kReservedSizeForEndOfContainer + kReservedSizeForIMRevision + kReservedSizeForEndOfContainer;
+
     Messaging::ExchangeHolder mExchangeCtx;
     Callback * mpCallback                      = nullptr;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
@@ -282,7 +347,14 @@ private:
 
     State mState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
+    TLV::TLVWriter mBackupWriter;
+    State mBackupState    = State::Idle;
     bool mBufferAllocated = false;
+
+    // Commands added to the request, and the callbacks for their responses, indexed by their reference.  A null callback
+    // means the callback of the CommandSender.
+    uint16_t mCommandCount                                        = 0;
+    Callback * mpCommandCallbacks[CHIP_IM_MAX_COMMANDS_PER_INVOKE] = {};
 };
 
 } // namespace app
@@ -16,6 +16,8 @@
  *    limitations under the License.
  */
 
+#include <algorithm>
+
 #include <access/AccessControl.h>
 #include <access/RequestPath.h>
 #include <access/SubjectDescriptor.h>
@@ -27,6 +29,7 @@
 #include <lib/core/CHIPEventLoggingConfig.h>
 #include <lib/core/CHIPTLVUtilities.hpp>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 using namespace chip::TLV;
@@ -134,7 +137,10 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    CircularEventBuffer backup = *nextBuffer;
+    // Only the circular buffer state changes below; leave the index out of the backup.
+    TLV::CHIPCircularTLVBuffer backup = *nextBuffer;
+    EventIndexEntry indexEntry;
+    bool indexed = false;
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -147,17 +153,44 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = reader.Next();
     SuccessOrExit(err);
 
+    // Carry the index entry of the moved event over, reading the envelope only if it was not indexed.
+    if (apEventBuffer->GetIndexSize() > 0 &&
+        apEventBuffer->GetIndexEntry(0).mOffset == apEventBuffer->GetOffset(apEventBuffer->QueueHead()))
+    {
+        indexEntry = apEventBuffer->GetIndexEntry(0);
+        indexed    = true;
+    }
+    else if (CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE == 0)
+    {
+        // Nothing is cached; the next buffer only counts the event.
+        indexed = true;
+    }
+    else
+    {
+        indexed = (ReadEventIndexEntry(reader, indexEntry) == CHIP_NO_ERROR);
+    }
+    indexEntry.mOffset = nextBuffer->GetOffset(nextBuffer->QueueTail());
+
     err = writer.CopyElement(reader);
     SuccessOrExit(err);
 
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    if (indexed)
+    {
+        nextBuffer->AddToIndex(indexEntry);
+    }
+    else
+    {
+        nextBuffer->InvalidateIndex();
+    }
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        *nextBuffer = backup;
+        static_cast<TLV::CHIPCircularTLVBuffer &>(*nextBuffer) = backup;
     }
     return err;
 }
@@ -182,9 +215,14 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
             ctx.mpEventBuffer             = eventBuffer;
             ctx.mSpaceNeededForMovedEvent = 0;
 
+            uint32_t headOffset                 = eventBuffer->GetOffset(eventBuffer->QueueHead());
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
             err                                 = eventBuffer->EvictHead();
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->RemoveHeadFromIndex(headOffset);
+            }
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -213,6 +251,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace)
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->RemoveHeadFromIndex(headOffset);
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -365,15 +404,24 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
         // Does not go on the wire.
         return CHIP_NO_ERROR;
     }
-    if ((aReader.GetTag() == TLV::ContextTag(to_underlying(EventDataIB::Tag::kSystemTimestamp))) && !(ctx->mpContext->mFirst))
+
+    // A delta is only written from an older timestamp of the same type; restored events can carry the other type.
+    const Timestamp & currentTime  = ctx->mpContext->mCurrentTime;
+    const Timestamp & previousTime = ctx->mpContext->mPreviousTime;
+    if (ctx->mpContext->mFirst || currentTime.mType != previousTime.mType || currentTime.mValue < previousTime.mValue)
+    {
+        return ctx->mpWriter->CopyElement(reader);
+    }
+
+    if (aReader.GetTag() == TLV::ContextTag(to_underlying(EventDataIB::Tag::kSystemTimestamp)))
     {
         return ctx->mpWriter->Put(TLV::ContextTag(to_underlying(EventDataIB::Tag::kDeltaSystemTimestamp)),
-                                  ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
+                                  currentTime.mValue - previousTime.mValue);
     }
-    if ((aReader.GetTag() == TLV::ContextTag(to_underlying(EventDataIB::Tag::kEpochTimestamp))) && !(ctx->mpContext->mFirst))
+    if (aReader.GetTag() == TLV::ContextTag(to_underlying(EventDataIB::Tag::kEpochTimestamp)))
     {
         return ctx->mpWriter->Put(TLV::ContextTag(to_underlying(EventDataIB::Tag::kDeltaEpochTimestamp)),
-                                  ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
+                                  currentTime.mValue - previousTime.mValue);
     }
 
     return ctx->mpWriter->CopyElement(reader);
@@ -411,6 +459,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     CircularEventBuffer * buffer = nullptr;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
     EventOptions opts;
+    EventIndexEntry indexEntry;
 #if CHIP_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS & CHIP_SYSTEM_CONFIG_PLATFORM_PROVIDES_TIME
     Timestamp timestamp;
     System::Clock::Timestamp utc_time;
@@ -443,9 +492,22 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize);
     SuccessOrExit(err);
 
+    indexEntry.mOffset = mpEventBuffer->GetOffset(mpEventBuffer->QueueTail());
+
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+    // The event is in the buffer from here on, even if it is rejected below.
+    indexEntry.mEventNumber = ctxt.mCurrentEventNumber;
+    indexEntry.mEndpointId  = opts.mPath.mEndpointId;
+    indexEntry.mClusterId   = opts.mPath.mClusterId;
+    indexEntry.mEventId     = opts.mPath.mEventId;
+    if (opts.mFabricIndex != kUndefinedFabricIndex)
+    {
+        indexEntry.mFabricIndex.SetValue(opts.mFabricIndex);
+    }
+    mpEventBuffer->AddToIndex(indexEntry);
+
     // Check the number of bytes written.  If the event is too large
     // to be evicted from subsequent buffers, drop it now.
     buffer = mpEventBuffer;
@@ -465,6 +527,11 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
+    if (mpPersistenceDelegate != nullptr)
+    {
+        mpPersistenceDelegate->OnEventLogChanged();
+    }
+
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(EventLogging, "Log event with error %" CHIP_ERROR_FORMAT, err.Format());
@@ -518,35 +585,39 @@ CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWr
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EventManagement::CheckEventContext(EventLoadOutContext * eventLoadOutContext,
-                                              const EventManagement::EventEnvelopeContext & event)
+bool EventManagement::IsEventOfInterest(const EventLoadOutContext & aContext, const ConcreteEventPath & aPath,
+                                        const Optional<FabricIndex> & aFabricIndex)
 {
-    if (eventLoadOutContext->mCurrentEventNumber < eventLoadOutContext->mStartingEventNumber)
+    if (aContext.mCurrentEventNumber < aContext.mStartingEventNumber)
     {
-        return CHIP_ERROR_UNEXPECTED_EVENT;
+        return false;
     }
 
-    if (event.mFabricIndex.HasValue() &&
-        (event.mFabricIndex.Value() == kUndefinedFabricIndex ||
-         eventLoadOutContext->mSubjectDescriptor.fabricIndex != event.mFabricIndex.Value()))
+    if (aFabricIndex.HasValue() &&
+        (aFabricIndex.Value() == kUndefinedFabricIndex || aContext.mSubjectDescriptor.fabricIndex != aFabricIndex.Value()))
     {
-        return CHIP_ERROR_UNEXPECTED_EVENT;
+        return false;
     }
 
-    ConcreteEventPath path(event.mEndpointId, event.mClusterId, event.mEventId);
-    CHIP_ERROR ret = CHIP_ERROR_UNEXPECTED_EVENT;
-
-    for (auto * interestedPath = eventLoadOutContext->mpInterestedEventPaths; interestedPath != nullptr;
+    for (auto * interestedPath = aContext.mpInterestedEventPaths; interestedPath != nullptr;
          interestedPath        = interestedPath->mpNext)
     {
-        if (interestedPath->mValue.IsEventPathSupersetOf(path))
+        if (interestedPath->mValue.IsEventPathSupersetOf(aPath))
         {
-            ret = CHIP_NO_ERROR;
-            break;
+            return true;
         }
     }
 
-    ReturnErrorOnFailure(ret);
+    return false;
+}
+
+CHIP_ERROR EventManagement::CheckEventContext(EventLoadOutContext * eventLoadOutContext,
+                                              const EventManagement::EventEnvelopeContext & event)
+{
+    ConcreteEventPath path(event.mEndpointId, event.mClusterId, event.mEventId);
+    CHIP_ERROR ret = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(IsEventOfInterest(*eventLoadOutContext, path, event.mFabricIndex), CHIP_ERROR_UNEXPECTED_EVENT);
 
     Access::RequestPath requestPath{ .cluster = event.mClusterId, .endpoint = event.mEndpointId };
     Access::Privilege requestPrivilege = RequiredPrivilege::ForReadEvent(path);
@@ -626,8 +697,8 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
             return err;
         }
 
-        loadOutContext->mPreviousTime.mValue = loadOutContext->mCurrentTime.mValue;
-        loadOutContext->mFirst               = false;
+        loadOutContext->mPreviousTime = loadOutContext->mCurrentTime;
+        loadOutContext->mFirst        = false;
         loadOutContext->mEventCount++;
     }
     return err;
@@ -637,16 +708,28 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const ObjectLi
                                              EventNumber & aEventMin, size_t & aEventCount,
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
 {
-    // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
     TLVReader reader;
     CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
+    EventCursor cursor;
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+
+    // Skip the events the reader has already seen without decoding them.
+    cursor = SeekEvent(aEventMin, context.mCurrentEventNumber);
+    VerifyOrExit(cursor.mpBuffer != nullptr, err = CHIP_NO_ERROR);
+
+    if (cursor.mIndexed)
+    {
+        err = CopyIndexedEventsSince(context, cursor);
+        ExitNow();
+    }
+
+    // Part of the remaining events is not indexed; decode them all.
+    err = GetEventReaderAt(reader, cursor.mpBuffer, cursor.mOffset, &bufWrapper);
     SuccessOrExit(err);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
@@ -720,15 +803,203 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     TLVReader reader;
     CircularEventBufferWrapper bufWrapper;
 
+    for (CircularEventBuffer * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        buffer->RemoveFabricFromIndex(aFabricIndex);
+    }
+
     ReturnErrorOnFailure(GetEventReader(reader, PriorityLevel::Critical, &bufWrapper));
     CHIP_ERROR err = TLV::Utilities::Iterate(reader, FabricRemovedCB, &aFabricIndex, recurse);
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
     }
+
+    if (mpPersistenceDelegate != nullptr)
+    {
+        mpPersistenceDelegate->OnEventLogChanged();
+    }
     return err;
 }
 
+CHIP_ERROR EventManagement::LoadRestoredEvents(const Optional<System::Clock::Milliseconds64> & aSystemTimeEpoch)
+{
+    CHIP_ERROR err              = CHIP_NO_ERROR;
+    EventNumber lastEventNumber = 0;
+    bool hasEvents              = false;
+
+    for (CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+         buffer                       = buffer->GetPreviousCircularEventBuffer())
+    {
+        if (ConvertRestoredTimestamps(buffer, aSystemTimeEpoch) != CHIP_NO_ERROR ||
+            LoadRestoredEvents(buffer, lastEventNumber, hasEvents) != CHIP_NO_ERROR)
+        {
+            ChipLogError(EventLogging, "Dropping restored events from buffer with priority %u",
+                         static_cast<unsigned>(buffer->GetPriority()));
+            buffer->Clear();
+            err = CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+        }
+    }
+
+    // Event numbers must keep growing across restarts.
+    if (hasEvents && lastEventNumber >= mLastEventNumber)
+    {
+        ChipLogError(EventLogging, "Dropping restored events, event number 0x" ChipLogFormatX64 " is ahead of the event counter",
+                     ChipLogValueX64(lastEventNumber));
+        for (CircularEventBuffer * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+        {
+            buffer->Clear();
+        }
+        err = CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+    }
+
+    return err;
+}
+
+CHIP_ERROR EventManagement::LoadRestoredEvents(CircularEventBuffer * apBuffer, EventNumber & aLastEventNumber, bool & aHasEvents)
+{
+    CircularTLVReader reader;
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+    const uint32_t headOffset = apBuffer->GetOffset(apBuffer->QueueHead());
+    uint32_t eventStart       = 0;
+
+    apBuffer->ClearIndex();
+    reader.Init(*apBuffer);
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        EventIndexEntry entry;
+        ReturnErrorOnFailure(ReadEventIndexEntry(reader, entry));
+        VerifyOrReturnError(!aHasEvents || entry.mEventNumber > aLastEventNumber, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+        entry.mOffset = (headOffset + eventStart) % apBuffer->GetTotalDataLength();
+        apBuffer->AddToIndex(entry);
+        aLastEventNumber = entry.mEventNumber;
+        aHasEvents       = true;
+
+        ReturnErrorOnFailure(reader.Skip());
+        eventStart = reader.GetLengthRead();
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    // The queue must end exactly after its last event.
+    VerifyOrReturnError(eventStart == apBuffer->DataLength(), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::ConvertRestoredTimestamps(CircularEventBuffer * apBuffer,
+                                                      const Optional<System::Clock::Milliseconds64> & aSystemTimeEpoch)
+{
+    CircularTLVReader reader;
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+    const uint32_t size       = apBuffer->GetTotalDataLength();
+    const uint32_t headOffset = apBuffer->GetOffset(apBuffer->QueueHead());
+    const uint32_t dataLength = apBuffer->DataLength();
+    uint32_t systemEventsEnd  = 0;
+    size_t systemEventCount   = 0;
+    size_t droppedEventCount  = 0;
+    Platform::ScopedMemoryBuffer<uint8_t> events;
+    Platform::ScopedMemoryBuffer<uint8_t> convertedEvent;
+    TLVReader eventReader;
+
+    reader.Init(*apBuffer);
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        EventEnvelopeContext envelope;
+        ReturnErrorOnFailure(ReadEventEnvelope(reader, envelope));
+        ReturnErrorOnFailure(reader.Skip());
+        if (envelope.mCurrentTime.IsSystem())
+        {
+            systemEventsEnd = reader.GetLengthRead();
+            systemEventCount++;
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    VerifyOrReturnError(systemEventCount > 0, CHIP_NO_ERROR);
+
+    if (!aSystemTimeEpoch.HasValue())
+    {
+        // Events only get newer from the head on; drop everything up to the newest event with a system timestamp.
+        ChipLogProgress(EventLogging, "Dropping restored events with system timestamps from buffer with priority %u",
+                        static_cast<unsigned>(apBuffer->GetPriority()));
+        return apBuffer->RestoreQueue((headOffset + systemEventsEnd) % size, dataLength - systemEventsEnd);
+    }
+
+    // Move the events out of the buffer, then write them back with epoch timestamps.  An event growing past the space
+    // left evicts the oldest ones, which are dropped rather than moved to the next buffer.
+    VerifyOrReturnError(events.Alloc(dataLength) && convertedEvent.Alloc(size), CHIP_ERROR_NO_MEMORY);
+    const uint32_t firstPart = std::min(dataLength, size - headOffset);
+    memcpy(events.Get(), apBuffer->QueueHead(), firstPart);
+    memcpy(events.Get() + firstPart, apBuffer->GetQueue(), dataLength - firstPart);
+    apBuffer->Clear();
+    apBuffer->mProcessEvictedElement = nullptr;
+
+    eventReader.Init(events.Get(), dataLength);
+    while ((err = eventReader.Next()) == CHIP_NO_ERROR)
+    {
+        TLVWriter writer;
+        TLVReader convertedReader;
+        CircularTLVWriter circularWriter;
+
+        writer.Init(convertedEvent.Get(), size);
+        ReturnErrorOnFailure(CopyEventWithEpochTimestamp(eventReader, writer, aSystemTimeEpoch.Value()));
+        while (apBuffer->AvailableDataLength() < writer.GetLengthWritten())
+        {
+            ReturnErrorOnFailure(apBuffer->EvictHead());
+            droppedEventCount++;
+        }
+
+        convertedReader.Init(convertedEvent.Get(), writer.GetLengthWritten());
+        ReturnErrorOnFailure(convertedReader.Next());
+        circularWriter.Init(*apBuffer);
+        ReturnErrorOnFailure(circularWriter.CopyElement(convertedReader));
+        ReturnErrorOnFailure(circularWriter.Finalize());
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    if (droppedEventCount > 0)
+    {
+        ChipLogProgress(EventLogging, "Dropped %u restored events from buffer with priority %u to fit epoch timestamps",
+                        static_cast<unsigned>(droppedEventCount), static_cast<unsigned>(apBuffer->GetPriority()));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::CopyEventWithEpochTimestamp(const TLVReader & aReader, TLVWriter & aWriter,
+                                                        System::Clock::Milliseconds64 aSystemTimeEpoch)
+{
+    TLVReader reader;
+    TLVType containerType;
+    TLVType containerType1;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(aWriter.StartContainer(AnonymousTag(), kTLVType_Structure, containerType));
+
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType1));
+    ReturnErrorOnFailure(
+        aWriter.StartContainer(TLV::ContextTag(to_underlying(EventReportIB::Tag::kEventData)), kTLVType_Structure, containerType1));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == TLV::ContextTag(to_underlying(EventDataIB::Tag::kSystemTimestamp)))
+        {
+            uint64_t systemTime;
+            ReturnErrorOnFailure(reader.Get(systemTime));
+            ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(to_underlying(EventDataIB::Tag::kEpochTimestamp)),
+                                             systemTime + aSystemTimeEpoch.count()));
+        }
+        else
+        {
+            ReturnErrorOnFailure(aWriter.CopyElement(reader));
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(aWriter.EndContainer(containerType1));
+    ReturnErrorOnFailure(aWriter.EndContainer(containerType));
+    return aWriter.Finalize();
+}
+
 CHIP_ERROR EventManagement::GetEventReader(TLVReader & aReader, PriorityLevel aPriority, CircularEventBufferWrapper * apBufWrapper)
 {
     CircularEventBuffer * buffer = GetPriorityBuffer(aPriority);
@@ -742,6 +1013,139 @@ CHIP_ERROR EventManagement::GetEventReader(TLVReader & aReader, PriorityLevel aP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR EventManagement::GetEventReaderAt(TLVReader & aReader, CircularEventBuffer * apBuffer, uint32_t aOffset,
+                                             CircularEventBufferWrapper * apBufWrapper)
+{
+    const uint32_t size = apBuffer->GetTotalDataLength();
+
+    apBufWrapper->mpCurrent  = apBuffer;
+    apBufWrapper->mSkipBytes = (aOffset + size - apBuffer->GetOffset(apBuffer->QueueHead())) % size;
+    VerifyOrReturnError(apBufWrapper->mSkipBytes < apBuffer->DataLength(), CHIP_ERROR_INCORRECT_STATE);
+
+    CircularEventReader reader;
+    reader.Init(apBufWrapper);
+    aReader.Init(reader);
+
+    return CHIP_NO_ERROR;
+}
+
+EventManagement::EventCursor EventManagement::SeekEvent(EventNumber aEventMin, EventNumber & aLastEventNumber) const
+{
+    EventCursor cursor;
+
+    // Buffers are read from the most important one, which holds the oldest events, and event numbers only grow from one
+    // event to the next.
+    for (CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+         buffer                       = buffer->GetPreviousCircularEventBuffer())
+    {
+        if (buffer->DataLength() == 0)
+        {
+            continue;
+        }
+
+        if (cursor.mpBuffer != nullptr)
+        {
+            cursor.mIndexed = cursor.mIndexed && buffer->IsFullyIndexed();
+            continue;
+        }
+
+        const size_t indexSize = buffer->GetIndexSize();
+        size_t entry           = 0;
+        while (entry < indexSize && buffer->GetIndexEntry(entry).mEventNumber < aEventMin)
+        {
+            entry++;
+        }
+
+        if (indexSize > 0 && entry == indexSize)
+        {
+            // Every event of the buffer has been seen already.
+            aLastEventNumber = buffer->GetIndexEntry(indexSize - 1).mEventNumber;
+            continue;
+        }
+
+        cursor.mpBuffer = buffer;
+        if (entry < indexSize && (entry > 0 || buffer->IsFullyIndexed()))
+        {
+            cursor.mOffset     = buffer->GetIndexEntry(entry).mOffset;
+            cursor.mIndexEntry = entry;
+            cursor.mIndexed    = true;
+        }
+        else
+        {
+            // Events older than the oldest indexed one may not have been seen yet.
+            cursor.mOffset  = buffer->GetOffset(buffer->QueueHead());
+            cursor.mIndexed = false;
+        }
+    }
+
+    return cursor;
+}
+
+CHIP_ERROR EventManagement::CopyIndexedEventsSince(EventLoadOutContext & aContext, const EventCursor & aCursor)
+{
+    size_t entry = aCursor.mIndexEntry;
+    for (CircularEventBuffer * buffer = aCursor.mpBuffer; buffer != nullptr; buffer = buffer->GetPreviousCircularEventBuffer())
+    {
+        for (; entry < buffer->GetIndexSize(); entry++)
+        {
+            const EventIndexEntry & indexEntry = buffer->GetIndexEntry(entry);
+            aContext.mCurrentEventNumber       = indexEntry.mEventNumber;
+
+            ConcreteEventPath path(indexEntry.mEndpointId, indexEntry.mClusterId, indexEntry.mEventId);
+            if (!IsEventOfInterest(aContext, path, indexEntry.mFabricIndex))
+            {
+                continue;
+            }
+
+            TLVReader reader;
+            CircularEventBufferWrapper bufWrapper;
+            ReturnErrorOnFailure(GetEventReaderAt(reader, buffer, indexEntry.mOffset, &bufWrapper));
+            ReturnErrorOnFailure(reader.Next());
+
+            // This decodes the event again, which also checks access control.
+            CHIP_ERROR err = CopyEventsSince(reader, 0, &aContext);
+            VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV, err);
+        }
+        entry = 0;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::ReadEventEnvelope(const TLVReader & aReader, EventEnvelopeContext & aEnvelope)
+{
+    TLVReader reader;
+    TLVType containerType;
+    TLVType containerType1;
+
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(reader.EnterContainer(containerType1));
+
+    CHIP_ERROR err = TLV::Utilities::Iterate(reader, FetchEventParameters, &aEnvelope, false /*recurse*/);
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+    VerifyOrReturnError(aEnvelope.mFieldsToRead == kRequiredEventField, CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::ReadEventIndexEntry(const TLVReader & aReader, EventIndexEntry & aEntry)
+{
+    EventEnvelopeContext envelope;
+    ReturnErrorOnFailure(ReadEventEnvelope(aReader, envelope));
+
+    aEntry.mEventNumber = envelope.mEventNumber;
+    aEntry.mEndpointId  = envelope.mEndpointId;
+    aEntry.mClusterId   = envelope.mClusterId;
+    aEntry.mEventId     = envelope.mEventId;
+    aEntry.mFabricIndex = envelope.mFabricIndex;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size_t, void * apContext)
 {
     EventEnvelopeContext * const envelope = static_cast<EventEnvelopeContext *>(apContext);
@@ -851,6 +1255,95 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+    ClearIndex();
+}
+
+void CircularEventBuffer::ClearIndex()
+{
+    mIndexStart      = 0;
+    mIndexSize       = 0;
+    mUnindexedEvents = 0;
+}
+
+void CircularEventBuffer::Clear()
+{
+    RestoreQueue(0, 0);
+    ClearIndex();
+}
+
+void CircularEventBuffer::InvalidateIndex()
+{
+    // The number of unindexed events is unknown; it becomes known again once the buffer is empty.
+    mIndexStart      = 0;
+    mIndexSize       = 0;
+    mUnindexedEvents = UINT32_MAX;
+}
+
+void CircularEventBuffer::AddToIndex(const EventIndexEntry & aEntry)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (mIndexSize == CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE)
+    {
+        mIndexStart = static_cast<uint16_t>((mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE);
+        mIndexSize--;
+        if (mUnindexedEvents != UINT32_MAX)
+        {
+            mUnindexedEvents++;
+        }
+    }
+
+    mIndex[(mIndexStart + mIndexSize) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE] = aEntry;
+    mIndexSize++;
+#else
+    // Only count the events, so that fetching knows it has to scan them.
+    if (mUnindexedEvents != UINT32_MAX)
+    {
+        mUnindexedEvents++;
+    }
+#endif
+}
+
+void CircularEventBuffer::RemoveHeadFromIndex(uint32_t aHeadOffset)
+{
+    if (DataLength() == 0)
+    {
+        ClearIndex();
+    }
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    else if (mIndexSize > 0 && GetIndexEntry(0).mOffset == aHeadOffset)
+    {
+        mIndexStart = static_cast<uint16_t>((mIndexStart + 1) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE);
+        mIndexSize--;
+    }
+#endif
+    else if (mUnindexedEvents > 0)
+    {
+        if (mUnindexedEvents != UINT32_MAX)
+        {
+            mUnindexedEvents--;
+        }
+    }
+    else
+    {
+        ChipLogError(EventLogging, "Event index out of sync with buffer with priority %u", static_cast<unsigned>(mPriority));
+        InvalidateIndex();
+    }
+}
+
+void CircularEventBuffer::RemoveFabricFromIndex(FabricIndex aFabricIndex)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    for (uint16_t i = 0; i < mIndexSize; i++)
+    {
+        EventIndexEntry & entry = mIndex[(mIndexStart + i) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+        if (entry.mFabricIndex.HasValue() && entry.mFabricIndex.Value() == aFabricIndex)
+        {
+            entry.mFabricIndex.SetValue(kUndefinedFabricIndex);
+        }
+    }
+#else
+    (void) aFabricIndex;
+#endif
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -865,8 +1358,10 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
+    uint32_t skipBytes = apBufWrapper->mSkipBytes;
+
     TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
+    mMaxLen = apBufWrapper->mpCurrent->DataLength() - skipBytes;
     for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
@@ -882,6 +1377,19 @@ CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const
     mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
+    // Start reading past the head of the first buffer; the skipped bytes may wrap around the end of its storage.
+    while (mSkipBytes > 0 && aBufLen > 0)
+    {
+        uint32_t skip = std::min(mSkipBytes, aBufLen);
+        aBufStart += skip;
+        aBufLen -= skip;
+        mSkipBytes -= skip;
+        if (aBufLen == 0)
+        {
+            mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+        }
+    }
+
     if ((aBufLen == 0) && (mpCurrent->GetPreviousCircularEventBuffer() != nullptr))
     {
         mpCurrent = mpCurrent->GetPreviousCircularEventBuffer();
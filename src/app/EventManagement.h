@@ -34,7 +34,9 @@
 #include <app/ObjectList.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCircularTLVBuffer.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/CHIPCounter.h>
+#include <lib/support/CodeUtils.h>
 #include <messaging/ExchangeMgr.h>
 
 #define CHIP_CONFIG_EVENT_GLOBAL_PRIORITY PriorityLevel::Debug
@@ -47,6 +49,21 @@ constexpr size_t kMaxEventSizeReserve            = 512;
 constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
+/**
+ * @brief
+ *   Envelope of an event stored in a CircularEventBuffer, cached so that fetching events can seek to an event number
+ *   and filter on the path and fabric without decoding the event.
+ */
+struct EventIndexEntry
+{
+    EventNumber mEventNumber = 0;
+    uint32_t mOffset         = 0; ///< Offset of the event's first byte in the backing store of the buffer
+    EndpointId mEndpointId   = 0;
+    ClusterId mClusterId     = 0;
+    EventId mEventId         = 0;
+    Optional<FabricIndex> mFabricIndex;
+};
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::CHIPCircularTLVBuffer
@@ -99,6 +116,67 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Record an event that was just appended to the buffer.  When the index is full its oldest entry is dropped, and
+     *   the index no longer covers every event of the buffer.
+     */
+    void AddToIndex(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Must be called after the head event of the buffer was evicted; @p aHeadOffset is the offset the head had
+     *   before the eviction.
+     */
+    void RemoveHeadFromIndex(uint32_t aHeadOffset);
+
+    /**
+     * @brief
+     *   Mark every indexed event of @p aFabricIndex as belonging to no valid fabric, mirroring
+     *   EventManagement::FabricRemoved.
+     */
+    void RemoveFabricFromIndex(FabricIndex aFabricIndex);
+
+    /**
+     * @brief
+     *   Forget every indexed event, e.g. when an event could not be indexed.  The index covers the events added from
+     *   then on, and covers the whole buffer again once it is empty.
+     */
+    void InvalidateIndex();
+
+    /**
+     * @brief
+     *   Drop every event of the buffer.
+     */
+    void Clear();
+
+    /**
+     * @brief
+     *   Forget every indexed event, before indexing every event of the buffer again.
+     */
+    void ClearIndex();
+
+    /// Indexed events, oldest first.  They are the newest GetIndexSize() events of the buffer.
+    size_t GetIndexSize() const { return mIndexSize; }
+    const EventIndexEntry & GetIndexEntry(size_t aIndex) const
+    {
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+        return mIndex[(mIndexStart + aIndex) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+#else
+        // The index is always empty.
+        chipDie();
+#endif
+    }
+
+    /// Whether every event of the buffer is indexed.
+    bool IsFullyIndexed() const { return mUnindexedEvents == 0; }
+
+    /// Offset of @p apPosition, a pointer into the backing store, from the start of the backing store.
+    uint32_t GetOffset(const uint8_t * apPosition) const
+    {
+        return static_cast<uint32_t>(apPosition - GetQueue()) % GetTotalDataLength();
+    }
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -109,6 +187,13 @@ private:
                                                       ///< lesser priority are dropped when they get bumped out of this buffer
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    EventIndexEntry mIndex[CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE]; ///< Ring of the newest events in the buffer
+#endif
+    uint16_t mIndexStart      = 0;
+    uint16_t mIndexSize       = 0;
+    uint32_t mUnindexedEvents = 0; ///< Events older than the oldest indexed one
 };
 
 class CircularEventReader;
@@ -124,6 +209,7 @@ class CircularEventBufferWrapper : public TLV::CHIPCircularTLVBuffer
 public:
     CircularEventBufferWrapper() : CHIPCircularTLVBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    uint32_t mSkipBytes = 0; ///< Bytes to skip past the head of the first buffer, to start reading at a given event
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -158,6 +244,23 @@ struct LogStorageResources
         PriorityLevel::Invalid; // Log priority level associated with the resources provided in this structure.
 };
 
+/**
+ * @brief
+ *   Notified whenever the content of the event buffers changed, so that buffers kept in persistent storage (see
+ *   LogStorageResources) can be saved along with the position of their data.
+ */
+class EventLogPersistenceDelegate
+{
+public:
+    virtual ~EventLogPersistenceDelegate() = default;
+
+    /**
+     * @brief
+     *   Called on the Matter thread after events were logged, moved, evicted or modified.  Must not block.
+     */
+    virtual void OnEventLogChanged() = 0;
+};
+
 /**
  * @brief
  *   A class for managing the in memory event logs.
@@ -349,6 +452,26 @@ public:
      */
     void SetScheduledEventInfo(EventNumber & aEventNumber, uint32_t & aInitialWrittenEventBytes) const;
 
+    void SetPersistenceDelegate(EventLogPersistenceDelegate * apDelegate) { mpPersistenceDelegate = apDelegate; }
+
+    /**
+     * @brief
+     *   Take over the events that were already in the buffers when Init was called, after their queues were restored with
+     *   CircularEventBuffer::RestoreQueue.  The events of a buffer that is not a valid sequence of events, and all events
+     *   if their numbers are not below the next event number to be vended, are dropped.
+     *
+     *   System timestamps count from the start of the run that logged the events, so restored events carrying one are
+     *   rewritten with an epoch timestamp, or dropped when @p aSystemTimeEpoch is missing.  Rewritten events may take more
+     *   space, in which case the oldest ones are dropped.
+     *
+     * @param[in] aSystemTimeEpoch  Epoch time, in milliseconds, at which the system time of the run that logged the
+     *                              events was zero.
+     *
+     * @retval #CHIP_NO_ERROR                  All restored events were taken over, or dropped for their system timestamp.
+     * @retval #CHIP_ERROR_INTEGRITY_CHECK_FAILED Some events were dropped.
+     */
+    CHIP_ERROR LoadRestoredEvents(const Optional<System::Clock::Milliseconds64> & aSystemTimeEpoch);
+
 private:
     /**
      * @brief
@@ -373,6 +496,18 @@ private:
         Optional<FabricIndex> mFabricIndex;
     };
 
+    /**
+     * @brief
+     *   Where fetching events from a given event number on starts.
+     */
+    struct EventCursor
+    {
+        CircularEventBuffer * mpBuffer = nullptr; ///< Buffer holding the first event to fetch, nullptr when there is none
+        uint32_t mOffset               = 0;       ///< Offset of the first event to fetch in the buffer
+        size_t mIndexEntry             = 0;       ///< Index entry of the first event to fetch, valid when mIndexed is set
+        bool mIndexed                  = false;   ///< Whether every event from the cursor on is indexed
+    };
+
     void VendEventNumber();
     CHIP_ERROR CalculateEventSize(EventLoggingDelegate * apDelegate, const EventOptions * apOptions, uint32_t & requiredSize);
     /**
@@ -485,6 +620,32 @@ private:
      */
     static CHIP_ERROR CheckEventContext(EventLoadOutContext * eventLoadOutContext, const EventEnvelopeContext & event);
 
+    /**
+     * @brief
+     *   The part of CheckEventContext that only needs the event envelope: event number, fabric and interested paths.
+     */
+    static bool IsEventOfInterest(const EventLoadOutContext & aContext, const ConcreteEventPath & aPath,
+                                  const Optional<FabricIndex> & aFabricIndex);
+
+    static CHIP_ERROR ReadEventEnvelope(const TLV::TLVReader & aReader, EventEnvelopeContext & aEnvelope);
+    static CHIP_ERROR ReadEventIndexEntry(const TLV::TLVReader & aReader, EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Find the oldest event whose number is at least @p aEventMin.  When all events are older, the returned cursor has no
+     *   buffer and @p aLastEventNumber is set to the number of the newest event.
+     */
+    EventCursor SeekEvent(EventNumber aEventMin, EventNumber & aLastEventNumber) const;
+
+    /**
+     * @brief
+     *   Copy the events of interest from @p aCursor on, decoding only those whose indexed envelope matches.
+     */
+    static CHIP_ERROR CopyIndexedEventsSince(EventLoadOutContext & aContext, const EventCursor & aCursor);
+
+    static CHIP_ERROR GetEventReaderAt(TLV::TLVReader & aReader, CircularEventBuffer * apBuffer, uint32_t aOffset,
+                                       CircularEventBufferWrapper * apBufWrapper);
+
     /**
      * @brief copy event from circular buffer to target buffer for report
      */
@@ -500,6 +661,27 @@ private:
      */
     CircularEventBuffer * GetPriorityBuffer(PriorityLevel aPriority) const;
 
+    /**
+     * @brief
+     *   Index the restored events of @p apBuffer, checking that their numbers grow from @p aLastEventNumber on.
+     */
+    static CHIP_ERROR LoadRestoredEvents(CircularEventBuffer * apBuffer, EventNumber & aLastEventNumber, bool & aHasEvents);
+
+    /**
+     * @brief
+     *   Rewrite the system timestamps of the restored events of @p apBuffer as epoch timestamps, or drop the events
+     *   carrying one when @p aSystemTimeEpoch is missing.
+     */
+    static CHIP_ERROR ConvertRestoredTimestamps(CircularEventBuffer * apBuffer,
+                                                const Optional<System::Clock::Milliseconds64> & aSystemTimeEpoch);
+
+    /**
+     * @brief
+     *   Copy the event @p aReader is positioned on, replacing its system timestamp by an epoch timestamp.
+     */
+    static CHIP_ERROR CopyEventWithEpochTimestamp(const TLV::TLVReader & aReader, TLV::TLVWriter & aWriter,
+                                                  System::Clock::Milliseconds64 aSystemTimeEpoch);
+
     // EventBuffer for debug level,
     CircularEventBuffer * mpEventBuffer        = nullptr;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
@@ -511,6 +693,8 @@ private:
 
     EventNumber mLastEventNumber = 0; ///< Last event Number vended
     Timestamp mLastEventTimestamp;    ///< The timestamp of the last event in this buffer
+
+    EventLogPersistenceDelegate * mpPersistenceDelegate = nullptr;
 };
 } // namespace app
 } // namespace chip
@@ -63,6 +63,7 @@ CHIP_ERROR InteractionModelEngine::Init(Messaging::ExchangeManager * apExchangeM
     ReturnErrorOnFailure(mpExchangeMgr->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this));
 
     mReportingEngine.Init();
+    mResubscriptionScheduler.Init();
     mMagic++;
 
     StatusIB::RegisterErrorFormatter();
@@ -128,6 +129,8 @@ void InteractionModelEngine::Shutdown()
     //
     mpActiveReadClientList = nullptr;
 
+    mResubscriptionScheduler.Shutdown();
+
     for (auto & writeHandler : mWriteHandlers)
     {
         writeHandler.Abort();
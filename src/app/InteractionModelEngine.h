@@ -51,6 +51,7 @@
 #include <app/ObjectList.h>
 #include <app/ReadClient.h>
 #include <app/ReadHandler.h>
+#include <app/ResubscriptionScheduler.h>
 #include <app/StatusResponse.h>
 #include <app/TimedHandler.h>
 #include <app/WriteClient.h>
@@ -176,6 +177,8 @@ public:
 
     reporting::Engine & GetReportingEngine() { return mReportingEngine; }
 
+    ResubscriptionScheduler & GetResubscriptionScheduler() { return mResubscriptionScheduler; }
+
     void ReleaseAttributePathList(ObjectList<AttributePathParams> *& aAttributePathList);
 
     CHIP_ERROR PushFrontAttributePathList(ObjectList<AttributePathParams> *& aAttributePathList,
@@ -544,6 +547,7 @@ private:
     ObjectPool<TimedHandler, CHIP_IM_MAX_NUM_TIMED_HANDLER> mTimedHandlers;
     WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
+    ResubscriptionScheduler mResubscriptionScheduler;
 
     static constexpr size_t kReservedHandlersForReads = kMinSupportedReadRequestsPerFabric * (CHIP_CONFIG_MAX_FABRICS);
     static constexpr size_t kReservedPathsForReads    = kMinSupportedPathsPerReadRequest * kReservedHandlersForReads;
@@ -0,0 +1,262 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/MappedEventLogStorage.h>
+
+#include <lib/core/CHIPEventLoggingConfig.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemError.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+/// Epoch time, in milliseconds, at which the system time was zero, or 0 when the real time is unknown.
+uint64_t GetSystemTimeEpoch()
+{
+    System::Clock::Milliseconds64 realTime;
+    const System::Clock::Milliseconds64 systemTime = System::SystemClock().GetMonotonicMilliseconds64();
+
+    VerifyOrReturnValue(System::SystemClock().GetClock_RealTimeMS(realTime) == CHIP_NO_ERROR && realTime > systemTime, 0);
+    return (realTime - systemTime).count();
+}
+
+} // namespace
+
+CHIP_ERROR MappedEventLogStorage::Init(const char * apPath, LogStorageResources * apResources, uint32_t aNumBuffers,
+                                       System::Layer * apSystemLayer)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct stat fileStat;
+    size_t offset;
+    void * mapping;
+
+    VerifyOrReturnError(mFd == -1, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(apPath != nullptr && apResources != nullptr && apSystemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aNumBuffers > 0 && aNumBuffers <= kNumPriorityLevel, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mMappingSize = sizeof(FileHeader);
+    for (uint32_t i = 0; i < aNumBuffers; i++)
+    {
+        VerifyOrReturnError(apResources[i].mBufferSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+        mMappingSize += apResources[i].mBufferSize;
+    }
+
+    mFd = open(apPath, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrExit(mFd >= 0, err = CHIP_ERROR_POSIX(errno));
+    VerifyOrExit(fstat(mFd, &fileStat) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    if (static_cast<size_t>(fileStat.st_size) != mMappingSize)
+    {
+        // Either a new file or one written with other buffer sizes; start from a zeroed file.
+        ChipLogProgress(EventLogging, "Resetting event log storage %s", apPath);
+        VerifyOrExit(ftruncate(mFd, 0) == 0, err = CHIP_ERROR_POSIX(errno));
+        VerifyOrExit(ftruncate(mFd, static_cast<off_t>(mMappingSize)) == 0, err = CHIP_ERROR_POSIX(errno));
+    }
+
+    mapping = mmap(nullptr, mMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    VerifyOrExit(mapping != MAP_FAILED, err = CHIP_ERROR_POSIX(errno));
+    mpMapping = static_cast<uint8_t *>(mapping);
+
+    if (!IsLayoutValid(apResources, aNumBuffers))
+    {
+        FileHeader * header = GetHeader();
+        memset(header, 0, sizeof(FileHeader));
+        header->mMagic      = kMagic;
+        header->mVersion    = kVersion;
+        header->mNumBuffers = static_cast<uint16_t>(aNumBuffers);
+        for (uint32_t i = 0; i < aNumBuffers; i++)
+        {
+            header->mBuffers[i].mSize     = apResources[i].mBufferSize;
+            header->mBuffers[i].mPriority = static_cast<uint8_t>(apResources[i].mPriority);
+        }
+    }
+
+    offset = sizeof(FileHeader);
+    for (uint32_t i = 0; i < aNumBuffers; i++)
+    {
+        apResources[i].mpBuffer = mpMapping + offset;
+        offset += apResources[i].mBufferSize;
+    }
+
+    mNumBuffers   = aNumBuffers;
+    mpSystemLayer = apSystemLayer;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Failed to map event log storage %s: %" CHIP_ERROR_FORMAT, apPath, err.Format());
+        Shutdown();
+    }
+    return err;
+}
+
+bool MappedEventLogStorage::IsLayoutValid(const LogStorageResources * apResources, uint32_t aNumBuffers) const
+{
+    const FileHeader * header = GetHeader();
+
+    VerifyOrReturnValue(header->mMagic == kMagic && header->mVersion == kVersion && header->mNumBuffers == aNumBuffers, false);
+    for (uint32_t i = 0; i < aNumBuffers; i++)
+    {
+        const BufferHeader & buffer = header->mBuffers[i];
+        VerifyOrReturnValue(buffer.mSize == apResources[i].mBufferSize &&
+                                buffer.mPriority == static_cast<uint8_t>(apResources[i].mPriority),
+                            false);
+    }
+    return true;
+}
+
+CHIP_ERROR MappedEventLogStorage::Restore(EventManagement & aEventManagement, CircularEventBuffer * apBuffers)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    size_t offset  = sizeof(FileHeader);
+
+    VerifyOrReturnError(mpMapping != nullptr && mpBuffers == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    for (uint32_t i = 0; i < mNumBuffers; i++)
+    {
+        const BufferHeader & buffer = GetHeader()->mBuffers[i];
+
+        // The buffers must be the ones handed out by Init.
+        VerifyOrReturnError(apBuffers[i].GetQueue() == mpMapping + offset && apBuffers[i].GetTotalDataLength() == buffer.mSize,
+                            CHIP_ERROR_INVALID_ARGUMENT);
+        offset += buffer.mSize;
+
+        if (apBuffers[i].RestoreQueue(buffer.mHeadOffset, buffer.mDataLength) != CHIP_NO_ERROR)
+        {
+            apBuffers[i].Clear();
+            err = CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+        }
+    }
+
+    Optional<System::Clock::Milliseconds64> systemTimeEpoch;
+    if (GetHeader()->mSystemTimeEpoch != 0)
+    {
+        systemTimeEpoch.SetValue(System::Clock::Milliseconds64(GetHeader()->mSystemTimeEpoch));
+    }
+
+    CHIP_ERROR loadErr = aEventManagement.LoadRestoredEvents(systemTimeEpoch);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = loadErr;
+    }
+
+    mpBuffers         = apBuffers;
+    mpEventManagement = &aEventManagement;
+    mpEventManagement->SetPersistenceDelegate(this);
+
+    // Record what survived the checks, with their new timestamps, right away.
+    Flush(MS_SYNC);
+    return err;
+}
+
+void MappedEventLogStorage::OnEventLogChanged()
+{
+    VerifyOrReturn(mpBuffers != nullptr && !mSyncPending);
+
+    if (mpSystemLayer->StartTimer(CHIP_CONFIG_EVENT_LOGGING_STORAGE_SYNC_INTERVAL, SyncTimerHandler, this) == CHIP_NO_ERROR)
+    {
+        mSyncPending = true;
+    }
+    else
+    {
+        Flush(MS_ASYNC);
+    }
+}
+
+void MappedEventLogStorage::SyncTimerHandler(System::Layer * apSystemLayer, void * apAppState)
+{
+    MappedEventLogStorage * storage = static_cast<MappedEventLogStorage *>(apAppState);
+    storage->mSyncPending           = false;
+    storage->Flush(MS_ASYNC);
+}
+
+void MappedEventLogStorage::Flush(int aDataFlags)
+{
+    VerifyOrReturn(mpMapping != nullptr && mpBuffers != nullptr);
+
+    // Writing the events back can take long: unless asked to wait for it, only start it.  The events may then reach the
+    // file after the header pointing at them; Restore() checks them and drops those that did not.
+    VerifyOrReturn(Sync(mpMapping, mMappingSize, aDataFlags));
+
+    FileHeader * header      = GetHeader();
+    header->mSystemTimeEpoch = GetSystemTimeEpoch();
+    for (uint32_t i = 0; i < mNumBuffers; i++)
+    {
+        header->mBuffers[i].mHeadOffset = mpBuffers[i].GetOffset(mpBuffers[i].QueueHead());
+        header->mBuffers[i].mDataLength = mpBuffers[i].DataLength();
+    }
+
+    // The header is a small part of the first page of the mapping.
+    Sync(mpMapping, sizeof(FileHeader), MS_SYNC);
+}
+
+bool MappedEventLogStorage::Sync(void * apStart, size_t aLength, int aFlags)
+{
+    if (msync(apStart, aLength, aFlags) != 0)
+    {
+        ChipLogError(EventLogging, "Failed to sync event log storage: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return false;
+    }
+    return true;
+}
+
+void MappedEventLogStorage::Shutdown()
+{
+    if (mpEventManagement != nullptr)
+    {
+        mpEventManagement->SetPersistenceDelegate(nullptr);
+        mpEventManagement = nullptr;
+    }
+
+    if (mSyncPending)
+    {
+        mpSystemLayer->CancelTimer(SyncTimerHandler, this);
+        mSyncPending = false;
+    }
+
+    if (mpMapping != nullptr)
+    {
+        Flush(MS_SYNC);
+        munmap(mpMapping, mMappingSize);
+        mpMapping = nullptr;
+    }
+
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    mpBuffers     = nullptr;
+    mNumBuffers   = 0;
+    mMappingSize  = 0;
+    mpSystemLayer = nullptr;
+}
+
+} // namespace app
+} // namespace chip
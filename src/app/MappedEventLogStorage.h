@@ -0,0 +1,138 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines MappedEventLogStorage, which keeps the event
+ *      buffers of EventManagement in a memory-mapped file so that
+ *      events survive a restart.
+ */
+
+#pragma once
+
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @brief
+ *   Provides the storage of the EventManagement buffers from a memory-mapped file.
+ *
+ * Events are written to and read from the mapping directly, so reports are still built without copying the events.  At
+ * most CHIP_CONFIG_EVENT_LOGGING_STORAGE_SYNC_INTERVAL after a change, the write-back of the mapping to the file is
+ * started, and the position of the data of each buffer is recorded in a header at the start of the file, which is
+ * written synchronously.  Only the header is waited for, so the event loop does not block on writing the events; as the
+ * events may then reach the file after the header, the events restored from the file are checked, and those that are not
+ * intact are dropped.
+ *
+ * The header also records when the system time of the run was zero, so that restored events with a system timestamp
+ * get an epoch timestamp instead.
+ *
+ * Usage:
+ *   1. Init() with the size and priority of each buffer; it sets the mpBuffer of each LogStorageResources.
+ *   2. EventManagement::Init() with those resources.
+ *   3. Restore() to take over the events found in the file.
+ *
+ * A file whose layout does not match the requested buffers is reset.
+ */
+class MappedEventLogStorage : public EventLogPersistenceDelegate
+{
+public:
+    MappedEventLogStorage() = default;
+    ~MappedEventLogStorage() override { Shutdown(); }
+
+    MappedEventLogStorage(const MappedEventLogStorage &) = delete;
+    MappedEventLogStorage & operator=(const MappedEventLogStorage &) = delete;
+
+    /**
+     * @brief
+     *   Map the file at @p apPath, creating it if needed, and point each of @p apResources to its buffer in the mapping.
+     *   @p apResources are left untouched when this fails.
+     *
+     * @param[in]     apPath          Path of the file.
+     * @param[in,out] apResources     Priority and size of each buffer, ordered like for EventManagement::Init.
+     * @param[in]     aNumBuffers     Number of elements of @p apResources.
+     * @param[in]     apSystemLayer   Layer running the timer batching the flushes.
+     */
+    CHIP_ERROR Init(const char * apPath, LogStorageResources * apResources, uint32_t aNumBuffers, System::Layer * apSystemLayer);
+
+    /**
+     * @brief
+     *   Restore the events of the file into @p apBuffers, the buffers EventManagement was initialized with, and keep
+     *   the file up to date from then on.  Restored events with a system timestamp are handled as described for
+     *   EventManagement::LoadRestoredEvents.
+     *
+     * @retval #CHIP_ERROR_INTEGRITY_CHECK_FAILED Some stored events were dropped; the storage is usable nonetheless.
+     */
+    CHIP_ERROR Restore(EventManagement & aEventManagement, CircularEventBuffer * apBuffers);
+
+    /**
+     * @brief
+     *   Flush the mapping to the file and unmap it.  EventManagement must not use the buffers afterwards.
+     */
+    void Shutdown();
+
+    void OnEventLogChanged() override;
+
+private:
+    static constexpr uint32_t kMagic   = 0x4d45564c; // "MEVL"
+    static constexpr uint16_t kVersion = 2;
+
+    struct BufferHeader
+    {
+        uint32_t mSize;
+        uint32_t mHeadOffset;
+        uint32_t mDataLength;
+        uint8_t mPriority;
+        uint8_t mReserved[3];
+    };
+
+    struct FileHeader
+    {
+        uint32_t mMagic;
+        uint16_t mVersion;
+        uint16_t mNumBuffers;
+        uint64_t mSystemTimeEpoch; // Epoch time, in milliseconds, of system time zero; 0 when unknown.
+        BufferHeader mBuffers[kNumPriorityLevel];
+    };
+
+    static void SyncTimerHandler(System::Layer * apSystemLayer, void * apAppState);
+    FileHeader * GetHeader() const { return reinterpret_cast<FileHeader *>(mpMapping); }
+    bool IsLayoutValid(const LogStorageResources * apResources, uint32_t aNumBuffers) const;
+    void Flush(int aDataFlags);
+    bool Sync(void * apStart, size_t aLength, int aFlags);
+
+    int mFd                             = -1;
+    uint8_t * mpMapping                 = nullptr;
+    size_t mMappingSize                 = 0;
+    uint32_t mNumBuffers                = 0;
+    CircularEventBuffer * mpBuffers     = nullptr;
+    EventManagement * mpEventManagement = nullptr;
+    System::Layer * mpSystemLayer       = nullptr;
+    bool mSyncPending                   = false;
+};
+
+} // namespace app
+} // namespace chip
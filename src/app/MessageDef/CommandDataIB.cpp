@@ -73,6 +73,19 @@ CHIP_ERROR CommandDataIB::Parser::CheckSchemaValidity() const
             ReturnErrorOnFailure(CheckIMPayload(reader, 0, "CommandFields"));
             PRETTY_PRINT_DECDEPTH();
             break;
+        case to_underlying(Tag::kRef):
+            // check if this tag has appeared before
+            VerifyOrReturnError(!(tagPresenceMask & (1 << to_underlying(Tag::kRef))), CHIP_ERROR_INVALID_TLV_TAG);
+            tagPresenceMask |= (1 << to_underlying(Tag::kRef));
+            VerifyOrReturnError(TLV::kTLVType_UnsignedInteger == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+#if CHIP_DETAIL_LOGGING
+            {
+                uint16_t ref;
+                ReturnErrorOnFailure(reader.Get(ref));
+                PRETTY_PRINT("\tRef = 0x%x,", ref);
+            }
+#endif // CHIP_DETAIL_LOGGING
+            break;
         default:
             PRETTY_PRINT("Unknown tag num %" PRIu32, tagNum);
             break;
@@ -106,12 +119,26 @@ CHIP_ERROR CommandDataIB::Parser::GetFields(TLV::TLVReader * const apReader) con
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandDataIB::Parser::GetRef(uint16_t * const apRef) const
+{
+    return GetUnsignedInteger(to_underlying(Tag::kRef), apRef);
+}
+
 CommandPathIB::Builder & CommandDataIB::Builder::CreatePath()
 {
     mError = mPath.Init(mpWriter, to_underlying(Tag::kPath));
     return mPath;
 }
 
+CommandDataIB::Builder & CommandDataIB::Builder::Ref(const uint16_t aRef)
+{
+    if (mError == CHIP_NO_ERROR)
+    {
+        mError = mpWriter->Put(TLV::ContextTag(to_underlying(Tag::kRef)), aRef);
+    }
+    return *this;
+}
+
 CommandDataIB::Builder & CommandDataIB::Builder::EndOfCommandDataIB()
 {
     EndOfContainer();
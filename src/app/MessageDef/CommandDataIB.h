@@ -37,6 +37,7 @@ enum class Tag : uint8_t
 {
     kPath   = 0,
     kFields = 1,
+    kRef    = 2,
 };
 
 class Parser : public StructParser
@@ -79,6 +80,17 @@ public:
      *          #CHIP_END_OF_TLV if there is no such element
      */
     CHIP_ERROR GetFields(TLV::TLVReader * const apReader) const;
+
+    /**
+     *  @brief Get the Ref, identifying the command among the commands of an InvokeRequest.
+     *
+     *  @param [in] apRef    A pointer to apRef
+     *
+     *  @return #CHIP_NO_ERROR on success
+     *          #CHIP_ERROR_WRONG_TLV_TYPE if there is such element but it's not any of the defined unsigned integer types
+     *          #CHIP_END_OF_TLV if there is no such element
+     */
+    CHIP_ERROR GetRef(uint16_t * const apRef) const;
 };
 
 class Builder : public StructBuilder
@@ -91,6 +103,15 @@ public:
      */
     CommandPathIB::Builder & CreatePath();
 
+    /**
+     *  @brief Inject the Ref into the TLV stream, to identify the command among the commands of an InvokeRequest.
+     *
+     *  @param [in] aRef The reference of the command, unique within the InvokeRequest.
+     *
+     *  @return A reference to *this
+     */
+    CommandDataIB::Builder & Ref(const uint16_t aRef);
+
     /**
      *  @brief Mark the end of this CommandDataIB
      *
@@ -75,6 +75,19 @@ CHIP_ERROR CommandStatusIB::Parser::CheckSchemaValidity() const
                 PRETTY_PRINT_DECDEPTH();
             }
             break;
+        case to_underlying(Tag::kRef):
+            // check if this tag has appeared before
+            VerifyOrReturnError(!(tagPresenceMask & (1 << to_underlying(Tag::kRef))), CHIP_ERROR_INVALID_TLV_TAG);
+            tagPresenceMask |= (1 << to_underlying(Tag::kRef));
+            VerifyOrReturnError(TLV::kTLVType_UnsignedInteger == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+#if CHIP_DETAIL_LOGGING
+            {
+                uint16_t ref;
+                ReturnErrorOnFailure(reader.Get(ref));
+                PRETTY_PRINT("\tRef = 0x%x,", ref);
+            }
+#endif // CHIP_DETAIL_LOGGING
+            break;
         default:
             PRETTY_PRINT("Unknown tag num %" PRIu32, tagNum);
             break;
@@ -109,6 +122,11 @@ CHIP_ERROR CommandStatusIB::Parser::GetErrorStatus(StatusIB::Parser * const apEr
     return apErrorStatus->Init(reader);
 }
 
+CHIP_ERROR CommandStatusIB::Parser::GetRef(uint16_t * const apRef) const
+{
+    return GetUnsignedInteger(to_underlying(Tag::kRef), apRef);
+}
+
 CommandPathIB::Builder & CommandStatusIB::Builder::CreatePath()
 {
     if (mError == CHIP_NO_ERROR)
@@ -127,6 +145,15 @@ StatusIB::Builder & CommandStatusIB::Builder::CreateErrorStatus()
     return mErrorStatus;
 }
 
+CommandStatusIB::Builder & CommandStatusIB::Builder::Ref(const uint16_t aRef)
+{
+    if (mError == CHIP_NO_ERROR)
+    {
+        mError = mpWriter->Put(TLV::ContextTag(to_underlying(Tag::kRef)), aRef);
+    }
+    return *this;
+}
+
 CommandStatusIB::Builder & CommandStatusIB::Builder::EndOfCommandStatusIB()
 {
     EndOfContainer();
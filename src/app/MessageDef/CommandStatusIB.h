@@ -37,6 +37,7 @@ enum class Tag : uint8_t
 {
     kPath        = 0,
     kErrorStatus = 1,
+    kRef         = 2,
 };
 
 class Parser : public StructParser
@@ -80,6 +81,17 @@ public:
      *          #CHIP_END_OF_TLV if there is no such element
      */
     CHIP_ERROR GetErrorStatus(StatusIB::Parser * const apErrorStatus) const;
+
+    /**
+     *  @brief Get the Ref of the command this status is for, as found in its CommandDataIB.
+     *
+     *  @param [in] apRef    A pointer to apRef
+     *
+     *  @return #CHIP_NO_ERROR on success
+     *          #CHIP_ERROR_WRONG_TLV_TYPE if there is such element but it's not any of the defined unsigned integer types
+     *          #CHIP_END_OF_TLV if there is no such element
+     */
+    CHIP_ERROR GetRef(uint16_t * const apRef) const;
 };
 
 class Builder : public StructBuilder
@@ -99,6 +111,15 @@ public:
      */
     StatusIB::Builder & CreateErrorStatus();
 
+    /**
+     *  @brief Inject the Ref of the command this status is for into the TLV stream.
+     *
+     *  @param [in] aRef The Ref found in the CommandDataIB of the command.
+     *
+     *  @return A reference to *this
+     */
+    CommandStatusIB::Builder & Ref(const uint16_t aRef);
+
     /**
      *  @brief Mark the end of this CommandStatusIB
      *
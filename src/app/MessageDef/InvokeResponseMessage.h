@@ -33,8 +33,9 @@ namespace app {
 namespace InvokeResponseMessage {
 enum class Tag : uint8_t
 {
-    kSuppressResponse = 0,
-    kInvokeResponses  = 1,
+    kSuppressResponse    = 0,
+    kInvokeResponses     = 1,
+    kMoreChunkedMessages = 2,
 };
 
 class Parser : public MessageParser
@@ -74,6 +75,17 @@ public:
      *          #CHIP_END_OF_TLV if there is no such element
      */
     CHIP_ERROR GetInvokeResponses(InvokeResponseIBs::Parser * const apInvokeResponses) const;
+
+    /**
+     *  @brief Check whether more InvokeResponse messages follow this one in the transaction. Next() must be called before
+     *  accessing them.
+     *
+     *  @param [in] apMoreChunkedMessages   A pointer to apMoreChunkedMessages
+     *
+     *  @return #CHIP_NO_ERROR on success
+     *          #CHIP_END_OF_TLV if there is no such element
+     */
+    CHIP_ERROR GetMoreChunkedMessages(bool * const apMoreChunkedMessages) const;
 };
 
 class Builder : public MessageBuilder
@@ -99,6 +111,14 @@ public:
      */
     InvokeResponseIBs::Builder & GetInvokeResponses() { return mInvokeResponses; }
 
+    /**
+     *  @brief This flag is set to 'true' when the responses to the InvokeRequest did not fit in this message, and more
+     *  InvokeResponse messages follow.
+     *  @param [in] aMoreChunkedMessages The boolean variable to indicate if there are more chunked messages in a transaction.
+     *  @return A reference to *this
+     */
+    InvokeResponseMessage::Builder & MoreChunkedMessages(const bool aMoreChunkedMessages);
+
     /**
      *  @brief Mark the end of this InvokeResponseMessage
      *
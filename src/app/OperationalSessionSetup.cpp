@@ -308,6 +308,14 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error)
     VerifyOrReturn(mState != State::Uninitialized && mState != State::NeedsAddress,
                    ChipLogError(Controller, "HandleCASEConnectionFailure was called while the device was not initialized"));
 
+    // The peer may have moved: do not let the next lookup of its address be answered from a cache.
+    auto const * fabricInfo = mFabricTable->FindFabricWithIndex(mPeerId.GetFabricIndex());
+    if (fabricInfo != nullptr)
+    {
+        PeerId peerId(fabricInfo->GetCompressedFabricId(), mPeerId.GetNodeId());
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerValid(peerId);
+    }
+
     DequeueConnectionCallbacks(error);
     // Do not touch `this` instance anymore; it has been destroyed in DequeueConnectionCallbacks.
 }
@@ -822,6 +822,7 @@ void ReadClient::CancelResubscribeTimer()
 {
     InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer()->CancelTimer(
         OnResubscribeTimerCallback, this);
+    InteractionModelEngine::GetInstance()->GetResubscriptionScheduler().CancelAdmission(this);
 }
 
 void ReadClient::OnLivenessTimeoutCallback(System::Layer * apSystemLayer, void * apAppState)
@@ -1070,12 +1071,21 @@ void ReadClient::OnResubscribeTimerCallback(System::Layer * apSystemLayer, void
     ReadClient * const _this = static_cast<ReadClient *>(apAppState);
     VerifyOrDie(_this != nullptr);
 
+    //
+    // Rather than re-subscribing right away, go through the process-wide scheduler so that all the clients
+    // re-subscribing at the same time do not flood the network.
+    //
+    InteractionModelEngine::GetInstance()->GetResubscriptionScheduler().RequestAdmission(_this);
+}
+
+void ReadClient::OnResubscriptionAdmitted()
+{
     CHIP_ERROR err;
 
-    ChipLogProgress(DataManagement, "OnResubscribeTimerCallback: DoCASE = %d", _this->mDoCaseOnNextResub);
-    _this->mNumRetries++;
+    ChipLogProgress(DataManagement, "OnResubscriptionAdmitted: DoCASE = %d", mDoCaseOnNextResub);
+    mNumRetries++;
 
-    if (_this->mDoCaseOnNextResub)
+    if (mDoCaseOnNextResub)
     {
         auto * caseSessionManager = InteractionModelEngine::GetInstance()->GetCASESessionManager();
         VerifyOrExit(caseSessionManager != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
@@ -1088,17 +1098,16 @@ void ReadClient::OnResubscribeTimerCallback(System::Layer * apSystemLayer, void
         // Doing so will ensure that the subsequent call to FindOrEstablishSession will not bind to
         // an existing established session but rather trigger establishing a new one.
         //
-        if (_this->mReadPrepareParams.mSessionHolder)
+        if (mReadPrepareParams.mSessionHolder)
         {
-            _this->mReadPrepareParams.mSessionHolder->AsSecureSession()->MarkAsDefunct();
+            mReadPrepareParams.mSessionHolder->AsSecureSession()->MarkAsDefunct();
         }
 
-        caseSessionManager->FindOrEstablishSession(_this->mPeer, &_this->mOnConnectedCallback,
-                                                   &_this->mOnConnectionFailureCallback);
+        caseSessionManager->FindOrEstablishSession(mPeer, &mOnConnectedCallback, &mOnConnectionFailureCallback);
         return;
     }
 
-    err = _this->SendSubscribeRequest(_this->mReadPrepareParams);
+    err = SendSubscribeRequest(mReadPrepareParams);
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -1109,7 +1118,7 @@ exit:
         //
         // In that case, don't permit re-subscription to occur.
         //
-        _this->Close(err, err != CHIP_ERROR_INCORRECT_STATE);
+        Close(err, err != CHIP_ERROR_INCORRECT_STATE);
     }
 }
 
@@ -394,7 +394,9 @@ public:
 
 private:
     friend class TestReadInteraction;
+    friend class TestResubscriptionScheduler;
     friend class InteractionModelEngine;
+    friend class ResubscriptionScheduler;
 
     enum class ClientState : uint8_t
     {
@@ -463,6 +465,12 @@ private:
     CHIP_ERROR SendSubscribeRequestImpl(const ReadPrepareParams & aSubscribePrepareParams);
     void UpdateDataVersionFilters(const ConcreteDataAttributePath & aPath);
     static void OnResubscribeTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+
+    /*
+     * Called by the ResubscriptionScheduler once the re-subscription that was due is admitted, to establish CASE
+     * if needed and send the SubscribeRequest.
+     */
+    void OnResubscriptionAdmitted();
     // Called to ensure OnReportBegin is called before calling OnEventData or OnAttributeData
     void NoteReportingData();
 
@@ -509,6 +517,11 @@ private:
     ReadClient * mpNext                 = nullptr;
     InteractionModelEngine * mpImEngine = nullptr;
 
+    // Link and state of the client in the queues of the ResubscriptionScheduler.
+    ReadClient * mpNextResubscription = nullptr;
+    System::Clock::Timestamp mResubscriptionRequestTime;
+    bool mWaitingForResubscriptionAdmission = false;
+
     //
     // This stores the params associated with the interaction in a specific set of cases:
     //      1. Stores all parameters when used with subscriptions initiated using SendAutoResubscribeRequest.
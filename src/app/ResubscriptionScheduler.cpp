@@ -0,0 +1,272 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ResubscriptionScheduler.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+System::Layer * GetSystemLayer()
+{
+    return InteractionModelEngine::GetInstance()->GetExchangeManager()->GetSessionManager()->SystemLayer();
+}
+
+} // namespace
+
+void ResubscriptionScheduler::Init()
+{
+    mTokens         = mBurst;
+    mLastRefillTime = System::SystemClock().GetMonotonicTimestamp();
+    mMetrics        = Metrics();
+}
+
+void ResubscriptionScheduler::Shutdown()
+{
+    GetSystemLayer()->CancelTimer(OnAdmissionTimerCallback, this);
+
+    //
+    // The subscriptions have been shut down by now, so this should not find any client, but make sure none is left
+    // pointing into the queues.
+    //
+    for (size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        while (mpQueueHead[priority] != nullptr)
+        {
+            Unlink(mpQueueHead[priority], nullptr, priority);
+        }
+    }
+}
+
+void ResubscriptionScheduler::SetAdmissionLimit(uint16_t aBurst, System::Clock::Milliseconds32 aInterval)
+{
+    mBurst          = aBurst;
+    mTokens         = aBurst;
+    mInterval       = aInterval;
+    mLastRefillTime = System::SystemClock().GetMonotonicTimestamp();
+
+    // Clients may have been waiting for tokens that are now available.
+    AdmitPending();
+}
+
+void ResubscriptionScheduler::RequestAdmission(ReadClient * apReadClient)
+{
+    VerifyOrDie(apReadClient != nullptr);
+    VerifyOrReturn(!apReadClient->mWaitingForResubscriptionAdmission);
+
+    apReadClient->mResubscriptionRequestTime = System::SystemClock().GetMonotonicTimestamp();
+    Enqueue(apReadClient);
+    AdmitPending();
+}
+
+void ResubscriptionScheduler::CancelAdmission(ReadClient * apReadClient)
+{
+    VerifyOrReturn(apReadClient->mWaitingForResubscriptionAdmission);
+
+    for (size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        ReadClient * previous = nullptr;
+        for (ReadClient * client = mpQueueHead[priority]; client != nullptr; client = client->mpNextResubscription)
+        {
+            if (client == apReadClient)
+            {
+                Unlink(client, previous, priority);
+                return;
+            }
+            previous = client;
+        }
+    }
+}
+
+void ResubscriptionScheduler::AdmitPending()
+{
+    //
+    // Admitted clients are called back, and can in turn request or withdraw admissions: only the outermost call goes
+    // through the queues, and picks up the changes made by the callbacks.
+    //
+    VerifyOrReturn(!mAdmitting);
+    mAdmitting = true;
+
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    ReadClient * client;
+
+    RefillTokens(now);
+    while ((mBurst == 0 || mTokens > 0) && (client = PopNext()) != nullptr)
+    {
+        // Keep the peer, as the admitted client may be gone once called back.
+        ScopedNodeId peer = client->mPeer;
+
+        if (mBurst != 0)
+        {
+            mTokens--;
+        }
+        Admit(client, now);
+
+        while ((client = PopPeer(peer)) != nullptr)
+        {
+            mMetrics.mCoalescedCount++;
+            Admit(client, now);
+        }
+    }
+
+    mAdmitting = false;
+
+    if (mMetrics.mQueueDepth > 0)
+    {
+        // Out of tokens: try again once the next one is added.
+        System::Clock::Milliseconds64 elapsed = now - mLastRefillTime;
+        System::Clock::Milliseconds32 delay   = mInterval;
+        if (elapsed < mInterval)
+        {
+            delay = System::Clock::Milliseconds32(mInterval.count() - static_cast<uint32_t>(elapsed.count()));
+        }
+
+        CHIP_ERROR err = GetSystemLayer()->StartTimer(delay, OnAdmissionTimerCallback, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to start the re-subscription admission timer: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+}
+
+void ResubscriptionScheduler::Admit(ReadClient * apReadClient, System::Clock::Timestamp aNow)
+{
+    System::Clock::Milliseconds64 waitTime = aNow - apReadClient->mResubscriptionRequestTime;
+
+    mMetrics.mAdmittedCount++;
+    mMetrics.mTotalWaitTime += waitTime;
+    if (waitTime > mMetrics.mMaxWaitTime)
+    {
+        mMetrics.mMaxWaitTime = waitTime;
+    }
+
+    apReadClient->OnResubscriptionAdmitted();
+}
+
+void ResubscriptionScheduler::Enqueue(ReadClient * apReadClient)
+{
+    size_t priority = static_cast<size_t>(apReadClient->mReadPrepareParams.mResubscriptionPriority);
+    VerifyOrDie(priority < kPriorityCount);
+
+    apReadClient->mpNextResubscription               = nullptr;
+    apReadClient->mWaitingForResubscriptionAdmission = true;
+    if (mpQueueTail[priority] == nullptr)
+    {
+        mpQueueHead[priority] = apReadClient;
+    }
+    else
+    {
+        mpQueueTail[priority]->mpNextResubscription = apReadClient;
+    }
+    mpQueueTail[priority] = apReadClient;
+
+    mMetrics.mQueueDepth++;
+    if (mMetrics.mQueueDepth > mMetrics.mPeakQueueDepth)
+    {
+        mMetrics.mPeakQueueDepth = mMetrics.mQueueDepth;
+    }
+}
+
+ReadClient * ResubscriptionScheduler::PopNext()
+{
+    for (size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        ReadClient * client = mpQueueHead[priority];
+        if (client != nullptr)
+        {
+            Unlink(client, nullptr, priority);
+            return client;
+        }
+    }
+    return nullptr;
+}
+
+ReadClient * ResubscriptionScheduler::PopPeer(const ScopedNodeId & aPeer)
+{
+    for (size_t priority = 0; priority < kPriorityCount; priority++)
+    {
+        ReadClient * previous = nullptr;
+        for (ReadClient * client = mpQueueHead[priority]; client != nullptr; client = client->mpNextResubscription)
+        {
+            if (client->mPeer == aPeer)
+            {
+                Unlink(client, previous, priority);
+                return client;
+            }
+            previous = client;
+        }
+    }
+    return nullptr;
+}
+
+void ResubscriptionScheduler::Unlink(ReadClient * apReadClient, ReadClient * apPrevious, size_t aPriority)
+{
+    if (apPrevious == nullptr)
+    {
+        mpQueueHead[aPriority] = apReadClient->mpNextResubscription;
+    }
+    else
+    {
+        apPrevious->mpNextResubscription = apReadClient->mpNextResubscription;
+    }
+    if (mpQueueTail[aPriority] == apReadClient)
+    {
+        mpQueueTail[aPriority] = apPrevious;
+    }
+
+    apReadClient->mpNextResubscription               = nullptr;
+    apReadClient->mWaitingForResubscriptionAdmission = false;
+    mMetrics.mQueueDepth--;
+}
+
+void ResubscriptionScheduler::RefillTokens(System::Clock::Timestamp aNow)
+{
+    if (mBurst == 0 || mTokens >= mBurst || mInterval == System::Clock::kZero)
+    {
+        // The bucket is full: the next token is due a full interval after it is first used.
+        mTokens         = mBurst;
+        mLastRefillTime = aNow;
+        return;
+    }
+
+    uint64_t newTokens = (aNow - mLastRefillTime).count() / mInterval.count();
+    if (newTokens >= static_cast<uint64_t>(mBurst - mTokens))
+    {
+        mTokens         = mBurst;
+        mLastRefillTime = aNow;
+    }
+    else
+    {
+        mTokens = static_cast<uint16_t>(mTokens + newTokens);
+        mLastRefillTime += System::Clock::Milliseconds64(newTokens * mInterval.count());
+    }
+}
+
+void ResubscriptionScheduler::OnAdmissionTimerCallback(System::Layer * apSystemLayer, void * apAppState)
+{
+    ResubscriptionScheduler * const _this = static_cast<ResubscriptionScheduler *>(apAppState);
+    VerifyOrDie(_this != nullptr);
+
+    _this->AdmitPending();
+}
+
+} // namespace app
+} // namespace chip
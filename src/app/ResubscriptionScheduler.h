@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the scheduler admitting the re-subscriptions of all the ReadClients of the process.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+class ReadClient;
+
+/**
+ * Priority class of the re-subscriptions of a ReadClient: when re-subscriptions are throttled, clients of a higher
+ * priority are admitted first.
+ */
+enum class ResubscriptionPriority : uint8_t
+{
+    kHigh   = 0,
+    kNormal = 1,
+    kLow    = 2,
+};
+
+/**
+ * Process-wide admission control of the re-subscriptions.
+ *
+ * When the re-subscription of a ReadClient is due, the client requests admission from the scheduler before it
+ * re-establishes CASE and sends its SubscribeRequest.  The scheduler admits re-subscriptions against a token bucket,
+ * so that a controller losing all its subscriptions at once (on restart or after a network outage) does not
+ * re-establish all of them in the same instant, overloading itself, the network and the border routers.
+ *
+ * Clients waiting for admission are queued by priority, in order of arrival within a priority.  When a client is
+ * admitted, all the clients waiting to re-subscribe to the same peer are admitted along with it without using more
+ * tokens, as they share the session establishment with the peer.
+ */
+class ResubscriptionScheduler
+{
+public:
+    struct Metrics
+    {
+        // Clients currently waiting for admission, and highest count of them so far.
+        uint32_t mQueueDepth     = 0;
+        uint32_t mPeakQueueDepth = 0;
+        // Clients admitted, including those admitted along with another client to the same peer.
+        uint32_t mAdmittedCount  = 0;
+        uint32_t mCoalescedCount = 0;
+        // Time the admitted clients waited for admission.
+        System::Clock::Milliseconds64 mTotalWaitTime = System::Clock::kZero;
+        System::Clock::Milliseconds64 mMaxWaitTime   = System::Clock::kZero;
+    };
+
+    void Init();
+    void Shutdown();
+
+    /**
+     * Configure the token bucket: up to aBurst re-subscriptions are admitted at once, and a token is added every
+     * aInterval afterwards.  aBurst set to 0 disables admission control.
+     */
+    void SetAdmissionLimit(uint16_t aBurst, System::Clock::Milliseconds32 aInterval);
+
+    /**
+     * Request the admission of the re-subscription of a client.  The client is called back through
+     * ReadClient::OnResubscriptionAdmitted(), which can happen before this call returns.
+     */
+    void RequestAdmission(ReadClient * apReadClient);
+
+    /**
+     * Withdraw the admission request of a client, if it has any.
+     */
+    void CancelAdmission(ReadClient * apReadClient);
+
+    const Metrics & GetMetrics() const { return mMetrics; }
+
+private:
+    friend class TestResubscriptionScheduler;
+
+    static constexpr size_t kPriorityCount = 3;
+
+    void AdmitPending();
+    void Admit(ReadClient * apReadClient, System::Clock::Timestamp aNow);
+    void Enqueue(ReadClient * apReadClient);
+    ReadClient * PopNext();
+    ReadClient * PopPeer(const ScopedNodeId & aPeer);
+    void Unlink(ReadClient * apReadClient, ReadClient * apPrevious, size_t aPriority);
+    void RefillTokens(System::Clock::Timestamp aNow);
+    static void OnAdmissionTimerCallback(System::Layer * apSystemLayer, void * apAppState);
+
+    ReadClient * mpQueueHead[kPriorityCount] = {};
+    ReadClient * mpQueueTail[kPriorityCount] = {};
+
+    uint16_t mBurst                          = CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_BURST;
+    uint16_t mTokens                         = CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_BURST;
+    System::Clock::Milliseconds32 mInterval  = System::Clock::Milliseconds32(CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_INTERVAL_MS);
+    System::Clock::Timestamp mLastRefillTime = System::Clock::kZero;
+    bool mAdmitting                          = false;
+
+    Metrics mMetrics;
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,388 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmarks of the Interaction Model message builders and parsers,
+ *      of the cluster objects, and of their conversion to JSON.
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/MessageDef/InvokeRequestMessage.h>
+#include <app/MessageDef/ReportDataMessage.h>
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/benchmark/Benchmark.h>
+#include <lib/support/jsontlv/TlvJson.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using chip::Benchmark::DoNotOptimize;
+using chip::Benchmark::State;
+
+namespace {
+
+constexpr size_t kBufferSize           = 1280;
+constexpr EndpointId kEndpointId       = 1;
+constexpr uint32_t kAttributeCount     = 16;
+constexpr DataVersion kDataVersion     = 0x5a5a5a5a;
+constexpr SubscriptionId kSubscription = 0x1234;
+constexpr FabricIndex kFabricIndex     = 1;
+
+const uint64_t kSubjects[] = { 0x0102030405060708, 0x1112131415161718, 0x2122232425262728 };
+
+/**
+ * A report of the attributes 0 to kAttributeCount - 1 of the OnOff cluster, shaped like a priming report.
+ */
+CHIP_ERROR BuildReportData(TLV::TLVWriter & writer)
+{
+    ReportDataMessage::Builder report;
+
+    ReturnErrorOnFailure(report.Init(&writer));
+    report.SubscriptionId(kSubscription);
+    ReturnErrorOnFailure(report.GetError());
+
+    AttributeReportIBs::Builder & attributeReportIBs = report.CreateAttributeReportIBs();
+    ReturnErrorOnFailure(report.GetError());
+    for (uint32_t i = 0; i < kAttributeCount; i++)
+    {
+        AttributeReportIB::Builder & attributeReport = attributeReportIBs.CreateAttributeReport();
+        ReturnErrorOnFailure(attributeReportIBs.GetError());
+        AttributeDataIB::Builder & attributeData = attributeReport.CreateAttributeData();
+        ReturnErrorOnFailure(attributeReport.GetError());
+        attributeData.DataVersion(kDataVersion);
+        ReturnErrorOnFailure(
+            attributeData.CreatePath().Endpoint(kEndpointId).Cluster(OnOff::Id).Attribute(i).EndOfAttributePathIB().GetError());
+        ReturnErrorOnFailure(
+            DataModel::Encode(*attributeData.GetWriter(), TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kData)), i));
+        ReturnErrorOnFailure(attributeData.EndOfAttributeDataIB().GetError());
+        ReturnErrorOnFailure(attributeReport.EndOfAttributeReportIB().GetError());
+    }
+    ReturnErrorOnFailure(attributeReportIBs.EndOfAttributeReportIBs().GetError());
+
+    report.MoreChunkedMessages(false);
+    return report.EndOfReportDataMessage().GetError();
+}
+
+CHIP_ERROR ParseReportData(TLV::TLVReader & reader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    ReportDataMessage::Parser report;
+    AttributeReportIBs::Parser attributeReportIBs;
+    TLV::TLVReader attributeReportIBsReader;
+    SubscriptionId subscriptionId;
+
+    ReturnErrorOnFailure(report.Init(reader));
+    ReturnErrorOnFailure(report.GetSubscriptionId(&subscriptionId));
+    ReturnErrorOnFailure(report.GetAttributeReportIBs(&attributeReportIBs));
+    attributeReportIBs.GetReader(&attributeReportIBsReader);
+
+    while ((err = attributeReportIBsReader.Next()) == CHIP_NO_ERROR)
+    {
+        AttributeReportIB::Parser attributeReport;
+        AttributeDataIB::Parser attributeData;
+        AttributePathIB::Parser path;
+        TLV::TLVReader dataReader;
+        EndpointId endpoint;
+        ClusterId cluster;
+        AttributeId attribute;
+        DataVersion version;
+        uint32_t value;
+
+        ReturnErrorOnFailure(attributeReport.Init(attributeReportIBsReader));
+        ReturnErrorOnFailure(attributeReport.GetAttributeData(&attributeData));
+        ReturnErrorOnFailure(attributeData.GetPath(&path));
+        ReturnErrorOnFailure(path.GetEndpoint(&endpoint));
+        ReturnErrorOnFailure(path.GetCluster(&cluster));
+        ReturnErrorOnFailure(path.GetAttribute(&attribute));
+        ReturnErrorOnFailure(attributeData.GetDataVersion(&version));
+        ReturnErrorOnFailure(attributeData.GetData(&dataReader));
+        ReturnErrorOnFailure(DataModel::Decode(dataReader, value));
+        DoNotOptimize(value);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return report.ExitContainer();
+}
+
+LevelControl::Commands::MoveToLevel::Type MakeMoveToLevel()
+{
+    LevelControl::Commands::MoveToLevel::Type request;
+
+    request.level = 128;
+    request.transitionTime.SetNonNull(static_cast<uint16_t>(10));
+    request.optionsMask     = 1;
+    request.optionsOverride = 1;
+    return request;
+}
+
+CHIP_ERROR BuildInvokeRequest(TLV::TLVWriter & writer)
+{
+    InvokeRequestMessage::Builder invokeRequest;
+    auto request = MakeMoveToLevel();
+
+    ReturnErrorOnFailure(invokeRequest.Init(&writer));
+    invokeRequest.SuppressResponse(false).TimedRequest(false);
+    InvokeRequests::Builder & invokeRequests = invokeRequest.CreateInvokeRequests();
+    ReturnErrorOnFailure(invokeRequest.GetError());
+
+    CommandDataIB::Builder & commandData = invokeRequests.CreateCommandData();
+    ReturnErrorOnFailure(invokeRequests.GetError());
+    ReturnErrorOnFailure(commandData.CreatePath()
+                             .EndpointId(kEndpointId)
+                             .ClusterId(request.GetClusterId())
+                             .CommandId(request.GetCommandId())
+                             .EndOfCommandPathIB()
+                             .GetError());
+    ReturnErrorOnFailure(
+        DataModel::Encode(*commandData.GetWriter(), TLV::ContextTag(to_underlying(CommandDataIB::Tag::kFields)), request));
+    ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
+    ReturnErrorOnFailure(invokeRequests.EndOfInvokeRequests().GetError());
+
+    return invokeRequest.EndOfInvokeRequestMessage().GetError();
+}
+
+CHIP_ERROR ParseInvokeRequest(TLV::TLVReader & reader)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    InvokeRequestMessage::Parser invokeRequest;
+    InvokeRequests::Parser invokeRequests;
+    TLV::TLVReader invokeRequestsReader;
+    bool suppressResponse;
+    bool timedRequest;
+
+    ReturnErrorOnFailure(invokeRequest.Init(reader));
+    ReturnErrorOnFailure(invokeRequest.GetSuppressResponse(&suppressResponse));
+    ReturnErrorOnFailure(invokeRequest.GetTimedRequest(&timedRequest));
+    ReturnErrorOnFailure(invokeRequest.GetInvokeRequests(&invokeRequests));
+    invokeRequests.GetReader(&invokeRequestsReader);
+
+    while ((err = invokeRequestsReader.Next()) == CHIP_NO_ERROR)
+    {
+        CommandDataIB::Parser commandData;
+        CommandPathIB::Parser path;
+        TLV::TLVReader fieldsReader;
+        EndpointId endpoint;
+        ClusterId cluster;
+        CommandId command;
+        LevelControl::Commands::MoveToLevel::DecodableType request;
+
+        ReturnErrorOnFailure(commandData.Init(invokeRequestsReader));
+        ReturnErrorOnFailure(commandData.GetPath(&path));
+        ReturnErrorOnFailure(path.GetEndpointId(&endpoint));
+        ReturnErrorOnFailure(path.GetClusterId(&cluster));
+        ReturnErrorOnFailure(path.GetCommandId(&command));
+        ReturnErrorOnFailure(commandData.GetFields(&fieldsReader));
+        ReturnErrorOnFailure(DataModel::Decode(fieldsReader, request));
+        DoNotOptimize(request);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return invokeRequest.ExitContainer();
+}
+
+/**
+ * An ACL entry granting access to a few subjects on a few targets, the kind of fabric-scoped struct with nested lists
+ * that the controllers read and write the most.
+ */
+CHIP_ERROR EncodeAccessControlEntry(TLV::TLVWriter & writer)
+{
+    AccessControl::Structs::Target::Type targets[2];
+    AccessControl::Structs::AccessControlEntry::Type entry;
+
+    targets[0].cluster.SetNonNull(OnOff::Id);
+    targets[0].endpoint.SetNonNull(kEndpointId);
+    targets[1].deviceType.SetNonNull(0x0100);
+
+    entry.privilege = AccessControl::Privilege::kOperate;
+    entry.authMode  = AccessControl::AuthMode::kCase;
+    entry.subjects.SetNonNull(kSubjects);
+    entry.targets.SetNonNull(targets);
+    entry.fabricIndex = kFabricIndex;
+
+    return DataModel::EncodeForRead(writer, TLV::AnonymousTag(), kFabricIndex, entry);
+}
+
+/**
+ * A struct with a field of each of the common types.  Comparing builds with and without
+ * chip_cluster_objects_table_codec weighs the table-driven codec of the cluster objects against the unrolled one.
+ */
+CHIP_ERROR EncodeSimpleStruct(TLV::TLVWriter & writer)
+{
+    TestCluster::Structs::SimpleStruct::Type value;
+
+    value.a = 20;
+    value.b = true;
+    value.c = TestCluster::SimpleEnum::kValueB;
+    value.d = ByteSpan(reinterpret_cast<const uint8_t *>("bytes"), 5);
+    value.e = CharSpan::fromCharString("characters");
+    value.f = BitMask<TestCluster::SimpleBitmap>(TestCluster::SimpleBitmap::kValueC);
+    value.g = 1.5f;
+    value.h = 2.25;
+
+    return DataModel::Encode(writer, TLV::AnonymousTag(), value);
+}
+
+template <CHIP_ERROR (*Build)(TLV::TLVWriter & writer)>
+void BenchmarkBuild(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length = 0;
+
+    while (state.KeepRunning())
+    {
+        TLV::TLVWriter writer;
+        writer.Init(buffer);
+        if (Build(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to build the message");
+            return;
+        }
+        length = writer.GetLengthWritten();
+        DoNotOptimize(buffer);
+    }
+    state.SetBytesProcessed(state.Iterations() * length);
+    state.SetItemsProcessed(state.Iterations());
+}
+
+template <CHIP_ERROR (*Build)(TLV::TLVWriter & writer), CHIP_ERROR (*Parse)(TLV::TLVReader & reader)>
+void BenchmarkParse(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    TLV::TLVWriter writer;
+
+    writer.Init(buffer);
+    if (Build(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to build the message");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        TLV::TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        if (Parse(reader) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to parse the message");
+            return;
+        }
+    }
+    state.SetBytesProcessed(state.Iterations() * writer.GetLengthWritten());
+    state.SetItemsProcessed(state.Iterations());
+}
+
+CHIP_ERROR DecodeAccessControlEntry(TLV::TLVReader & reader)
+{
+    AccessControl::Structs::AccessControlEntry::DecodableType entry;
+
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(DataModel::Decode(reader, entry));
+    // The lists are decoded lazily; go through them like their consumers would.
+    VerifyOrReturnError(!entry.subjects.IsNull() && !entry.targets.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    auto subjects = entry.subjects.Value().begin();
+    while (subjects.Next())
+    {
+        DoNotOptimize(subjects.GetValue());
+    }
+    ReturnErrorOnFailure(subjects.GetStatus());
+    auto targets = entry.targets.Value().begin();
+    while (targets.Next())
+    {
+        DoNotOptimize(targets.GetValue());
+    }
+    return targets.GetStatus();
+}
+
+CHIP_ERROR DecodeSimpleStruct(TLV::TLVReader & reader)
+{
+    TestCluster::Structs::SimpleStruct::DecodableType value;
+
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(DataModel::Decode(reader, value));
+    DoNotOptimize(value);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ConvertToJson(TLV::TLVReader & reader)
+{
+    Json::Value json;
+
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(TlvToJson(reader, json));
+    DoNotOptimize(json);
+    return CHIP_NO_ERROR;
+}
+
+void BenchmarkReportDataBuild(State & state)
+{
+    BenchmarkBuild<BuildReportData>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkReportDataBuild)
+
+void BenchmarkReportDataParse(State & state)
+{
+    BenchmarkParse<BuildReportData, ParseReportData>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkReportDataParse)
+
+void BenchmarkInvokeRequestBuild(State & state)
+{
+    BenchmarkBuild<BuildInvokeRequest>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkInvokeRequestBuild)
+
+void BenchmarkInvokeRequestParse(State & state)
+{
+    BenchmarkParse<BuildInvokeRequest, ParseInvokeRequest>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkInvokeRequestParse)
+
+void BenchmarkAccessControlEntryEncode(State & state)
+{
+    BenchmarkBuild<EncodeAccessControlEntry>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkAccessControlEntryEncode)
+
+void BenchmarkAccessControlEntryDecode(State & state)
+{
+    BenchmarkParse<EncodeAccessControlEntry, DecodeAccessControlEntry>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkAccessControlEntryDecode)
+
+void BenchmarkSimpleStructEncode(State & state)
+{
+    BenchmarkBuild<EncodeSimpleStruct>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkSimpleStructEncode)
+
+void BenchmarkSimpleStructDecode(State & state)
+{
+    BenchmarkParse<EncodeSimpleStruct, DecodeSimpleStruct>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkSimpleStructDecode)
+
+void BenchmarkTlvToJson(State & state)
+{
+    BenchmarkParse<EncodeAccessControlEntry, ConvertToJson>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkTlvToJson)
+
+} // namespace
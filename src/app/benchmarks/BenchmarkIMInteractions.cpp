@@ -0,0 +1,704 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      End-to-end benchmarks of the Interaction Model reads, subscriptions, writes and invokes, between two nodes of the
+ *      same process connected by the loopback transport, against the mock data model.
+ *
+ *      Each iteration runs one interaction on each of `concurrency` slots at once, and waits for all of them to complete.
+ *      Along with the throughput of the interactions, the benchmarks report the median and 99th percentile of their
+ *      latency, and the heap allocations and CPU time they take.
+ *
+ *      Parameters, given as --benchmark_param=<name>=<value>:
+ *        concurrency     Interactions run at once (default 4), up to the handlers the node has for them.
+ *        payload_size    Size of the octet strings read, reported, written and echoed by the commands (default 16).
+ *        path_count      Attributes read, subscribed to or written by each interaction (default 1).
+ *        loss_per_mille  Share of the messages the loopback transport drops, in thousandths (default 0).
+ */
+
+#include <app/AttributeAccessInterface.h>
+#include <app/CommandHandler.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/WriteClient.h>
+#include <app/WriteHandler.h>
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/mock/Constants.h>
+#include <app/util/mock/Functions.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/Optional.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/benchmark/Benchmark.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using chip::Benchmark::State;
+using chip::Protocols::InteractionModel::Status;
+using chip::Test::AppContext;
+
+// See the note in AttributePathExpandIterator.cpp: these are provided by the mock data model.
+extern uint16_t emberAfEndpointCount(void);
+extern uint8_t emberAfClusterCount(EndpointId endpoint, bool server);
+extern uint16_t emberAfGetServerAttributeCount(chip::EndpointId endpoint, chip::ClusterId cluster);
+extern uint16_t emberAfGetServerAttributeIndexByAttributeId(chip::EndpointId endpoint, chip::ClusterId cluster,
+                                                            chip::AttributeId attributeId);
+extern chip::EndpointId emberAfEndpointFromIndex(uint16_t index);
+extern Optional<ClusterId> emberAfGetNthClusterId(chip::EndpointId endpoint, uint8_t n, bool server);
+extern Optional<AttributeId> emberAfGetServerAttributeIdByIndex(chip::EndpointId endpoint, chip::ClusterId cluster,
+                                                                uint16_t attributeIndex);
+
+namespace {
+
+constexpr size_t kMaxPayloadSize                     = 1024;
+constexpr EndpointId kEchoEndpointId                 = Test::kMockEndpoint1;
+constexpr ClusterId kEchoClusterId                   = Test::MockClusterId(1);
+constexpr CommandId kEchoCommandId                   = 1;
+constexpr uint16_t kMaxIntervalCeilingSeconds        = 60;
+constexpr System::Clock::Timeout kIterationTimeout   = System::Clock::Seconds16(30);
+constexpr uint64_t kDefaultConcurrency               = 4;
+constexpr uint64_t kDefaultPayloadSize               = 16;
+constexpr uint64_t kDefaultPathCount                 = 1;
+constexpr uint64_t kDefaultLossPerMille              = 0;
+constexpr size_t kMaxExchangesPerInteraction         = 2;
+constexpr size_t kMaxConcurrencyForExchanges         = CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / kMaxExchangesPerInteraction;
+constexpr System::Clock::Microseconds64 kNoStartTime = System::Clock::Microseconds64(0);
+constexpr uint8_t kEchoPayloadTag                    = 0;
+constexpr double kPercentilesForLatency[]            = { 50, 99 };
+constexpr const char * kLatencyCounterNames[]        = { "p50_us", "p99_us" };
+static_assert(ArraySize(kPercentilesForLatency) == ArraySize(kLatencyCounterNames), "One counter name per percentile");
+
+// The octet string the data model serves, and the commands echo: its size is the payload_size parameter.
+uint8_t gPayload[kMaxPayloadSize];
+size_t gPayloadSize = 0;
+
+ByteSpan GetPayload()
+{
+    return ByteSpan(gPayload, gPayloadSize);
+}
+
+/**
+ * The request and response of the command the data model echoes, carrying an octet string.
+ */
+struct EchoCommand
+{
+    static constexpr bool kIsFabricScoped = false;
+
+    static constexpr ClusterId GetClusterId() { return kEchoClusterId; }
+    static constexpr CommandId GetCommandId() { return kEchoCommandId; }
+    static constexpr bool MustUseTimedInvoke() { return false; }
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+    {
+        TLV::TLVType outer;
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+        ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(kEchoPayloadTag), payload));
+        return writer.EndContainer(outer);
+    }
+
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        TLV::TLVType outer;
+        VerifyOrReturnError(reader.GetType() == TLV::kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+        ReturnErrorOnFailure(reader.EnterContainer(outer));
+        ReturnErrorOnFailure(reader.Next(TLV::ContextTag(kEchoPayloadTag)));
+        ReturnErrorOnFailure(DataModel::Decode(reader, payload));
+        return reader.ExitContainer(outer);
+    }
+
+    ByteSpan payload;
+};
+
+/**
+ * Whether the mock data model serves the attribute as an octet string of the payload, rather than as its own value.
+ */
+bool IsPayloadAttribute(const ConcreteAttributePath & aPath)
+{
+    return aPath.mEndpointId >= Test::kMockEndpointMin && !IsGlobalAttribute(aPath.mAttributeId) &&
+        emberAfGetServerAttributeIndexByAttributeId(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId) != UINT16_MAX;
+}
+
+/**
+ * The first pathCount of the payload attributes of the mock data model, going around them again if needed.
+ */
+std::vector<AttributePathParams> GetPayloadAttributePaths(size_t pathCount)
+{
+    std::vector<AttributePathParams> attributes;
+    std::vector<AttributePathParams> paths;
+
+    for (uint16_t endpointIndex = 0; endpointIndex < emberAfEndpointCount(); endpointIndex++)
+    {
+        EndpointId endpoint = emberAfEndpointFromIndex(endpointIndex);
+        for (uint8_t clusterIndex = 0; clusterIndex < emberAfClusterCount(endpoint, true); clusterIndex++)
+        {
+            ClusterId cluster = emberAfGetNthClusterId(endpoint, clusterIndex, true).Value();
+            for (uint16_t attributeIndex = 0; attributeIndex < emberAfGetServerAttributeCount(endpoint, cluster); attributeIndex++)
+            {
+                AttributeId attribute = emberAfGetServerAttributeIdByIndex(endpoint, cluster, attributeIndex).Value();
+                if (!IsGlobalAttribute(attribute))
+                {
+                    attributes.push_back(AttributePathParams(endpoint, cluster, attribute));
+                }
+            }
+        }
+    }
+
+    VerifyOrDie(!attributes.empty());
+    for (size_t i = 0; i < pathCount; i++)
+    {
+        paths.push_back(attributes[i % attributes.size()]);
+    }
+    return paths;
+}
+
+System::Clock::Microseconds64 Now()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64();
+}
+
+/**
+ * The parameters of a run, out of the command line.
+ */
+struct Config
+{
+    size_t mConcurrency;
+    size_t mPathCount;
+    uint32_t mLossPerMille;
+};
+
+bool LoadConfig(State & state, size_t maxConcurrency, Config & config)
+{
+    uint64_t concurrency  = Benchmark::GetParameter("concurrency", kDefaultConcurrency);
+    uint64_t payloadSize  = Benchmark::GetParameter("payload_size", kDefaultPayloadSize);
+    uint64_t pathCount    = Benchmark::GetParameter("path_count", kDefaultPathCount);
+    uint64_t lossPerMille = Benchmark::GetParameter("loss_per_mille", kDefaultLossPerMille);
+
+    if (concurrency == 0 || concurrency > std::min(maxConcurrency, kMaxConcurrencyForExchanges))
+    {
+        state.SkipWithError("concurrency is out of the range the node supports");
+        return false;
+    }
+    if (payloadSize > kMaxPayloadSize)
+    {
+        state.SkipWithError("payload_size is too large");
+        return false;
+    }
+    if (pathCount == 0 || pathCount > InteractionModelEngine::kMinSupportedPathsPerReadRequest)
+    {
+        state.SkipWithError("path_count is out of the range the node supports");
+        return false;
+    }
+    if (lossPerMille >= 1000)
+    {
+        state.SkipWithError("loss_per_mille must be lower than 1000");
+        return false;
+    }
+
+    config.mConcurrency  = static_cast<size_t>(concurrency);
+    config.mPathCount    = static_cast<size_t>(pathCount);
+    config.mLossPerMille = static_cast<uint32_t>(lossPerMille);
+
+    gPayloadSize = static_cast<size_t>(payloadSize);
+    for (size_t i = 0; i < gPayloadSize; i++)
+    {
+        gPayload[i] = static_cast<uint8_t>(i);
+    }
+    return true;
+}
+
+/**
+ * Latencies and outcomes of the interactions of a run.
+ */
+class Recorder
+{
+public:
+    void Reserve(size_t count) { mLatencies.reserve(count); }
+
+    void OnStarted() { mPendingCount++; }
+    void OnCompleted(System::Clock::Microseconds64 startTime, bool success)
+    {
+        VerifyOrDie(mPendingCount > 0);
+        mPendingCount--;
+        mLatencies.push_back(Now() - startTime);
+        if (!success)
+        {
+            mFailureCount++;
+        }
+    }
+
+    size_t GetPendingCount() const { return mPendingCount; }
+
+    void Report(State & state, uint64_t allocationCount)
+    {
+        uint64_t count = mLatencies.size();
+        VerifyOrReturn(count > 0);
+
+        std::sort(mLatencies.begin(), mLatencies.end());
+        for (size_t i = 0; i < ArraySize(kPercentilesForLatency); i++)
+        {
+            size_t index = std::min(static_cast<size_t>(static_cast<double>(count) * kPercentilesForLatency[i] / 100),
+                                    static_cast<size_t>(count - 1));
+            state.SetCounter(kLatencyCounterNames[i], static_cast<double>(mLatencies[index].count()));
+        }
+
+        state.SetItemsProcessed(count);
+        state.SetCounter("cpu_us_per_interaction", static_cast<double>(state.GetCpuTimeNs()) / 1e3 / static_cast<double>(count));
+        state.SetCounter("failure_rate", static_cast<double>(mFailureCount) / static_cast<double>(count));
+        if (Benchmark::IsAllocationCountingSupported())
+        {
+            state.SetCounter("allocs_per_interaction", static_cast<double>(allocationCount) / static_cast<double>(count));
+        }
+    }
+
+private:
+    std::vector<System::Clock::Microseconds64> mLatencies;
+    size_t mPendingCount = 0;
+    size_t mFailureCount = 0;
+};
+
+/**
+ * The stack of the two nodes, and the state of a run over it.
+ */
+class Fixture
+{
+public:
+    bool Init(State & state, size_t maxConcurrency)
+    {
+        if (!LoadConfig(state, maxConcurrency, mConfig))
+        {
+            return false;
+        }
+        if (mContext.Init() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to initialize the stack");
+            return false;
+        }
+        mPaths = GetPayloadAttributePaths(mConfig.mPathCount);
+        return true;
+    }
+
+    void Shutdown()
+    {
+        // Let the work scheduled by the interactions run, as the engine stays around for the next run.
+        mContext.DrainAndServiceIO();
+        mContext.Shutdown();
+    }
+
+    /**
+     * Run the iterations of the benchmark: each calls start(slot) for all the slots, and waits for the interactions
+     * started to complete, along with their exchanges.
+     */
+    template <typename StartFunction>
+    void Run(State & state, StartFunction start)
+    {
+        auto & exchangeManager = mContext.GetExchangeManager();
+        uint64_t allocationCount;
+
+        mRecorder.Reserve(static_cast<size_t>(state.Iterations()) * mConfig.mConcurrency);
+        mContext.GetLoopback().mMessageLossPerMille = mConfig.mLossPerMille;
+        allocationCount                             = Benchmark::GetAllocationCount();
+
+        while (state.KeepRunning())
+        {
+            for (size_t slot = 0; slot < mConfig.mConcurrency; slot++)
+            {
+                if (start(slot) != CHIP_NO_ERROR)
+                {
+                    state.SkipWithError("Failed to start an interaction");
+                    break;
+                }
+            }
+
+            mContext.GetIOContext().DriveIOUntil(kIterationTimeout, [&]() {
+                return mRecorder.GetPendingCount() == 0 && exchangeManager.GetNumActiveExchanges() == 0;
+            });
+            if (mRecorder.GetPendingCount() != 0)
+            {
+                state.SkipWithError("Interactions did not complete in time");
+            }
+        }
+
+        allocationCount                             = Benchmark::GetAllocationCount() - allocationCount;
+        mContext.GetLoopback().mMessageLossPerMille = 0;
+        if (state.GetErrorMessage() == nullptr)
+        {
+            mRecorder.Report(state, allocationCount);
+        }
+    }
+
+    AppContext mContext;
+    Config mConfig;
+    std::vector<AttributePathParams> mPaths;
+    Recorder mRecorder;
+};
+
+/**
+ * A slot running reads, or keeping a subscription and waiting for its reports.
+ */
+class ReadSlot : public ReadClient::Callback
+{
+public:
+    CHIP_ERROR Start(Fixture & fixture, ReadClient::InteractionType type)
+    {
+        ReadPrepareParams params(fixture.mContext.GetSessionBobToAlice());
+
+        params.mpAttributePathParamsList    = fixture.mPaths.data();
+        params.mAttributePathParamsListSize = fixture.mPaths.size();
+        if (type == ReadClient::InteractionType::Subscribe)
+        {
+            params.mMaxIntervalCeilingSeconds = kMaxIntervalCeilingSeconds;
+            params.mKeepSubscriptions         = true;
+        }
+
+        mClient.ClearValue();
+        mClient.Emplace(InteractionModelEngine::GetInstance(), &fixture.mContext.GetExchangeManager(), *this, type);
+        ExpectReport(fixture.mRecorder);
+
+        CHIP_ERROR err = mClient.Value().SendRequest(params);
+        if (err != CHIP_NO_ERROR)
+        {
+            mpRecorder->OnCompleted(mStartTime, false);
+            mStartTime = kNoStartTime;
+        }
+        return err;
+    }
+
+    void ExpectReport(Recorder & recorder)
+    {
+        mpRecorder = &recorder;
+        mStartTime = Now();
+        mSuccess   = true;
+        mpRecorder->OnStarted();
+    }
+
+    void Stop() { mClient.ClearValue(); }
+
+private:
+    void Complete()
+    {
+        if (mStartTime != kNoStartTime)
+        {
+            mpRecorder->OnCompleted(mStartTime, mSuccess);
+            mStartTime = kNoStartTime;
+        }
+    }
+
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        mSuccess = mSuccess && aStatus.IsSuccess() && apData != nullptr;
+    }
+
+    void OnReportEnd() override
+    {
+        // The reads complete with their OnDone, once they are done with their exchanges.
+        if (mClient.Value().IsSubscriptionType())
+        {
+            Complete();
+        }
+    }
+
+    void OnError(CHIP_ERROR aError) override { mSuccess = false; }
+    void OnDone(ReadClient * apReadClient) override
+    {
+        mSuccess = mSuccess && !apReadClient->IsSubscriptionType();
+        Complete();
+    }
+
+    Optional<ReadClient> mClient;
+    Recorder * mpRecorder                    = nullptr;
+    System::Clock::Microseconds64 mStartTime = kNoStartTime;
+    bool mSuccess                            = true;
+};
+
+class WriteSlot : public WriteClient::Callback
+{
+public:
+    CHIP_ERROR Start(Fixture & fixture)
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+
+        mpRecorder = &fixture.mRecorder;
+        mStartTime = Now();
+        mSuccess   = true;
+        mpRecorder->OnStarted();
+
+        mClient.ClearValue();
+        mClient.Emplace(&fixture.mContext.GetExchangeManager(), this, NullOptional);
+        for (const auto & path : fixture.mPaths)
+        {
+            SuccessOrExit(err = mClient.Value().EncodeAttribute(path, GetPayload()));
+        }
+        err = mClient.Value().SendWriteRequest(fixture.mContext.GetSessionBobToAlice());
+
+    exit:
+        if (err != CHIP_NO_ERROR)
+        {
+            mClient.ClearValue();
+            mpRecorder->OnCompleted(mStartTime, false);
+        }
+        return err;
+    }
+
+private:
+    void OnResponse(const WriteClient * apWriteClient, const ConcreteDataAttributePath & aPath, StatusIB aStatus) override
+    {
+        mSuccess = mSuccess && aStatus.IsSuccess();
+    }
+
+    void OnError(const WriteClient * apWriteClient, CHIP_ERROR aError) override { mSuccess = false; }
+    void OnDone(WriteClient * apWriteClient) override { mpRecorder->OnCompleted(mStartTime, mSuccess); }
+
+    Optional<WriteClient> mClient;
+    Recorder * mpRecorder                    = nullptr;
+    System::Clock::Microseconds64 mStartTime = kNoStartTime;
+    bool mSuccess                            = true;
+};
+
+class InvokeSlot : public CommandSender::Callback
+{
+public:
+    CHIP_ERROR Start(Fixture & fixture)
+    {
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        EchoCommand request;
+
+        mpRecorder = &fixture.mRecorder;
+        mStartTime = Now();
+        mSuccess   = false;
+        mpRecorder->OnStarted();
+
+        request.payload = GetPayload();
+        mSender.ClearValue();
+        mSender.Emplace(this, &fixture.mContext.GetExchangeManager());
+        SuccessOrExit(err = mSender.Value().AddRequestData(
+                          CommandPathParams(kEchoEndpointId, 0, kEchoClusterId, kEchoCommandId, CommandPathFlags::kEndpointIdValid),
+                          request));
+        err = mSender.Value().SendCommandRequest(fixture.mContext.GetSessionBobToAlice());
+
+    exit:
+        if (err != CHIP_NO_ERROR)
+        {
+            mSender.ClearValue();
+            mpRecorder->OnCompleted(mStartTime, false);
+        }
+        return err;
+    }
+
+private:
+    void OnResponse(CommandSender * apCommandSender, const ConcreteCommandPath & aPath, const StatusIB & aStatusIB,
+                    TLV::TLVReader * apData) override
+    {
+        EchoCommand response;
+        mSuccess = aStatusIB.IsSuccess() && apData != nullptr && response.Decode(*apData) == CHIP_NO_ERROR &&
+            response.payload.size() == gPayloadSize;
+    }
+
+    void OnError(const CommandSender * apCommandSender, CHIP_ERROR aError) override { mSuccess = false; }
+    void OnDone(CommandSender * apCommandSender) override { mpRecorder->OnCompleted(mStartTime, mSuccess); }
+
+    Optional<CommandSender> mSender;
+    Recorder * mpRecorder                    = nullptr;
+    System::Clock::Microseconds64 mStartTime = kNoStartTime;
+    bool mSuccess                            = false;
+};
+
+void BenchmarkRead(State & state)
+{
+    Fixture fixture;
+    ReadSlot slots[kMaxConcurrencyForExchanges];
+
+    VerifyOrReturn(fixture.Init(state, CHIP_IM_MAX_NUM_READS));
+
+    fixture.Run(state, [&](size_t slot) { return slots[slot].Start(fixture, ReadClient::InteractionType::Read); });
+
+    for (auto & slot : slots)
+    {
+        slot.Stop();
+    }
+    fixture.Shutdown();
+}
+
+/**
+ * Each iteration changes the attributes of all the subscriptions, and measures the time until their reports are in.
+ */
+void BenchmarkSubscribe(State & state)
+{
+    Fixture fixture;
+    ReadSlot slots[kMaxConcurrencyForExchanges];
+    bool established = true;
+
+    VerifyOrReturn(fixture.Init(state, CHIP_IM_MAX_NUM_SUBSCRIPTIONS));
+
+    for (size_t slot = 0; slot < fixture.mConfig.mConcurrency && established; slot++)
+    {
+        established = (slots[slot].Start(fixture, ReadClient::InteractionType::Subscribe) == CHIP_NO_ERROR);
+    }
+    fixture.mContext.GetIOContext().DriveIOUntil(kIterationTimeout, [&]() {
+        return fixture.mRecorder.GetPendingCount() == 0 && fixture.mContext.GetExchangeManager().GetNumActiveExchanges() == 0;
+    });
+    established = established && fixture.mRecorder.GetPendingCount() == 0;
+
+    if (!established)
+    {
+        state.SkipWithError("Failed to establish the subscriptions");
+    }
+    else
+    {
+        // Leave the priming reports out of the results.
+        fixture.mRecorder = Recorder();
+        fixture.Run(state, [&](size_t slot) {
+            if (slot == 0)
+            {
+                Test::BumpVersion();
+                for (auto & path : fixture.mPaths)
+                {
+                    ReturnErrorOnFailure(InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(path));
+                }
+            }
+            slots[slot].ExpectReport(fixture.mRecorder);
+            return CHIP_NO_ERROR;
+        });
+    }
+
+    for (auto & slot : slots)
+    {
+        slot.Stop();
+    }
+    fixture.Shutdown();
+}
+
+void BenchmarkWrite(State & state)
+{
+    Fixture fixture;
+    WriteSlot slots[kMaxConcurrencyForExchanges];
+
+    VerifyOrReturn(fixture.Init(state, CHIP_IM_MAX_NUM_WRITE_HANDLER));
+
+    fixture.Run(state, [&](size_t slot) { return slots[slot].Start(fixture); });
+    fixture.Shutdown();
+}
+
+void BenchmarkInvoke(State & state)
+{
+    Fixture fixture;
+    InvokeSlot slots[kMaxConcurrencyForExchanges];
+
+    VerifyOrReturn(fixture.Init(state, CHIP_IM_MAX_NUM_COMMAND_HANDLER));
+
+    fixture.Run(state, [&](size_t slot) { return slots[slot].Start(fixture); });
+    fixture.Shutdown();
+}
+
+} // namespace
+
+CHIP_REGISTER_BENCHMARK(BenchmarkRead)
+CHIP_REGISTER_BENCHMARK(BenchmarkSubscribe)
+CHIP_REGISTER_BENCHMARK(BenchmarkWrite)
+CHIP_REGISTER_BENCHMARK(BenchmarkInvoke)
+
+//
+// The data model of the node: the payload attributes of the mock data model are octet strings of the payload, and the
+// echo command responds with its request.
+//
+namespace chip {
+namespace app {
+
+CHIP_ERROR ReadSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, bool aIsFabricFiltered,
+                                 const ConcreteReadAttributePath & aPath, AttributeReportIBs::Builder & aAttributeReports,
+                                 AttributeValueEncoder::AttributeEncodeState * apEncoderState)
+{
+    if (!IsPayloadAttribute(aPath))
+    {
+        return Test::ReadSingleMockClusterData(aSubjectDescriptor.fabricIndex, aPath, aAttributeReports, apEncoderState);
+    }
+
+    AttributeValueEncoder::AttributeEncodeState state =
+        (apEncoderState == nullptr ? AttributeValueEncoder::AttributeEncodeState() : *apEncoderState);
+    AttributeValueEncoder valueEncoder(aAttributeReports, aSubjectDescriptor.fabricIndex, aPath, Test::GetVersion(),
+                                       aIsFabricFiltered, state);
+    return valueEncoder.Encode(GetPayload());
+}
+
+bool IsClusterDataVersionEqual(const ConcreteClusterPath & aConcreteClusterPath, DataVersion aRequiredVersion)
+{
+    return Test::GetVersion() == aRequiredVersion;
+}
+
+bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint)
+{
+    return false;
+}
+
+bool ConcreteAttributePathExists(const ConcreteAttributePath & aPath)
+{
+    return IsPayloadAttribute(aPath);
+}
+
+const EmberAfAttributeMetadata * GetAttributeMetadata(const ConcreteAttributePath & aConcreteClusterPath)
+{
+    // The payload attributes are not lists, which is all the writes need to know.
+    return nullptr;
+}
+
+CHIP_ERROR WriteSingleClusterData(const Access::SubjectDescriptor & aSubjectDescriptor, const ConcreteDataAttributePath & aPath,
+                                  TLV::TLVReader & aReader, WriteHandler * aWriteHandler)
+{
+    ByteSpan value;
+
+    if (!IsPayloadAttribute(aPath))
+    {
+        return aWriteHandler->AddStatus(aPath, Status::UnsupportedAttribute);
+    }
+    ReturnErrorOnFailure(DataModel::Decode(aReader, value));
+    return aWriteHandler->AddStatus(aPath, value.size() == gPayloadSize ? Status::Success : Status::ConstraintError);
+}
+
+Status ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath)
+{
+    if (aCommandPath.mEndpointId != kEchoEndpointId)
+    {
+        return Status::UnsupportedEndpoint;
+    }
+    if (aCommandPath.mClusterId != kEchoClusterId)
+    {
+        return Status::UnsupportedCluster;
+    }
+    return aCommandPath.mCommandId == kEchoCommandId ? Status::Success : Status::UnsupportedCommand;
+}
+
+void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip::TLV::TLVReader & aReader,
+                                  CommandHandler * apCommandObj)
+{
+    EchoCommand request;
+
+    if (request.Decode(aReader) != CHIP_NO_ERROR)
+    {
+        apCommandObj->AddStatus(aCommandPath, Status::InvalidCommand);
+        return;
+    }
+    apCommandObj->AddResponse(aCommandPath, request);
+}
+
+} // namespace app
+} // namespace chip
@@ -77,6 +77,7 @@ function(chip_configure_data_model APP_TARGET)
     target_sources(${APP_TARGET} PRIVATE
         ${CHIP_APP_BASE_DIR}/../../zzz_generated/app-common/app-common/zap-generated/attributes/Accessors.cpp
         ${CHIP_APP_BASE_DIR}/../../zzz_generated/app-common/app-common/zap-generated/cluster-objects.cpp
+        ${CHIP_APP_BASE_DIR}/data-model/StructCodec.cpp
         ${CHIP_APP_BASE_DIR}/util/af-event.cpp
         ${CHIP_APP_BASE_DIR}/util/attribute-size-util.cpp
         ${CHIP_APP_BASE_DIR}/util/attribute-storage.cpp
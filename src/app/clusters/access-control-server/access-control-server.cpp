@@ -170,20 +170,23 @@ CHIP_ERROR AccessControlAttribute::ReadImpl(const ConcreteReadAttributePath & aP
 
 CHIP_ERROR AccessControlAttribute::ReadAcl(AttributeValueEncoder & aEncoder)
 {
-    AccessControl::EntryIterator iterator;
     AccessControl::Entry entry;
     AclStorage::EncodableEntry encodableEntry(entry);
-    return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
+    // The entries are indexed across fabrics, in the order of the fabric table, so that a chunked read resumes by reading
+    // the entry it stopped at rather than by going through all the entries before it.
+    return aEncoder.EncodeListFrom([&](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
+        size_t fabricStartIndex = 0;
         for (auto & info : Server::GetInstance().GetFabricTable())
         {
-            auto fabric = info.GetFabricIndex();
-            ReturnErrorOnFailure(GetAccessControl().Entries(fabric, iterator));
-            CHIP_ERROR err;
-            while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+            auto fabric       = info.GetFabricIndex();
+            size_t entryCount = 0;
+            ReturnErrorOnFailure(GetAccessControl().GetEntryCount(fabric, entryCount));
+            for (size_t index = (startIndex > fabricStartIndex) ? startIndex - fabricStartIndex : 0; index < entryCount; index++)
             {
-                ReturnErrorOnFailure(encoder.Encode(encodableEntry));
+                ReturnErrorOnFailure(GetAccessControl().ReadEntry(fabric, index, entry));
+                ReturnErrorOnFailure(encoder.Encode(static_cast<ListIndex>(fabricStartIndex + index), encodableEntry));
             }
-            ReturnErrorCodeIf(err != CHIP_NO_ERROR && err != CHIP_ERROR_SENTINEL, err);
+            fabricStartIndex += entryCount;
         }
         return CHIP_NO_ERROR;
     });
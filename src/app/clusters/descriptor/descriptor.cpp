@@ -61,8 +61,10 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
 
     if (endpoint == 0x00)
     {
-        err = aEncoder.EncodeList([](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        // The parts are listed by endpoint index, so that a chunked read of the parts of a bridge with many endpoints resumes
+        // from the endpoint it stopped at.
+        err = aEncoder.EncodeListFrom([](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
+            for (uint16_t index = startIndex; index < emberAfEndpointCount(); index++)
             {
                 if (emberAfEndpointIndexIsEnabled(index))
                 {
@@ -70,7 +72,7 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
                     if (endpointId == 0)
                         continue;
 
-                    ReturnErrorOnFailure(encoder.Encode(endpointId));
+                    ReturnErrorOnFailure(encoder.Encode(index, endpointId));
                 }
             }
 
@@ -79,8 +81,8 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
     }
     else
     {
-        err = aEncoder.EncodeList([endpoint](const auto & encoder) -> CHIP_ERROR {
-            for (uint16_t index = 0; index < emberAfEndpointCount(); index++)
+        err = aEncoder.EncodeListFrom([endpoint](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
+            for (uint16_t index = startIndex; index < emberAfEndpointCount(); index++)
             {
                 if (!emberAfEndpointIndexIsEnabled(index))
                     continue;
@@ -94,7 +96,7 @@ CHIP_ERROR DescriptorAttrAccess::ReadPartsAttribute(EndpointId endpoint, Attribu
 
                     if (parentEndpointId == endpoint)
                     {
-                        ReturnErrorOnFailure(encoder.Encode(emberAfEndpointFromIndex(index)));
+                        ReturnErrorOnFailure(encoder.Encode(index, emberAfEndpointFromIndex(index)));
                         break;
                     }
 
@@ -133,13 +135,13 @@ CHIP_ERROR DescriptorAttrAccess::ReadDeviceAttribute(EndpointId endpoint, Attrib
 
 CHIP_ERROR DescriptorAttrAccess::ReadClientServerAttribute(EndpointId endpoint, AttributeValueEncoder & aEncoder, bool server)
 {
-    CHIP_ERROR err = aEncoder.EncodeList([&endpoint, server](const auto & encoder) -> CHIP_ERROR {
+    CHIP_ERROR err = aEncoder.EncodeListFrom([&endpoint, server](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
         uint8_t clusterCount = emberAfClusterCount(endpoint, server);
 
-        for (uint8_t clusterIndex = 0; clusterIndex < clusterCount; clusterIndex++)
+        for (ListIndex clusterIndex = startIndex; clusterIndex < clusterCount; clusterIndex++)
         {
-            const EmberAfCluster * cluster = emberAfGetNthCluster(endpoint, clusterIndex, server);
-            ReturnErrorOnFailure(encoder.Encode(cluster->clusterId));
+            const EmberAfCluster * cluster = emberAfGetNthCluster(endpoint, static_cast<uint8_t>(clusterIndex), server);
+            ReturnErrorOnFailure(encoder.Encode(clusterIndex, cluster->clusterId));
         }
 
         return CHIP_NO_ERROR;
@@ -443,7 +443,7 @@ void DoorLockServer::getUserCommandHandler(chip::app::CommandHandler * commandOb
     {
         chip::app::ConcreteCommandPath path = { emberAfCurrentEndpoint(), ::Id, Commands::GetUserResponse::Id };
         chip::TLV::TLVWriter * writer;
-        SuccessOrExit(err = commandObj->PrepareCommand(path));
+        SuccessOrExit(err = commandObj->PrepareCommand(commandPath, path));
         VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
         SuccessOrExit(
             err = writer->Put(chip::TLV::ContextTag(to_underlying(Commands::GetUserResponse::Fields::kUserIndex)), userIndex));
@@ -161,24 +161,29 @@ private:
         auto provider     = GetGroupDataProvider();
         VerifyOrReturnError(nullptr != provider, CHIP_ERROR_INTERNAL);
 
-        CHIP_ERROR err = aEncoder.EncodeList([provider, fabric_index](const auto & encoder) -> CHIP_ERROR {
+        return aEncoder.EncodeListFrom([provider, fabric_index](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
             auto iter = provider->IterateGroupKeys(fabric_index);
             VerifyOrReturnError(nullptr != iter, CHIP_ERROR_NO_MEMORY);
 
+            CHIP_ERROR encodeErr = CHIP_NO_ERROR;
             GroupDataProvider::GroupKey mapping;
-            while (iter->Next(mapping))
+            // The mappings are stored as a linked list, so the ones of the previous chunks are still walked, but not encoded.
+            for (ListIndex index = 0; encodeErr == CHIP_NO_ERROR && iter->Next(mapping); index++)
             {
+                if (index < startIndex)
+                {
+                    continue;
+                }
                 GroupKeyManagement::Structs::GroupKeyMapStruct::Type key = {
                     .groupId       = mapping.group_id,
                     .groupKeySetID = mapping.keyset_id,
                     .fabricIndex   = fabric_index,
                 };
-                encoder.Encode(key);
+                encodeErr = encoder.Encode(index, key);
             }
             iter->Release();
-            return CHIP_NO_ERROR;
+            return encodeErr;
         });
-        return err;
     }
 
     CHIP_ERROR WriteGroupKeyMap(const ConcreteDataAttributePath & aPath, AttributeValueDecoder & aDecoder)
@@ -246,19 +251,24 @@ private:
         auto provider     = GetGroupDataProvider();
         VerifyOrReturnError(nullptr != provider, CHIP_ERROR_INTERNAL);
 
-        CHIP_ERROR err = aEncoder.EncodeList([provider, fabric_index](const auto & encoder) -> CHIP_ERROR {
+        return aEncoder.EncodeListFrom([provider, fabric_index](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
             auto iter = provider->IterateGroupInfo(fabric_index);
             VerifyOrReturnError(nullptr != iter, CHIP_ERROR_NO_MEMORY);
 
+            CHIP_ERROR encodeErr = CHIP_NO_ERROR;
             GroupDataProvider::GroupInfo info;
-            while (iter->Next(info))
+            // Like the mappings, the groups of the previous chunks are walked but their endpoints are not read.
+            for (ListIndex index = 0; encodeErr == CHIP_NO_ERROR && iter->Next(info); index++)
             {
-                encoder.Encode(GroupTableCodec(provider, fabric_index, info));
+                if (index < startIndex)
+                {
+                    continue;
+                }
+                encodeErr = encoder.Encode(index, GroupTableCodec(provider, fabric_index, info));
             }
             iter->Release();
-            return CHIP_NO_ERROR;
+            return encodeErr;
         });
-        return err;
     }
     CHIP_ERROR ReadMaxGroupsPerFabric(EndpointId endpoint, AttributeValueEncoder & aEncoder)
     {
@@ -285,7 +285,7 @@ bool emberAfScenesClusterRemoveSceneCallback(app::CommandHandler * commandObj, c
             app::ConcreteCommandPath path = { emberAfCurrentEndpoint(), ZCL_SCENES_CLUSTER_ID,
                                               ZCL_REMOVE_SCENE_RESPONSE_COMMAND_ID };
             TLV::TLVWriter * writer       = nullptr;
-            SuccessOrExit(err = commandObj->PrepareCommand(path));
+            SuccessOrExit(err = commandObj->PrepareCommand(commandPath, path));
             VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
             SuccessOrExit(err = writer->Put(TLV::ContextTag(0), status));
             SuccessOrExit(err = writer->Put(TLV::ContextTag(1), groupId));
@@ -338,7 +338,7 @@ bool emberAfScenesClusterRemoveAllScenesCallback(app::CommandHandler * commandOb
             app::ConcreteCommandPath path = { emberAfCurrentEndpoint(), ZCL_SCENES_CLUSTER_ID,
                                               ZCL_REMOVE_ALL_SCENES_RESPONSE_COMMAND_ID };
             TLV::TLVWriter * writer       = nullptr;
-            SuccessOrExit(err = commandObj->PrepareCommand(path));
+            SuccessOrExit(err = commandObj->PrepareCommand(commandPath, path));
             VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
             SuccessOrExit(err = writer->Put(TLV::ContextTag(0), status));
             SuccessOrExit(err = writer->Put(TLV::ContextTag(1), groupId));
@@ -373,7 +373,7 @@ bool emberAfScenesClusterStoreSceneCallback(app::CommandHandler * commandObj, co
             app::ConcreteCommandPath path = { emberAfCurrentEndpoint(), ZCL_SCENES_CLUSTER_ID,
                                               ZCL_STORE_SCENE_RESPONSE_COMMAND_ID };
             TLV::TLVWriter * writer       = nullptr;
-            SuccessOrExit(err = commandObj->PrepareCommand(path));
+            SuccessOrExit(err = commandObj->PrepareCommand(commandPath, path));
             VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
             SuccessOrExit(err = writer->Put(TLV::ContextTag(0), status));
             SuccessOrExit(err = writer->Put(TLV::ContextTag(1), groupId));
@@ -469,7 +469,7 @@ bool emberAfScenesClusterGetSceneMembershipCallback(app::CommandHandler * comman
         app::ConcreteCommandPath path = { emberAfCurrentEndpoint(), ZCL_SCENES_CLUSTER_ID,
                                           ZCL_GET_SCENE_MEMBERSHIP_RESPONSE_COMMAND_ID };
         TLV::TLVWriter * writer       = nullptr;
-        SuccessOrExit(err = commandObj->PrepareCommand(path));
+        SuccessOrExit(err = commandObj->PrepareCommand(commandPath, path));
         VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
         SuccessOrExit(err = writer->Put(TLV::ContextTag(0), status));
         SuccessOrExit(
@@ -1070,7 +1070,8 @@ kickout:
             path = { emberAfCurrentEndpoint(), ZCL_SCENES_CLUSTER_ID, ZCL_ENHANCED_ADD_SCENE_RESPONSE_COMMAND_ID };
         }
         TLV::TLVWriter * writer = nullptr;
-        SuccessOrExit(err = commandObj->PrepareCommand(path));
+        SuccessOrExit(
+            err = commandObj->PrepareCommand(app::ConcreteCommandPath(endpoint, ZCL_SCENES_CLUSTER_ID, cmd->commandId), path));
         VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
         SuccessOrExit(err = writer->Put(TLV::ContextTag(0), status));
         SuccessOrExit(err = writer->Put(TLV::ContextTag(1), groupId));
@@ -1126,7 +1127,8 @@ bool emberAfPluginScenesServerParseViewScene(app::CommandHandler * commandObj, c
         path = { emberAfCurrentEndpoint(), ZCL_SCENES_CLUSTER_ID, ZCL_ENHANCED_VIEW_SCENE_RESPONSE_COMMAND_ID };
     }
     TLV::TLVWriter * writer = nullptr;
-    SuccessOrExit(err = commandObj->PrepareCommand(path));
+    SuccessOrExit(
+        err = commandObj->PrepareCommand(app::ConcreteCommandPath(endpoint, ZCL_SCENES_CLUSTER_ID, cmd->commandId), path));
     VerifyOrExit((writer = commandObj->GetCommandDataIBTLVWriter()) != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     SuccessOrExit(err = writer->Put(TLV::ContextTag(0), status));
     SuccessOrExit(err = writer->Put(TLV::ContextTag(1), groupId));
@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/data-model/StructCodec.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+namespace {
+
+CHIP_ERROR EncodeFields(TLV::TLVWriter & writer, TLV::Tag tag, const void * object, const FieldDescriptor * fields,
+                        uint8_t skippedFlags, FabricIndex accessingFabricIndex)
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+    for (const FieldDescriptor * field = fields; !field->IsEnd(); field++)
+    {
+        if (field->mCodec->mEncode == nullptr || (field->mFlags & skippedFlags) != 0)
+        {
+            continue;
+        }
+        const void * value = static_cast<const uint8_t *>(object) + field->mOffset;
+        ReturnErrorOnFailure(field->mCodec->mEncode(writer, TLV::ContextTag(field->mTag), value, accessingFabricIndex));
+    }
+    return writer.EndContainer(outer);
+}
+
+} // namespace
+
+CHIP_ERROR EncodeStruct(TLV::TLVWriter & writer, TLV::Tag tag, const void * object, const FieldDescriptor * fields,
+                        FabricIndex accessingFabricIndex)
+{
+    return EncodeFields(writer, tag, object, fields, FieldDescriptor::kNone, accessingFabricIndex);
+}
+
+CHIP_ERROR EncodeFabricScopedStruct(TLV::TLVWriter & writer, TLV::Tag tag, const void * object, const FieldDescriptor * fields,
+                                    const Optional<FabricIndex> & accessingFabricIndex, FabricIndex fabricIndex)
+{
+    uint8_t skippedFlags = FieldDescriptor::kNone;
+
+    if (!accessingFabricIndex.HasValue())
+    {
+        skippedFlags |= FieldDescriptor::kFabricIndex;
+    }
+    else if (accessingFabricIndex.Value() != fabricIndex)
+    {
+        skippedFlags |= FieldDescriptor::kFabricSensitive;
+    }
+
+    return EncodeFields(writer, tag, object, fields, skippedFlags, accessingFabricIndex.ValueOr(kUndefinedFabricIndex));
+}
+
+CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, void * object, const FieldDescriptor * fields)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVType outer;
+    // Fields are usually encoded in the order of the table; look there first.
+    const FieldDescriptor * expected = fields;
+
+    VerifyOrReturnError(TLV::kTLVType_Structure == reader.GetType(), CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!TLV::IsContextTag(reader.GetTag()))
+        {
+            continue;
+        }
+
+        uint32_t tagNum               = TLV::TagNumFromTag(reader.GetTag());
+        const FieldDescriptor * field = expected;
+        if (field->IsEnd() || field->mTag != tagNum)
+        {
+            field = fields;
+            while (!field->IsEnd() && field->mTag != tagNum)
+            {
+                field++;
+            }
+        }
+        if (field->IsEnd())
+        {
+            continue;
+        }
+
+        expected = field + 1;
+        if (field->mCodec->mDecode != nullptr)
+        {
+            ReturnErrorOnFailure(field->mCodec->mDecode(reader, static_cast<uint8_t *>(object) + field->mOffset));
+        }
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(outer);
+}
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -0,0 +1,218 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/data-model/Decode.h>
+#include <app/data-model/Encode.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/Optional.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace DataModel {
+
+/*
+ * @brief
+ * The functions encoding and decoding a field of a given C++ type (nullable and optional fields included, through
+ * Nullable<> and Optional<>).  There is one instance of them per type and use, shared by all the fields of that type
+ * across the cluster objects.
+ */
+struct FieldCodecOps
+{
+    using EncodeFunction = CHIP_ERROR (*)(TLV::TLVWriter & writer, TLV::Tag tag, const void * field,
+                                          FabricIndex accessingFabricIndex);
+    using DecodeFunction = CHIP_ERROR (*)(TLV::TLVReader & reader, void * field);
+
+    EncodeFunction mEncode; ///< Null for a field only decoded.
+    DecodeFunction mDecode; ///< Null for a field only encoded.
+};
+
+/*
+ * @brief
+ * Describes one context-tagged field of a cluster object struct, so that EncodeStruct and DecodeStruct can walk a
+ * table of them instead of each struct unrolling its own encode and decode code.
+ *
+ * A table ends with kEndOfFields.
+ */
+struct FieldDescriptor
+{
+    enum Flags : uint8_t
+    {
+        kNone            = 0,
+        kFabricSensitive = 0x01, ///< Omitted when a fabric-scoped struct is encoded for a read from another fabric.
+        kFabricIndex     = 0x02, ///< The fabric index of a fabric-scoped struct, only encoded for reads.
+    };
+
+    uint8_t mTag;
+    uint8_t mFlags;
+    uint16_t mOffset;
+    const FieldCodecOps * mCodec;
+
+    constexpr bool IsEnd() const { return mCodec == nullptr; }
+};
+
+constexpr FieldDescriptor kEndOfFields = { 0, FieldDescriptor::kNone, 0, nullptr };
+
+namespace detail {
+
+template <typename X>
+struct FieldCodec
+{
+    static CHIP_ERROR Encode(TLV::TLVWriter & writer, TLV::Tag tag, const void * field, FabricIndex accessingFabricIndex)
+    {
+        return DataModel::Encode(writer, tag, *static_cast<const X *>(field));
+    }
+
+    static CHIP_ERROR EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, const void * field, FabricIndex accessingFabricIndex)
+    {
+        return DataModel::EncodeForRead(writer, tag, accessingFabricIndex, *static_cast<const X *>(field));
+    }
+
+    static CHIP_ERROR Decode(TLV::TLVReader & reader, void * field) { return DataModel::Decode(reader, *static_cast<X *>(field)); }
+
+    static constexpr FieldCodecOps kOps           = { &Encode, &Decode };
+    static constexpr FieldCodecOps kEncodeOps     = { &Encode, nullptr };
+    static constexpr FieldCodecOps kEncodeReadOps = { &EncodeForRead, nullptr };
+    static constexpr FieldCodecOps kDecodeOps     = { nullptr, &Decode };
+};
+
+template <typename X>
+constexpr FieldCodecOps FieldCodec<X>::kOps;
+template <typename X>
+constexpr FieldCodecOps FieldCodec<X>::kEncodeOps;
+template <typename X>
+constexpr FieldCodecOps FieldCodec<X>::kEncodeReadOps;
+template <typename X>
+constexpr FieldCodecOps FieldCodec<X>::kDecodeOps;
+
+template <typename T, typename X, X T::*kMember>
+struct MemberCodec
+{
+    static CHIP_ERROR Decode(TLV::TLVReader & reader, void * object)
+    {
+        return DataModel::Decode(reader, static_cast<T *>(object)->*kMember);
+    }
+
+    static constexpr FieldCodecOps kDecodeOps = { nullptr, &Decode };
+};
+
+template <typename T, typename X, X T::*kMember>
+constexpr FieldCodecOps MemberCodec<T, X, kMember>::kDecodeOps;
+
+template <uint32_t kTag, size_t kOffset>
+constexpr FieldDescriptor MakeFieldDescriptor(uint8_t flags, const FieldCodecOps * codec)
+{
+    static_assert(kTag <= UINT8_MAX, "The tag of the field does not fit in a FieldDescriptor");
+    static_assert(kOffset <= UINT16_MAX, "The offset of the field does not fit in a FieldDescriptor");
+    return { static_cast<uint8_t>(kTag), flags, static_cast<uint16_t>(kOffset), codec };
+}
+
+} // namespace detail
+
+/*
+ * @brief
+ * Describe a field of type X, context tag kTag and offset kOffset in a struct that is both encoded and decoded.
+ *
+ * The offsets are taken with offsetof, which is only defined for standard-layout types.
+ */
+template <typename X, uint32_t kTag, size_t kOffset>
+constexpr FieldDescriptor Field(uint8_t flags = FieldDescriptor::kNone)
+{
+    return detail::MakeFieldDescriptor<kTag, kOffset>(flags, &detail::FieldCodec<X>::kOps);
+}
+
+/*
+ * @brief
+ * Describe a field of type X, context tag kTag and offset kOffset in a struct that is only encoded, like the Type of a
+ * struct holding lists.
+ */
+template <typename X, uint32_t kTag, size_t kOffset>
+constexpr FieldDescriptor EncodableField(uint8_t flags = FieldDescriptor::kNone)
+{
+    return detail::MakeFieldDescriptor<kTag, kOffset>(flags, &detail::FieldCodec<X>::kEncodeOps);
+}
+
+/*
+ * @brief
+ * Describe a fabric-scoped struct field of type X, context tag kTag and offset kOffset, encoded for a read by the
+ * fabric handed to EncodeStruct.
+ */
+template <typename X, uint32_t kTag, size_t kOffset>
+constexpr FieldDescriptor EncodableForReadField()
+{
+    return detail::MakeFieldDescriptor<kTag, kOffset>(FieldDescriptor::kNone, &detail::FieldCodec<X>::kEncodeReadOps);
+}
+
+/*
+ * @brief
+ * Describe a field of type X, context tag kTag and offset kOffset in a struct that is only decoded, like the
+ * DecodableType of a command.
+ */
+template <typename X, uint32_t kTag, size_t kOffset>
+constexpr FieldDescriptor DecodableField()
+{
+    return detail::MakeFieldDescriptor<kTag, kOffset>(FieldDescriptor::kNone, &detail::FieldCodec<X>::kDecodeOps);
+}
+
+/*
+ * @brief
+ * Describe the field kMember, of type X and context tag kTag, of a struct T that is only decoded and is not
+ * standard-layout, like the DecodableType of a struct holding lists: its offset cannot be taken with offsetof.  The
+ * field is reached through the member pointer instead, which costs a decode function per field.
+ */
+template <typename T, typename X, X T::*kMember, uint32_t kTag>
+constexpr FieldDescriptor DecodableMemberField()
+{
+    return detail::MakeFieldDescriptor<kTag, 0>(FieldDescriptor::kNone, &detail::MemberCodec<T, X, kMember>::kDecodeOps);
+}
+
+/*
+ * @brief
+ * Encode the fields of @p object described by @p fields as a structure.
+ *
+ * @param accessingFabricIndex  The fabric the fields described by EncodableForReadField are encoded for.
+ */
+CHIP_ERROR EncodeStruct(TLV::TLVWriter & writer, TLV::Tag tag, const void * object, const FieldDescriptor * fields,
+                        FabricIndex accessingFabricIndex = kUndefinedFabricIndex);
+
+/*
+ * @brief
+ * Encode the fields of the fabric-scoped struct @p object described by @p fields as a structure.
+ *
+ * @param accessingFabricIndex  Has a value when encoding for a read by that fabric, in which case the fabric index is
+ *                              included and the fabric-sensitive fields are only included if the struct belongs to it.
+ * @param fabricIndex           The fabric of the struct.
+ */
+CHIP_ERROR EncodeFabricScopedStruct(TLV::TLVWriter & writer, TLV::Tag tag, const void * object, const FieldDescriptor * fields,
+                                    const Optional<FabricIndex> & accessingFabricIndex, FabricIndex fabricIndex);
+
+/*
+ * @brief
+ * Decode the structure the reader is positioned on into the fields of @p object described by @p fields.  Elements
+ * that are not context-tagged or not described are skipped.
+ */
+CHIP_ERROR DecodeStruct(TLV::TLVReader & reader, void * object, const FieldDescriptor * fields);
+
+} // namespace DataModel
+} // namespace app
+} // namespace chip
@@ -19,8 +19,12 @@
 
 #include <access/examples/ExampleAccessControlDelegate.h>
 
+#include <app/AppBuildConfig.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#if CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
+#include <app/MappedEventLogStorage.h>
+#endif // CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
 #include <app/server/Dnssd.h>
 #include <app/server/EchoHandler.h>
 #include <app/util/DataModelHandler.h>
@@ -95,6 +99,9 @@ Server Server::sServer;
 
 #if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 #define CHIP_NUM_EVENT_LOGGING_BUFFERS 3
+#if CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
+static ::chip::app::MappedEventLogStorage sEventLogStorage;
+#endif // CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
 static uint8_t sInfoEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_INFO_BUFFER_SIZE];
 static uint8_t sDebugEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_DEBUG_BUFFER_SIZE];
 static uint8_t sCritEventBuffer[CHIP_DEVICE_CONFIG_EVENT_LOGGING_CRIT_BUFFER_SIZE];
@@ -236,8 +243,29 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
             { &sCritEventBuffer[0], sizeof(sCritEventBuffer), ::chip::app::PriorityLevel::Critical }
         };
 
+#if CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
+        // On success, the buffers are moved to the mapped file; otherwise events are only kept in RAM.
+        const char * eventLogStoragePath =
+            initParams.eventLogStoragePath != nullptr ? initParams.eventLogStoragePath : CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH;
+        CHIP_ERROR eventLogStorageErr = sEventLogStorage.Init(eventLogStoragePath, &logStorageResources[0],
+                                                              CHIP_NUM_EVENT_LOGGING_BUFFERS, &DeviceLayer::SystemLayer());
+        if (eventLogStorageErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Events will not survive a restart, event log storage failed: %" CHIP_ERROR_FORMAT,
+                         eventLogStorageErr.Format());
+        }
+#endif // CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
+
         chip::app::EventManagement::GetInstance().Init(&mExchangeMgr, CHIP_NUM_EVENT_LOGGING_BUFFERS, &sLoggingBuffer[0],
                                                        &logStorageResources[0], &sGlobalEventIdCounter);
+
+#if CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
+        if (eventLogStorageErr == CHIP_NO_ERROR)
+        {
+            // Dropped events are logged by EventManagement; the storage is usable regardless.
+            sEventLogStorage.Restore(chip::app::EventManagement::GetInstance(), &sLoggingBuffer[0]);
+        }
+#endif // CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
     }
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
@@ -432,6 +460,10 @@ void Server::Shutdown()
     mAccessControl.Finish();
     Credentials::SetGroupDataProvider(nullptr);
     mAttributePersister.Shutdown();
+#if CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
+    chip::app::EventManagement::DestroyEventManagement();
+    sEventLogStorage.Shutdown();
+#endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT && CHIP_CONFIG_ENABLE_MAPPED_EVENT_LOG
     // TODO(16969): Remove chip::Platform::MemoryInit() call from Server class, it belongs to outer code
     chip::Platform::MemoryShutdown();
 }
@@ -128,6 +128,9 @@ struct ServerInitParams
     // Operational certificate store with access to the operational certs in persisted storage:
     // must not be null at timne of Server::Init().
     Credentials::OperationalCertificateStore * opCertStore = nullptr;
+    // File keeping the events when chip_enable_mapped_event_log is set: optional, defaults to
+    // CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH.  Instances sharing a host need their own.
+    const char * eventLogStoragePath = nullptr;
 };
 
 class IgnoreCertificateValidityPolicy : public Credentials::CertificateValidityPolicy
@@ -384,6 +384,82 @@ void TestEncodeListChunking(nlTestSuite * aSuite, void * aContext)
     }
 }
 
+void TestEncodeListFromChunking(nlTestSuite * aSuite, void * aContext)
+{
+    AttributeValueEncoder::AttributeEncodeState state;
+
+    // The item at index 1 is not reported by the generator.
+    bool list[]        = { true, true, false };
+    ListIndex starts[] = { kInvalidListIndex, kInvalidListIndex };
+    size_t calls       = 0;
+    auto listEncoder   = [&](ListIndex startIndex, const auto & encoder) -> CHIP_ERROR {
+        starts[calls++] = startIndex;
+        for (ListIndex index = startIndex; index < ArraySize(list); index++)
+        {
+            if (index != 1)
+            {
+                ReturnErrorOnFailure(encoder.Encode(index, list[index]));
+            }
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    const uint8_t header[] = {
+        // clang-format off
+        0x15, 0x36, 0x01, // Test overhead, Start Anonymous struct + Start 1 byte Tag Array + Tag (01)
+        0x15, // Start anonymous struct
+          0x35, 0x01, // Start 1 byte tag struct + Tag (01)
+            0x24, 0x00, 0x99, // Tag (00) Value (1 byte uint) 0x99 (Attribute Version)
+            0x37, 0x01, // Start 1 byte tag list + Tag (01) (Attribute Path)
+              0x24, 0x02, 0x55, // Tag (02) Value (1 byte uint) 0x55
+              0x24, 0x03, 0xaa, // Tag (03) Value (1 byte uint) 0xaa
+              0x24, 0x04, 0xcc, // Tag (04) Value (1 byte uint) 0xcc
+              0x34, 0x05, // Tag (05) Null
+            0x18, // End of container
+        // clang-format on
+    };
+
+    {
+        // Use 60 bytes buffer to force chunking: it fits the empty list and one item, like in TestEncodeListChunking.
+        LimitedTestSetup<60> test1(aSuite, kTestFabricIndex);
+        CHIP_ERROR err = test1.encoder.EncodeListFrom(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+        state = test1.encoder.GetState();
+
+        const uint8_t expected[] = {
+            // clang-format off
+            0x29, 0x02, // Tag (02) Value True (Attribute Value)
+            0x18, // End of container
+            0x18, // End of container
+            // clang-format on
+        };
+        NL_TEST_ASSERT(aSuite, test1.writer.GetLengthWritten() > sizeof(header) + sizeof(expected));
+        NL_TEST_ASSERT(aSuite,
+                       memcmp(test1.buf + test1.writer.GetLengthWritten() - sizeof(expected), expected, sizeof(expected)) == 0);
+    }
+    {
+        LimitedTestSetup<60> test2(aSuite, 0, state);
+        CHIP_ERROR err = test2.encoder.EncodeListFrom(listEncoder);
+        NL_TEST_ASSERT(aSuite, err == CHIP_NO_ERROR);
+
+        const uint8_t expected[] = {
+            // clang-format off
+            0x28, 0x02, // Tag (02) Value False (Attribute Value)
+            0x18, // End of container
+            0x18, // End of container
+            // clang-format on
+        };
+        NL_TEST_ASSERT(aSuite, test2.writer.GetLengthWritten() == sizeof(header) + sizeof(expected));
+        NL_TEST_ASSERT(aSuite, memcmp(test2.buf, header, sizeof(header)) == 0);
+        NL_TEST_ASSERT(aSuite, memcmp(test2.buf + sizeof(header), expected, sizeof(expected)) == 0);
+    }
+
+    // The second chunk resumes right after the item encoded last, without going through the first one again.
+    NL_TEST_ASSERT(aSuite, calls == 2);
+    NL_TEST_ASSERT(aSuite, starts[0] == 0);
+    NL_TEST_ASSERT(aSuite, starts[1] == 1);
+}
+
 #undef VERIFY_BUFFER_STATE
 
 } // anonymous namespace
@@ -396,6 +472,7 @@ const nlTest sTests[] = { NL_TEST_DEF("TestEncodeNothing", TestEncodeNothing),
                           NL_TEST_DEF("TestEncodeListOfBools1", TestEncodeListOfBools1),
                           NL_TEST_DEF("TestEncodeListOfBools2", TestEncodeListOfBools2),
                           NL_TEST_DEF("TestEncodeListChunking", TestEncodeListChunking),
+                          NL_TEST_DEF("TestEncodeListFromChunking", TestEncodeListFromChunking),
                           NL_TEST_DEF("TestEncodeFabricScoped", TestEncodeFabricScoped),
                           NL_TEST_SENTINEL() };
 }
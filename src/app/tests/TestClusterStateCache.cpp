@@ -617,10 +617,103 @@ void TestCache(nlTestSuite * apSuite, void * apContext)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+uint32_t GetCachedLength(ClusterStateCache & cache, EndpointId endpointId, AttributeInstruction::AttributeType attributeType)
+{
+    TLV::TLVReader reader;
+    AttributeInstruction instruction(attributeType, endpointId, AttributeInstruction::kData);
+    ConcreteAttributePath path(endpointId, Clusters::TestCluster::Id, instruction.GetAttributeId());
+
+    NL_TEST_ASSERT(gSuite, cache.Get(path, reader) == CHIP_NO_ERROR);
+    return reader.GetTotalLength();
+}
+
+/*
+ * This validates the accounting of the memory held by the cache, as values get updated in place, replaced and
+ * released.
+ */
+void TestCacheMemoryUsage(nlTestSuite * apSuite, void * apContext)
+{
+    //
+    // The second E2:D takes the place of the first one and E0:A is left stale by its status, while the status of E3:D
+    // releases the block that held it on its own.
+    //
+    {
+        AttributeInstructionListType list = {
+            AttributeInstruction(AttributeInstruction::kAttributeD, 2, AttributeInstruction::kData),
+            AttributeInstruction(AttributeInstruction::kAttributeD, 3, AttributeInstruction::kData),
+            AttributeInstruction(AttributeInstruction::kAttributeD, 2, AttributeInstruction::kData),
+            AttributeInstruction(AttributeInstruction::kAttributeA, 1, AttributeInstruction::kData),
+            AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData),
+            AttributeInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kStatus),
+            AttributeInstruction(AttributeInstruction::kAttributeD, 3, AttributeInstruction::kStatus),
+        };
+        ForwardedDataCallbackValidator dataCallbackValidator;
+        CacheValidator client(list, dataCallbackValidator);
+        ClusterStateCache cache(client);
+        DataSeriesGenerator generator(&cache.GetBufferedCallback(), list);
+        generator.Generate(dataCallbackValidator);
+
+        uint32_t listLength                  = GetCachedLength(cache, 2, AttributeInstruction::kAttributeD);
+        uint32_t intLength                   = GetCachedLength(cache, 1, AttributeInstruction::kAttributeA);
+        ClusterStateCache::MemoryUsage usage = cache.GetMemoryUsage();
+
+        NL_TEST_ASSERT(apSuite, usage.mClusterCount == 4);
+        NL_TEST_ASSERT(apSuite, usage.mAttributeCount == 4);
+        NL_TEST_ASSERT(apSuite, usage.mDataBytes == listLength + intLength);
+        NL_TEST_ASSERT(apSuite, usage.mStaleBytes == intLength);
+        NL_TEST_ASSERT(apSuite, usage.mArenaBytes >= usage.mDataBytes + usage.mStaleBytes);
+        NL_TEST_ASSERT(apSuite, usage.mArenaBytes < usage.mDataBytes + usage.mStaleBytes + 3 * listLength);
+        NL_TEST_ASSERT(apSuite, usage.mIndexBytes > 0);
+    }
+}
+
+class PassiveCallback : public ClusterStateCache::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+/*
+ * This validates that a reader of a cached value stays valid while other attributes are added and updated, and the
+ * arena grows and releases blocks.
+ */
+void TestCacheReaderLifetime(nlTestSuite * apSuite, void * apContext)
+{
+    PassiveCallback callback;
+    ClusterStateCache cache(callback);
+    ForwardedDataCallbackValidator dataCallbackValidator;
+
+    AttributeInstruction intInstruction(AttributeInstruction::kAttributeA, 0, AttributeInstruction::kData);
+    AttributeInstructionListType firstList = { intInstruction };
+    DataSeriesGenerator(&cache.GetBufferedCallback(), firstList).Generate(dataCallbackValidator);
+
+    TLV::TLVReader reader;
+    ConcreteAttributePath path(0, Clusters::TestCluster::Id, intInstruction.GetAttributeId());
+    NL_TEST_ASSERT(apSuite, cache.Get(path, reader) == CHIP_NO_ERROR);
+
+    AttributeInstructionListType secondList;
+    for (EndpointId endpointId = 1; endpointId <= 8; endpointId++)
+    {
+        secondList.push_back(AttributeInstruction(AttributeInstruction::kAttributeD, endpointId, AttributeInstruction::kData));
+    }
+    secondList.push_back(AttributeInstruction(AttributeInstruction::kAttributeD, 1, AttributeInstruction::kStatus));
+    secondList.push_back(AttributeInstruction(AttributeInstruction::kAttributeD, 2, AttributeInstruction::kData));
+    DataSeriesGenerator(&cache.GetBufferedCallback(), secondList).Generate(dataCallbackValidator);
+
+    Clusters::TestCluster::Attributes::Int16u::TypeInfo::DecodableType value = 0;
+    NL_TEST_ASSERT(apSuite, DataModel::Decode(reader, value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, value == intInstruction.mInstructionId);
+
+    ClusterStateCache::MemoryUsage usage = cache.GetMemoryUsage();
+    NL_TEST_ASSERT(apSuite, usage.mAttributeCount == 9);
+    NL_TEST_ASSERT(apSuite, usage.mArenaBytes >= usage.mDataBytes + usage.mStaleBytes);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestCache", TestCache),
+    NL_TEST_DEF("TestCacheMemoryUsage", TestCacheMemoryUsage),
+    NL_TEST_DEF("TestCacheReaderLifetime", TestCacheReaderLifetime),
     NL_TEST_SENTINEL()
 };
 
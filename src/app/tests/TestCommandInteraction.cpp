@@ -81,12 +81,31 @@ constexpr ClusterId kTestClusterId                        = 3;
 constexpr CommandId kTestCommandIdWithData                = 4;
 constexpr CommandId kTestCommandIdNoData                  = 5;
 constexpr CommandId kTestCommandIdCommandSpecificResponse = 6;
+constexpr CommandId kTestCommandIdLargeResponse           = 7;
+constexpr CommandId kTestCommandIdSinglePathResponse      = 8;
 constexpr CommandId kTestNonExistCommandId                = 0;
+
+// Command ids from this one on get a response too large for several of them to fit in a single InvokeResponse.
+constexpr CommandId kTestCommandIdLargeResponseBase = 0x100;
+
+struct LargeResponseFields
+{
+    static constexpr CommandId GetCommandId() { return kTestCommandIdLargeResponse; }
+    CHIP_ERROR Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
+    {
+        uint8_t data[300] = { 0 };
+        TLV::TLVType outerContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(aTag, TLV::kTLVType_Structure, outerContainerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(1), ByteSpan(data)));
+        return aWriter.EndContainer(outerContainerType);
+    }
+};
 } // namespace
 
 namespace app {
 
 CommandHandler::Handle asyncCommandHandle;
+CHIP_ERROR singlePathPrepareError = CHIP_NO_ERROR;
 
 InteractionModel::Status ServerClusterCommandExists(const ConcreteCommandPath & aCommandPath)
 {
@@ -159,9 +178,28 @@ void DispatchSingleClusterCommand(const ConcreteCommandPath & aCommandPath, chip
         {
             apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Success);
         }
+        else if (aCommandPath.mCommandId >= kTestCommandIdLargeResponseBase)
+        {
+            apCommandObj->AddResponse(aCommandPath, LargeResponseFields());
+        }
+        else if (aCommandPath.mCommandId == kTestCommandIdSinglePathResponse)
+        {
+            // Respond without giving the path of the command the response is for.
+            singlePathPrepareError = apCommandObj->PrepareCommand(aCommandPath);
+            if (singlePathPrepareError == CHIP_NO_ERROR)
+            {
+                chip::TLV::TLVWriter * writer = apCommandObj->GetCommandDataIBTLVWriter();
+                writer->PutBoolean(chip::TLV::ContextTag(1), true);
+                apCommandObj->FinishCommand();
+            }
+            else
+            {
+                apCommandObj->AddStatus(aCommandPath, Protocols::InteractionModel::Status::Failure);
+            }
+        }
         else
         {
-            apCommandObj->PrepareCommand(aCommandPath);
+            apCommandObj->PrepareCommand(aCommandPath, aCommandPath);
             chip::TLV::TLVWriter * writer = apCommandObj->GetCommandDataIBTLVWriter();
             writer->PutBoolean(chip::TLV::ContextTag(1), true);
             apCommandObj->FinishCommand();
@@ -244,7 +282,7 @@ public:
     static void TestCommandHandlerWithSendEmptyResponse(nlTestSuite * apSuite, void * apContext);
 
     static void TestCommandHandlerWithProcessReceivedEmptyDataMsg(nlTestSuite * apSuite, void * apContext);
-    static void TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerRejectDuplicateCommands(nlTestSuite * apSuite, void * apContext);
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     static void TestCommandHandlerReleaseWithExchangeClosed(nlTestSuite * apSuite, void * apContext);
@@ -254,6 +292,9 @@ public:
     static void TestCommandSenderCommandAsyncSuccessResponseFlow(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderCommandFailureResponseFlow(nlTestSuite * apSuite, void * apContext);
     static void TestCommandSenderCommandSpecificResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderBatchedCommands(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandHandlerSinglePathResponseInBatch(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderChunkedResponses(nlTestSuite * apSuite, void * apContext);
 
     static void TestCommandSenderAbruptDestruction(nlTestSuite * apSuite, void * apContext);
 
@@ -462,7 +503,7 @@ void TestCommandInteraction::AddInvokeResponseData(nlTestSuite * apSuite, void *
     else
     {
         ConcreteCommandPath path = { kTestEndpointId, kTestClusterId, aCommandId };
-        err                      = apCommandHandler->PrepareCommand(path);
+        err                      = apCommandHandler->PrepareCommand(path, path);
         NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
         chip::TLV::TLVWriter * writer = apCommandHandler->GetCommandDataIBTLVWriter();
@@ -495,7 +536,7 @@ void TestCommandInteraction::TestCommandHandlerWithWrongState(nlTestSuite * apSu
 
     app::CommandHandler commandHandler(&mockCommandHandlerDelegate);
 
-    err = commandHandler.PrepareCommand(path);
+    err = commandHandler.PrepareCommand(path, path);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
     TestExchangeDelegate delegate;
@@ -532,8 +573,10 @@ void TestCommandInteraction::TestCommandSenderWithSendCommand(nlTestSuite * apSu
     ctx.DrainAndServiceIO();
 
     GenerateInvokeResponse(apSuite, apContext, buf, kTestCommandIdWithData);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::TestCommandHandlerWithSendEmptyCommand(nlTestSuite * apSuite, void * apContext)
@@ -549,7 +592,7 @@ void TestCommandInteraction::TestCommandHandlerWithSendEmptyCommand(nlTestSuite
     auto exchange = ctx.NewExchangeToAlice(&delegate, false);
     commandHandler.mExchangeCtx.Grab(exchange);
 
-    err = commandHandler.PrepareCommand(path);
+    err = commandHandler.PrepareCommand(path, path);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     err = commandHandler.FinishCommand();
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
@@ -569,8 +612,10 @@ void TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg(nlTestSuite
     System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
 
     GenerateInvokeResponse(apSuite, apContext, buf, kTestCommandIdWithData);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode)
@@ -616,6 +661,7 @@ void TestCommandInteraction::TestCommandHandlerWithSendSimpleCommandData(nlTestS
 struct Fields
 {
     static constexpr chip::CommandId GetCommandId() { return 4; }
+    static constexpr bool MustUseTimedInvoke() { return false; }
     CHIP_ERROR Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
     {
         TLV::TLVType outerContainerType;
@@ -1223,6 +1269,125 @@ void TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow(nlTest
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+void TestCommandInteraction::TestCommandSenderBatchedCommands(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+    MockCommandSenderCallback unsupportedCommandCallback;
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdWithData), Fields());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdCommandSpecificResponse), Fields());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    // The response to this one goes to its own callback.
+    err = commandSender.AddRequestData(MakeTestCommandPath(kTestNonExistCommandId), Fields(), unsupportedCommandCallback);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, commandSender.GetCommandCount() == 3);
+
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == 2 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onErrorCalledTimes == 0);
+    NL_TEST_ASSERT(apSuite,
+                   unsupportedCommandCallback.onResponseCalledTimes == 0 && unsupportedCommandCallback.onFinalCalledTimes == 0 &&
+                       unsupportedCommandCallback.onErrorCalledTimes == 1);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandHandlerSinglePathResponseInBatch(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    // A response prepared with the response path only is matched with the command of a single-command request.
+    {
+        mockCommandSenderDelegate.ResetCounter();
+        singlePathPrepareError = CHIP_ERROR_INTERNAL;
+        app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+        err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdSinglePathResponse), Fields());
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, singlePathPrepareError == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite,
+                       mockCommandSenderDelegate.onResponseCalledTimes == 1 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                           mockCommandSenderDelegate.onErrorCalledTimes == 0);
+    }
+
+    // In a batched request, it cannot be matched with a command and is refused: the command gets a failure status instead,
+    // and the other commands are not affected.
+    {
+        mockCommandSenderDelegate.ResetCounter();
+        singlePathPrepareError = CHIP_NO_ERROR;
+        app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+        err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdSinglePathResponse), Fields());
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdWithData), Fields());
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+        err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(apSuite, singlePathPrepareError == CHIP_ERROR_INCORRECT_STATE);
+        NL_TEST_ASSERT(apSuite,
+                       mockCommandSenderDelegate.onResponseCalledTimes == 1 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                           mockCommandSenderDelegate.onErrorCalledTimes == 1);
+        NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.mError == CHIP_IM_GLOBAL_STATUS(Failure));
+    }
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestCommandInteraction::TestCommandSenderChunkedResponses(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    // The responses to these do not fit in a single InvokeResponse.
+    for (CommandId i = 0; i < CHIP_IM_MAX_COMMANDS_PER_INVOKE; i++)
+    {
+        err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdLargeResponseBase + i), Fields());
+        NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    }
+
+    err = commandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdLargeResponseBase + CHIP_IM_MAX_COMMANDS_PER_INVOKE),
+                                       Fields());
+    NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NO_MEMORY);
+
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == CHIP_IM_MAX_COMMANDS_PER_INVOKE &&
+                       mockCommandSenderDelegate.onFinalCalledTimes == 1 && mockCommandSenderDelegate.onErrorCalledTimes == 0);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 void TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -1289,7 +1454,7 @@ void TestCommandInteraction::TestCommandSenderAbruptDestruction(nlTestSuite * ap
     NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
 }
 
-void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext)
+void TestCommandInteraction::TestCommandHandlerRejectDuplicateCommands(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
     CHIP_ERROR err    = CHIP_NO_ERROR;
@@ -1304,7 +1469,8 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
 
         commandSender.AllocateBuffer();
 
-        // CommandSender does not support sending multiple commands with public API, so we craft a message manaully.
+        // CommandSender gives each command a reference, and does not check the paths, so we craft a message with two commands
+        // with the same path and no references manually.
         for (int i = 0; i < 2; i++)
         {
             InvokeRequests::Builder & invokeRequests = commandSender.mInvokeRequestBuilder.GetInvokeRequests();
@@ -1324,10 +1490,7 @@ void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuit
             NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.EndOfCommandDataIB().GetError());
         }
 
-        NL_TEST_ASSERT(apSuite,
-                       CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
-
+        // The message is closed when the request is sent.
         commandSender.MoveToState(app::CommandSender::State::AddedCommand);
     }
 
@@ -1402,7 +1565,7 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedNotExistCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistCommand),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedEmptyDataMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg),
-    NL_TEST_DEF("TestCommandHandlerRejectMultipleCommands", chip::app::TestCommandInteraction::TestCommandHandlerRejectMultipleCommands),
+    NL_TEST_DEF("TestCommandHandlerRejectDuplicateCommands", chip::app::TestCommandInteraction::TestCommandHandlerRejectDuplicateCommands),
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     NL_TEST_DEF("TestCommandHandlerReleaseWithExchangeClosed", chip::app::TestCommandInteraction::TestCommandHandlerReleaseWithExchangeClosed),
@@ -1411,6 +1574,9 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandSenderCommandSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandAsyncSuccessResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandAsyncSuccessResponseFlow),
     NL_TEST_DEF("TestCommandSenderCommandSpecificResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandSpecificResponseFlow),
+    NL_TEST_DEF("TestCommandSenderBatchedCommands", chip::app::TestCommandInteraction::TestCommandSenderBatchedCommands),
+    NL_TEST_DEF("TestCommandHandlerSinglePathResponseInBatch", chip::app::TestCommandInteraction::TestCommandHandlerSinglePathResponseInBatch),
+    NL_TEST_DEF("TestCommandSenderChunkedResponses", chip::app::TestCommandInteraction::TestCommandSenderChunkedResponses),
     NL_TEST_DEF("TestCommandSenderCommandFailureResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderCommandFailureResponseFlow),
     NL_TEST_DEF("TestCommandSenderAbruptDestruction", chip::app::TestCommandInteraction::TestCommandSenderAbruptDestruction),
     NL_TEST_DEF("TestCommandHandlerInvalidMessageSync", chip::app::TestCommandInteraction::TestCommandHandlerInvalidMessageSync),
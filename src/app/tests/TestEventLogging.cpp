@@ -268,6 +268,18 @@ static void CheckLogEventWithEvictToNextBuffer(nlTestSuite * apSuite, void * apC
     paths[0].mpNext = &paths[1];
     // first path is not wildcard, second path is wildcard path at default, expect to retrieve all events
     CheckLogReadOut(apSuite, logMgmt, 0, 6, pathsWithWildcard);
+
+    // starting past the last event, expect to retrieve nothing and to continue after the last event
+    CheckLogReadOut(apSuite, logMgmt, eid6 + 1, 0, &pathsWithWildcard[1]);
+
+    chip::TLV::TLVWriter writer;
+    uint8_t backingStore[256];
+    chip::EventNumber eventMin = eid6 + 1;
+    size_t eventCount          = 0;
+    writer.Init(backingStore);
+    err = logMgmt.FetchEventsSince(writer, &pathsWithWildcard[1], eventMin, eventCount, chip::Access::SubjectDescriptor{});
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventCount == 0 && eventMin == eid6 + 1);
 }
 
 static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apContext)
@@ -311,12 +323,348 @@ static void CheckLogEventWithDiscardLowEvent(nlTestSuite * apSuite, void * apCon
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
     CheckLogState(apSuite, logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
+// Epoch time of system time zero in the run that logged the restored events.
+constexpr chip::System::Clock::Milliseconds64 kSystemTimeEpoch(1600000000000);
+
+static void CheckLogEventRestore(nlTestSuite * apSuite, void * apContext)
+{
+    chip::app::ObjectList<chip::app::EventPathParams> path;
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    chip::EventNumber lastEventNumber    = logMgmt.GetLastEventNumber();
+    uint8_t * const eventBuffers[]       = { gDebugEventBuffer, gInfoEventBuffer, gCritEventBuffer };
+    uint8_t savedEventBuffers[3][sizeof(gDebugEventBuffer)];
+    uint32_t headOffsets[3];
+    uint32_t dataLengths[3];
+    size_t eventCount = 0;
+
+    chip::TLV::TLVWriter writer;
+    uint8_t backingStore[1024];
+    chip::EventNumber eventMin = 0;
+    writer.Init(backingStore);
+    NL_TEST_ASSERT(apSuite,
+                   logMgmt.FetchEventsSince(writer, &path, eventMin, eventCount, chip::Access::SubjectDescriptor{}) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, eventCount > 0);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        memcpy(savedEventBuffers[i], eventBuffers[i], sizeof(savedEventBuffers[i]));
+        headOffsets[i] = gCircularEventBuffer[i].GetOffset(gCircularEventBuffer[i].QueueHead());
+        dataLengths[i] = gCircularEventBuffer[i].DataLength();
+    }
+
+    // Simulate a restart with buffers kept in persistent storage
+    chip::app::LogStorageResources logStorageResources[] = {
+        { &gDebugEventBuffer[0], sizeof(gDebugEventBuffer), chip::app::PriorityLevel::Debug },
+        { &gInfoEventBuffer[0], sizeof(gInfoEventBuffer), chip::app::PriorityLevel::Info },
+        { &gCritEventBuffer[0], sizeof(gCritEventBuffer), chip::app::PriorityLevel::Critical },
+    };
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> eventCounter;
+    auto restart = [&](chip::EventNumber aNextEventNumber) {
+        chip::app::EventManagement::DestroyEventManagement();
+        NL_TEST_ASSERT(apSuite, eventCounter.Init(aNextEventNumber) == CHIP_NO_ERROR);
+        chip::app::EventManagement::CreateEventManagement(nullptr, 3, gCircularEventBuffer, logStorageResources, &eventCounter);
+        for (size_t i = 0; i < 3; i++)
+        {
+            memcpy(eventBuffers[i], savedEventBuffers[i], sizeof(savedEventBuffers[i]));
+            NL_TEST_ASSERT(apSuite, gCircularEventBuffer[i].RestoreQueue(headOffsets[i], dataLengths[i]) == CHIP_NO_ERROR);
+        }
+    };
+
+    // system timestamps of the previous run are turned into epoch timestamps; the longer timestamps may push the oldest
+    // events out, but the last one is kept
+    restart(lastEventNumber);
+    NL_TEST_ASSERT(apSuite, logMgmt.LoadRestoredEvents(chip::MakeOptional(kSystemTimeEpoch)) == CHIP_NO_ERROR);
+    CheckLogReadOut(apSuite, logMgmt, lastEventNumber - 1, 1, &path);
+
+    size_t restoredEventCount = 0;
+    eventMin                  = 0;
+    writer.Init(backingStore);
+    NL_TEST_ASSERT(apSuite,
+                   logMgmt.FetchEventsSince(writer, &path, eventMin, restoredEventCount, chip::Access::SubjectDescriptor{}) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, restoredEventCount > 0 && restoredEventCount <= eventCount);
+
+    chip::TLV::TLVReader reader;
+    chip::app::EventReportIB::Parser report;
+    chip::app::EventDataIB::Parser data;
+    uint64_t timestamp = 0;
+    reader.Init(backingStore, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, report.Init(reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, report.GetEventData(&data) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, data.GetSystemTimestamp(&timestamp) == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(apSuite, data.GetEpochTimestamp(&timestamp) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, timestamp >= kSystemTimeEpoch.count());
+
+    // without the epoch time of the previous run, events with a system timestamp are dropped
+    restart(lastEventNumber);
+    NL_TEST_ASSERT(apSuite, logMgmt.LoadRestoredEvents(chip::NullOptional) == CHIP_NO_ERROR);
+    CheckLogReadOut(apSuite, logMgmt, 0, 0, &path);
+
+    // restored events must be older than the next event number, or they are dropped
+    restart(lastEventNumber - 1);
+    NL_TEST_ASSERT(apSuite, logMgmt.LoadRestoredEvents(chip::MakeOptional(kSystemTimeEpoch)) == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    CheckLogReadOut(apSuite, logMgmt, 0, 0, &path);
+}
+
+// Buffers holding more events than the index, so that the index wraps around and only covers the newest events.
+static uint8_t gLargeDebugEventBuffer[1024];
+static uint8_t gLargeInfoEventBuffer[1024];
+static uint8_t gLargeCritEventBuffer[1024];
+static chip::app::CircularEventBuffer gLargeCircularEventBuffer[3];
+
+constexpr size_t kMaxStoredEvents = 128;
+
+struct StoredEvent
+{
+    chip::EventNumber mEventNumber = 0;
+    uint32_t mOffset               = 0;
+    chip::app::ConcreteEventPath mPath;
+    chip::Optional<chip::FabricIndex> mFabricIndex;
+};
+
+static CHIP_ERROR DecodeStoredEvent(const chip::TLV::TLVReader & aReader, StoredEvent & aEvent)
+{
+    chip::app::EventReportIB::Parser report;
+    chip::app::EventDataIB::Parser data;
+    chip::app::EventPathIB::Parser path;
+    chip::TLV::TLVReader reader;
+
+    ReturnErrorOnFailure(report.Init(aReader));
+    ReturnErrorOnFailure(report.GetEventData(&data));
+    ReturnErrorOnFailure(data.GetEventNumber(&aEvent.mEventNumber));
+    ReturnErrorOnFailure(data.GetPath(&path));
+    ReturnErrorOnFailure(path.GetEndpoint(&aEvent.mPath.mEndpointId));
+    ReturnErrorOnFailure(path.GetCluster(&aEvent.mPath.mClusterId));
+    ReturnErrorOnFailure(path.GetEvent(&aEvent.mPath.mEventId));
+
+    // The parser's reader is inside the EventDataIB structure.
+    data.GetReader(&reader);
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (reader.GetTag() == chip::TLV::ProfileTag(chip::app::kEventManagementProfile, chip::app::kFabricIndexTag))
+        {
+            chip::FabricIndex fabricIndex;
+            ReturnErrorOnFailure(reader.Get(fabricIndex));
+            aEvent.mFabricIndex.SetValue(fabricIndex);
+        }
+    }
+    return err == CHIP_END_OF_TLV ? CHIP_NO_ERROR : err;
+}
+
+// Decodes every event of a single buffer, oldest first.
+static size_t CollectBufferEvents(nlTestSuite * apSuite, chip::app::CircularEventBuffer & aBuffer, StoredEvent * apEvents)
+{
+    chip::TLV::CircularTLVReader reader;
+    const uint32_t headOffset = aBuffer.GetOffset(aBuffer.QueueHead());
+    uint32_t eventStart       = 0;
+    size_t count              = 0;
+
+    reader.Init(aBuffer);
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        NL_TEST_ASSERT(apSuite, count < kMaxStoredEvents);
+        NL_TEST_ASSERT(apSuite, DecodeStoredEvent(reader, apEvents[count]) == CHIP_NO_ERROR);
+        apEvents[count].mOffset = (headOffset + eventStart) % aBuffer.GetTotalDataLength();
+        count++;
+        NL_TEST_ASSERT(apSuite, reader.Skip() == CHIP_NO_ERROR);
+        eventStart = reader.GetLengthRead();
+    }
+    return count;
+}
+
+// Checks that the index of a buffer describes its newest events.
+static void CheckIndexInSync(nlTestSuite * apSuite, chip::app::CircularEventBuffer & aBuffer)
+{
+    StoredEvent events[kMaxStoredEvents];
+    size_t count     = CollectBufferEvents(apSuite, aBuffer, events);
+    size_t indexSize = aBuffer.GetIndexSize();
+
+    NL_TEST_ASSERT(apSuite, indexSize == std::min(count, static_cast<size_t>(CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE)));
+    NL_TEST_ASSERT(apSuite, aBuffer.IsFullyIndexed() == (indexSize == count));
+    for (size_t i = 0; i < indexSize && i < count; i++)
+    {
+        const chip::app::EventIndexEntry & entry = aBuffer.GetIndexEntry(i);
+        const StoredEvent & event                = events[count - indexSize + i];
+        NL_TEST_ASSERT(apSuite, entry.mEventNumber == event.mEventNumber);
+        NL_TEST_ASSERT(apSuite, entry.mOffset == event.mOffset);
+        NL_TEST_ASSERT(apSuite, chip::app::ConcreteEventPath(entry.mEndpointId, entry.mClusterId, entry.mEventId) == event.mPath);
+        NL_TEST_ASSERT(apSuite, entry.mFabricIndex == event.mFabricIndex);
+    }
+}
+
+// Checks FetchEventsSince against a scan of every stored event, for every starting event number.
+static void CheckFetchMatchesFullScan(nlTestSuite * apSuite, chip::app::EventManagement & aLogMgmt,
+                                      const chip::app::ObjectList<chip::app::EventPathParams> * apPaths,
+                                      chip::FabricIndex aFabricIndex)
+{
+    StoredEvent events[kMaxStoredEvents];
+    size_t count = 0;
+
+    // Buffers are read from the most important one, which holds the oldest events.
+    for (size_t i = 3; i > 0; i--)
+    {
+        count += CollectBufferEvents(apSuite, gLargeCircularEventBuffer[i - 1], &events[count]);
+    }
+    NL_TEST_ASSERT(apSuite, count > 0);
+
+    chip::Access::SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = aFabricIndex;
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    VerifyOrDie(backingStore.Alloc(4096));
+
+    chip::EventNumber firstEventMin = (events[0].mEventNumber > 0) ? events[0].mEventNumber - 1 : 0;
+    for (chip::EventNumber eventMin = firstEventMin; eventMin <= events[count - 1].mEventNumber + 1; eventMin++)
+    {
+        chip::TLV::TLVWriter writer;
+        chip::EventNumber nextEventMin = eventMin;
+        size_t eventCount              = 0;
+
+        writer.Init(backingStore.Get(), 4096);
+        NL_TEST_ASSERT(apSuite,
+                       aLogMgmt.FetchEventsSince(writer, apPaths, nextEventMin, eventCount, subjectDescriptor) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, nextEventMin == events[count - 1].mEventNumber + 1);
+
+        chip::TLV::TLVReader reader;
+        size_t fetched = 0;
+        reader.Init(backingStore.Get(), writer.GetLengthWritten());
+        for (size_t i = 0; i < count; i++)
+        {
+            const StoredEvent & event = events[i];
+            bool interested           = false;
+            for (auto * path = apPaths; path != nullptr; path = path->mpNext)
+            {
+                interested = interested || path->mValue.IsEventPathSupersetOf(event.mPath);
+            }
+            if (event.mEventNumber < eventMin || !interested ||
+                (event.mFabricIndex.HasValue() &&
+                 (event.mFabricIndex.Value() == chip::kUndefinedFabricIndex || event.mFabricIndex.Value() != aFabricIndex)))
+            {
+                continue;
+            }
+
+            StoredEvent fetchedEvent;
+            NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, DecodeStoredEvent(reader, fetchedEvent) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(apSuite, fetchedEvent.mEventNumber == event.mEventNumber);
+            fetched++;
+        }
+        NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_END_OF_TLV);
+        NL_TEST_ASSERT(apSuite, eventCount == fetched);
+    }
+}
+
+static void CheckEventIndexState(nlTestSuite * apSuite, chip::app::EventManagement & aLogMgmt)
+{
+    chip::app::ObjectList<chip::app::EventPathParams> wildcardPath;
+    chip::app::ObjectList<chip::app::EventPathParams> paths[2];
+
+    paths[0].mValue.mEndpointId = kTestEndpointId1;
+    paths[0].mValue.mClusterId  = kLivenessClusterId;
+    paths[1].mValue.mEndpointId = kTestEndpointId2;
+    paths[1].mValue.mClusterId  = kLivenessClusterId;
+    paths[1].mValue.mEventId    = kLivenessChangeEvent;
+
+    for (auto & buffer : gLargeCircularEventBuffer)
+    {
+        CheckIndexInSync(apSuite, buffer);
+    }
+
+    // Events are logged for fabrics 1 and 2 or for no fabric; fabric 2 is read like fabric 1.
+    for (chip::FabricIndex fabricIndex = chip::kUndefinedFabricIndex; fabricIndex <= 1; fabricIndex++)
+    {
+        CheckFetchMatchesFullScan(apSuite, aLogMgmt, &wildcardPath, fabricIndex);
+        CheckFetchMatchesFullScan(apSuite, aLogMgmt, &paths[0], fabricIndex);
+        CheckFetchMatchesFullScan(apSuite, aLogMgmt, &paths[1], fabricIndex);
+    }
+}
+
+static void LogIndexTestEvents(nlTestSuite * apSuite, chip::app::EventManagement & aLogMgmt, size_t aNumEvents)
+{
+    static const chip::app::PriorityLevel kPriorities[] = { chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Info,
+                                                            chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Critical,
+                                                            chip::app::PriorityLevel::Info };
+    static size_t sEventIndex = 0;
+    TestEventGenerator testEventGenerator;
+
+    for (size_t i = 0; i < aNumEvents; i++, sEventIndex++)
+    {
+        chip::app::EventOptions options;
+        chip::EventNumber eventNumber;
+
+        chip::EndpointId endpointId = (sEventIndex % 2) ? kTestEndpointId1 : kTestEndpointId2;
+        chip::EventId eventId       = static_cast<chip::EventId>(kLivenessChangeEvent + sEventIndex % 3);
+
+        options.mPath        = { endpointId, kLivenessClusterId, eventId };
+        options.mPriority    = kPriorities[sEventIndex % ArraySize(kPriorities)];
+        options.mFabricIndex = static_cast<chip::FabricIndex>(sEventIndex % 3);
+        testEventGenerator.SetStatus(static_cast<int32_t>(sEventIndex));
+        NL_TEST_ASSERT(apSuite, aLogMgmt.LogEvent(&testEventGenerator, options, eventNumber) == CHIP_NO_ERROR);
+    }
+}
+
+static void CheckEventIndex(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                    = *static_cast<TestContext *>(apContext);
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> eventCounter;
+    chip::app::LogStorageResources logStorageResources[] = {
+        { &gLargeDebugEventBuffer[0], sizeof(gLargeDebugEventBuffer), chip::app::PriorityLevel::Debug },
+        { &gLargeInfoEventBuffer[0], sizeof(gLargeInfoEventBuffer), chip::app::PriorityLevel::Info },
+        { &gLargeCritEventBuffer[0], sizeof(gLargeCritEventBuffer), chip::app::PriorityLevel::Critical },
+    };
+
+    NL_TEST_ASSERT(apSuite, eventCounter.Init(0) == CHIP_NO_ERROR);
+    chip::app::EventManagement::DestroyEventManagement();
+    chip::app::EventManagement::CreateEventManagement(&ctx.GetExchangeManager(), 3, gLargeCircularEventBuffer,
+                                                      logStorageResources, &eventCounter);
+
+    // A few events, all of them indexed.
+    LogIndexTestEvents(apSuite, logMgmt, 5);
+    CheckEventIndexState(apSuite, logMgmt);
+
+    // Fill the buffers: the index wraps around, and events are evicted or moved to the next buffer.
+    for (size_t round = 0; round < 12; round++)
+    {
+        LogIndexTestEvents(apSuite, logMgmt, 12);
+        CheckEventIndexState(apSuite, logMgmt);
+    }
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    NL_TEST_ASSERT(apSuite, gLargeCircularEventBuffer[0].GetIndexSize() == CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE);
+    NL_TEST_ASSERT(apSuite, !gLargeCircularEventBuffer[0].IsFullyIndexed());
+#endif
+
+    // Events of a removed fabric are neither fetched nor reported as indexed for it.
+    NL_TEST_ASSERT(apSuite, logMgmt.FabricRemoved(1) == CHIP_NO_ERROR);
+    CheckEventIndexState(apSuite, logMgmt);
+    LogIndexTestEvents(apSuite, logMgmt, 7);
+    CheckEventIndexState(apSuite, logMgmt);
+
+    // An invalidated index is not used until it is rebuilt, and fetching falls back to scanning.
+    gLargeCircularEventBuffer[1].InvalidateIndex();
+    NL_TEST_ASSERT(apSuite, !gLargeCircularEventBuffer[1].IsFullyIndexed());
+    for (chip::FabricIndex fabricIndex = chip::kUndefinedFabricIndex; fabricIndex <= 1; fabricIndex++)
+    {
+        chip::app::ObjectList<chip::app::EventPathParams> wildcardPath;
+        CheckFetchMatchesFullScan(apSuite, logMgmt, &wildcardPath, fabricIndex);
+    }
+    NL_TEST_ASSERT(apSuite, logMgmt.LoadRestoredEvents(chip::MakeOptional(kSystemTimeEpoch)) == CHIP_NO_ERROR);
+    CheckEventIndexState(apSuite, logMgmt);
+
+    chip::app::EventManagement::DestroyEventManagement();
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
 
 const nlTest sTests[] = { NL_TEST_DEF("CheckLogEventWithEvictToNextBuffer", CheckLogEventWithEvictToNextBuffer),
-                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent), NL_TEST_SENTINEL() };
+                          NL_TEST_DEF("CheckLogEventWithDiscardLowEvent", CheckLogEventWithDiscardLowEvent),
+                          NL_TEST_DEF("CheckLogEventRestore", CheckLogEventRestore),
+                          NL_TEST_DEF("CheckEventIndex", CheckEventIndex), NL_TEST_SENTINEL() };
 
 // clang-format off
 nlTestSuite sSuite =
@@ -0,0 +1,328 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a test for keeping the event log in a memory-mapped file across restarts.
+ */
+
+#include <access/SubjectDescriptor.h>
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <app/MappedEventLogStorage.h>
+#include <app/MessageDef/EventReportIB.h>
+#include <app/ObjectList.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+using TestContext = chip::Test::AppContext;
+
+constexpr ClusterId kLivenessClusterId = 0x00000022;
+constexpr EventId kLivenessChangeEvent = 1;
+constexpr EndpointId kTestEndpointId   = 2;
+constexpr uint32_t kBufferSize         = 256;
+constexpr uint32_t kNumBuffers         = 3;
+constexpr System::Clock::Milliseconds64 kRealTime(1650000000000);
+
+app::CircularEventBuffer gCircularEventBuffer[kNumBuffers];
+
+class TestEventGenerator : public app::EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(TLV::ContextTag(to_underlying(app::EventDataIB::Tag::kData)),
+                                                    TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(1), mStatus));
+        return aWriter.EndContainer(dataContainerType);
+    }
+
+    int32_t mStatus = 0;
+};
+
+class ScopedMockClock
+{
+public:
+    ScopedMockClock() : mRealClock(System::SystemClock()) { System::Clock::Internal::SetSystemClockForTesting(&mMockClock); }
+    ~ScopedMockClock() { System::Clock::Internal::SetSystemClockForTesting(&mRealClock); }
+
+    System::Clock::Internal::MockClock & Get() { return mMockClock; }
+
+private:
+    System::Clock::ClockBase & mRealClock;
+    System::Clock::Internal::MockClock mMockClock;
+};
+
+/// One run of the application: storage mapped from the file, then EventManagement restoring the events in it.
+class Run
+{
+public:
+    Run(nlTestSuite * apSuite, TestContext & aContext, const char * apPath, EventNumber aNextEventNumber) : mpSuite(apSuite)
+    {
+        app::LogStorageResources resources[] = {
+            { nullptr, kBufferSize, app::PriorityLevel::Debug },
+            { nullptr, kBufferSize, app::PriorityLevel::Info },
+            { nullptr, kBufferSize, app::PriorityLevel::Critical },
+        };
+
+        NL_TEST_ASSERT(apSuite, mEventCounter.Init(aNextEventNumber) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, mStorage.Init(apPath, resources, kNumBuffers, &aContext.GetSystemLayer()) == CHIP_NO_ERROR);
+        app::EventManagement::CreateEventManagement(&aContext.GetExchangeManager(), kNumBuffers, gCircularEventBuffer, resources,
+                                                    &mEventCounter);
+        mRestoreError = mStorage.Restore(app::EventManagement::GetInstance(), gCircularEventBuffer);
+    }
+
+    ~Run()
+    {
+        app::EventManagement::DestroyEventManagement();
+        mStorage.Shutdown();
+    }
+
+    void LogEvents(size_t aCount)
+    {
+        TestEventGenerator generator;
+        app::EventOptions options;
+        EventNumber eventNumber;
+
+        options.mPath     = { kTestEndpointId, kLivenessClusterId, kLivenessChangeEvent };
+        options.mPriority = app::PriorityLevel::Info;
+        for (size_t i = 0; i < aCount; i++)
+        {
+            generator.mStatus = static_cast<int32_t>(i);
+            CHIP_ERROR err = app::EventManagement::GetInstance().LogEvent(&generator, options, eventNumber);
+            NL_TEST_ASSERT(mpSuite, err == CHIP_NO_ERROR);
+        }
+    }
+
+    // Fetch all events, and the epoch timestamp of the first one if it has one.
+    size_t FetchEvents(Optional<uint64_t> & aFirstEpochTimestamp)
+    {
+        app::ObjectList<app::EventPathParams> path;
+        TLV::TLVWriter writer;
+        TLV::TLVReader reader;
+        uint8_t backingStore[1024];
+        EventNumber eventMin = 0;
+        size_t eventCount    = 0;
+
+        writer.Init(backingStore);
+        CHIP_ERROR err =
+            app::EventManagement::GetInstance().FetchEventsSince(writer, &path, eventMin, eventCount, Access::SubjectDescriptor{});
+        NL_TEST_ASSERT(mpSuite, err == CHIP_NO_ERROR || err == CHIP_END_OF_TLV);
+
+        reader.Init(backingStore, writer.GetLengthWritten());
+        if (reader.Next() == CHIP_NO_ERROR)
+        {
+            app::EventReportIB::Parser report;
+            app::EventDataIB::Parser data;
+            uint64_t timestamp;
+            NL_TEST_ASSERT(mpSuite, report.Init(reader) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(mpSuite, report.GetEventData(&data) == CHIP_NO_ERROR);
+            if (data.GetEpochTimestamp(&timestamp) == CHIP_NO_ERROR)
+            {
+                aFirstEpochTimestamp.SetValue(timestamp);
+            }
+        }
+        return eventCount;
+    }
+
+    CHIP_ERROR mRestoreError = CHIP_NO_ERROR;
+
+private:
+    nlTestSuite * mpSuite;
+    MonotonicallyIncreasingCounter<EventNumber> mEventCounter;
+    app::MappedEventLogStorage mStorage;
+};
+
+class ScopedTempFile
+{
+public:
+    ScopedTempFile()
+    {
+        int fd = mkstemp(mPath);
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+    ~ScopedTempFile() { unlink(mPath); }
+
+    const char * Get() const { return mPath; }
+
+private:
+    char mPath[64] = "/tmp/TestMappedEventLogStorage-XXXXXX";
+};
+
+bool CopyFile(const char * apFrom, const char * apTo)
+{
+    uint8_t data[kBufferSize];
+    FILE * from = fopen(apFrom, "rb");
+    FILE * to   = fopen(apTo, "wb");
+    bool copied = (from != nullptr && to != nullptr);
+    size_t length;
+
+    while (copied && (length = fread(data, 1, sizeof(data), from)) > 0)
+    {
+        copied = fwrite(data, 1, length, to) == length;
+    }
+    if (from != nullptr)
+    {
+        fclose(from);
+    }
+    if (to != nullptr)
+    {
+        fclose(to);
+    }
+    return copied;
+}
+
+void CheckRestoreAfterRestart(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    ScopedTempFile file;
+    EventNumber nextEventNumber;
+    Optional<uint64_t> firstEpochTimestamp;
+
+    clock.Get().SetMonotonic(5000_ms64);
+    clock.Get().SetClock_RealTime(kRealTime);
+    {
+        Run run(apSuite, ctx, file.Get(), 0);
+        NL_TEST_ASSERT(apSuite, run.mRestoreError == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 0);
+        run.LogEvents(3);
+        nextEventNumber = app::EventManagement::GetInstance().GetLastEventNumber();
+    }
+
+    // After a reboot, system time starts over: the events come back with the epoch time at which they were logged.
+    clock.Get().SetMonotonic(100_ms64);
+    clock.Get().AdvanceRealTime(60000_ms64);
+    {
+        Run run(apSuite, ctx, file.Get(), nextEventNumber);
+        NL_TEST_ASSERT(apSuite, run.mRestoreError == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 3);
+        NL_TEST_ASSERT(apSuite, firstEpochTimestamp.HasValue() && firstEpochTimestamp.Value() == kRealTime.count());
+
+        // Events of this run keep a system timestamp, and are reported along with the restored ones.
+        run.LogEvents(1);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 4);
+    }
+}
+
+void CheckHeaderFollowsEvents(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    ScopedTempFile file;
+    ScopedTempFile crashFile;
+    EventNumber nextEventNumber;
+    Optional<uint64_t> firstEpochTimestamp;
+
+    clock.Get().SetMonotonic(5000_ms64);
+    clock.Get().SetClock_RealTime(kRealTime);
+    {
+        Run run(apSuite, ctx, file.Get(), 0);
+        run.LogEvents(2);
+        nextEventNumber = app::EventManagement::GetInstance().GetLastEventNumber();
+    }
+    {
+        Run run(apSuite, ctx, file.Get(), nextEventNumber);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 2);
+
+        // The flush timer has not fired: the file holds the new events, but the header does not point at them yet.
+        run.LogEvents(2);
+        nextEventNumber = app::EventManagement::GetInstance().GetLastEventNumber();
+        NL_TEST_ASSERT(apSuite, CopyFile(file.Get(), crashFile.Get()));
+    }
+
+    // A crash at that point only loses the events logged since the last flush.
+    {
+        Run run(apSuite, ctx, crashFile.Get(), nextEventNumber);
+        NL_TEST_ASSERT(apSuite, run.mRestoreError == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 2);
+    }
+
+    // A clean shutdown flushes them.
+    {
+        Run run(apSuite, ctx, file.Get(), nextEventNumber);
+        NL_TEST_ASSERT(apSuite, run.mRestoreError == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 4);
+    }
+}
+
+void CheckRestoreWithoutRealTime(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    ScopedTempFile file;
+    EventNumber nextEventNumber;
+    Optional<uint64_t> firstEpochTimestamp;
+
+    // Without the real time, the system timestamps of the events cannot be placed after a reboot: they are dropped.
+    clock.Get().SetMonotonic(5000_ms64);
+    {
+        Run run(apSuite, ctx, file.Get(), 0);
+        run.LogEvents(3);
+        nextEventNumber = app::EventManagement::GetInstance().GetLastEventNumber();
+    }
+    {
+        Run run(apSuite, ctx, file.Get(), nextEventNumber);
+        NL_TEST_ASSERT(apSuite, run.mRestoreError == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, run.FetchEvents(firstEpochTimestamp) == 0);
+    }
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("CheckRestoreAfterRestart", CheckRestoreAfterRestart),
+    NL_TEST_DEF("CheckHeaderFollowsEvents", CheckHeaderFollowsEvents),
+    NL_TEST_DEF("CheckRestoreWithoutRealTime", CheckRestoreWithoutRealTime),
+    NL_TEST_SENTINEL(),
+};
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "MappedEventLogStorage",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestMappedEventLogStorage()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMappedEventLogStorage)
@@ -0,0 +1,566 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the admission control of the re-subscriptions.
+ *
+ *      No CASESessionManager is given to the InteractionModelEngine of the tests, so an admitted
+ *      client closes itself right away: its OnDone() callback tells the order of the admissions.
+ */
+
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ResubscriptionScheduler.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#include <vector>
+
+using TestContext = chip::Test::AppContext;
+
+namespace chip {
+namespace app {
+
+namespace {
+
+using namespace System::Clock::Literals;
+
+constexpr FabricIndex kFabric = 1;
+
+class ScopedMockClock
+{
+public:
+    ScopedMockClock() : mRealClock(System::SystemClock())
+    {
+        mMockClock.SetMonotonic(System::Clock::Milliseconds64(1000));
+        System::Clock::Internal::SetSystemClockForTesting(&mMockClock);
+    }
+    ~ScopedMockClock() { System::Clock::Internal::SetSystemClockForTesting(&mRealClock); }
+
+    void Advance(System::Clock::Milliseconds64 aIncrement) { mMockClock.AdvanceMonotonic(aIncrement); }
+
+private:
+    System::Clock::ClockBase & mRealClock;
+    System::Clock::Internal::MockClock mMockClock;
+};
+
+/// Records the order in which the clients are admitted.
+class TestCallback : public ReadClient::Callback
+{
+public:
+    TestCallback(std::vector<int> & aAdmitted, int aId) : mAdmitted(aAdmitted), mId(aId) {}
+
+    void OnError(CHIP_ERROR aError) override { mError = aError; }
+
+    void OnDone(ReadClient * apReadClient) override
+    {
+        mAdmitted.push_back(mId);
+        if (mpOnAdmitted != nullptr)
+        {
+            mpOnAdmitted(mpOnAdmittedContext);
+        }
+    }
+
+    std::vector<int> & mAdmitted;
+    int mId;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+
+    // Run from within the admission of the client.
+    void (*mpOnAdmitted)(void * apContext) = nullptr;
+    void * mpOnAdmittedContext             = nullptr;
+};
+
+} // namespace
+
+class TestResubscriptionScheduler
+{
+public:
+    static void TestRefillTokens(nlTestSuite * apSuite, void * apContext);
+    static void TestThrottling(nlTestSuite * apSuite, void * apContext);
+    static void TestPriorityOrder(nlTestSuite * apSuite, void * apContext);
+    static void TestPeerCoalescing(nlTestSuite * apSuite, void * apContext);
+    static void TestCancelWhileQueued(nlTestSuite * apSuite, void * apContext);
+    static void TestReentrantAdmission(nlTestSuite * apSuite, void * apContext);
+    static void TestDisabled(nlTestSuite * apSuite, void * apContext);
+
+private:
+    static ResubscriptionScheduler & Scheduler() { return InteractionModelEngine::GetInstance()->GetResubscriptionScheduler(); }
+
+    static void ResetScheduler(uint16_t aBurst, System::Clock::Milliseconds32 aInterval)
+    {
+        Scheduler().Shutdown();
+        Scheduler().SetAdmissionLimit(aBurst, aInterval);
+        Scheduler().Init();
+    }
+
+    static void RestoreScheduler()
+    {
+        ResetScheduler(CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_BURST,
+                       System::Clock::Milliseconds32(CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_INTERVAL_MS));
+    }
+
+    static void RequestAdmission(ReadClient & aReadClient, NodeId aNodeId,
+                                 ResubscriptionPriority aPriority = ResubscriptionPriority::kNormal, FabricIndex aFabric = kFabric)
+    {
+        aReadClient.mPeer                                      = ScopedNodeId(aNodeId, aFabric);
+        aReadClient.mReadPrepareParams.mResubscriptionPriority = aPriority;
+        Scheduler().RequestAdmission(&aReadClient);
+    }
+
+    // What the admission timer does once it fires.
+    static void FireAdmissionTimer() { ResubscriptionScheduler::OnAdmissionTimerCallback(nullptr, &Scheduler()); }
+
+    static bool IsWaiting(const ReadClient & aReadClient) { return aReadClient.mWaitingForResubscriptionAdmission; }
+
+    static ReadClient * NewReadClient(TestContext & aContext, TestCallback & aCallback)
+    {
+        return Platform::New<ReadClient>(InteractionModelEngine::GetInstance(), &aContext.GetExchangeManager(), aCallback,
+                                         ReadClient::InteractionType::Subscribe);
+    }
+
+    static void RequestAdmissionOnAdmitted(void * apContext);
+    static void DeleteOnAdmitted(void * apContext);
+};
+
+void TestResubscriptionScheduler::TestRefillTokens(nlTestSuite * apSuite, void * apContext)
+{
+    ScopedMockClock clock;
+    ResubscriptionScheduler & scheduler = Scheduler();
+
+    ResetScheduler(3, 100_ms32);
+    System::Clock::Timestamp start = scheduler.mLastRefillTime;
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 3);
+
+    // Whole intervals add a token each, and the remainder counts towards the next one.
+    scheduler.mTokens = 0;
+    scheduler.RefillTokens(start + 250_ms64);
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 2);
+    NL_TEST_ASSERT(apSuite, scheduler.mLastRefillTime == start + 200_ms64);
+
+    scheduler.RefillTokens(start + 299_ms64);
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 2);
+    NL_TEST_ASSERT(apSuite, scheduler.mLastRefillTime == start + 200_ms64);
+
+    // Filling the bucket restarts the interval at the time it got full.
+    scheduler.RefillTokens(start + 300_ms64);
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 3);
+    NL_TEST_ASSERT(apSuite, scheduler.mLastRefillTime == start + 300_ms64);
+
+    // A full bucket does not keep tokens for later: the next one is due an interval after it is first used.
+    scheduler.RefillTokens(start + 10000_ms64);
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 3);
+    NL_TEST_ASSERT(apSuite, scheduler.mLastRefillTime == start + 10000_ms64);
+
+    // A long wait does not overflow the bucket.
+    scheduler.mTokens = 1;
+    scheduler.RefillTokens(start + 1000000_ms64);
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 3);
+    NL_TEST_ASSERT(apSuite, scheduler.mLastRefillTime == start + 1000000_ms64);
+
+    // Without an interval, the bucket is always full.
+    ResetScheduler(3, 0_ms32);
+    scheduler.mTokens = 0;
+    scheduler.RefillTokens(scheduler.mLastRefillTime);
+    NL_TEST_ASSERT(apSuite, scheduler.mTokens == 3);
+
+    RestoreScheduler();
+}
+
+void TestResubscriptionScheduler::TestThrottling(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    std::vector<int> admitted;
+
+    ResetScheduler(2, 100_ms32);
+    {
+        TestCallback callback0(admitted, 0), callback1(admitted, 1), callback2(admitted, 2), callback3(admitted, 3),
+            callback4(admitted, 4);
+        ReadClient client0(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback0,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client1(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback1,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client2(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback2,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client3(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback3,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client4(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback4,
+                           ReadClient::InteractionType::Subscribe);
+
+        // The burst is admitted before RequestAdmission returns, the other clients wait.
+        RequestAdmission(client0, 100);
+        RequestAdmission(client1, 101);
+        RequestAdmission(client2, 102);
+        RequestAdmission(client3, 103);
+        RequestAdmission(client4, 104);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1 }));
+        NL_TEST_ASSERT(apSuite, callback0.mError == CHIP_ERROR_INCORRECT_STATE);
+        NL_TEST_ASSERT(apSuite, IsWaiting(client2) && IsWaiting(client3) && IsWaiting(client4));
+
+        // Nothing more before the next token.
+        clock.Advance(99_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted.size() == 2);
+
+        clock.Advance(51_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1, 2 }));
+
+        // The 50 ms over the first interval count towards the second one.
+        clock.Advance(50_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1, 2, 3 }));
+
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1, 2, 3, 4 }));
+
+        const ResubscriptionScheduler::Metrics & metrics = Scheduler().GetMetrics();
+        NL_TEST_ASSERT(apSuite, metrics.mQueueDepth == 0);
+        NL_TEST_ASSERT(apSuite, metrics.mPeakQueueDepth == 3);
+        NL_TEST_ASSERT(apSuite, metrics.mAdmittedCount == 5);
+        NL_TEST_ASSERT(apSuite, metrics.mCoalescedCount == 0);
+        NL_TEST_ASSERT(apSuite, metrics.mTotalWaitTime == 150_ms64 + 200_ms64 + 300_ms64);
+        NL_TEST_ASSERT(apSuite, metrics.mMaxWaitTime == 300_ms64);
+    }
+
+    RestoreScheduler();
+}
+
+void TestResubscriptionScheduler::TestPriorityOrder(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    std::vector<int> admitted;
+
+    ResetScheduler(1, 100_ms32);
+    {
+        TestCallback callback0(admitted, 0), callbackLow(admitted, 1), callbackNormal1(admitted, 2),
+            callbackHigh(admitted, 3), callbackNormal2(admitted, 4);
+        ReadClient client0(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback0,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient clientLow(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callbackLow,
+                             ReadClient::InteractionType::Subscribe);
+        ReadClient clientNormal1(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callbackNormal1,
+                                 ReadClient::InteractionType::Subscribe);
+        ReadClient clientHigh(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callbackHigh,
+                              ReadClient::InteractionType::Subscribe);
+        ReadClient clientNormal2(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callbackNormal2,
+                                 ReadClient::InteractionType::Subscribe);
+
+        // The first client takes the only token, so that the others are queued.
+        RequestAdmission(client0, 100, ResubscriptionPriority::kLow);
+        RequestAdmission(clientLow, 101, ResubscriptionPriority::kLow);
+        RequestAdmission(clientNormal1, 102, ResubscriptionPriority::kNormal);
+        RequestAdmission(clientHigh, 103, ResubscriptionPriority::kHigh);
+        RequestAdmission(clientNormal2, 104, ResubscriptionPriority::kNormal);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0 }));
+
+        // Requesting admission again does not queue a client twice.
+        RequestAdmission(clientNormal1, 102, ResubscriptionPriority::kNormal);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 4);
+
+        for (int i = 0; i < 4; i++)
+        {
+            clock.Advance(100_ms64);
+            FireAdmissionTimer();
+        }
+
+        // By priority, then in order of arrival.
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 3, 2, 4, 1 }));
+    }
+
+    RestoreScheduler();
+}
+
+void TestResubscriptionScheduler::TestPeerCoalescing(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    std::vector<int> admitted;
+
+    ResetScheduler(1, 100_ms32);
+    {
+        TestCallback callback0(admitted, 0), callback1(admitted, 1), callback2(admitted, 2), callback3(admitted, 3),
+            callback4(admitted, 4), callback5(admitted, 5);
+        ReadClient client0(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback0,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client1(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback1,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client2(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback2,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client3(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback3,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client4(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback4,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client5(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback5,
+                           ReadClient::InteractionType::Subscribe);
+
+        RequestAdmission(client0, 100);
+        RequestAdmission(client1, 200, ResubscriptionPriority::kNormal);
+        RequestAdmission(client2, 100, ResubscriptionPriority::kLow);
+        RequestAdmission(client3, 200, ResubscriptionPriority::kHigh);
+        // The same node id on another fabric is another peer.
+        RequestAdmission(client4, 200, ResubscriptionPriority::kLow, kFabric + 1);
+        RequestAdmission(client5, 200, ResubscriptionPriority::kLow);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0 }));
+
+        // Admitting the client of the highest priority admits the other clients to its peer, whatever their priority.
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 3, 1, 5 }));
+        NL_TEST_ASSERT(apSuite, IsWaiting(client2) && IsWaiting(client4));
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mCoalescedCount == 2);
+
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 3, 1, 5, 2 }));
+
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 3, 1, 5, 2, 4 }));
+
+        const ResubscriptionScheduler::Metrics & metrics = Scheduler().GetMetrics();
+        NL_TEST_ASSERT(apSuite, metrics.mQueueDepth == 0);
+        NL_TEST_ASSERT(apSuite, metrics.mPeakQueueDepth == 5);
+        NL_TEST_ASSERT(apSuite, metrics.mAdmittedCount == 6);
+        NL_TEST_ASSERT(apSuite, metrics.mCoalescedCount == 2);
+        NL_TEST_ASSERT(apSuite, metrics.mMaxWaitTime == 300_ms64);
+    }
+
+    RestoreScheduler();
+}
+
+void TestResubscriptionScheduler::TestCancelWhileQueued(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    std::vector<int> admitted;
+
+    ResetScheduler(1, 100_ms32);
+    {
+        TestCallback callback0(admitted, 0), callback1(admitted, 1), callback2(admitted, 2), callback3(admitted, 3),
+            callback4(admitted, 4);
+        ReadClient client0(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback0,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client3(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback3,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient * client1 = NewReadClient(ctx, callback1);
+        ReadClient * client2 = NewReadClient(ctx, callback2);
+        ReadClient * client4 = NewReadClient(ctx, callback4);
+        NL_TEST_ASSERT(apSuite, client1 != nullptr && client2 != nullptr && client4 != nullptr);
+
+        RequestAdmission(client0, 100);
+        RequestAdmission(*client1, 101);
+        RequestAdmission(*client2, 102);
+        RequestAdmission(client3, 103);
+        RequestAdmission(*client4, 104);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 4);
+
+        // Destroying queued clients withdraws them, from the middle, the head and the tail of the queue.
+        Platform::Delete(client2);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 3);
+        Platform::Delete(client1);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 2);
+        Platform::Delete(client4);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 1);
+
+        // Cancelling a client that is not queued does nothing.
+        Scheduler().CancelAdmission(&client0);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 1);
+
+        // A client queued afterwards goes after the remaining one.
+        RequestAdmission(client0, 100);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 2);
+
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 3 }));
+
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 3, 0 }));
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 0);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mAdmittedCount == 3);
+    }
+
+    RestoreScheduler();
+}
+
+namespace {
+
+struct ReentrantContext
+{
+    ReadClient * mpReadClient;
+    std::vector<int> * mpAdmitted;
+    size_t mAdmittedInCallback;
+};
+
+} // namespace
+
+void TestResubscriptionScheduler::RequestAdmissionOnAdmitted(void * apContext)
+{
+    ReentrantContext * context = static_cast<ReentrantContext *>(apContext);
+    RequestAdmission(*context->mpReadClient, 300);
+    context->mAdmittedInCallback = context->mpAdmitted->size();
+}
+
+void TestResubscriptionScheduler::DeleteOnAdmitted(void * apContext)
+{
+    ReentrantContext * context = static_cast<ReentrantContext *>(apContext);
+    Platform::Delete(context->mpReadClient);
+    context->mpReadClient        = nullptr;
+    context->mAdmittedInCallback = context->mpAdmitted->size();
+}
+
+void TestResubscriptionScheduler::TestReentrantAdmission(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    std::vector<int> admitted;
+
+    ResetScheduler(2, 100_ms32);
+    {
+        TestCallback callback0(admitted, 0), callback1(admitted, 1), callback2(admitted, 2), callback3(admitted, 3);
+        ReadClient client0(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback0,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client1(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback1,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client2(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback2,
+                           ReadClient::InteractionType::Subscribe);
+
+        // A client requesting admission from within the admission of another one is admitted by the outer call, once
+        // the callback returned, with the tokens left.
+        ReentrantContext requestContext = { &client1, &admitted, 0 };
+        callback0.mpOnAdmitted          = RequestAdmissionOnAdmitted;
+        callback0.mpOnAdmittedContext   = &requestContext;
+
+        RequestAdmission(client0, 100);
+        NL_TEST_ASSERT(apSuite, requestContext.mAdmittedInCallback == 1);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1 }));
+        NL_TEST_ASSERT(apSuite, !IsWaiting(client1));
+
+        // Out of tokens, a client queued from a callback waits for the next one.
+        callback2.mpOnAdmitted        = RequestAdmissionOnAdmitted;
+        requestContext.mpReadClient   = &client0;
+        callback2.mpOnAdmittedContext = &requestContext;
+
+        clock.Advance(100_ms64);
+        RequestAdmission(client2, 102);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1, 2 }));
+        NL_TEST_ASSERT(apSuite, IsWaiting(client0));
+
+        // A client destroyed from within the admission of another one is withdrawn before its turn, even when it would
+        // have been admitted along with it as a client to the same peer.
+        ReadClient * client3           = NewReadClient(ctx, callback3);
+        ReentrantContext deleteContext = { client3, &admitted, 0 };
+        callback0.mpOnAdmitted         = DeleteOnAdmitted;
+        callback0.mpOnAdmittedContext  = &deleteContext;
+        RequestAdmission(*client3, 300);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 2);
+
+        clock.Advance(100_ms64);
+        FireAdmissionTimer();
+        NL_TEST_ASSERT(apSuite, deleteContext.mpReadClient == nullptr);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1, 2, 0 }));
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 0);
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mAdmittedCount == 4);
+    }
+
+    RestoreScheduler();
+}
+
+void TestResubscriptionScheduler::TestDisabled(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    ScopedMockClock clock;
+    std::vector<int> admitted;
+
+    ResetScheduler(1, 100_ms32);
+    {
+        TestCallback callback0(admitted, 0), callback1(admitted, 1), callback2(admitted, 2);
+        ReadClient client0(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback0,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client1(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback1,
+                           ReadClient::InteractionType::Subscribe);
+        ReadClient client2(InteractionModelEngine::GetInstance(), &ctx.GetExchangeManager(), callback2,
+                           ReadClient::InteractionType::Subscribe);
+
+        RequestAdmission(client0, 100);
+        RequestAdmission(client1, 101);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0 }));
+
+        // Disabling admission control admits the clients waiting for it, and those requesting it afterwards.
+        Scheduler().SetAdmissionLimit(0, 100_ms32);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1 }));
+        RequestAdmission(client2, 102);
+        RequestAdmission(client0, 100);
+        NL_TEST_ASSERT(apSuite, admitted == std::vector<int>({ 0, 1, 2, 0 }));
+        NL_TEST_ASSERT(apSuite, Scheduler().GetMetrics().mQueueDepth == 0);
+    }
+
+    RestoreScheduler();
+}
+
+} // namespace app
+} // namespace chip
+
+namespace {
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestRefillTokens", chip::app::TestResubscriptionScheduler::TestRefillTokens),
+    NL_TEST_DEF("TestThrottling", chip::app::TestResubscriptionScheduler::TestThrottling),
+    NL_TEST_DEF("TestPriorityOrder", chip::app::TestResubscriptionScheduler::TestPriorityOrder),
+    NL_TEST_DEF("TestPeerCoalescing", chip::app::TestResubscriptionScheduler::TestPeerCoalescing),
+    NL_TEST_DEF("TestCancelWhileQueued", chip::app::TestResubscriptionScheduler::TestCancelWhileQueued),
+    NL_TEST_DEF("TestReentrantAdmission", chip::app::TestResubscriptionScheduler::TestReentrantAdmission),
+    NL_TEST_DEF("TestDisabled", chip::app::TestResubscriptionScheduler::TestDisabled),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestResubscriptionScheduler",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestResubscriptionScheduler()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestResubscriptionScheduler)
@@ -0,0 +1,314 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the table-driven struct codec of the
+ *      cluster objects.
+ *
+ */
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <app/data-model/DecodableList.h>
+#include <app/data-model/StructCodec.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <stddef.h>
+#include <string.h>
+#include <type_traits>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+namespace {
+
+using SimpleStruct = TestCluster::Structs::SimpleStruct::Type;
+using SimpleFields = TestCluster::Structs::SimpleStruct::Fields;
+
+// The table the generated code uses for SimpleStruct when CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC is set.
+const DataModel::FieldDescriptor kSimpleStructFields[] = {
+    DataModel::Field<decltype(SimpleStruct::a), to_underlying(SimpleFields::kA), offsetof(SimpleStruct, a)>(),
+    DataModel::Field<decltype(SimpleStruct::b), to_underlying(SimpleFields::kB), offsetof(SimpleStruct, b)>(),
+    DataModel::Field<decltype(SimpleStruct::c), to_underlying(SimpleFields::kC), offsetof(SimpleStruct, c)>(),
+    DataModel::Field<decltype(SimpleStruct::d), to_underlying(SimpleFields::kD), offsetof(SimpleStruct, d)>(),
+    DataModel::Field<decltype(SimpleStruct::e), to_underlying(SimpleFields::kE), offsetof(SimpleStruct, e)>(),
+    DataModel::Field<decltype(SimpleStruct::f), to_underlying(SimpleFields::kF), offsetof(SimpleStruct, f)>(),
+    DataModel::Field<decltype(SimpleStruct::g), to_underlying(SimpleFields::kG), offsetof(SimpleStruct, g)>(),
+    DataModel::Field<decltype(SimpleStruct::h), to_underlying(SimpleFields::kH), offsetof(SimpleStruct, h)>(),
+    DataModel::kEndOfFields,
+};
+
+struct FabricScopedStruct
+{
+    uint8_t plain = 0;
+    Optional<uint16_t> sensitive;
+    DataModel::Nullable<uint8_t> nullableSensitive;
+    FabricIndex fabricIndex = kUndefinedFabricIndex;
+};
+
+const DataModel::FieldDescriptor kFabricScopedStructFields[] = {
+    DataModel::Field<uint8_t, 1, offsetof(FabricScopedStruct, plain)>(),
+    DataModel::Field<Optional<uint16_t>, 2, offsetof(FabricScopedStruct, sensitive)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::Field<DataModel::Nullable<uint8_t>, 3, offsetof(FabricScopedStruct, nullableSensitive)>(
+        DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::Field<FabricIndex, 254, offsetof(FabricScopedStruct, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+
+// Holding a DecodableList makes it non-standard-layout, like the DecodableType of the cluster objects holding lists.
+struct ListStruct
+{
+    uint8_t plain = 0;
+    DataModel::DecodableList<uint16_t> list;
+    Optional<uint8_t> optional;
+};
+
+static_assert(!std::is_standard_layout<ListStruct>::value, "ListStruct must exercise the member pointer fields");
+
+const DataModel::FieldDescriptor kListStructFields[] = {
+    DataModel::DecodableMemberField<ListStruct, uint8_t, &ListStruct::plain, 0>(),
+    DataModel::DecodableMemberField<ListStruct, DataModel::DecodableList<uint16_t>, &ListStruct::list, 1>(),
+    DataModel::DecodableMemberField<ListStruct, Optional<uint8_t>, &ListStruct::optional, 2>(),
+    DataModel::kEndOfFields,
+};
+
+SimpleStruct MakeSimpleStruct()
+{
+    SimpleStruct value;
+    value.a = 20;
+    value.b = true;
+    value.c = TestCluster::SimpleEnum::kValueB;
+    value.d = ByteSpan(reinterpret_cast<const uint8_t *>("bytes"), 5);
+    value.e = CharSpan::fromCharString("characters");
+    value.f = BitMask<TestCluster::SimpleBitmap>(TestCluster::SimpleBitmap::kValueC);
+    value.g = 1.5f;
+    value.h = 2.25;
+    return value;
+}
+
+bool SameSimpleStruct(const SimpleStruct & lhs, const SimpleStruct & rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c && lhs.d.data_equal(rhs.d) && lhs.e.data_equal(rhs.e) &&
+        lhs.f == rhs.f && lhs.g == rhs.g && lhs.h == rhs.h;
+}
+
+CHIP_ERROR SetupReader(TLV::TLVReader & reader, const uint8_t * buf, uint32_t len)
+{
+    reader.Init(buf, len);
+    return reader.Next();
+}
+
+/**
+ * Decode the fabric-scoped test struct encoded in @p buf and tell which of its fields were present.
+ */
+CHIP_ERROR DecodeFieldTags(const uint8_t * buf, uint32_t len, uint32_t & tagMask)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TLV::TLVReader reader;
+    TLV::TLVType outer;
+
+    tagMask = 0;
+    ReturnErrorOnFailure(SetupReader(reader, buf, len));
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        uint32_t tagNum = TLV::TagNumFromTag(reader.GetTag());
+        tagMask |= (tagNum == 254) ? (1u << 31) : (1u << tagNum);
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return reader.ExitContainer(outer);
+}
+
+void TestStructCodec_MatchesGeneratedCode(nlTestSuite * inSuite, void * inContext)
+{
+    const SimpleStruct value = MakeSimpleStruct();
+    uint8_t generatedBuf[128];
+    uint8_t tableBuf[128];
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+    SimpleStruct decoded;
+
+    writer.Init(generatedBuf);
+    NL_TEST_ASSERT(inSuite, value.Encode(writer, TLV::AnonymousTag()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    uint32_t generatedLen = writer.GetLengthWritten();
+
+    writer.Init(tableBuf);
+    NL_TEST_ASSERT(inSuite, DataModel::EncodeStruct(writer, TLV::AnonymousTag(), &value, kSimpleStructFields) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == generatedLen);
+    NL_TEST_ASSERT(inSuite, memcmp(generatedBuf, tableBuf, generatedLen) == 0);
+
+    NL_TEST_ASSERT(inSuite, SetupReader(reader, tableBuf, generatedLen) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DataModel::DecodeStruct(reader, &decoded, kSimpleStructFields) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, SameSimpleStruct(value, decoded));
+}
+
+void TestStructCodec_DecodeAnyOrder(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+    TLV::TLVType outer;
+    SimpleStruct decoded;
+
+    // Fields out of order, along with unknown and non-context-tagged elements that must be skipped.
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::ContextTag(to_underlying(SimpleFields::kH)), 4.5) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::ContextTag(20), static_cast<uint8_t>(7)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::ProfileTag(0x1234, 0), static_cast<uint8_t>(8)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::ContextTag(to_underlying(SimpleFields::kA)), static_cast<uint8_t>(9)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutBoolean(TLV::ContextTag(to_underlying(SimpleFields::kB)), true) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, SetupReader(reader, buf, writer.GetLengthWritten()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DataModel::DecodeStruct(reader, &decoded, kSimpleStructFields) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, decoded.a == 9);
+    NL_TEST_ASSERT(inSuite, decoded.b);
+    NL_TEST_ASSERT(inSuite, decoded.h == 4.5);
+    NL_TEST_ASSERT(inSuite, decoded.e.empty());
+
+    // A field of the wrong type fails the decode.
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutString(TLV::ContextTag(to_underlying(SimpleFields::kA)), "a") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, SetupReader(reader, buf, writer.GetLengthWritten()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DataModel::DecodeStruct(reader, &decoded, kSimpleStructFields) != CHIP_NO_ERROR);
+}
+
+void TestStructCodec_FabricScoped(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kPlain       = 1u << 1;
+    constexpr uint32_t kSensitive   = (1u << 2) | (1u << 3);
+    constexpr uint32_t kFabricIndex = 1u << 31;
+
+    FabricScopedStruct value;
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+    uint32_t tagMask;
+
+    value.plain       = 1;
+    value.sensitive   = MakeOptional(static_cast<uint16_t>(1000));
+    value.fabricIndex = 2;
+    value.nullableSensitive.SetNull();
+
+    // Written by a client: no fabric index.
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite,
+                   DataModel::EncodeFabricScopedStruct(writer, TLV::AnonymousTag(), &value, kFabricScopedStructFields, NullOptional,
+                                                       value.fabricIndex) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DecodeFieldTags(buf, writer.GetLengthWritten(), tagMask) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tagMask == (kPlain | kSensitive));
+
+    // Read by the fabric of the struct: everything.
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite,
+                   DataModel::EncodeFabricScopedStruct(writer, TLV::AnonymousTag(), &value, kFabricScopedStructFields,
+                                                       MakeOptional(value.fabricIndex), value.fabricIndex) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DecodeFieldTags(buf, writer.GetLengthWritten(), tagMask) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tagMask == (kPlain | kSensitive | kFabricIndex));
+
+    FabricScopedStruct decoded;
+    NL_TEST_ASSERT(inSuite, SetupReader(reader, buf, writer.GetLengthWritten()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DataModel::DecodeStruct(reader, &decoded, kFabricScopedStructFields) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, decoded.plain == value.plain);
+    NL_TEST_ASSERT(inSuite, decoded.sensitive == value.sensitive);
+    NL_TEST_ASSERT(inSuite, decoded.nullableSensitive.IsNull());
+    NL_TEST_ASSERT(inSuite, decoded.fabricIndex == value.fabricIndex);
+
+    // Read by another fabric: the fabric-sensitive fields are left out.
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite,
+                   DataModel::EncodeFabricScopedStruct(writer, TLV::AnonymousTag(), &value, kFabricScopedStructFields,
+                                                       MakeOptional(static_cast<FabricIndex>(3)), value.fabricIndex) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DecodeFieldTags(buf, writer.GetLengthWritten(), tagMask) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, tagMask == (kPlain | kFabricIndex));
+}
+
+void TestStructCodec_MemberFields(nlTestSuite * inSuite, void * inContext)
+{
+    const uint16_t values[] = { 1, 2, 3 };
+    uint8_t buf[64];
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+    TLV::TLVType outer;
+    ListStruct decoded;
+
+    writer.Init(buf);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::ContextTag(2), static_cast<uint8_t>(5)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   DataModel::Encode(writer, TLV::ContextTag(1), DataModel::List<const uint16_t>(values)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(TLV::ContextTag(0), static_cast<uint8_t>(7)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, SetupReader(reader, buf, writer.GetLengthWritten()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DataModel::DecodeStruct(reader, &decoded, kListStructFields) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, decoded.plain == 7);
+    NL_TEST_ASSERT(inSuite, decoded.optional == MakeOptional(static_cast<uint8_t>(5)));
+
+    size_t count  = 0;
+    auto iterator = decoded.list.begin();
+    while (iterator.Next())
+    {
+        NL_TEST_ASSERT(inSuite, count < ArraySize(values) && iterator.GetValue() == values[count]);
+        count++;
+    }
+    NL_TEST_ASSERT(inSuite, iterator.GetStatus() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, count == ArraySize(values));
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test struct codec matches generated code", TestStructCodec_MatchesGeneratedCode),
+    NL_TEST_DEF("Test struct codec decode in any order", TestStructCodec_DecodeAnyOrder),
+    NL_TEST_DEF("Test struct codec fabric-scoped struct", TestStructCodec_FabricScoped),
+    NL_TEST_DEF("Test struct codec member pointer fields", TestStructCodec_MemberFields),
+
+    NL_TEST_SENTINEL()
+};
+
+} // namespace
+
+int TestStructCodec()
+{
+    nlTestSuite theSuite = { "StructCodec tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestStructCodec);
@@ -0,0 +1,188 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of BulkCommissioner.
+ *
+ */
+
+#include <controller/BulkCommissioner.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR BulkCommissioner::Init(System::Layer * systemLayer, DeviceCommissioner * const * commissioners,
+                                  size_t commissionerCount, Delegate * delegate)
+{
+    VerifyOrReturnError(mSlots.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(commissioners != nullptr && commissionerCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(delegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    for (size_t i = 0; i < commissionerCount; ++i)
+    {
+        VerifyOrReturnError(commissioners[i] != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    mSystemLayer = systemLayer;
+    mDelegate    = delegate;
+
+    // Slots are registered as pairing delegates, so they must never move once created.
+    mSlots.reserve(commissionerCount);
+    for (size_t i = 0; i < commissionerCount; ++i)
+    {
+        mSlots.emplace_back(this, commissioners[i]);
+        commissioners[i]->RegisterPairingDelegate(&mSlots.back());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void BulkCommissioner::Shutdown()
+{
+    VerifyOrReturn(!mSlots.empty());
+
+    mSystemLayer->CancelTimer(DispatchPending, this);
+
+    for (auto & slot : mSlots)
+    {
+        if (slot.mCommissioner->GetPairingDelegate() == &slot)
+        {
+            slot.mCommissioner->RegisterPairingDelegate(nullptr);
+        }
+        if (!slot.IsIdle())
+        {
+            StopCommissioning(*slot.mCommissioner, slot.mNodeId.Value());
+        }
+    }
+
+    mSlots.clear();
+    mPending     = std::queue<Job>();
+    mDelegate    = nullptr;
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR BulkCommissioner::Enqueue(NodeId remoteDeviceId, const char * setUpCode, const CommissioningParameters & params,
+                                     DiscoveryType discoveryType)
+{
+    VerifyOrReturnError(!mSlots.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(setUpCode != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mPending.push(Job{ remoteDeviceId, setUpCode, params, discoveryType });
+    ScheduleDispatch();
+    return CHIP_NO_ERROR;
+}
+
+size_t BulkCommissioner::GetInFlightCount() const
+{
+    size_t count = 0;
+    for (const auto & slot : mSlots)
+    {
+        count += slot.IsIdle() ? 0 : 1;
+    }
+    return count;
+}
+
+CommissioningStageMetrics BulkCommissioner::GetCommissioningStageMetrics() const
+{
+    CommissioningStageMetrics metrics;
+    for (const auto & slot : mSlots)
+    {
+        metrics.Merge(slot.mCommissioner->GetCommissioningStageMetrics());
+    }
+    return metrics;
+}
+
+void BulkCommissioner::ScheduleDispatch()
+{
+    // Dispatch from a fresh stack frame: completion callbacks are delivered while the commissioner
+    // is still cleaning up after the previous device.  A timer rather than ScheduleWork, so that
+    // requests coalesce and Shutdown can cancel the pending one.
+    CHIP_ERROR err = mSystemLayer->StartTimer(System::Clock::kZero, DispatchPending, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to schedule bulk commissioning dispatch: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void BulkCommissioner::DispatchPending(System::Layer * systemLayer, void * appState)
+{
+    static_cast<BulkCommissioner *>(appState)->DispatchPending();
+}
+
+void BulkCommissioner::DispatchPending()
+{
+    for (auto & slot : mSlots)
+    {
+        // A device that fails to start leaves the slot idle: hand it the next one right away.
+        while (slot.IsIdle() && !mPending.empty())
+        {
+            Job job = std::move(mPending.front());
+            mPending.pop();
+
+            ChipLogProgress(Controller, "Bulk commissioning node 0x" ChipLogFormatX64 " (%u queued)", ChipLogValueX64(job.nodeId),
+                            static_cast<unsigned>(mPending.size()));
+
+            slot.mNodeId.SetValue(job.nodeId);
+            CHIP_ERROR err =
+                StartCommissioning(*slot.mCommissioner, job.nodeId, job.setUpCode.c_str(), job.params, job.discoveryType);
+            if (err != CHIP_NO_ERROR)
+            {
+                slot.mNodeId.ClearValue();
+                mDelegate->OnDeviceCommissioned(job.nodeId, err);
+            }
+        }
+    }
+
+    if (mPending.empty() && GetInFlightCount() == 0)
+    {
+        mDelegate->OnAllDevicesCommissioned();
+    }
+}
+
+void BulkCommissioner::OnSlotDone(Slot & slot, CHIP_ERROR error)
+{
+    VerifyOrReturn(!slot.IsIdle());
+
+    NodeId nodeId = slot.mNodeId.Value();
+    slot.mNodeId.ClearValue();
+
+    mDelegate->OnDeviceCommissioned(nodeId, error);
+    ScheduleDispatch();
+}
+
+void BulkCommissioner::Slot::OnPairingComplete(CHIP_ERROR error)
+{
+    // On success, commissioning continues and completion is reported through OnCommissioningComplete.
+    if (error != CHIP_NO_ERROR)
+    {
+        mOwner->OnSlotDone(*this, error);
+    }
+}
+
+void BulkCommissioner::Slot::OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error)
+{
+    VerifyOrReturn(mNodeId.HasValue() && mNodeId.Value() == deviceId);
+    mOwner->OnSlotDone(*this, error);
+}
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,154 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of BulkCommissioner, a scheduler that commissions many
+ *      devices concurrently by spreading them over a set of DeviceCommissioner
+ *      instances, each running its own AutoCommissioner state machine.
+ *
+ */
+
+#pragma once
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/CommissioningStageMetrics.h>
+#include <controller/DevicePairingDelegate.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/DLLUtil.h>
+#include <system/SystemLayer.h>
+
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * A DeviceCommissioner only tracks a single commissionee at a time. BulkCommissioner keeps a queue
+ * of devices to commission and hands them out to a pool of DeviceCommissioner instances, so that
+ * up to one device per commissioner is in flight at any time. Each commissioner establishes its own
+ * PASE session and runs its own attestation and NOC issuance; they share the process-wide device
+ * attestation verifier (and therefore its PAA trust store) and, if the caller configured them that
+ * way, the same OperationalCredentialsDelegate.
+ *
+ * The commissioners must be initialized on the same fabric (see ControllerInitParams::permitMultiControllerFabrics)
+ * and are owned by the caller. BulkCommissioner registers itself as their pairing delegate.
+ *
+ * All methods must be called with the CHIP stack lock held.
+ */
+class DLL_EXPORT BulkCommissioner
+{
+public:
+    class Delegate
+    {
+    public:
+        virtual ~Delegate() {}
+
+        /**
+         * Called when a queued device has finished commissioning, successfully or not.
+         */
+        virtual void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) = 0;
+
+        /**
+         * Called when the queue becomes empty and no commissioning is in flight anymore.
+         */
+        virtual void OnAllDevicesCommissioned() {}
+    };
+
+    BulkCommissioner() = default;
+    virtual ~BulkCommissioner() { Shutdown(); }
+
+    BulkCommissioner(const BulkCommissioner &) = delete;
+    BulkCommissioner & operator=(const BulkCommissioner &) = delete;
+
+    CHIP_ERROR Init(System::Layer * systemLayer, DeviceCommissioner * const * commissioners, size_t commissionerCount,
+                    Delegate * delegate);
+    void Shutdown();
+
+    /**
+     * Queue a device for commissioning. It is dispatched to the first idle commissioner.
+     *
+     * Buffers referenced by `params` (e.g. network credentials) must outlive the commissioning of the device.
+     */
+    CHIP_ERROR Enqueue(NodeId remoteDeviceId, const char * setUpCode, const CommissioningParameters & params,
+                       DiscoveryType discoveryType = DiscoveryType::kAll);
+
+    size_t GetPendingCount() const { return mPending.size(); }
+    size_t GetInFlightCount() const;
+
+    /**
+     * Per-stage latency metrics accumulated over all the commissioners in the pool.
+     */
+    CommissioningStageMetrics GetCommissioningStageMetrics() const;
+
+protected:
+    /**
+     * Start commissioning a device on one of the commissioners of the pool.  Completion is reported through the
+     * pairing delegate of the commissioner.
+     */
+    virtual CHIP_ERROR StartCommissioning(DeviceCommissioner & commissioner, NodeId remoteDeviceId, const char * setUpCode,
+                                          const CommissioningParameters & params, DiscoveryType discoveryType)
+    {
+        return commissioner.PairDevice(remoteDeviceId, setUpCode, params, discoveryType);
+    }
+
+    virtual void StopCommissioning(DeviceCommissioner & commissioner, NodeId remoteDeviceId)
+    {
+        commissioner.StopPairing(remoteDeviceId);
+    }
+
+private:
+    struct Job
+    {
+        NodeId nodeId;
+        std::string setUpCode;
+        CommissioningParameters params;
+        DiscoveryType discoveryType;
+    };
+
+    class Slot : public DevicePairingDelegate
+    {
+    public:
+        Slot(BulkCommissioner * owner, DeviceCommissioner * commissioner) : mOwner(owner), mCommissioner(commissioner) {}
+
+        bool IsIdle() const { return !mNodeId.HasValue(); }
+
+        void OnPairingComplete(CHIP_ERROR error) override;
+        void OnCommissioningComplete(NodeId deviceId, CHIP_ERROR error) override;
+
+        BulkCommissioner * mOwner;
+        DeviceCommissioner * mCommissioner;
+        Optional<NodeId> mNodeId;
+    };
+
+    static void DispatchPending(System::Layer * systemLayer, void * appState);
+    void DispatchPending();
+    void ScheduleDispatch();
+    void OnSlotDone(Slot & slot, CHIP_ERROR error);
+
+    System::Layer * mSystemLayer = nullptr;
+    Delegate * mDelegate         = nullptr;
+    std::vector<Slot> mSlots;
+    std::queue<Job> mPending;
+};
+
+} // namespace Controller
+} // namespace chip
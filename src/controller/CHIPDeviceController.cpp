@@ -685,6 +685,7 @@ CHIP_ERROR DeviceCommissioner::EstablishPASEConnection(NodeId remoteDeviceId, Re
     VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
     mDeviceInPASEEstablishment = device;
+    mPASEStartTime             = System::SystemClock().GetMonotonicTimestamp();
     device->Init(GetControllerDeviceInitParams(), remoteDeviceId, peerAddress);
 
 #if CONFIG_NETWORK_LAYER_BLE
@@ -872,6 +873,11 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
 
 void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
 {
+    if (mDeviceInPASEEstablishment != nullptr)
+    {
+        RecordStageLatency(CommissioningStage::kSecurePairing, mPASEStartTime, err);
+    }
+
     if (mPairingDelegate != nullptr)
     {
         mPairingDelegate->OnStatusUpdate(DevicePairingDelegate::SecurePairingFailed);
@@ -899,6 +905,7 @@ void DeviceCommissioner::OnSessionEstablished(const SessionHandle & session)
     }
 
     ChipLogDetail(Controller, "Remote device completed SPAKE2+ handshake");
+    RecordStageLatency(CommissioningStage::kSecurePairing, mPASEStartTime, CHIP_NO_ERROR);
 
     if (mPairingDelegate != nullptr)
     {
@@ -1590,6 +1597,8 @@ void DeviceCommissioner::CommissioningStageComplete(CHIP_ERROR err, Commissionin
     DeviceProxy * proxy      = mDeviceBeingCommissioned;
     mDeviceBeingCommissioned = nullptr;
 
+    RecordStageLatency(mCommissioningStage, mCommissioningStageStartTime, err);
+
     if (mPairingDelegate != nullptr)
     {
         mPairingDelegate->OnCommissioningStatusUpdate(PeerId(GetCompressedFabricId(), nodeId), mCommissioningStage, err);
@@ -1614,6 +1623,14 @@ void DeviceCommissioner::CommissioningStageComplete(CHIP_ERROR err, Commissionin
     }
 }
 
+void DeviceCommissioner::RecordStageLatency(CommissioningStage stage, System::Clock::Timestamp startTime, CHIP_ERROR err)
+{
+    auto elapsed = std::chrono::duration_cast<System::Clock::Milliseconds32>(System::SystemClock().GetMonotonicTimestamp() -
+                                                                             startTime);
+    mStageMetrics.Record(stage, elapsed, err == CHIP_NO_ERROR);
+    ChipLogProgress(Controller, "Commissioning stage '%s' took %" PRIu32 " ms", StageToString(stage), elapsed.count());
+}
+
 void DeviceCommissioner::OnDeviceConnectedFn(void * context, Messaging::ExchangeManager & exchangeMgr,
                                              SessionHandle & sessionHandle)
 {
@@ -2038,9 +2055,10 @@ void DeviceCommissioner::PerformCommissioningStep(DeviceProxy * proxy, Commissio
 
     // For now, we ignore errors coming in from the device since not all commissioning clusters are implemented on the device
     // side.
-    mCommissioningStage      = step;
-    mCommissioningDelegate   = delegate;
-    mDeviceBeingCommissioned = proxy;
+    mCommissioningStage          = step;
+    mCommissioningDelegate       = delegate;
+    mDeviceBeingCommissioned     = proxy;
+    mCommissioningStageStartTime = System::SystemClock().GetMonotonicTimestamp();
     // TODO: Extend timeouts to the DAC and Opcert requests.
 
     // TODO(cecille): We probably want something better than this for breadcrumbs.
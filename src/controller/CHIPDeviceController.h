@@ -39,6 +39,7 @@
 #include <controller/CHIPDeviceControllerSystemState.h>
 #include <controller/CommissioneeDeviceProxy.h>
 #include <controller/CommissioningDelegate.h>
+#include <controller/CommissioningStageMetrics.h>
 #include <controller/DevicePairingDelegate.h>
 #include <controller/OperationalCredentialsDelegate.h>
 #include <controller/SetUpCodePairer.h>
@@ -644,6 +645,14 @@ public:
     void RegisterPairingDelegate(DevicePairingDelegate * pairingDelegate) { mPairingDelegate = pairingDelegate; }
     DevicePairingDelegate * GetPairingDelegate() const { return mPairingDelegate; }
 
+    /**
+     * @brief
+     *   Returns the latency of every commissioning stage (including PASE establishment) performed by this commissioner
+     *   since it was initialized or since the last call to ResetCommissioningStageMetrics().
+     */
+    const CommissioningStageMetrics & GetCommissioningStageMetrics() const { return mStageMetrics; }
+    void ResetCommissioningStageMetrics() { mStageMetrics.Reset(); }
+
     // ClusterStateCache::Callback impl
     void OnDone(app::ReadClient *) override;
 
@@ -673,6 +682,12 @@ private:
     CommissioningStage mCommissioningStage = CommissioningStage::kSecurePairing;
     bool mRunCommissioningAfterConnection  = false;
 
+    System::Clock::Timestamp mPASEStartTime;
+    System::Clock::Timestamp mCommissioningStageStartTime;
+    CommissioningStageMetrics mStageMetrics;
+
+    void RecordStageLatency(CommissioningStage stage, System::Clock::Timestamp startTime, CHIP_ERROR err);
+
     ObjectPool<CommissioneeDeviceProxy, kNumMaxActiveDevices> mCommissioneeDevicePool;
 
 #if CHIP_DEVICE_CONFIG_ENABLE_COMMISSIONER_DISCOVERY // make this commissioner discoverable
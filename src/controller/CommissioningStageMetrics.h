@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <controller/CommissioningDelegate.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Controller {
+
+constexpr size_t kNumCommissioningStages = static_cast<size_t>(CommissioningStage::kNeedsNetworkCreds) + 1;
+
+/**
+ * Latency statistics for every commissioning stage, accumulated across all the commissionings
+ * performed by one (or, when merged, several) DeviceCommissioner instances.
+ */
+struct CommissioningStageMetrics
+{
+    struct Stage
+    {
+        uint32_t completions = 0;
+        uint32_t failures    = 0;
+        System::Clock::Milliseconds64 totalTime{ 0 };
+        System::Clock::Milliseconds32 lastTime{ 0 };
+        System::Clock::Milliseconds32 maxTime{ 0 };
+        // When lastTime was recorded, so that merging keeps the most recent one.
+        System::Clock::Timestamp lastRecordedAt{ 0 };
+
+        System::Clock::Milliseconds32 AverageTime() const
+        {
+            return System::Clock::Milliseconds32(completions == 0 ? 0
+                                                                  : static_cast<uint32_t>(totalTime.count() / completions));
+        }
+    };
+
+    Stage stages[kNumCommissioningStages];
+
+    void Record(CommissioningStage stage, System::Clock::Milliseconds32 elapsed, bool success)
+    {
+        VerifyOrReturn(static_cast<size_t>(stage) < kNumCommissioningStages);
+
+        Stage & entry = stages[stage];
+        entry.completions++;
+        if (!success)
+        {
+            entry.failures++;
+        }
+        entry.totalTime += elapsed;
+        entry.lastTime       = elapsed;
+        entry.lastRecordedAt = System::SystemClock().GetMonotonicTimestamp();
+        entry.maxTime        = std::max(entry.maxTime, elapsed);
+    }
+
+    void Merge(const CommissioningStageMetrics & other)
+    {
+        for (size_t i = 0; i < kNumCommissioningStages; ++i)
+        {
+            stages[i].completions += other.stages[i].completions;
+            stages[i].failures += other.stages[i].failures;
+            stages[i].totalTime += other.stages[i].totalTime;
+            stages[i].maxTime = std::max(stages[i].maxTime, other.stages[i].maxTime);
+            if (other.stages[i].completions > 0 && other.stages[i].lastRecordedAt >= stages[i].lastRecordedAt)
+            {
+                stages[i].lastTime       = other.stages[i].lastTime;
+                stages[i].lastRecordedAt = other.stages[i].lastRecordedAt;
+            }
+        }
+    }
+
+    void Reset() { *this = CommissioningStageMetrics(); }
+
+    void Log() const
+    {
+        for (size_t i = 0; i < kNumCommissioningStages; ++i)
+        {
+            const Stage & entry = stages[i];
+            if (entry.completions == 0)
+            {
+                continue;
+            }
+            ChipLogProgress(Controller, "Stage '%s': %u completed (%u failed), avg %u ms, max %u ms",
+                            StageToString(static_cast<CommissioningStage>(i)), static_cast<unsigned>(entry.completions),
+                            static_cast<unsigned>(entry.failures), static_cast<unsigned>(entry.AverageTime().count()),
+                            static_cast<unsigned>(entry.maxTime.count()));
+        }
+    }
+};
+
+} // namespace Controller
+} // namespace chip
@@ -0,0 +1,356 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/ReadCoalescer.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace Controller {
+
+constexpr System::Clock::Milliseconds32 ReadCoalescer::kDefaultWindow;
+constexpr size_t ReadCoalescer::kDefaultMaxPathsPerRead;
+
+namespace {
+
+bool IsPathRequested(const std::vector<app::AttributePathParams> & aPaths, const app::ConcreteAttributePath & aPath,
+                     bool aConcreteOnly)
+{
+    for (const auto & path : aPaths)
+    {
+        if ((!aConcreteOnly || !path.IsWildcardPath()) && path.IsAttributePathSupersetOf(aPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ContainsPath(const std::vector<app::AttributePathParams> & aPaths, const app::AttributePathParams & aPath)
+{
+    for (const auto & path : aPaths)
+    {
+        if (path == aPath)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+ReadCoalescer::~ReadCoalescer()
+{
+    // The callbacks may call back into the coalescer: keep the batches out of its reach.
+    std::vector<Platform::UniquePtr<Batch>> batches = std::move(mBatches);
+    mBatches.clear();
+
+    for (auto & batch : batches)
+    {
+        if (!batch->IsSent())
+        {
+            mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(OnWindowExpired, batch.get());
+        }
+        batch->Fail(CHIP_ERROR_CANCELLED);
+    }
+}
+
+CHIP_ERROR ReadCoalescer::Read(const SessionHandle & aSessionHandle, const app::AttributePathParams * apAttributePathParamsList,
+                               size_t aAttributePathParamsListSize, app::ReadClient::Callback & aCallback, bool aIsFabricFiltered)
+{
+    VerifyOrReturnError(apAttributePathParamsList != nullptr && aAttributePathParamsListSize > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aAttributePathParamsListSize <= mMaxPathsPerRead, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Batch * batch = FindPendingBatch(aSessionHandle->GetPeer(), aIsFabricFiltered);
+    if (batch != nullptr &&
+        batch->mPaths.size() + batch->CountNewPaths(apAttributePathParamsList, aAttributePathParamsListSize) > mMaxPathsPerRead)
+    {
+        // The read does not fit in the pending request: send that one right away, and start another one.
+        SendBatch(batch);
+        batch = nullptr;
+    }
+
+    if (batch == nullptr)
+    {
+        auto newBatch      = Platform::MakeUnique<Batch>(*this, aSessionHandle, aIsFabricFiltered);
+        auto * systemLayer = mpExchangeMgr->GetSessionManager()->SystemLayer();
+        VerifyOrReturnError(newBatch != nullptr, CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(systemLayer->StartTimer(mWindow, OnWindowExpired, newBatch.get()));
+        batch = newBatch.get();
+        mBatches.push_back(std::move(newBatch));
+    }
+
+    batch->AddConsumer(apAttributePathParamsList, aAttributePathParamsListSize, aCallback);
+    mRequestedReadCount++;
+    return CHIP_NO_ERROR;
+}
+
+void ReadCoalescer::Cancel(app::ReadClient::Callback & aCallback)
+{
+    for (size_t i = 0; i < mBatches.size();)
+    {
+        Batch * batch = mBatches[i].get();
+
+        for (auto & consumer : batch->mConsumers)
+        {
+            if (consumer.mpCallback == &aCallback)
+            {
+                consumer.mpCallback = nullptr;
+            }
+        }
+
+        // A request that is not sent yet is not worth sending once nobody waits for it anymore.
+        if (!batch->IsSent() && !batch->HasActiveConsumers())
+        {
+            mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(OnWindowExpired, batch);
+            RemoveBatch(batch);
+            continue;
+        }
+        i++;
+    }
+}
+
+ReadCoalescer::Batch * ReadCoalescer::FindPendingBatch(const ScopedNodeId & aPeer, bool aIsFabricFiltered)
+{
+    for (auto & batch : mBatches)
+    {
+        if (!batch->IsSent() && batch->mPeer == aPeer && batch->mIsFabricFiltered == aIsFabricFiltered)
+        {
+            return batch.get();
+        }
+    }
+    return nullptr;
+}
+
+void ReadCoalescer::SendBatch(Batch * apBatch)
+{
+    mpExchangeMgr->GetSessionManager()->SystemLayer()->CancelTimer(OnWindowExpired, apBatch);
+
+    CHIP_ERROR err = apBatch->Send(mpExchangeMgr);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to send coalesced read to " ChipLogFormatScopedNodeId ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueScopedNodeId(apBatch->mPeer), err.Format());
+
+        // Take the batch out first, so that the callbacks cannot add reads to it.
+        Platform::UniquePtr<Batch> failedBatch = RemoveBatch(apBatch);
+        failedBatch->Fail(err);
+        return;
+    }
+
+    mSentReadCount++;
+}
+
+Platform::UniquePtr<ReadCoalescer::Batch> ReadCoalescer::RemoveBatch(Batch * apBatch)
+{
+    for (auto it = mBatches.begin(); it != mBatches.end(); ++it)
+    {
+        if (it->get() == apBatch)
+        {
+            Platform::UniquePtr<Batch> batch = std::move(*it);
+            mBatches.erase(it);
+            return batch;
+        }
+    }
+    return nullptr;
+}
+
+void ReadCoalescer::OnWindowExpired(System::Layer * apSystemLayer, void * apAppState)
+{
+    Batch * const batch = static_cast<Batch *>(apAppState);
+    VerifyOrDie(batch != nullptr);
+
+    batch->mCoalescer.SendBatch(batch);
+}
+
+bool ReadCoalescer::Batch::HasActiveConsumers() const
+{
+    for (const auto & consumer : mConsumers)
+    {
+        if (consumer.mpCallback != nullptr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ReadCoalescer::Batch::CountNewPaths(const app::AttributePathParams * apPaths, size_t aPathCount) const
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < aPathCount; i++)
+    {
+        if (ContainsPath(mPaths, apPaths[i]))
+        {
+            continue;
+        }
+
+        bool repeated = false;
+        for (size_t j = 0; j < i && !repeated; j++)
+        {
+            repeated = (apPaths[j] == apPaths[i]);
+        }
+        if (!repeated)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void ReadCoalescer::Batch::AddConsumer(const app::AttributePathParams * apPaths, size_t aPathCount,
+                                       app::ReadClient::Callback & aCallback)
+{
+    Consumer consumer;
+
+    consumer.mpCallback = &aCallback;
+    consumer.mPaths.assign(apPaths, apPaths + aPathCount);
+
+    for (const auto & path : consumer.mPaths)
+    {
+        if (!ContainsPath(mPaths, path))
+        {
+            mPaths.push_back(path);
+        }
+    }
+    mConsumers.push_back(std::move(consumer));
+}
+
+CHIP_ERROR ReadCoalescer::Batch::Send(Messaging::ExchangeManager * apExchangeMgr)
+{
+    auto session = mSession.Get();
+    VerifyOrReturnError(session.HasValue(), CHIP_ERROR_NOT_CONNECTED);
+
+    app::ReadPrepareParams readParams(session.Value());
+    readParams.mpAttributePathParamsList    = mPaths.data();
+    readParams.mAttributePathParamsListSize = mPaths.size();
+    readParams.mIsFabricFiltered            = mIsFabricFiltered;
+
+    auto readClient = Platform::MakeUnique<app::ReadClient>(app::InteractionModelEngine::GetInstance(), apExchangeMgr,
+                                                            mBufferedReadCallback, app::ReadClient::InteractionType::Read);
+    VerifyOrReturnError(readClient != nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(readClient->SendRequest(readParams));
+
+    mpReadClient = std::move(readClient);
+    return CHIP_NO_ERROR;
+}
+
+void ReadCoalescer::Batch::Fail(CHIP_ERROR aError)
+{
+    for (auto & consumer : mConsumers)
+    {
+        app::ReadClient::Callback * callback = consumer.mpCallback;
+        if (callback != nullptr)
+        {
+            consumer.mpCallback = nullptr;
+            callback->OnError(aError);
+            callback->OnDone(nullptr);
+        }
+    }
+}
+
+void ReadCoalescer::Batch::OnReportBegin()
+{
+    for (auto & consumer : mConsumers)
+    {
+        if (consumer.mpCallback != nullptr)
+        {
+            consumer.mpCallback->OnReportBegin();
+        }
+    }
+}
+
+void ReadCoalescer::Batch::OnReportEnd()
+{
+    for (auto & consumer : mConsumers)
+    {
+        if (consumer.mpCallback != nullptr)
+        {
+            consumer.mpCallback->OnReportEnd();
+        }
+    }
+}
+
+void ReadCoalescer::Batch::OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                           const app::StatusIB & aStatus)
+{
+    //
+    // The node reports errors for the concrete paths it was asked for, and skips the attributes of wildcard paths it
+    // cannot report: when some reads asked for the path of an error, it is theirs only.
+    //
+    bool concreteOnly = false;
+    if (!aStatus.IsSuccess())
+    {
+        for (const auto & consumer : mConsumers)
+        {
+            concreteOnly = concreteOnly || IsPathRequested(consumer.mPaths, aPath, true);
+        }
+    }
+
+    for (auto & consumer : mConsumers)
+    {
+        if (consumer.mpCallback == nullptr || !IsPathRequested(consumer.mPaths, aPath, concreteOnly))
+        {
+            continue;
+        }
+
+        if (apData == nullptr)
+        {
+            consumer.mpCallback->OnAttributeData(aPath, nullptr, aStatus);
+            continue;
+        }
+
+        // Every read decodes the data from the same position.
+        TLV::TLVReader reader;
+        reader.Init(*apData);
+        consumer.mpCallback->OnAttributeData(aPath, &reader, aStatus);
+    }
+}
+
+void ReadCoalescer::Batch::OnError(CHIP_ERROR aError)
+{
+    for (auto & consumer : mConsumers)
+    {
+        if (consumer.mpCallback != nullptr)
+        {
+            consumer.mpCallback->OnError(aError);
+        }
+    }
+}
+
+void ReadCoalescer::Batch::OnDone(app::ReadClient * apReadClient)
+{
+    for (auto & consumer : mConsumers)
+    {
+        app::ReadClient::Callback * callback = consumer.mpCallback;
+        if (callback != nullptr)
+        {
+            consumer.mpCallback = nullptr;
+            callback->OnDone(nullptr);
+        }
+    }
+
+    // This destroys the batch, along with its ReadClient, which is allowed from OnDone.
+    mCoalescer.RemoveBatch(this);
+}
+
+} // namespace Controller
+} // namespace chip
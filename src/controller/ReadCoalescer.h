@@ -0,0 +1,151 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/BufferedReadCallback.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/CHIPMem.h>
+#include <messaging/ExchangeMgr.h>
+#include <system/SystemClock.h>
+#include <transport/Session.h>
+
+#include <vector>
+
+namespace chip {
+namespace Controller {
+
+/*
+ * This merges the attribute reads issued to the same node within a short window into a single ReadRequest.
+ *
+ * Independent components of a controller often read from the same node at about the same time: each of these reads
+ * costs the node an exchange, and the encoding and chunking of its own reports.  The coalescer holds the reads it is
+ * given for a window, merges the reads to the same node into one ReadRequest with the duplicate paths removed, and
+ * dispatches the reports of that request back to the callbacks of the reads they answer.
+ *
+ * A merged request never has more paths than the node is required to support in a single ReadRequest: a read that
+ * would take a pending request past that is sent in a request of its own.
+ *
+ * The callbacks of a read get calls to OnReportBegin, OnAttributeData, OnReportEnd, OnError and OnDone as they would
+ * from a ReadClient of their own, with the following differences:
+ *  1. The reports of list attributes are always delivered whole, as they would through a BufferedReadCallback.
+ *  2. OnDone is called with a null ReadClient, as the ReadClient of the merged request belongs to the coalescer.
+ *  3. A path matching both a wildcard path of a read and a concrete path of another one may be reported to the
+ *     first read as well, if the node reports it for the concrete path.
+ *
+ * Subscriptions, event reads and reads with data version filters are not coalesced: they should use their own
+ * ReadClient.
+ */
+class ReadCoalescer
+{
+public:
+    static constexpr System::Clock::Milliseconds32 kDefaultWindow = System::Clock::Milliseconds32(20);
+    static constexpr size_t kDefaultMaxPathsPerRead               = app::InteractionModelEngine::kMinSupportedPathsPerReadRequest;
+
+    ReadCoalescer(Messaging::ExchangeManager * apExchangeMgr, System::Clock::Milliseconds32 aWindow = kDefaultWindow,
+                  size_t aMaxPathsPerRead = kDefaultMaxPathsPerRead) :
+        mpExchangeMgr(apExchangeMgr),
+        mWindow(aWindow), mMaxPathsPerRead(aMaxPathsPerRead)
+    {}
+
+    /*
+     * Reads that are still pending are aborted: their callbacks get OnError with CHIP_ERROR_CANCELLED, then OnDone.
+     */
+    ~ReadCoalescer();
+
+    /*
+     * Read the given attribute paths from the peer of the session, along with the other reads to the same peer
+     * issued within the window.  The paths are copied, and need not outlive this call.
+     *
+     * If this returns an error, none of the methods of the callback will be called.  Otherwise, OnDone will be called
+     * once the read completes, unless the read is cancelled first.
+     */
+    CHIP_ERROR Read(const SessionHandle & aSessionHandle, const app::AttributePathParams * apAttributePathParamsList,
+                    size_t aAttributePathParamsListSize, app::ReadClient::Callback & aCallback, bool aIsFabricFiltered = true);
+
+    /*
+     * Stop calling the given callback for any of the reads it was passed to, including OnDone.
+     */
+    void Cancel(app::ReadClient::Callback & aCallback);
+
+    /*
+     * Number of reads passed to Read, and of ReadRequests sent to carry them.
+     */
+    uint32_t GetRequestedReadCount() const { return mRequestedReadCount; }
+    uint32_t GetSentReadCount() const { return mSentReadCount; }
+
+private:
+    struct Consumer
+    {
+        app::ReadClient::Callback * mpCallback;
+        std::vector<app::AttributePathParams> mPaths;
+    };
+
+    class Batch : public app::ReadClient::Callback
+    {
+    public:
+        Batch(ReadCoalescer & aCoalescer, const SessionHandle & aSessionHandle, bool aIsFabricFiltered) :
+            mCoalescer(aCoalescer), mSession(aSessionHandle), mPeer(aSessionHandle->GetPeer()),
+            mIsFabricFiltered(aIsFabricFiltered), mBufferedReadCallback(*this)
+        {}
+
+        bool IsSent() const { return mpReadClient != nullptr; }
+        bool HasActiveConsumers() const;
+        size_t CountNewPaths(const app::AttributePathParams * apPaths, size_t aPathCount) const;
+        void AddConsumer(const app::AttributePathParams * apPaths, size_t aPathCount, app::ReadClient::Callback & aCallback);
+        CHIP_ERROR Send(Messaging::ExchangeManager * apExchangeMgr);
+        void Fail(CHIP_ERROR aError);
+
+        //
+        // ReadClient::Callback
+        //
+        void OnReportBegin() override;
+        void OnReportEnd() override;
+        void OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                             const app::StatusIB & aStatus) override;
+        void OnError(CHIP_ERROR aError) override;
+        void OnDone(app::ReadClient * apReadClient) override;
+
+        ReadCoalescer & mCoalescer;
+        SessionHolder mSession;
+        ScopedNodeId mPeer;
+        bool mIsFabricFiltered;
+        std::vector<app::AttributePathParams> mPaths;
+        std::vector<Consumer> mConsumers;
+        app::BufferedReadCallback mBufferedReadCallback;
+        Platform::UniquePtr<app::ReadClient> mpReadClient;
+    };
+
+    Batch * FindPendingBatch(const ScopedNodeId & aPeer, bool aIsFabricFiltered);
+    void SendBatch(Batch * apBatch);
+    Platform::UniquePtr<Batch> RemoveBatch(Batch * apBatch);
+    static void OnWindowExpired(System::Layer * apSystemLayer, void * apAppState);
+
+    Messaging::ExchangeManager * mpExchangeMgr;
+    System::Clock::Milliseconds32 mWindow;
+    size_t mMaxPathsPerRead;
+    std::vector<Platform::UniquePtr<Batch>> mBatches;
+    uint32_t mRequestedReadCount = 0;
+    uint32_t mSentReadCount      = 0;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -21,6 +21,7 @@
 #include <app/AttributePathParams.h>
 #include <app/InteractionModelEngine.h>
 #include <app/ReadPrepareParams.h>
+#include <controller/ReadCoalescer.h>
 #include <controller/TypedReadCallback.h>
 
 namespace chip {
@@ -140,6 +141,32 @@ ReadAttribute(Messaging::ExchangeManager * exchangeMgr, const SessionHandle & se
         onErrorCb, fabricFiltered);
 }
 
+/*
+ * A typed read attribute function like the one above, which issues the read through the given ReadCoalescer, so that
+ * it can share a ReadRequest with the other reads to the same node.
+ */
+template <typename AttributeTypeInfo>
+CHIP_ERROR
+ReadAttribute(ReadCoalescer & coalescer, const SessionHandle & sessionHandle, EndpointId endpointId,
+              typename TypedReadAttributeCallback<typename AttributeTypeInfo::DecodableType>::OnSuccessCallbackType onSuccessCb,
+              typename TypedReadAttributeCallback<typename AttributeTypeInfo::DecodableType>::OnErrorCallbackType onErrorCb,
+              bool fabricFiltered = true)
+{
+    using DecodableType = typename AttributeTypeInfo::DecodableType;
+
+    auto onDone   = [](TypedReadAttributeCallback<DecodableType> * callback) { chip::Platform::Delete(callback); };
+    auto callback = chip::Platform::MakeUnique<TypedReadAttributeCallback<DecodableType>>(
+        AttributeTypeInfo::GetClusterId(), AttributeTypeInfo::GetAttributeId(), onSuccessCb, onErrorCb, onDone);
+    VerifyOrReturnError(callback != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    app::AttributePathParams path(endpointId, AttributeTypeInfo::GetClusterId(), AttributeTypeInfo::GetAttributeId());
+    ReturnErrorOnFailure(coalescer.Read(sessionHandle, &path, 1, callback->GetBufferedCallback(), fabricFiltered));
+
+    // As above, the callback frees itself once OnDone is called.
+    callback.release();
+    return CHIP_NO_ERROR;
+}
+
 // Helper for SubscribeAttribute to reduce the amount of code generated.
 template <typename DecodableAttributeType>
 CHIP_ERROR SubscribeAttribute(
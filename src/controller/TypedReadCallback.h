@@ -80,7 +80,7 @@ private:
     void OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
                          const app::StatusIB & aStatus) override
     {
-        if (mCalledCallback && mReadClient->IsReadType())
+        if (mCalledCallback && IsReadType())
         {
             return;
         }
@@ -112,7 +112,7 @@ private:
 
     void OnError(CHIP_ERROR aError) override
     {
-        if (mCalledCallback && mReadClient->IsReadType())
+        if (mCalledCallback && IsReadType())
         {
             return;
         }
@@ -123,6 +123,9 @@ private:
 
     void OnDone(app::ReadClient *) override { mOnDone(this); }
 
+    // Reads issued through a ReadCoalescer have no ReadClient of their own.
+    bool IsReadType() const { return mReadClient == nullptr || mReadClient->IsReadType(); }
+
     void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
     {
         if (mOnSubscriptionEstablished)
@@ -33,8 +33,10 @@ import chip.interaction_model
 import chip.tlv
 from enum import Enum, unique
 import inspect
+import io
 import sys
 import logging
+import pickle
 import threading
 import builtins
 
@@ -647,7 +649,29 @@ class AsyncReadTransaction:
     def GetAllEventValues(self):
         return self._events
 
-    def handleAttributeData(self, path: AttributePathWithListIndex, dataVersion: int, status: int, data: bytes):
+    def handleAttributeDataBatch(self, batch: bytes):
+        ''' Handles a batch of attribute reports serialized by the native TLVPickler (see TLVPickler.h).
+            Values have already been decoded natively, the raw TLV is only decoded in Python for the ones that were not.
+        '''
+        try:
+            reports = _LoadPickle(batch)
+        except Exception as ex:
+            logging.exception(ex)
+            return
+
+        for (endpoint, cluster, attribute, dataVersion, status, pickledValue, tlv) in reports:
+            value = None
+            if tlv is not None:
+                try:
+                    value = _DecodeAttributeValue(pickledValue, tlv)
+                except Exception as ex:
+                    logging.exception(ex)
+                    continue
+
+            self.handleAttributeData(AttributePath(
+                EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, value)
+
+    def handleAttributeData(self, path: AttributePathWithListIndex, dataVersion: int, status: int, value: Any):
         try:
             imStatus = status
             try:
@@ -659,8 +683,7 @@ class AsyncReadTransaction:
                 attributeValue = ValueDecodeFailure(
                     None, chip.interaction_model.InteractionModelError(imStatus))
             else:
-                tlvData = chip.tlv.TLVReader(data).get().get("Any", {})
-                attributeValue = tlvData
+                attributeValue = value
 
             self._cache.UpdateTLV(path, dataVersion, attributeValue)
             self._changedPathSet.add(path)
@@ -824,8 +847,42 @@ class AsyncWriteTransaction:
         self._event_loop.call_soon_threadsafe(self._handleDone)
 
 
-_OnReadAttributeDataCallbackFunct = CFUNCTYPE(
-    None, py_object, c_uint32, c_uint16, c_uint32, c_uint32, c_uint8, c_void_p, c_size_t)
+class _AttributeUnpickler(pickle.Unpickler):
+    ''' Unpickler for the streams of the native TLVPickler (see TLVPickler.h), which hold values read from devices.
+        They only ever refer to the chip.tlv uint and float32 classes: any other global is refused, so that a stream
+        cannot import and call arbitrary code.
+    '''
+    _ALLOWED_CLASSES = {
+        ('chip.tlv', 'uint'): chip.tlv.uint,
+        ('chip.tlv', 'float32'): chip.tlv.float32,
+    }
+
+    def find_class(self, module, name):
+        cls = self._ALLOWED_CLASSES.get((module, name))
+        if cls is None:
+            raise pickle.UnpicklingError(f"global '{module}.{name}' is forbidden")
+        return cls
+
+
+def _LoadPickle(data: bytes) -> Any:
+    return _AttributeUnpickler(io.BytesIO(data)).load()
+
+
+def _DecodeAttributeValue(pickledValue: bytes, tlv: bytes) -> Any:
+    ''' Decodes an attribute value of a batch, with the Python TLV decoder when the native one could not convert it
+        or when its pickle fails to load.
+    '''
+    if pickledValue is not None:
+        try:
+            return _LoadPickle(pickledValue)
+        except Exception as ex:
+            logging.exception(ex)
+
+    return chip.tlv.TLVReader(tlv).get().get("Any", {})
+
+
+_OnReadAttributeDataBatchCallbackFunct = CFUNCTYPE(
+    None, py_object, c_void_p, c_size_t)
 _OnSubscriptionEstablishedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32)
 _OnResubscriptionAttemptedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32, c_uint32)
 _OnReadEventDataCallbackFunct = CFUNCTYPE(
@@ -840,11 +897,9 @@ _OnReportEndCallbackFunct = CFUNCTYPE(
     None, py_object)
 
 
-@_OnReadAttributeDataCallbackFunct
-def _OnReadAttributeDataCallback(closure, dataVersion: int, endpoint: int, cluster: int, attribute: int, status, data, len):
-    dataBytes = ctypes.string_at(data, len)
-    closure.handleAttributeData(AttributePath(
-        EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, dataBytes[:])
+@_OnReadAttributeDataBatchCallbackFunct
+def _OnReadAttributeDataBatchCallback(closure, data, len):
+    closure.handleAttributeDataBatch(ctypes.string_at(data, len))
 
 
 @_OnReadEventDataCallbackFunct
@@ -1075,13 +1130,13 @@ def Init():
                    _OnWriteResponseCallbackFunct, _OnWriteErrorCallbackFunct, _OnWriteDoneCallbackFunct])
         handle.pychip_ReadClient_Read.restype = c_uint32
         setter.Set('pychip_ReadClient_InitCallbacks', None, [
-                   _OnReadAttributeDataCallbackFunct, _OnReadEventDataCallbackFunct, _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct, _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
+                   _OnReadAttributeDataBatchCallbackFunct, _OnReadEventDataCallbackFunct, _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct, _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
                    _OnReportBeginCallbackFunct, _OnReportEndCallbackFunct])
 
     handle.pychip_WriteClient_InitCallbacks(
         _OnWriteResponseCallback, _OnWriteErrorCallback, _OnWriteDoneCallback)
     handle.pychip_ReadClient_InitCallbacks(
-        _OnReadAttributeDataCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnResubscriptionAttemptedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
+        _OnReadAttributeDataBatchCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnResubscriptionAttemptedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
         _OnReportBeginCallback, _OnReportEndCallback)
 
     _BuildAttributeIndex()
@@ -0,0 +1,453 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/python/chip/clusters/TLVPickler.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <cstring>
+#include <memory>
+
+namespace chip {
+namespace python {
+
+namespace {
+
+// Pickle opcodes, see Lib/pickletools.py in the CPython sources.
+constexpr uint8_t kOpProto      = 0x80;
+constexpr uint8_t kOpGlobal     = 'c';
+constexpr uint8_t kOpBinPut     = 'q';
+constexpr uint8_t kOpBinGet     = 'h';
+constexpr uint8_t kOpMark       = '(';
+constexpr uint8_t kOpStop       = '.';
+constexpr uint8_t kOpEmptyList  = ']';
+constexpr uint8_t kOpAppends    = 'e';
+constexpr uint8_t kOpEmptyDict  = '}';
+constexpr uint8_t kOpSetItems   = 'u';
+constexpr uint8_t kOpTuple      = 't';
+constexpr uint8_t kOpTuple1     = 0x85;
+constexpr uint8_t kOpReduce     = 'R';
+constexpr uint8_t kOpNone       = 'N';
+constexpr uint8_t kOpNewTrue    = 0x88;
+constexpr uint8_t kOpNewFalse   = 0x89;
+constexpr uint8_t kOpBinInt1    = 'K';
+constexpr uint8_t kOpBinInt     = 'J';
+constexpr uint8_t kOpLong1      = 0x8a;
+constexpr uint8_t kOpBinFloat   = 'G';
+constexpr uint8_t kOpBinUnicode = 'X';
+constexpr uint8_t kOpBinBytes   = 'B';
+
+constexpr uint8_t kPickleProtocol = 3;
+
+// Memo slots holding the chip.tlv classes used to tag decoded values.
+constexpr uint8_t kMemoUInt    = 0;
+constexpr uint8_t kMemoFloat32 = 1;
+
+constexpr char kUIntClass[]    = "chip.tlv\nuint\n";
+constexpr char kFloat32Class[] = "chip.tlv\nfloat32\n";
+
+constexpr char kAnonymousTagKey[] = "Any";
+
+// Strict UTF-8 validation, matching what Python's str(val, "utf-8") accepts.
+bool IsValidUtf8(const uint8_t * data, uint32_t length)
+{
+    uint32_t i = 0;
+    while (i < length)
+    {
+        uint8_t c = data[i];
+        if (c < 0x80)
+        {
+            i++;
+            continue;
+        }
+
+        uint32_t continuationBytes;
+        uint8_t lowerBound = 0x80;
+        uint8_t upperBound = 0xBF;
+        if (c >= 0xC2 && c <= 0xDF)
+        {
+            continuationBytes = 1;
+        }
+        else if (c >= 0xE0 && c <= 0xEF)
+        {
+            continuationBytes = 2;
+            // Reject overlong encodings and UTF-16 surrogates.
+            lowerBound = (c == 0xE0) ? 0xA0 : 0x80;
+            upperBound = (c == 0xED) ? 0x9F : 0xBF;
+        }
+        else if (c >= 0xF0 && c <= 0xF4)
+        {
+            continuationBytes = 3;
+            // Reject overlong encodings and code points above U+10FFFF.
+            lowerBound = (c == 0xF0) ? 0x90 : 0x80;
+            upperBound = (c == 0xF4) ? 0x8F : 0xBF;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (length - i <= continuationBytes)
+        {
+            return false;
+        }
+
+        if (data[i + 1] < lowerBound || data[i + 1] > upperBound)
+        {
+            return false;
+        }
+        for (uint32_t j = 2; j <= continuationBytes; j++)
+        {
+            if ((data[i + j] & 0xC0) != 0x80)
+            {
+                return false;
+            }
+        }
+        i += continuationBytes + 1;
+    }
+    return true;
+}
+
+} // namespace
+
+void TLVPickler::Clear()
+{
+    mBuffer.clear();
+    mCount     = 0;
+    mFinalized = false;
+
+    PutOpcode(kOpProto);
+    PutOpcode(kPickleProtocol);
+    PutOpcode(kOpEmptyList);
+    PutOpcode(kOpMark);
+}
+
+const std::vector<uint8_t> & TLVPickler::Finalize()
+{
+    if (!mFinalized)
+    {
+        PutOpcode(kOpAppends);
+        PutOpcode(kOpStop);
+        mFinalized = true;
+    }
+    return mBuffer;
+}
+
+CHIP_ERROR TLVPickler::AddAttribute(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                                    Protocols::InteractionModel::Status aStatus)
+{
+    VerifyOrReturnError(!mFinalized, CHIP_ERROR_INCORRECT_STATE);
+
+    DataVersion version = 0;
+    if (aPath.mDataVersion.HasValue())
+    {
+        version = aPath.mDataVersion.Value();
+    }
+    else
+    {
+        ChipLogError(DataManagement, "expect aPath has valid mDataVersion");
+    }
+
+    const size_t entryStart = mBuffer.size();
+
+    PutOpcode(kOpMark);
+    PutUnsignedInteger(aPath.mEndpointId);
+    PutUnsignedInteger(aPath.mClusterId);
+    PutUnsignedInteger(aPath.mAttributeId);
+    PutUnsignedInteger(version);
+    PutUnsignedInteger(to_underlying(aStatus));
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (apData == nullptr)
+    {
+        PutOpcode(kOpNone);
+        PutOpcode(kOpNone);
+    }
+    else
+    {
+        const size_t valueStart = mBuffer.size();
+        TLV::TLVReader reader;
+        reader.Init(*apData);
+        if (PutValueStream(reader) != CHIP_NO_ERROR)
+        {
+            // Let the Python decoder handle whatever we could not convert.
+            mBuffer.resize(valueStart);
+            PutOpcode(kOpNone);
+        }
+
+        reader.Init(*apData);
+        err = PutRawElement(reader);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        mBuffer.resize(entryStart);
+        return err;
+    }
+
+    PutOpcode(kOpTuple);
+    mCount++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVPickler::PutValueStream(TLV::TLVReader & aReader)
+{
+    // The value is a pickle stream of its own, nested as bytes whose length is only known once it is written.
+    PutOpcode(kOpBinBytes);
+    const size_t lengthOffset = mBuffer.size();
+    PutUInt32(0);
+
+    mMemoizedClasses = 0;
+    PutOpcode(kOpProto);
+    PutOpcode(kPickleProtocol);
+    ReturnErrorOnFailure(PutElement(aReader));
+    PutOpcode(kOpStop);
+
+    const size_t length = mBuffer.size() - lengthOffset - sizeof(uint32_t);
+    VerifyOrReturnError(CanCastTo<uint32_t>(length), CHIP_ERROR_BUFFER_TOO_SMALL);
+    for (size_t i = 0; i < sizeof(uint32_t); i++)
+    {
+        mBuffer[lengthOffset + i] = static_cast<uint8_t>(length >> (8 * i));
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR TLVPickler::PutElement(TLV::TLVReader & aReader)
+{
+    switch (aReader.GetType())
+    {
+    case TLV::kTLVType_SignedInteger: {
+        int64_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        PutInteger(value);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        PutClass(kMemoUInt, kUIntClass, sizeof(kUIntClass) - 1);
+        PutUnsignedInteger(value);
+        PutOpcode(kOpTuple1);
+        PutOpcode(kOpReduce);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_FloatingPointNumber: {
+        double value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        bool isFloat32 = (aReader.GetControlByte() & TLV::kTLVTypeMask) == to_underlying(TLV::TLVElementType::FloatingPointNumber32);
+        if (isFloat32)
+        {
+            PutClass(kMemoFloat32, kFloat32Class, sizeof(kFloat32Class) - 1);
+        }
+        PutDouble(value);
+        if (isFloat32)
+        {
+            PutOpcode(kOpTuple1);
+            PutOpcode(kOpReduce);
+        }
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_Boolean: {
+        bool value;
+        ReturnErrorOnFailure(aReader.Get(value));
+        PutOpcode(value ? kOpNewTrue : kOpNewFalse);
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_Null:
+        PutOpcode(kOpNone);
+        return CHIP_NO_ERROR;
+    case TLV::kTLVType_UTF8String:
+    case TLV::kTLVType_ByteString: {
+        const uint8_t * data = nullptr;
+        ReturnErrorOnFailure(aReader.GetDataPtr(data));
+        uint32_t length = aReader.GetLength();
+        if (aReader.GetType() == TLV::kTLVType_UTF8String && IsValidUtf8(data, length))
+        {
+            PutString(data, length);
+        }
+        else
+        {
+            // Invalid UTF-8 strings are surfaced as bytes by the Python decoder too.
+            PutBytes(data, length);
+        }
+        return CHIP_NO_ERROR;
+    }
+    case TLV::kTLVType_Structure:
+        return PutContainer(aReader, true);
+    case TLV::kTLVType_Array:
+    case TLV::kTLVType_List:
+        return PutContainer(aReader, false);
+    default:
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+    }
+}
+
+CHIP_ERROR TLVPickler::PutContainer(TLV::TLVReader & aReader, bool isStructure)
+{
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(aReader.EnterContainer(containerType));
+
+    PutOpcode(isStructure ? kOpEmptyDict : kOpEmptyList);
+    PutOpcode(kOpMark);
+
+    CHIP_ERROR err;
+    while ((err = aReader.Next()) == CHIP_NO_ERROR)
+    {
+        TLV::Tag tag = aReader.GetTag();
+        if (isStructure)
+        {
+            if (tag == TLV::AnonymousTag())
+            {
+                PutString(reinterpret_cast<const uint8_t *>(kAnonymousTagKey), sizeof(kAnonymousTagKey) - 1);
+            }
+            else if (TLV::IsContextTag(tag))
+            {
+                PutInteger(TLV::TagNumFromTag(tag));
+            }
+            else
+            {
+                // Profile tags are keyed by (profile, tag) tuples whose exact form depends on the tag
+                // encoding; leave those to the Python decoder.
+                return CHIP_ERROR_NOT_IMPLEMENTED;
+            }
+        }
+        else
+        {
+            VerifyOrReturnError(tag == TLV::AnonymousTag(), CHIP_ERROR_NOT_IMPLEMENTED);
+        }
+
+        ReturnErrorOnFailure(PutElement(aReader));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    PutOpcode(isStructure ? kOpSetItems : kOpAppends);
+    return aReader.ExitContainer(containerType);
+}
+
+CHIP_ERROR TLVPickler::PutRawElement(TLV::TLVReader & aReader)
+{
+    // Same normalization as the per attribute path used to do: the element wrapped with an anonymous tag.
+    size_t bufferLen = aReader.GetRemainingLength() + aReader.GetLengthRead();
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[bufferLen]);
+
+    TLV::TLVWriter writer;
+    writer.Init(buffer.get(), bufferLen);
+    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), aReader));
+
+    PutBytes(buffer.get(), writer.GetLengthWritten());
+    return CHIP_NO_ERROR;
+}
+
+void TLVPickler::PutClass(uint8_t memo, const char * name, size_t nameLength)
+{
+    // The first use of a class in a value stream imports it, the following ones fetch it from the memo.
+    if (mMemoizedClasses & (1u << memo))
+    {
+        PutOpcode(kOpBinGet);
+        PutOpcode(memo);
+        return;
+    }
+
+    PutOpcode(kOpGlobal);
+    mBuffer.insert(mBuffer.end(), name, name + nameLength);
+    PutOpcode(kOpBinPut);
+    PutOpcode(memo);
+    mMemoizedClasses = static_cast<uint8_t>(mMemoizedClasses | (1u << memo));
+}
+
+void TLVPickler::PutUInt32(uint32_t value)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        mBuffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void TLVPickler::PutInteger(int64_t value)
+{
+    if (value >= 0 && value <= UINT8_MAX)
+    {
+        PutOpcode(kOpBinInt1);
+        PutOpcode(static_cast<uint8_t>(value));
+    }
+    else if (value >= INT32_MIN && value <= INT32_MAX)
+    {
+        PutOpcode(kOpBinInt);
+        PutUInt32(static_cast<uint32_t>(value));
+    }
+    else
+    {
+        // Little endian two's complement.
+        PutOpcode(kOpLong1);
+        PutOpcode(sizeof(value));
+        for (size_t i = 0; i < sizeof(value); i++)
+        {
+            mBuffer.push_back(static_cast<uint8_t>(static_cast<uint64_t>(value) >> (8 * i)));
+        }
+    }
+}
+
+void TLVPickler::PutUnsignedInteger(uint64_t value)
+{
+    if (value <= INT32_MAX)
+    {
+        PutInteger(static_cast<int64_t>(value));
+        return;
+    }
+
+    // An extra zero byte keeps the two's complement value positive.
+    PutOpcode(kOpLong1);
+    PutOpcode(sizeof(value) + 1);
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        mBuffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+    mBuffer.push_back(0);
+}
+
+void TLVPickler::PutDouble(double value)
+{
+    // BINFLOAT is big endian IEEE 754.
+    uint64_t bits;
+    static_assert(sizeof(bits) == sizeof(value), "Unexpected double size");
+    memcpy(&bits, &value, sizeof(bits));
+
+    PutOpcode(kOpBinFloat);
+    for (int i = 7; i >= 0; i--)
+    {
+        mBuffer.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+}
+
+void TLVPickler::PutBytes(const uint8_t * data, uint32_t length)
+{
+    PutOpcode(kOpBinBytes);
+    PutUInt32(length);
+    mBuffer.insert(mBuffer.end(), data, data + length);
+}
+
+void TLVPickler::PutString(const uint8_t * data, uint32_t length)
+{
+    PutOpcode(kOpBinUnicode);
+    PutUInt32(length);
+    mBuffer.insert(mBuffer.end(), data, data + length);
+}
+
+} // namespace python
+} // namespace chip
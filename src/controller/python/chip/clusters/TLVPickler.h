@@ -0,0 +1,89 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+#include <protocols/interaction_model/Constants.h>
+
+#include <vector>
+
+namespace chip {
+namespace python {
+
+/**
+ * Converts a batch of attribute reports into a single Python pickle (protocol 3) stream, so that the
+ * Python side can turn a whole report into native objects with one `pickle.loads` call instead of
+ * running the pure Python TLV decoder once per attribute.
+ *
+ * The stream unpickles to a list of tuples:
+ *
+ *     (endpointId, clusterId, attributeId, dataVersion, imStatus, pickledValue, tlv)
+ *
+ * `tlv` is the raw TLV of the element, wrapped with an anonymous tag. `pickledValue` is a nested pickle
+ * stream that unpickles to the same object `chip.tlv.TLVReader(tlv).get()["Any"]` would have produced
+ * (unsigned integers as `chip.tlv.uint`, single precision floats as `chip.tlv.float32`, structures as dicts
+ * keyed by tag, arrays and lists as lists). Each value is a stream of its own so that a value Python fails to
+ * unpickle only sends that attribute back to the Python decoder. `pickledValue` is None when the element could
+ * not be converted natively (e.g. it uses profile tags). Both are None for reports that only carry a status.
+ */
+class TLVPickler
+{
+public:
+    TLVPickler() { Clear(); }
+
+    /**
+     * Append an attribute report. `apData` may be null when the report only carries a status.
+     */
+    CHIP_ERROR AddAttribute(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                            Protocols::InteractionModel::Status aStatus);
+
+    size_t GetCount() const { return mCount; }
+    size_t GetPendingLength() const { return mBuffer.size(); }
+
+    /**
+     * Terminate the stream and return it. The returned buffer stays valid until the next call to Clear().
+     */
+    const std::vector<uint8_t> & Finalize();
+
+    void Clear();
+
+private:
+    CHIP_ERROR PutValueStream(TLV::TLVReader & aReader);
+    CHIP_ERROR PutElement(TLV::TLVReader & aReader);
+    CHIP_ERROR PutContainer(TLV::TLVReader & aReader, bool isStructure);
+    CHIP_ERROR PutRawElement(TLV::TLVReader & aReader);
+
+    void PutOpcode(uint8_t opcode) { mBuffer.push_back(opcode); }
+    void PutClass(uint8_t memo, const char * name, size_t nameLength);
+    void PutUInt32(uint32_t value);
+    void PutInteger(int64_t value);
+    void PutUnsignedInteger(uint64_t value);
+    void PutDouble(double value);
+    void PutBytes(const uint8_t * data, uint32_t length);
+    void PutString(const uint8_t * data, uint32_t length);
+
+    std::vector<uint8_t> mBuffer;
+    size_t mCount            = 0;
+    uint8_t mMemoizedClasses = 0;
+    bool mFinalized          = false;
+};
+
+} // namespace python
+} // namespace chip
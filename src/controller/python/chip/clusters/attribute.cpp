@@ -26,6 +26,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/ReadClient.h>
 #include <app/WriteClient.h>
+#include <controller/python/chip/clusters/TLVPickler.h>
 #include <lib/support/CodeUtils.h>
 
 #include <cstdio>
@@ -65,10 +66,8 @@ struct __attribute__((packed)) DataVersionFilter
     chip::DataVersion dataVersion;
 };
 
-using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, chip::DataVersion version, chip::EndpointId endpointId,
-                                             chip::ClusterId clusterId, chip::AttributeId attributeId,
-                                             std::underlying_type_t<Protocols::InteractionModel::Status> imstatus, uint8_t * data,
-                                             uint32_t dataLen);
+// Delivers a batch of attribute reports, serialized by TLVPickler.
+using OnReadAttributeDataBatchCallback  = void (*)(PyObject * appContext, const uint8_t * data, size_t dataLen);
 using OnReadEventDataCallback           = void (*)(PyObject * appContext, chip::EndpointId endpointId, chip::ClusterId clusterId,
                                          chip::EventId eventId, chip::EventNumber eventNumber, uint8_t priority, uint64_t timestamp,
                                          uint8_t timestampType, uint8_t * data, uint32_t dataLen,
@@ -81,7 +80,7 @@ using OnReadDoneCallback                = void (*)(PyObject * appContext);
 using OnReportBeginCallback             = void (*)(PyObject * appContext);
 using OnReportEndCallback               = void (*)(PyObject * appContext);
 
-OnReadAttributeDataCallback gOnReadAttributeDataCallback             = nullptr;
+OnReadAttributeDataBatchCallback gOnReadAttributeDataBatchCallback   = nullptr;
 OnReadEventDataCallback gOnReadEventDataCallback                     = nullptr;
 OnSubscriptionEstablishedCallback gOnSubscriptionEstablishedCallback = nullptr;
 OnResubscriptionAttemptedCallback gOnResubscriptionAttemptedCallback = nullptr;
@@ -109,38 +108,20 @@ public:
         // callback. If we do, that's a bug.
         //
         VerifyOrDie(!aPath.IsListItemOperation());
-        size_t bufferLen                  = (apData == nullptr ? 0 : apData->GetRemainingLength() + apData->GetLengthRead());
-        std::unique_ptr<uint8_t[]> buffer = std::unique_ptr<uint8_t[]>(apData == nullptr ? nullptr : new uint8_t[bufferLen]);
-        uint32_t size                     = 0;
-        // When the apData is nullptr, means we did not receive a valid attribute data from server, status will be some error
-        // status.
-        if (apData != nullptr)
-        {
-            // The TLVReader's read head is not pointing to the first element in the container instead of the container itself, use
-            // a TLVWriter to get a TLV with a normalized TLV buffer (Wrapped with a anonymous tag, no extra "end of container" tag
-            // at the end.)
-            TLV::TLVWriter writer;
-            writer.Init(buffer.get(), bufferLen);
-            CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
-            if (err != CHIP_NO_ERROR)
-            {
-                this->OnError(err);
-                return;
-            }
-            size = writer.GetLengthWritten();
-        }
 
-        DataVersion version = 0;
-        if (aPath.mDataVersion.HasValue())
+        // Attribute reports are handed over to Python in batches, crossing ctypes once per report rather than once per
+        // attribute.
+        CHIP_ERROR err = mPendingAttributes.AddAttribute(aPath, apData, aStatus.mStatus);
+        if (err != CHIP_NO_ERROR)
         {
-            version = aPath.mDataVersion.Value();
+            this->OnError(err);
+            return;
         }
-        else
+
+        if (mPendingAttributes.GetPendingLength() >= kMaxPendingAttributeBytes)
         {
-            ChipLogError(DataManagement, "expect aPath has valid mDataVersion");
+            FlushAttributes();
         }
-        gOnReadAttributeDataCallback(mAppContext, version, aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId,
-                                     to_underlying(aStatus.mStatus), buffer.get(), size);
     }
 
     void OnSubscriptionEstablished(SubscriptionId aSubscriptionId) override
@@ -195,7 +176,11 @@ public:
             to_underlying(apStatus == nullptr ? Protocols::InteractionModel::Status::Success : apStatus->mStatus));
     }
 
-    void OnError(CHIP_ERROR aError) override { gOnReadErrorCallback(mAppContext, aError.AsInteger()); }
+    void OnError(CHIP_ERROR aError) override
+    {
+        FlushAttributes();
+        gOnReadErrorCallback(mAppContext, aError.AsInteger());
+    }
 
     void OnReportBegin() override { gOnReportBeginCallback(mAppContext); }
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
@@ -216,10 +201,15 @@ public:
         }
     }
 
-    void OnReportEnd() override { gOnReportEndCallback(mAppContext); }
+    void OnReportEnd() override
+    {
+        FlushAttributes();
+        gOnReportEndCallback(mAppContext);
+    }
 
     void OnDone(ReadClient *) override
     {
+        FlushAttributes();
         gOnReadDoneCallback(mAppContext);
 
         delete this;
@@ -228,7 +218,23 @@ public:
     void AdoptReadClient(std::unique_ptr<ReadClient> apReadClient) { mReadClient = std::move(apReadClient); }
 
 private:
+    // Bounds the memory held for a single report, a batch is flushed early once it grows past this.
+    static constexpr size_t kMaxPendingAttributeBytes = 64 * 1024;
+
+    void FlushAttributes()
+    {
+        if (mPendingAttributes.GetCount() == 0)
+        {
+            return;
+        }
+
+        const std::vector<uint8_t> & batch = mPendingAttributes.Finalize();
+        gOnReadAttributeDataBatchCallback(mAppContext, batch.data(), batch.size());
+        mPendingAttributes.Clear();
+    }
+
     BufferedReadCallback mBufferedReadCallback;
+    TLVPickler mPendingAttributes;
 
     PyObject * mAppContext;
 
@@ -309,14 +315,14 @@ void pychip_WriteClient_InitCallbacks(OnWriteResponseCallback onWriteResponseCal
     gOnWriteDoneCallback     = onWriteDoneCallback;
 }
 
-void pychip_ReadClient_InitCallbacks(OnReadAttributeDataCallback onReadAttributeDataCallback,
+void pychip_ReadClient_InitCallbacks(OnReadAttributeDataBatchCallback onReadAttributeDataBatchCallback,
                                      OnReadEventDataCallback onReadEventDataCallback,
                                      OnSubscriptionEstablishedCallback onSubscriptionEstablishedCallback,
                                      OnResubscriptionAttemptedCallback onResubscriptionAttemptedCallback,
                                      OnReadErrorCallback onReadErrorCallback, OnReadDoneCallback onReadDoneCallback,
                                      OnReportBeginCallback onReportBeginCallback, OnReportEndCallback onReportEndCallback)
 {
-    gOnReadAttributeDataCallback       = onReadAttributeDataCallback;
+    gOnReadAttributeDataBatchCallback  = onReadAttributeDataBatchCallback;
     gOnReadEventDataCallback           = onReadEventDataCallback;
     gOnSubscriptionEstablishedCallback = onSubscriptionEstablishedCallback;
     gOnResubscriptionAttemptedCallback = onResubscriptionAttemptedCallback;
@@ -388,6 +394,33 @@ void pychip_ReadClient_Abort(ReadClient * apReadClient, ReadClientCallback * apC
     delete apCallback;
 }
 
+// Serializes a single attribute value the way reports are delivered to Python, so that the unit tests can check
+// TLVPickler against the Python TLV decoder. When the buffer is too small, bufferLen is set to the needed size.
+chip::ChipError::StorageType pychip_ReadClient_PickleAttributeValue(const uint8_t * tlv, size_t tlvLen, uint8_t * buffer,
+                                                                    size_t * bufferLen)
+{
+    TLVPickler pickler;
+    TLV::TLVReader reader;
+
+    reader.Init(tlv, tlvLen);
+    CHIP_ERROR err = reader.Next();
+    VerifyOrReturnError(err == CHIP_NO_ERROR, err.AsInteger());
+
+    ConcreteDataAttributePath path(0, 0, 0, MakeOptional(static_cast<DataVersion>(0)));
+    err = pickler.AddAttribute(path, &reader, Protocols::InteractionModel::Status::Success);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, err.AsInteger());
+
+    const std::vector<uint8_t> & stream = pickler.Finalize();
+    if (stream.size() > *bufferLen)
+    {
+        *bufferLen = stream.size();
+        return CHIP_ERROR_BUFFER_TOO_SMALL.AsInteger();
+    }
+    memcpy(buffer, stream.data(), stream.size());
+    *bufferLen = stream.size();
+    return CHIP_NO_ERROR.AsInteger();
+}
+
 void pychip_ReadClient_OverrideLivenessTimeout(ReadClient * pReadClient, uint32_t livenessTimeoutMs)
 {
     VerifyOrDie(pReadClient != nullptr);
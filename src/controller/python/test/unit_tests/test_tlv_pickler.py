@@ -0,0 +1,136 @@
+#
+#    Copyright (c) 2022 Project CHIP Authors
+#    All rights reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+
+from chip.clusters.Attribute import _DecodeAttributeValue, _LoadPickle
+from chip.tlv import TLVWriter, TLVReader
+from chip.tlv import uint, float32
+import chip.native
+
+import ctypes
+import pickle
+import unittest
+
+'''
+This file checks that the attribute values decoded by the native TLVPickler (see TLVPickler.h) are the same objects,
+down to their types, as the ones the Python TLVReader produces.
+'''
+
+
+def _encode(val) -> bytes:
+    writer = TLVWriter()
+    writer.put(None, val)
+    return bytes(writer.encoding)
+
+
+class TestTLVPickler(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        # The pickler does not need the stack, so the library is loaded without initializing it.
+        cls._handle = ctypes.CDLL(chip.native.FindNativeLibraryPath())
+        cls._handle.pychip_ReadClient_PickleAttributeValue.restype = ctypes.c_uint32
+        cls._handle.pychip_ReadClient_PickleAttributeValue.argtypes = [
+            ctypes.c_char_p, ctypes.c_size_t, ctypes.c_void_p, ctypes.POINTER(ctypes.c_size_t)]
+
+    def _pickle(self, tlv: bytes) -> bytes:
+        length = ctypes.c_size_t(0)
+        self._handle.pychip_ReadClient_PickleAttributeValue(tlv, len(tlv), None, ctypes.byref(length))
+        buffer = ctypes.create_string_buffer(length.value)
+        res = self._handle.pychip_ReadClient_PickleAttributeValue(tlv, len(tlv), buffer, ctypes.byref(length))
+        self.assertEqual(res, 0)
+        return buffer.raw[:length.value]
+
+    def _assertSameObject(self, actual, expected):
+        self.assertIs(type(actual), type(expected))
+        if isinstance(expected, dict):
+            self.assertEqual(list(actual.keys()), list(expected.keys()))
+            for key in expected:
+                self._assertSameObject(actual[key], expected[key])
+        elif isinstance(expected, list):
+            self.assertEqual(len(actual), len(expected))
+            for (actualItem, expectedItem) in zip(actual, expected):
+                self._assertSameObject(actualItem, expectedItem)
+        else:
+            self.assertEqual(actual, expected)
+
+    def _check(self, tlv: bytes, decodedNatively: bool = True):
+        reports = _LoadPickle(self._pickle(tlv))
+        self.assertEqual(len(reports), 1)
+
+        (endpoint, cluster, attribute, dataVersion, status, pickledValue, rawTlv) = reports[0]
+        self.assertEqual((endpoint, cluster, attribute, dataVersion, status), (0, 0, 0, 0, 0))
+        self.assertEqual(rawTlv, tlv)
+        self.assertEqual(pickledValue is not None, decodedNatively)
+
+        expected = TLVReader(rawTlv).get()["Any"]
+        if decodedNatively:
+            self._assertSameObject(_LoadPickle(pickledValue), expected)
+        self._assertSameObject(_DecodeAttributeValue(pickledValue, rawTlv), expected)
+
+    def test_integers(self):
+        for val in [0, 1, 255, 256, 0x7fffffff, 0x80000000, 0xffffffffffffffff]:
+            self._check(_encode(uint(val)))
+        for val in [-1, -128, -0x80000000, -0x80000001, -0x8000000000000000, 0x7fffffffffffffff]:
+            self._check(_encode(val))
+
+    def test_floats(self):
+        self._check(_encode(float32(1.5)))
+        self._check(_encode(-2.25e300))
+
+    def test_scalars(self):
+        self._check(_encode(True))
+        self._check(_encode(False))
+        self._check(_encode(None))
+        self._check(_encode(b'\x00\x01\xfe\xff'))
+        self._check(_encode(''))
+        self._check(_encode('Matter é中\U0001f600'))
+
+    def test_invalid_utf8(self):
+        # UTF-8 string with an anonymous tag and a one byte length, both decoders surface it as bytes.
+        self._check(bytes([0x0c, 0x02, 0xc3, 0x28]))
+        self._check(bytes([0x0c, 0x03, 0xed, 0xa0, 0x80]))
+
+    def test_containers(self):
+        self._check(_encode({}))
+        self._check(_encode([]))
+        self._check(_encode({0: uint(1), 1: 'name', 2: [uint(1), uint(2), float32(3.5)], 3: {0: None, 254: -5}}))
+        self._check(_encode([{0: uint(7)}, {0: uint(8), 1: [b'a', b'b']}, [[], [True]]]))
+
+    def test_classes_memoized_per_value(self):
+        # Every value is a stream of its own: the chip.tlv classes must be imported in each of them.
+        self._check(_encode([uint(i) for i in range(300)] + [float32(0.5), float32(0.25)]))
+
+    def test_profile_tags(self):
+        # Left to the Python decoder.
+        self._check(_encode({(0x1234, 5): uint(1)}), decodedNatively=False)
+
+    def test_fallback_on_unpickling_failure(self):
+        tlv = _encode({0: uint(1), 1: [True, 'a']})
+        self._assertSameObject(_DecodeAttributeValue(b'not a pickle', tlv), TLVReader(tlv).get()["Any"])
+
+    def test_forbidden_globals(self):
+        # Only the chip.tlv classes the native pickler refers to may be loaded, nothing that could run code.
+        for payload in [pickle.dumps(print), pickle.dumps(ctypes.c_uint8(1)), b'cos\nsystem\n(Vtrue\ntR.']:
+            with self.assertRaises(pickle.UnpicklingError):
+                _LoadPickle(payload)
+
+        tlv = _encode([uint(1), float32(2.5)])
+        self._assertSameObject(_DecodeAttributeValue(b'cos\nsystem\n(Vtrue\ntR.', tlv), TLVReader(tlv).get()["Any"])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,248 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/BulkCommissioner.h>
+
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <messaging/tests/MessagingContext.h>
+
+#include <nlunit-test.h>
+
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Controller;
+
+using TestContext = Test::LoopbackMessagingContext;
+
+constexpr char kSetUpCode[] = "34970112332";
+
+/**
+ * Records the devices it is asked to commission instead of commissioning them: the tests complete them through the
+ * pairing delegate of the commissioner, as a real commissioning would.
+ */
+class RecordingBulkCommissioner : public BulkCommissioner
+{
+public:
+    CHIP_ERROR StartCommissioning(DeviceCommissioner & commissioner, NodeId remoteDeviceId, const char * setUpCode,
+                                  const CommissioningParameters & params, DiscoveryType discoveryType) override
+    {
+        if (remoteDeviceId == mNodeIdFailingToStart)
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        mStarted.push_back(std::make_pair(&commissioner, remoteDeviceId));
+        return CHIP_NO_ERROR;
+    }
+
+    void StopCommissioning(DeviceCommissioner & commissioner, NodeId remoteDeviceId) override
+    {
+        mStopped.push_back(remoteDeviceId);
+    }
+
+    NodeId mNodeIdFailingToStart = kUndefinedNodeId;
+    std::vector<std::pair<DeviceCommissioner *, NodeId>> mStarted;
+    std::vector<NodeId> mStopped;
+};
+
+class TestDelegate : public BulkCommissioner::Delegate
+{
+public:
+    void OnDeviceCommissioned(NodeId nodeId, CHIP_ERROR error) override { mResults.push_back(std::make_pair(nodeId, error)); }
+    void OnAllDevicesCommissioned() override { mAllDevicesCommissionedCount++; }
+
+    std::vector<std::pair<NodeId, CHIP_ERROR>> mResults;
+    int mAllDevicesCommissionedCount = 0;
+};
+
+void TestInit(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    DeviceCommissioner commissioner;
+    DeviceCommissioner * commissioners[]        = { &commissioner };
+    DeviceCommissioner * missingCommissioners[] = { &commissioner, nullptr };
+    TestDelegate delegate;
+
+    RecordingBulkCommissioner bulk;
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(1, kSetUpCode, CommissioningParameters()) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(apSuite, bulk.Init(nullptr, commissioners, 1, &delegate) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 0, &delegate) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 1, nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), missingCommissioners, 2, &delegate) == CHIP_ERROR_INVALID_ARGUMENT);
+    bulk.Shutdown();
+
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 1, &delegate) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, commissioner.GetPairingDelegate() != nullptr);
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 1, &delegate) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(1, nullptr, CommissioningParameters()) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    bulk.Shutdown();
+    NL_TEST_ASSERT(apSuite, commissioner.GetPairingDelegate() == nullptr);
+}
+
+void TestDispatch(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    DeviceCommissioner commissioner1;
+    DeviceCommissioner commissioner2;
+    DeviceCommissioner * commissioners[] = { &commissioner1, &commissioner2 };
+    TestDelegate delegate;
+    RecordingBulkCommissioner bulk;
+
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 2, &delegate) == CHIP_NO_ERROR);
+    for (NodeId nodeId = 1; nodeId <= 5; nodeId++)
+    {
+        NL_TEST_ASSERT(apSuite, bulk.Enqueue(nodeId, kSetUpCode, CommissioningParameters()) == CHIP_NO_ERROR);
+    }
+
+    // Devices are dispatched from a scheduled work item, one per commissioner, in queue order.
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.empty());
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.size() == 2);
+    NL_TEST_ASSERT(apSuite, bulk.mStarted[0] == std::make_pair(&commissioner1, NodeId(1)));
+    NL_TEST_ASSERT(apSuite, bulk.mStarted[1] == std::make_pair(&commissioner2, NodeId(2)));
+    NL_TEST_ASSERT(apSuite, bulk.GetInFlightCount() == 2);
+    NL_TEST_ASSERT(apSuite, bulk.GetPendingCount() == 3);
+
+    // A completion for another device than the one in flight is ignored.
+    commissioner2.GetPairingDelegate()->OnCommissioningComplete(1, CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mResults.empty());
+
+    // The commissioner that completes first gets the next device.
+    commissioner2.GetPairingDelegate()->OnCommissioningComplete(2, CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mResults.size() == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mResults[0].first == 2 && delegate.mResults[0].second == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, bulk.GetInFlightCount() == 1);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.size() == 3);
+    NL_TEST_ASSERT(apSuite, bulk.mStarted[2] == std::make_pair(&commissioner2, NodeId(3)));
+
+    // A PASE success keeps the device in flight until commissioning completes; a PASE failure completes it.
+    commissioner1.GetPairingDelegate()->OnPairingComplete(CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, delegate.mResults.size() == 1);
+    commissioner1.GetPairingDelegate()->OnPairingComplete(CHIP_ERROR_TIMEOUT);
+    NL_TEST_ASSERT(apSuite, delegate.mResults.size() == 2);
+    NL_TEST_ASSERT(apSuite, delegate.mResults[1].first == 1 && delegate.mResults[1].second == CHIP_ERROR_TIMEOUT);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.size() == 4);
+    NL_TEST_ASSERT(apSuite, bulk.mStarted[3] == std::make_pair(&commissioner1, NodeId(4)));
+
+    commissioner1.GetPairingDelegate()->OnCommissioningComplete(4, CHIP_ERROR_INTERNAL);
+    commissioner2.GetPairingDelegate()->OnCommissioningComplete(3, CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.size() == 5);
+    NL_TEST_ASSERT(apSuite, bulk.GetPendingCount() == 0);
+    NL_TEST_ASSERT(apSuite, delegate.mAllDevicesCommissionedCount == 0);
+
+    commissioner1.GetPairingDelegate()->OnCommissioningComplete(5, CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, delegate.mResults.size() == 5);
+    NL_TEST_ASSERT(apSuite, delegate.mAllDevicesCommissionedCount == 1);
+    NL_TEST_ASSERT(apSuite, bulk.GetInFlightCount() == 0);
+    NL_TEST_ASSERT(apSuite, bulk.mStopped.empty());
+
+    bulk.Shutdown();
+}
+
+void TestStartFailure(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    DeviceCommissioner commissioner;
+    DeviceCommissioner * commissioners[] = { &commissioner };
+    TestDelegate delegate;
+    RecordingBulkCommissioner bulk;
+
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 1, &delegate) == CHIP_NO_ERROR);
+    bulk.mNodeIdFailingToStart = 1;
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(1, kSetUpCode, CommissioningParameters()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(2, kSetUpCode, CommissioningParameters()) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    // The device that fails to start is reported, and the commissioner moves on to the next one.
+    NL_TEST_ASSERT(apSuite, delegate.mResults.size() == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mResults[0].first == 1 && delegate.mResults[0].second == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.size() == 1);
+    NL_TEST_ASSERT(apSuite, bulk.mStarted[0].second == 2);
+    NL_TEST_ASSERT(apSuite, bulk.GetInFlightCount() == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mAllDevicesCommissionedCount == 0);
+
+    bulk.Shutdown();
+}
+
+void TestShutdown(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    DeviceCommissioner commissioner1;
+    DeviceCommissioner commissioner2;
+    DeviceCommissioner * commissioners[] = { &commissioner1, &commissioner2 };
+    TestDelegate delegate;
+    RecordingBulkCommissioner bulk;
+
+    NL_TEST_ASSERT(apSuite, bulk.Init(&ctx.GetSystemLayer(), commissioners, 2, &delegate) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(1, kSetUpCode, CommissioningParameters()) == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(2, kSetUpCode, CommissioningParameters()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(3, kSetUpCode, CommissioningParameters()) == CHIP_NO_ERROR);
+
+    // Shutting down stops the device in flight, and drops the queued ones along with the pending dispatch.
+    bulk.Shutdown();
+    NL_TEST_ASSERT(apSuite, bulk.mStopped.size() == 1 && bulk.mStopped[0] == 1);
+    NL_TEST_ASSERT(apSuite, bulk.GetPendingCount() == 0);
+    NL_TEST_ASSERT(apSuite, bulk.GetInFlightCount() == 0);
+    NL_TEST_ASSERT(apSuite, commissioner1.GetPairingDelegate() == nullptr);
+    NL_TEST_ASSERT(apSuite, commissioner2.GetPairingDelegate() == nullptr);
+
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, bulk.mStarted.size() == 1);
+    NL_TEST_ASSERT(apSuite, delegate.mResults.empty());
+    NL_TEST_ASSERT(apSuite, bulk.Enqueue(4, kSetUpCode, CommissioningParameters()) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestInit", TestInit),
+    NL_TEST_DEF("TestDispatch", TestDispatch),
+    NL_TEST_DEF("TestStartFailure", TestStartFailure),
+    NL_TEST_DEF("TestShutdown", TestShutdown),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestBulkCommissioner",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestBulkCommissioner()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBulkCommissioner)
@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <controller/CommissioningStageMetrics.h>
+
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::System::Clock::Literals;
+
+class ScopedMockClock
+{
+public:
+    ScopedMockClock() : mRealClock(System::SystemClock()) { System::Clock::Internal::SetSystemClockForTesting(&mMockClock); }
+    ~ScopedMockClock() { System::Clock::Internal::SetSystemClockForTesting(&mRealClock); }
+
+    System::Clock::Internal::MockClock & Get() { return mMockClock; }
+
+private:
+    System::Clock::ClockBase & mRealClock;
+    System::Clock::Internal::MockClock mMockClock;
+};
+
+void TestRecord(nlTestSuite * inSuite, void * inContext)
+{
+    ScopedMockClock clock;
+    CommissioningStageMetrics metrics;
+
+    metrics.Record(CommissioningStage::kSendNOC, 30_ms32, true);
+    metrics.Record(CommissioningStage::kSendNOC, 50_ms32, false);
+    metrics.Record(CommissioningStage::kSendNOC, 10_ms32, true);
+
+    const auto & stage = metrics.stages[CommissioningStage::kSendNOC];
+    NL_TEST_ASSERT(inSuite, stage.completions == 3);
+    NL_TEST_ASSERT(inSuite, stage.failures == 1);
+    NL_TEST_ASSERT(inSuite, stage.totalTime == 90_ms64);
+    NL_TEST_ASSERT(inSuite, stage.AverageTime() == 30_ms32);
+    NL_TEST_ASSERT(inSuite, stage.lastTime == 10_ms32);
+    NL_TEST_ASSERT(inSuite, stage.maxTime == 50_ms32);
+
+    // The other stages are untouched.
+    NL_TEST_ASSERT(inSuite, metrics.stages[CommissioningStage::kSendPAICertificateRequest].completions == 0);
+    NL_TEST_ASSERT(inSuite, metrics.stages[CommissioningStage::kSendPAICertificateRequest].AverageTime() == 0_ms32);
+
+    // Out-of-range stages are ignored.
+    metrics.Record(static_cast<CommissioningStage>(kNumCommissioningStages), 10_ms32, true);
+
+    metrics.Reset();
+    NL_TEST_ASSERT(inSuite, metrics.stages[CommissioningStage::kSendNOC].completions == 0);
+    NL_TEST_ASSERT(inSuite, metrics.stages[CommissioningStage::kSendNOC].totalTime == 0_ms64);
+}
+
+void TestMerge(nlTestSuite * inSuite, void * inContext)
+{
+    ScopedMockClock clock;
+    CommissioningStageMetrics first;
+    CommissioningStageMetrics second;
+
+    clock.Get().SetMonotonic(1000_ms64);
+    first.Record(CommissioningStage::kSendNOC, 40_ms32, true);
+    second.Record(CommissioningStage::kFindOperational, 70_ms32, true);
+
+    clock.Get().SetMonotonic(2000_ms64);
+    second.Record(CommissioningStage::kSendNOC, 20_ms32, false);
+
+    clock.Get().SetMonotonic(3000_ms64);
+    first.Record(CommissioningStage::kFindOperational, 60_ms32, true);
+
+    CommissioningStageMetrics merged;
+    merged.Merge(first);
+    merged.Merge(second);
+
+    const auto & noc = merged.stages[CommissioningStage::kSendNOC];
+    NL_TEST_ASSERT(inSuite, noc.completions == 2);
+    NL_TEST_ASSERT(inSuite, noc.failures == 1);
+    NL_TEST_ASSERT(inSuite, noc.totalTime == 60_ms64);
+    NL_TEST_ASSERT(inSuite, noc.maxTime == 40_ms32);
+    // The most recent completion wins, whatever the order of the merges.
+    NL_TEST_ASSERT(inSuite, noc.lastTime == 20_ms32);
+
+    const auto & operational = merged.stages[CommissioningStage::kFindOperational];
+    NL_TEST_ASSERT(inSuite, operational.completions == 2);
+    NL_TEST_ASSERT(inSuite, operational.maxTime == 70_ms32);
+    NL_TEST_ASSERT(inSuite, operational.lastTime == 60_ms32);
+
+    // Merging metrics without completions keeps the last time.
+    merged.Merge(CommissioningStageMetrics());
+    NL_TEST_ASSERT(inSuite, merged.stages[CommissioningStage::kSendNOC].lastTime == 20_ms32);
+    NL_TEST_ASSERT(inSuite, merged.stages[CommissioningStage::kSendNOC].completions == 2);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestRecord", TestRecord), //
+    NL_TEST_DEF("TestMerge", TestMerge),   //
+    NL_TEST_SENTINEL()                     //
+};
+
+} // namespace
+
+int TestCommissioningStageMetrics()
+{
+    nlTestSuite theSuite = { "CommissioningStageMetrics", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommissioningStageMetrics)
@@ -33,6 +33,9 @@
 #include <nlunit-test.h>
 #include <protocols/interaction_model/Constants.h>
 
+#include <algorithm>
+#include <vector>
+
 using TestContext = chip::Test::AppContext;
 
 using namespace chip;
@@ -281,6 +284,10 @@ public:
     static void TestReadAttribute_ManyDataValues(nlTestSuite * apSuite, void * apContext);
     static void TestReadAttribute_ManyDataValuesWrongPath(nlTestSuite * apSuite, void * apContext);
     static void TestReadAttribute_ManyErrors(nlTestSuite * apSuite, void * apContext);
+    static void TestReadAttribute_Coalesced(nlTestSuite * apSuite, void * apContext);
+    static void TestReadAttribute_CoalescedErrors(nlTestSuite * apSuite, void * apContext);
+    static void TestReadAttribute_CoalescedCancel(nlTestSuite * apSuite, void * apContext);
+    static void TestReadAttribute_CoalescedSplit(nlTestSuite * apSuite, void * apContext);
     static void TestSubscribeAttributeDeniedNotExistPath(nlTestSuite * apSuite, void * apContext);
 
 private:
@@ -4451,6 +4458,330 @@ void TestReadInteraction::TestReadAttribute_ManyErrors(nlTestSuite * apSuite, vo
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
 }
 
+void TestReadInteraction::TestReadAttribute_Coalesced(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx           = *static_cast<TestContext *>(apContext);
+    auto sessionHandle          = ctx.GetSessionBobToAlice();
+    uint16_t startReadCount     = totalReadCount;
+    uint16_t int16uValues[2]    = { 0, 0 };
+    size_t numSuccessCalls      = 0;
+    size_t numFailureCalls      = 0;
+    size_t numListItemsReceived = 0;
+
+    responseDirective = kSendDataResponse;
+
+    Controller::ReadCoalescer coalescer(&ctx.GetExchangeManager());
+
+    auto onFailureCb = [&numFailureCalls](const app::ConcreteDataAttributePath * attributePath, CHIP_ERROR aError) {
+        numFailureCalls++;
+    };
+
+    //
+    // Two reads of the same attribute and a read of a list attribute, issued within the window, should go out as a
+    // single ReadRequest with two paths.
+    //
+    for (auto & value : int16uValues)
+    {
+        auto onSuccessCb = [&value, &numSuccessCalls](const app::ConcreteDataAttributePath & attributePath,
+                                                      const auto & dataResponse) {
+            value = dataResponse;
+            numSuccessCalls++;
+        };
+
+        NL_TEST_ASSERT(apSuite,
+                       Controller::ReadAttribute<TestCluster::Attributes::Int16u::TypeInfo>(
+                           coalescer, sessionHandle, kTestEndpointId, onSuccessCb, onFailureCb) == CHIP_NO_ERROR);
+    }
+
+    auto onListSuccessCb = [&numListItemsReceived, &numSuccessCalls](const app::ConcreteDataAttributePath & attributePath,
+                                                                     const auto & dataResponse) {
+        auto iter = dataResponse.begin();
+        while (iter.Next())
+        {
+            numListItemsReceived++;
+        }
+        numSuccessCalls++;
+    };
+
+    NL_TEST_ASSERT(apSuite,
+                   Controller::ReadAttribute<TestCluster::Attributes::ListStructOctetString::TypeInfo>(
+                       coalescer, sessionHandle, kTestEndpointId, onListSuccessCb, onFailureCb) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, coalescer.GetRequestedReadCount() == 3);
+    NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 0);
+
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Milliseconds32(2000),
+                                    [&]() { return numSuccessCalls + numFailureCalls == 3; });
+
+    NL_TEST_ASSERT(apSuite, numSuccessCalls == 3 && numFailureCalls == 0);
+    NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 1);
+
+    // The node was asked for the attribute once, and both reads got the same value.
+    NL_TEST_ASSERT(apSuite, totalReadCount == startReadCount + 1);
+    NL_TEST_ASSERT(apSuite, int16uValues[0] == totalReadCount && int16uValues[1] == totalReadCount);
+    NL_TEST_ASSERT(apSuite, numListItemsReceived == 4);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+class CoalescedReadCallback : public app::ReadClient::Callback
+{
+public:
+    void OnReportBegin() override
+    {
+        if (mpCoalescerToCancel != nullptr)
+        {
+            mpCoalescerToCancel->Cancel(*mpCallbackToCancel);
+        }
+    }
+
+    void OnAttributeData(const app::ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
+                         const app::StatusIB & aStatus) override
+    {
+        if (aStatus.IsSuccess() && apData != nullptr)
+        {
+            mDataPaths.push_back(aPath);
+        }
+        else
+        {
+            mErrorPaths.push_back(aPath);
+        }
+    }
+
+    void OnError(CHIP_ERROR aError) override
+    {
+        mOnError++;
+        mLastError = aError;
+    }
+
+    void OnDone(app::ReadClient * apReadClient) override
+    {
+        mOnDone++;
+        mDoneWithReadClient = mDoneWithReadClient || (apReadClient != nullptr);
+    }
+
+    bool OnlyHasDataFor(const app::ConcreteAttributePath & aPath) const
+    {
+        return !mDataPaths.empty() && std::all_of(mDataPaths.begin(), mDataPaths.end(), [&aPath](const auto & path) {
+            return path == aPath;
+        });
+    }
+
+    bool HasDataFor(const app::ConcreteAttributePath & aPath) const
+    {
+        return std::find(mDataPaths.begin(), mDataPaths.end(), aPath) != mDataPaths.end();
+    }
+
+    bool HasErrorFor(const app::ConcreteAttributePath & aPath) const
+    {
+        return std::find(mErrorPaths.begin(), mErrorPaths.end(), aPath) != mErrorPaths.end();
+    }
+
+    std::vector<app::ConcreteAttributePath> mDataPaths;
+    std::vector<app::ConcreteAttributePath> mErrorPaths;
+    int32_t mOnError         = 0;
+    int32_t mOnDone          = 0;
+    CHIP_ERROR mLastError    = CHIP_NO_ERROR;
+    bool mDoneWithReadClient = false;
+
+    // Cancel another read when the report begins.
+    Controller::ReadCoalescer * mpCoalescerToCancel = nullptr;
+    app::ReadClient::Callback * mpCallbackToCancel  = nullptr;
+};
+
+void TestReadInteraction::TestReadAttribute_CoalescedErrors(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx  = *static_cast<TestContext *>(apContext);
+    auto sessionHandle = ctx.GetSessionBobToAlice();
+
+    Controller::ReadCoalescer coalescer(&ctx.GetExchangeManager());
+    CoalescedReadCallback wildcardCallback, existingCallback, missingCallback1, missingCallback2;
+
+    // Mock cluster 2 of mock endpoint 1 has attribute 1, and no attribute 2.
+    app::ConcreteAttributePath existingPath(Test::kMockEndpoint1, Test::MockClusterId(2), Test::MockAttributeId(1));
+    app::ConcreteAttributePath missingPath(Test::kMockEndpoint1, Test::MockClusterId(2), Test::MockAttributeId(2));
+    app::ConcreteAttributePath revisionPath(Test::kMockEndpoint1, Test::MockClusterId(2),
+                                            app::Clusters::Globals::Attributes::ClusterRevision::Id);
+    app::ConcreteAttributePath attributeListPath(Test::kMockEndpoint1, Test::MockClusterId(2),
+                                                 app::Clusters::Globals::Attributes::AttributeList::Id);
+    app::AttributePathParams wildcardPathParams(Test::kMockEndpoint1, Test::MockClusterId(2));
+    app::AttributePathParams existingPathParams(existingPath.mEndpointId, existingPath.mClusterId, existingPath.mAttributeId);
+    app::AttributePathParams missingPathParams(missingPath.mEndpointId, missingPath.mClusterId, missingPath.mAttributeId);
+
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &wildcardPathParams, 1, wildcardCallback) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &existingPathParams, 1, existingCallback) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &missingPathParams, 1, missingCallback1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &missingPathParams, 1, missingCallback2) == CHIP_NO_ERROR);
+
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Milliseconds32(2000), [&]() {
+        return wildcardCallback.mOnDone + existingCallback.mOnDone + missingCallback1.mOnDone + missingCallback2.mOnDone == 4;
+    });
+
+    NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 1);
+
+    // The data of the concrete path goes to both the wildcard read and the concrete read.
+    NL_TEST_ASSERT(apSuite, wildcardCallback.HasDataFor(existingPath));
+    NL_TEST_ASSERT(apSuite, wildcardCallback.HasDataFor(revisionPath));
+    NL_TEST_ASSERT(apSuite, existingCallback.OnlyHasDataFor(existingPath));
+    NL_TEST_ASSERT(apSuite, existingCallback.mErrorPaths.empty());
+
+    // The error the node reports for the missing attribute belongs to the reads that asked for it, and not to the
+    // wildcard read, for which the node would not have reported it.
+    NL_TEST_ASSERT(apSuite, !wildcardCallback.HasErrorFor(missingPath));
+    NL_TEST_ASSERT(apSuite, missingCallback1.mDataPaths.empty() && missingCallback2.mDataPaths.empty());
+    NL_TEST_ASSERT(apSuite, missingCallback1.mErrorPaths.size() == 1 && missingCallback1.mErrorPaths[0] == missingPath);
+    NL_TEST_ASSERT(apSuite, missingCallback2.mErrorPaths.size() == 1 && missingCallback2.mErrorPaths[0] == missingPath);
+
+    // The mock cluster has no data for its AttributeList, and reports an error for it when expanding the wildcard path:
+    // no read asked for it explicitly, so the error goes to the wildcard read.
+    NL_TEST_ASSERT(apSuite, wildcardCallback.HasErrorFor(attributeListPath));
+    NL_TEST_ASSERT(apSuite, !existingCallback.HasErrorFor(attributeListPath));
+
+    for (auto * callback : { &wildcardCallback, &existingCallback, &missingCallback1, &missingCallback2 })
+    {
+        NL_TEST_ASSERT(apSuite, callback->mOnError == 0);
+        NL_TEST_ASSERT(apSuite, callback->mOnDone == 1 && !callback->mDoneWithReadClient);
+    }
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestReadInteraction::TestReadAttribute_CoalescedCancel(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx  = *static_cast<TestContext *>(apContext);
+    auto sessionHandle = ctx.GetSessionBobToAlice();
+
+    app::ConcreteAttributePath path1(Test::kMockEndpoint1, Test::MockClusterId(2), Test::MockAttributeId(1));
+    app::ConcreteAttributePath path2(Test::kMockEndpoint2, Test::MockClusterId(3), Test::MockAttributeId(2));
+    app::AttributePathParams pathParams1(path1.mEndpointId, path1.mClusterId, path1.mAttributeId);
+    app::AttributePathParams pathParams2(path2.mEndpointId, path2.mClusterId, path2.mAttributeId);
+
+    //
+    // Cancelling every read of a request that is not sent yet drops the request.
+    //
+    {
+        Controller::ReadCoalescer coalescer(&ctx.GetExchangeManager());
+        CoalescedReadCallback callback1, callback2;
+
+        NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &pathParams1, 1, callback1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &pathParams2, 1, callback2) == CHIP_NO_ERROR);
+        coalescer.Cancel(callback1);
+        coalescer.Cancel(callback2);
+
+        ctx.GetIOContext().DriveIOUntil(4 * Controller::ReadCoalescer::kDefaultWindow, []() { return false; });
+
+        NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 0);
+        NL_TEST_ASSERT(apSuite, callback1.mOnDone == 0 && callback2.mOnDone == 0);
+        NL_TEST_ASSERT(apSuite, callback1.mOnError == 0 && callback2.mOnError == 0);
+    }
+
+    //
+    // A cancelled read gets no more calls, while the others sharing its request complete, whether it is cancelled
+    // before or after the request is sent.
+    //
+    {
+        Controller::ReadCoalescer coalescer(&ctx.GetExchangeManager());
+        CoalescedReadCallback callback1, callback2, callback3;
+
+        callback3.mpCoalescerToCancel = &coalescer;
+        callback3.mpCallbackToCancel  = &callback2;
+
+        NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &pathParams1, 1, callback1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &pathParams2, 1, callback2) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &pathParams2, 1, callback3) == CHIP_NO_ERROR);
+        coalescer.Cancel(callback1);
+
+        ctx.GetIOContext().DriveIOUntil(System::Clock::Milliseconds32(2000), [&]() { return callback3.mOnDone == 1; });
+
+        NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 1);
+        NL_TEST_ASSERT(apSuite, callback1.mDataPaths.empty() && callback1.mOnDone == 0);
+        NL_TEST_ASSERT(apSuite, callback2.mDataPaths.empty() && callback2.mOnDone == 0);
+        NL_TEST_ASSERT(apSuite, callback3.OnlyHasDataFor(path2) && callback3.mOnDone == 1);
+    }
+
+    //
+    // Destroying the coalescer aborts the reads still pending.
+    //
+    {
+        CoalescedReadCallback callback1;
+        {
+            Controller::ReadCoalescer coalescer(&ctx.GetExchangeManager());
+            NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &pathParams1, 1, callback1) == CHIP_NO_ERROR);
+        }
+
+        NL_TEST_ASSERT(apSuite, callback1.mOnError == 1 && callback1.mLastError == CHIP_ERROR_CANCELLED);
+        NL_TEST_ASSERT(apSuite, callback1.mOnDone == 1);
+    }
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void TestReadInteraction::TestReadAttribute_CoalescedSplit(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx  = *static_cast<TestContext *>(apContext);
+    auto sessionHandle = ctx.GetSessionBobToAlice();
+
+    // Mock cluster 2 of mock endpoint 3 has attributes 1 to 3, along with the global ones.
+    const app::AttributePathParams paths[] = {
+        app::AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(1)),
+        app::AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(2)),
+        app::AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(3)),
+        app::AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), app::Clusters::Globals::Attributes::FeatureMap::Id),
+    };
+
+    Controller::ReadCoalescer coalescer(&ctx.GetExchangeManager(), Controller::ReadCoalescer::kDefaultWindow, 3);
+    CoalescedReadCallback callback1, callback2, callback3, callback4;
+
+    // A read with more paths than a request can carry is refused.
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, paths, 4, callback1) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Paths already in the pending request do not count against its limit.
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &paths[0], 2, callback1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &paths[0], 3, callback2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 0);
+
+    // A read that does not fit sends the pending request right away, and starts another one.
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &paths[2], 2, callback3) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 1);
+    NL_TEST_ASSERT(apSuite, coalescer.Read(sessionHandle, &paths[3], 1, callback4) == CHIP_NO_ERROR);
+
+    ctx.GetIOContext().DriveIOUntil(System::Clock::Milliseconds32(2000), [&]() {
+        return callback1.mOnDone + callback2.mOnDone + callback3.mOnDone + callback4.mOnDone == 4;
+    });
+
+    NL_TEST_ASSERT(apSuite, coalescer.GetRequestedReadCount() == 4);
+    NL_TEST_ASSERT(apSuite, coalescer.GetSentReadCount() == 2);
+
+    NL_TEST_ASSERT(apSuite, callback1.mDataPaths.size() == 2);
+    NL_TEST_ASSERT(apSuite, callback2.mDataPaths.size() == 3);
+    NL_TEST_ASSERT(apSuite, callback3.mDataPaths.size() == 2);
+    NL_TEST_ASSERT(apSuite,
+                   callback4.OnlyHasDataFor(app::ConcreteAttributePath(paths[3].mEndpointId, paths[3].mClusterId,
+                                                                       paths[3].mAttributeId)));
+    for (auto * callback : { &callback1, &callback2, &callback3, &callback4 })
+    {
+        NL_TEST_ASSERT(apSuite, callback->mErrorPaths.empty() && callback->mOnError == 0 && callback->mOnDone == 1);
+    }
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(apSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadHandlers() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
@@ -4485,6 +4816,10 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestReadAttribute_ManyDataValues", TestReadInteraction::TestReadAttribute_ManyDataValues),
     NL_TEST_DEF("TestReadAttribute_ManyDataValuesWrongPath", TestReadInteraction::TestReadAttribute_ManyDataValuesWrongPath),
     NL_TEST_DEF("TestReadAttribute_ManyErrors", TestReadInteraction::TestReadAttribute_ManyErrors),
+    NL_TEST_DEF("TestReadAttribute_Coalesced", TestReadInteraction::TestReadAttribute_Coalesced),
+    NL_TEST_DEF("TestReadAttribute_CoalescedErrors", TestReadInteraction::TestReadAttribute_CoalescedErrors),
+    NL_TEST_DEF("TestReadAttribute_CoalescedCancel", TestReadInteraction::TestReadAttribute_CoalescedCancel),
+    NL_TEST_DEF("TestReadAttribute_CoalescedSplit", TestReadInteraction::TestReadAttribute_CoalescedSplit),
     NL_TEST_DEF("TestSubscribeAttributeDeniedNotExistPath", TestReadInteraction::TestSubscribeAttributeDeniedNotExistPath),
     NL_TEST_DEF("TestResubscribeAttributeTimeout", TestReadInteraction::TestResubscribeAttributeTimeout),
     NL_TEST_DEF("TestSubscribeAttributeTimeout", TestReadInteraction::TestSubscribeAttributeTimeout),
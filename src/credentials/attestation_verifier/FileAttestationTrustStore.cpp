@@ -17,14 +17,25 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
 #include <cstdio>
 #include <cstring>
+#include <functional>
 #include <string>
 
 extern "C" {
 #include <dirent.h>
 }
 
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 namespace chip {
 namespace Credentials {
 
@@ -38,27 +49,22 @@ const char * GetFilenameExtension(const char * filename)
     }
     return dot + 1;
 }
-} // namespace
-
-FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStorePath)
-{
-    VerifyOrReturn(paaTrustStorePath != nullptr);
-
-    if (paaTrustStorePath != nullptr)
-    {
-        mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
-        VerifyOrReturn(paaCount());
-    }
 
-    mIsInitialized = true;
-}
+#if defined(__linux__)
+// Delay after the last directory change before reloading, so that copying a whole PAA set
+// into the directory only triggers a single reload.
+constexpr int kReloadSettleTimeMs = 250;
+#endif
 
-std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath)
+/**
+ * Calls `onCert` with the DER data and SKID of every X.509 certificate with a subject key
+ * identifier found in `trustStorePath`. Each certificate is parsed exactly once.
+ */
+void ForEachX509DerCert(const char * trustStorePath, const std::function<void(std::vector<uint8_t> &&, const ByteSpan &)> & onCert)
 {
-    std::vector<std::vector<uint8_t>> certs;
     if (trustStorePath == nullptr)
     {
-        return certs;
+        return;
     }
 
     DIR * dir;
@@ -97,7 +103,7 @@ std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePat
 
                         if (CHIP_NO_ERROR == Crypto::ExtractSKIDFromX509Cert(certSpan, kidSpan))
                         {
-                            certs.push_back(certificate);
+                            onCert(std::move(certificate), kidSpan);
                         }
                     }
                 }
@@ -106,10 +112,188 @@ std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePat
         }
         closedir(dir);
     }
+}
+} // namespace
+
+size_t FileAttestationTrustStore::SkidHash::operator()(const std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength> & skid) const
+{
+    // SKIDs are hashes of the public key, so their leading bytes are already uniformly distributed.
+    size_t hash = 0;
+    memcpy(&hash, skid.data(), sizeof(hash));
+    return hash;
+}
+
+FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStorePath) : mPAAIndex(std::make_shared<const PaaIndex>())
+{
+    VerifyOrReturn(paaTrustStorePath != nullptr);
+
+    if (paaTrustStorePath != nullptr)
+    {
+        mTrustStorePath = paaTrustStorePath;
+        SetIndex(LoadIndex(paaTrustStorePath));
+        VerifyOrReturn(paaCount());
+    }
+
+    mIsInitialized = true;
+}
+
+std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath)
+{
+    std::vector<std::vector<uint8_t>> certs;
+
+    ForEachX509DerCert(trustStorePath, [&certs](std::vector<uint8_t> && certificate, const ByteSpan &) {
+        certs.push_back(std::move(certificate));
+    });
 
     return certs;
 }
 
+std::shared_ptr<const FileAttestationTrustStore::PaaIndex> FileAttestationTrustStore::LoadIndex(const char * trustStorePath)
+{
+    auto index = std::make_shared<PaaIndex>();
+
+    ForEachX509DerCert(trustStorePath, [&index](std::vector<uint8_t> && certificate, const ByteSpan & skid) {
+        std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength> key;
+        memcpy(key.data(), skid.data(), key.size());
+        // On duplicate SKIDs, the first certificate found wins.
+        index->emplace(key, std::move(certificate));
+    });
+
+    return index;
+}
+
+std::shared_ptr<const FileAttestationTrustStore::PaaIndex> FileAttestationTrustStore::GetIndex() const
+{
+    std::lock_guard<std::mutex> lock(mIndexLock);
+    return mPAAIndex;
+}
+
+void FileAttestationTrustStore::SetIndex(std::shared_ptr<const PaaIndex> index)
+{
+    std::lock_guard<std::mutex> lock(mIndexLock);
+    mPAAIndex = std::move(index);
+}
+
+CHIP_ERROR FileAttestationTrustStore::Reload()
+{
+    VerifyOrReturnError(!mTrustStorePath.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    // Parsing happens outside of the lock, lookups keep using the previous index until the swap.
+    std::shared_ptr<const PaaIndex> index = LoadIndex(mTrustStorePath.c_str());
+
+    // An empty store would make lookups fall back to the test PAAs, so an empty directory, likely caught in the
+    // middle of being updated, keeps the current roots.
+    if (index->empty())
+    {
+        ChipLogError(Controller, "No PAA certificates found in %s, keeping the %u current ones", mTrustStorePath.c_str(),
+                     static_cast<unsigned>(paaCount()));
+        return CHIP_ERROR_NOT_FOUND;
+    }
+
+    SetIndex(std::move(index));
+
+    ChipLogProgress(Controller, "Reloaded %u PAA certificates from %s", static_cast<unsigned>(paaCount()),
+                    mTrustStorePath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+#if defined(__linux__)
+CHIP_ERROR FileAttestationTrustStore::StartWatching()
+{
+    VerifyOrReturnError(!mTrustStorePath.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!mWatcherThread.joinable(), CHIP_ERROR_INCORRECT_STATE);
+
+    mInotifyFd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+    VerifyOrReturnError(mInotifyFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    if (inotify_add_watch(mInotifyFd, mTrustStorePath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE) < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(mInotifyFd);
+        mInotifyFd = -1;
+        return err;
+    }
+
+    mWakeupFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (mWakeupFd < 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(mInotifyFd);
+        mInotifyFd = -1;
+        return err;
+    }
+
+    mWatcherThread = std::thread(&FileAttestationTrustStore::WatcherThread, this);
+    return CHIP_NO_ERROR;
+}
+
+void FileAttestationTrustStore::StopWatching()
+{
+    if (mWatcherThread.joinable())
+    {
+        uint64_t value = 1;
+        // Nothing useful can be done if the write fails, the thread would be stuck in poll().
+        (void) write(mWakeupFd, &value, sizeof(value));
+        mWatcherThread.join();
+    }
+
+    if (mInotifyFd >= 0)
+    {
+        close(mInotifyFd);
+        mInotifyFd = -1;
+    }
+
+    if (mWakeupFd >= 0)
+    {
+        close(mWakeupFd);
+        mWakeupFd = -1;
+    }
+}
+
+void FileAttestationTrustStore::WatcherThread()
+{
+    pollfd fds[2]      = { { mInotifyFd, POLLIN, 0 }, { mWakeupFd, POLLIN, 0 } };
+    bool reloadPending = false;
+
+    while (true)
+    {
+        int res = poll(fds, 2, reloadPending ? kReloadSettleTimeMs : -1);
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            ChipLogError(Controller, "PAA trust store watcher failed: %s", strerror(errno));
+            return;
+        }
+
+        if (fds[1].revents & POLLIN)
+        {
+            return;
+        }
+
+        if (res == 0)
+        {
+            // Directory has been quiet for the settle time.
+            reloadPending = false;
+            Reload();
+            continue;
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            alignas(inotify_event) char events[4096];
+            // Content of the events does not matter, any change in the directory triggers a full reload.
+            while (read(mInotifyFd, events, sizeof(events)) > 0)
+            {
+            }
+            reloadPending = true;
+        }
+    }
+}
+#endif // defined(__linux__)
+
 FileAttestationTrustStore::~FileAttestationTrustStore()
 {
     Cleanup();
@@ -117,41 +301,36 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 
 void FileAttestationTrustStore::Cleanup()
 {
-    mPAADerCerts.clear();
+#if defined(__linux__)
+    StopWatching();
+#endif
+    SetIndex(std::make_shared<const PaaIndex>());
     mIsInitialized = false;
 }
 
 CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const ByteSpan & skid,
                                                                          MutableByteSpan & outPaaDerBuffer) const
 {
+    std::shared_ptr<const PaaIndex> index = GetIndex();
+
     // If the constructor has not tried to initialize the PAA certificates database, return CHIP_ERROR_NOT_IMPLEMENTED to use the
     // testing trust store if the DefaultAttestationVerifier is in use.
-    if (mIsInitialized && paaCount() == 0)
+    if (mIsInitialized && index->empty())
     {
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
 
-    VerifyOrReturnError(!mPAADerCerts.empty(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+    VerifyOrReturnError(!index->empty(), CHIP_ERROR_CA_CERT_NOT_FOUND);
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
+    std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength> key;
+    memcpy(key.data(), skid.data(), key.size());
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto candidate = index->find(key);
+    VerifyOrReturnError(candidate != index->end(), CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    return CopySpanToMutableSpan(ByteSpan{ candidate->second.data(), candidate->second.size() }, outPaaDerBuffer);
 }
 
 } // namespace Credentials
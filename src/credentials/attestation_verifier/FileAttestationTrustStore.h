@@ -18,10 +18,19 @@
 
 #include <credentials/CHIPCert.h>
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
+#include <crypto/CHIPCryptoPAL.h>
 
 #include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#if defined(__linux__)
+#include <thread>
+#endif
+
 namespace chip {
 namespace Credentials {
 
@@ -37,6 +46,17 @@ namespace Credentials {
  */
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath);
 
+/**
+ * @brief AttestationTrustStore backed by a directory of PAA DER certificates.
+ *
+ * Every certificate is parsed once at load time and indexed by its subject key identifier,
+ * so that GetProductAttestationAuthorityCert is a single hash lookup regardless of how
+ * many PAAs are in the store.
+ *
+ * On Linux, StartWatching() can be used to reload the store whenever the directory content
+ * changes. The new index is built on the watcher thread and swapped in atomically, so lookups
+ * issued by ongoing commissioning are never blocked by the reload.
+ */
 class FileAttestationTrustStore : public AttestationTrustStore
 {
 public:
@@ -46,13 +66,62 @@ public:
     CHIP_ERROR GetProductAttestationAuthorityCert(const ByteSpan & skid, MutableByteSpan & outPaaDerBuffer) const override;
 
     bool IsInitialized() const { return mIsInitialized; }
-    size_t paaCount() const { return mPAADerCerts.size(); };
+    size_t paaCount() const { return GetIndex()->size(); };
+
+    /**
+     * @brief Re-read the PAA trust store directory and replace the current set of certificates.
+     *
+     * The current certificates are kept if the directory no longer holds any.
+     *
+     * @returns CHIP_ERROR_INCORRECT_STATE if the store was not created with a path,
+     *          CHIP_ERROR_NOT_FOUND if the directory holds no PAA certificate,
+     *          CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Reload();
+
+#if defined(__linux__)
+    /**
+     * @brief Start a background thread that calls Reload() when certificates are added,
+     *        replaced or removed in the trust store directory.
+     */
+    CHIP_ERROR StartWatching();
+
+    /**
+     * @brief Stop the background watcher, if running. Called automatically on destruction.
+     */
+    void StopWatching();
+#endif // defined(__linux__)
 
 protected:
-    std::vector<std::vector<uint8_t>> mPAADerCerts;
+    struct SkidHash
+    {
+        size_t operator()(const std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength> & skid) const;
+    };
+
+    // PAA DER certificates keyed by their subject key identifier.
+    using PaaIndex =
+        std::unordered_map<std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>, std::vector<uint8_t>, SkidHash>;
+
+    static std::shared_ptr<const PaaIndex> LoadIndex(const char * trustStorePath);
+
+    std::shared_ptr<const PaaIndex> GetIndex() const;
+    void SetIndex(std::shared_ptr<const PaaIndex> index);
 
 private:
     bool mIsInitialized = false;
+    std::string mTrustStorePath;
+
+    // Only held while copying/replacing the index pointer, never while parsing or looking up.
+    mutable std::mutex mIndexLock;
+    std::shared_ptr<const PaaIndex> mPAAIndex;
+
+#if defined(__linux__)
+    void WatcherThread();
+
+    std::thread mWatcherThread;
+    int mInotifyFd = -1;
+    int mWakeupFd  = -1;
+#endif // defined(__linux__)
 
     void Cleanup();
 };
@@ -0,0 +1,291 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the AttestationTrustStore
+ *      backed by a directory of PAA certificates.
+ *
+ */
+
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include "CHIPAttCert_test_vectors.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+/**
+ * Temporary directory standing for the PAA trust store, removed with its content on destruction.
+ */
+class TrustStoreDirectory
+{
+public:
+    TrustStoreDirectory()
+    {
+        char path[] = "/tmp/chip-paa-XXXXXX";
+        if (mkdtemp(path) != nullptr)
+        {
+            mPath = path;
+        }
+    }
+
+    ~TrustStoreDirectory()
+    {
+        for (const auto & name : mFiles)
+        {
+            unlink(FilePath(name).c_str());
+        }
+        if (!mPath.empty())
+        {
+            rmdir(mPath.c_str());
+        }
+    }
+
+    const char * Path() const { return mPath.c_str(); }
+    bool IsValid() const { return !mPath.empty(); }
+
+    bool Write(const char * name, const ByteSpan & content)
+    {
+        FILE * file = fopen(FilePath(name).c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+        bool written = fwrite(content.data(), 1, content.size(), file) == content.size();
+        written      = (fclose(file) == 0) && written;
+        mFiles.push_back(name);
+        return written;
+    }
+
+    void Remove(const char * name) { unlink(FilePath(name).c_str()); }
+
+private:
+    std::string FilePath(const std::string & name) const { return mPath + "/" + name; }
+
+    std::string mPath;
+    std::vector<std::string> mFiles;
+};
+
+bool IsPaaFound(const FileAttestationTrustStore & store, const ByteSpan & skid, const ByteSpan & expectedCert)
+{
+    uint8_t buffer[kMaxDERCertLength];
+    MutableByteSpan paa{ buffer };
+    return store.GetProductAttestationAuthorityCert(skid, paa) == CHIP_NO_ERROR && paa.data_equal(expectedCert);
+}
+
+#if defined(__linux__)
+template <typename Predicate>
+bool WaitFor(Predicate predicate)
+{
+    // Well beyond the time the watcher waits for the directory to settle before reloading.
+    for (int i = 0; i < 100; i++)
+    {
+        if (predicate())
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return predicate();
+}
+#endif // defined(__linux__)
+
+void TestSkidIndex(nlTestSuite * inSuite, void * inContext)
+{
+    TrustStoreDirectory directory;
+    NL_TEST_ASSERT(inSuite, directory.IsValid());
+
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.der", sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff2.der", sTestCert_PAA_FFF2_ValInPast_Cert));
+    // Files which are not DER certificates are ignored.
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.pem", sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, directory.Write("garbage.der", sTestCert_PAA_FFF1_SKID));
+
+    FileAttestationTrustStore store(directory.Path());
+    NL_TEST_ASSERT(inSuite, store.IsInitialized());
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 2);
+
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert));
+
+    uint8_t buffer[kMaxDERCertLength];
+    MutableByteSpan paa{ buffer };
+    NL_TEST_ASSERT(inSuite, store.GetProductAttestationAuthorityCert(sTestCert_PAA_FFF2_ValInFuture_SKID, paa) ==
+                       CHIP_ERROR_CA_CERT_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite,
+                   store.GetProductAttestationAuthorityCert(sTestCert_PAA_FFF1_SKID.SubSpan(1), paa) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The certificate does not fit in the output buffer.
+    MutableByteSpan tooSmall{ buffer, sTestCert_PAA_FFF1_Cert.size() - 1 };
+    NL_TEST_ASSERT(inSuite, store.GetProductAttestationAuthorityCert(sTestCert_PAA_FFF1_SKID, tooSmall) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+void TestReload(nlTestSuite * inSuite, void * inContext)
+{
+    TrustStoreDirectory directory;
+    NL_TEST_ASSERT(inSuite, directory.IsValid());
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.der", sTestCert_PAA_FFF1_Cert));
+
+    FileAttestationTrustStore store(directory.Path());
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 1);
+    NL_TEST_ASSERT(inSuite, !IsPaaFound(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert));
+
+    // Added and removed certificates are only picked up by a reload.
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff2.der", sTestCert_PAA_FFF2_ValInPast_Cert));
+    directory.Remove("paa-fff1.der");
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 1);
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert));
+
+    NL_TEST_ASSERT(inSuite, store.Reload() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 1);
+    NL_TEST_ASSERT(inSuite, !IsPaaFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert));
+
+    // A store without a directory has nothing to reload.
+    FileAttestationTrustStore noPathStore;
+    NL_TEST_ASSERT(inSuite, noPathStore.Reload() == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestReloadEmptyDirectory(nlTestSuite * inSuite, void * inContext)
+{
+    TrustStoreDirectory directory;
+    NL_TEST_ASSERT(inSuite, directory.IsValid());
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.der", sTestCert_PAA_FFF1_Cert));
+
+    FileAttestationTrustStore store(directory.Path());
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 1);
+
+    // Emptying the directory does not make the store fall back to the test PAAs: the current roots are kept.
+    directory.Remove("paa-fff1.der");
+    NL_TEST_ASSERT(inSuite, store.Reload() == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, store.IsInitialized());
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 1);
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert));
+
+    // A store created on an empty directory picks the certificates up once they are there.
+    FileAttestationTrustStore emptyStore(directory.Path());
+    NL_TEST_ASSERT(inSuite, emptyStore.paaCount() == 0);
+    NL_TEST_ASSERT(inSuite, emptyStore.Reload() == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.der", sTestCert_PAA_FFF1_Cert));
+    NL_TEST_ASSERT(inSuite, emptyStore.Reload() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, IsPaaFound(emptyStore, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert));
+}
+
+#if defined(__linux__)
+void TestWatching(nlTestSuite * inSuite, void * inContext)
+{
+    TrustStoreDirectory directory;
+    NL_TEST_ASSERT(inSuite, directory.IsValid());
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.der", sTestCert_PAA_FFF1_Cert));
+
+    FileAttestationTrustStore noPathStore;
+    NL_TEST_ASSERT(inSuite, noPathStore.StartWatching() == CHIP_ERROR_INCORRECT_STATE);
+
+    FileAttestationTrustStore store(directory.Path());
+    NL_TEST_ASSERT(inSuite, store.StartWatching() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.StartWatching() == CHIP_ERROR_INCORRECT_STATE);
+
+    // A certificate added to the directory is picked up without an explicit reload.
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff2.der", sTestCert_PAA_FFF2_ValInPast_Cert));
+    NL_TEST_ASSERT(inSuite, WaitFor([&store]() { return store.paaCount() == 2; }));
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert));
+
+    // So is a removed one.
+    directory.Remove("paa-fff1.der");
+    NL_TEST_ASSERT(inSuite, WaitFor([&store]() { return store.paaCount() == 1; }));
+    NL_TEST_ASSERT(inSuite, !IsPaaFound(store, sTestCert_PAA_FFF1_SKID, sTestCert_PAA_FFF1_Cert));
+
+    // Removing the last one keeps it in the store.
+    directory.Remove("paa-fff2.der");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    NL_TEST_ASSERT(inSuite, IsPaaFound(store, sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert));
+
+    // Once stopped, changes are no longer picked up, and watching can be started again.
+    store.StopWatching();
+    NL_TEST_ASSERT(inSuite, directory.Write("paa-fff1.der", sTestCert_PAA_FFF1_Cert));
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    NL_TEST_ASSERT(inSuite, store.paaCount() == 1);
+    NL_TEST_ASSERT(inSuite, store.StartWatching() == CHIP_NO_ERROR);
+}
+#endif // defined(__linux__)
+
+int TestFileAttestationTrustStore_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+    {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int TestFileAttestationTrustStore_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test the lookup of PAAs by SKID", TestSkidIndex),
+    NL_TEST_DEF("Test reloading the PAAs", TestReload),
+    NL_TEST_DEF("Test reloading an empty directory", TestReloadEmptyDirectory),
+#if defined(__linux__)
+    NL_TEST_DEF("Test watching the PAA directory", TestWatching),
+#endif
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestFileAttestationTrustStore()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "File Attestation Trust Store",
+        &sTests[0],
+        TestFileAttestationTrustStore_Setup,
+        TestFileAttestationTrustStore_Teardown
+    };
+    // clang-format on
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestFileAttestationTrustStore);
@@ -31,6 +31,10 @@
 #include <lib/support/Span.h>
 #include <string.h>
 
+#if CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+#include <mutex>
+#endif // CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+
 using chip::ByteSpan;
 using chip::MutableByteSpan;
 using chip::Encoding::BufferWriter;
@@ -572,6 +576,81 @@ exit:
     return err;
 }
 
+#if CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+namespace {
+
+// Memoized PBKDF2 outputs.  ComputeWS is called without the CHIP stack lock by some controllers (the Darwin
+// framework generates verifiers from arbitrary threads), so the cache is guarded by its own lock.
+struct Spake2pWSCacheEntry
+{
+    uint32_t pbkdf2IterCount;
+    uint32_t setupPin;
+    uint8_t salt[kSpake2p_Max_PBKDF_Salt_Length];
+    size_t saltLen;
+    uint8_t ws[kSpake2p_WS_Length * 2];
+    // Value of sWSCacheUseCounter on last access, 0 if the entry is free.
+    uint64_t lastUsed;
+
+    bool Matches(uint32_t iterCount, const ByteSpan & inSalt, uint32_t pin) const
+    {
+        return lastUsed != 0 && pbkdf2IterCount == iterCount && setupPin == pin && inSalt.data_equal(ByteSpan(salt, saltLen));
+    }
+};
+
+std::mutex sWSCacheLock;
+Spake2pWSCacheEntry sWSCache[CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE];
+uint64_t sWSCacheUseCounter = 0;
+
+uint64_t NextWSCacheUse()
+{
+    return ++sWSCacheUseCounter;
+}
+
+bool LookupWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPin, uint8_t * ws, uint32_t ws_len)
+{
+    VerifyOrReturnValue(ws_len == sizeof(Spake2pWSCacheEntry::ws), false);
+
+    std::lock_guard<std::mutex> lock(sWSCacheLock);
+
+    for (auto & entry : sWSCache)
+    {
+        if (entry.Matches(pbkdf2IterCount, salt, setupPin))
+        {
+            memcpy(ws, entry.ws, ws_len);
+            entry.lastUsed = NextWSCacheUse();
+            return true;
+        }
+    }
+    return false;
+}
+
+void StoreWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t setupPin, const uint8_t * ws, uint32_t ws_len)
+{
+    VerifyOrReturn(ws_len == sizeof(Spake2pWSCacheEntry::ws));
+
+    std::lock_guard<std::mutex> lock(sWSCacheLock);
+    Spake2pWSCacheEntry * victim = &sWSCache[0];
+    for (auto & entry : sWSCache)
+    {
+        if (entry.lastUsed < victim->lastUsed)
+        {
+            victim = &entry;
+        }
+    }
+
+    // Wipe the evicted result before reusing its entry.
+    ClearSecretData(reinterpret_cast<uint8_t *>(victim), sizeof(*victim));
+    victim->pbkdf2IterCount = pbkdf2IterCount;
+    victim->setupPin        = setupPin;
+    memcpy(victim->salt, salt.data(), salt.size());
+    victim->saltLen = salt.size();
+    memcpy(victim->ws, ws, ws_len);
+    victim->lastUsed = NextWSCacheUse();
+}
+
+} // namespace
+#endif // CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+
 CHIP_ERROR Spake2pVerifier::ComputeWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t & setupPin, uint8_t * ws,
                                       uint32_t ws_len)
 {
@@ -588,8 +667,29 @@ CHIP_ERROR Spake2pVerifier::ComputeWS(uint32_t pbkdf2IterCount, const ByteSpan &
     ReturnErrorCodeIf(pbkdf2IterCount < kSpake2p_Min_PBKDF_Iterations || pbkdf2IterCount > kSpake2p_Max_PBKDF_Iterations,
                       CHIP_ERROR_INVALID_ARGUMENT);
 
+#if CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+    if (LookupWS(pbkdf2IterCount, salt, setupPin, ws, ws_len))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(pbkdf2.pbkdf2_sha256(littleEndianSetupPINCode, sizeof(littleEndianSetupPINCode), salt.data(),
+                                              salt.size(), pbkdf2IterCount, ws_len, ws));
+    StoreWS(pbkdf2IterCount, salt, setupPin, ws, ws_len);
+    return CHIP_NO_ERROR;
+#else
     return pbkdf2.pbkdf2_sha256(littleEndianSetupPINCode, sizeof(littleEndianSetupPINCode), salt.data(), salt.size(),
                                 pbkdf2IterCount, ws_len, ws);
+#endif // CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+}
+
+void Spake2pVerifier::ClearWSCache()
+{
+#if CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
+    std::lock_guard<std::mutex> lock(sWSCacheLock);
+    ClearSecretData(reinterpret_cast<uint8_t *>(sWSCache), sizeof(sWSCache));
+    sWSCacheUseCounter = 0;
+#endif // CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE > 0
 }
 
 CHIP_ERROR ConvertIntegerRawToDerWithoutTag(const ByteSpan & raw_integer, MutableByteSpan & out_der_integer)
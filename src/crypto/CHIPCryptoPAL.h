@@ -1362,10 +1362,18 @@ public:
      * @param ws              The output pair (w0, w1) stored sequentially
      * @param ws_len          The output length
      *
+     * When CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE is non-zero, the result is memoized so that repeated
+     * computations for the same passcode, salt and iteration count skip PBKDF2.
+     *
      * @return CHIP_ERROR     The result from running PBKDF2
      */
     static CHIP_ERROR ComputeWS(uint32_t pbkdf2IterCount, const ByteSpan & salt, uint32_t & setupPin, uint8_t * ws,
                                 uint32_t ws_len);
+
+    /**
+     * @brief Securely erase all the results memoized by ComputeWS.
+     */
+    static void ClearWSCache();
 };
 
 /**
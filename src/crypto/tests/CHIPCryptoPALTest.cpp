@@ -1807,6 +1807,58 @@ static void TestSPAKE2P_Reuse(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, spake2.Init(nullptr, 0) == CHIP_NO_ERROR);
 }
 
+static void TestSPAKE2P_ComputeWS(nlTestSuite * inSuite, void * inContext)
+{
+    HeapChecker heapChecker(inSuite);
+
+    const uint8_t kSalt1[kSpake2p_Min_PBKDF_Salt_Length] = { 'S', 'P', 'A', 'K', 'E', '2', 'P', ' ',
+                                                             'K', 'e', 'y', ' ', 'S', 'a', 'l', 't' };
+    const uint8_t kSalt2[kSpake2p_Min_PBKDF_Salt_Length] = { 'O', 't', 'h', 'e', 'r', ' ', 'S', 'P',
+                                                             'A', 'K', 'E', '2', 'P', ' ', 'S', 'a' };
+    uint32_t setupPin                                    = 20202021;
+
+    uint8_t ws1[kSpake2p_WS_Length * 2];
+    uint8_t ws2[kSpake2p_WS_Length * 2];
+    uint8_t ws3[kSpake2p_WS_Length * 2];
+
+    Spake2pVerifier::ClearWSCache();
+
+    // Repeated computations (memoized or not) must produce the same result.
+    NL_TEST_ASSERT(inSuite,
+                   Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt1), setupPin, ws1, sizeof(ws1)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt1), setupPin, ws2, sizeof(ws2)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ws1, ws2, sizeof(ws1)) == 0);
+
+    // Any change in the inputs must not be served a previous result.
+    NL_TEST_ASSERT(inSuite,
+                   Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt2), setupPin, ws3, sizeof(ws3)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ws1, ws3, sizeof(ws1)) != 0);
+
+    uint32_t otherSetupPin = setupPin + 1;
+    NL_TEST_ASSERT(inSuite,
+                   Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt1), otherSetupPin, ws3, sizeof(ws3)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ws1, ws3, sizeof(ws1)) != 0);
+
+    NL_TEST_ASSERT(inSuite,
+                   Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations + 1, ByteSpan(kSalt1), setupPin, ws3, sizeof(ws3)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ws1, ws3, sizeof(ws1)) != 0);
+
+    // Clearing the memoized results does not change the outcome.
+    Spake2pVerifier::ClearWSCache();
+    NL_TEST_ASSERT(inSuite,
+                   Spake2pVerifier::ComputeWS(kSpake2p_Min_PBKDF_Iterations, ByteSpan(kSalt1), setupPin, ws3, sizeof(ws3)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(ws1, ws3, sizeof(ws1)) == 0);
+
+    Spake2pVerifier::ClearWSCache();
+}
+
 static void TestCompressedFabricIdentifier(nlTestSuite * inSuite, void * inContext)
 {
     HeapChecker heapChecker(inSuite);
@@ -2414,6 +2466,7 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test Spake2p_spake2p PointIsValid", TestSPAKE2P_spake2p_PointIsValid),
     NL_TEST_DEF("Test Spake2+ against RFC test vectors", TestSPAKE2P_RFC),
     NL_TEST_DEF("Test Spake2+ object reuse", TestSPAKE2P_Reuse),
+    NL_TEST_DEF("Test Spake2+ w0s/w1s computation", TestSPAKE2P_ComputeWS),
     NL_TEST_DEF("Test compressed fabric identifier", TestCompressedFabricIdentifier),
     NL_TEST_DEF("Test Pubkey Extraction from x509 Certificate", TestPubkey_x509Extraction),
     NL_TEST_DEF("Test x509 Certificate Chain Validation", TestX509_CertChainValidation),
@@ -106,6 +106,9 @@ private:
 
     inline ImplClass * Impl() { return static_cast<ImplClass *>(this); }
 
+    // Number of events taken off the queue at a time by ProcessDeviceEvents.
+    static constexpr size_t kEventBatchSize = 8;
+
     void ProcessDeviceEvents();
 
     DeviceSafeQueue mChipEventQueue;
@@ -140,10 +140,15 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+    ChipDeviceEvent events[kEventBatchSize];
+    size_t count;
+
+    while ((count = mChipEventQueue.PopFront(events, kEventBatchSize)) > 0)
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
-        Impl()->DispatchEvent(&event);
+        for (size_t i = 0; i < count; i++)
+        {
+            Impl()->DispatchEvent(&events[i]);
+        }
     }
 }
 
@@ -109,6 +109,31 @@ void CHIPCircularTLVBuffer::Init(uint8_t * inBuffer, uint32_t inBufferLength)
     mImplicitProfileId = kCommonProfileId;
 }
 
+/**
+ * @brief
+ *   Restore the state of a queue whose backing store already holds
+ *   data, e.g. because the backing store is kept in persistent
+ *   storage.  The buffer must have been initialized with that backing
+ *   store.
+ *
+ * @param[in] inHeadOffset  Offset of the oldest element from the
+ *                          start of the backing store
+ *
+ * @param[in] inDataLength  Number of bytes of data in the queue
+ *
+ * @retval #CHIP_NO_ERROR               On success.
+ * @retval #CHIP_ERROR_INVALID_ARGUMENT The state does not fit in the
+ *                                      backing store.
+ */
+CHIP_ERROR CHIPCircularTLVBuffer::RestoreQueue(uint32_t inHeadOffset, uint32_t inDataLength)
+{
+    VerifyOrReturnError(inHeadOffset < mQueueSize && inDataLength <= mQueueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mQueueHead   = mQueue + inHeadOffset;
+    mQueueLength = inDataLength;
+    return CHIP_NO_ERROR;
+}
+
 /**
  * @brief
  *   Evicts the oldest top-level TLV element in the CHIPCircularTLVBuffer
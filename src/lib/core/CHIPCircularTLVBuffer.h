@@ -61,6 +61,7 @@ public:
     CHIPCircularTLVBuffer(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead);
 
     void Init(uint8_t * inBuffer, uint32_t inBufferLength);
+    CHIP_ERROR RestoreQueue(uint32_t inHeadOffset, uint32_t inDataLength);
     inline uint8_t * QueueHead() const { return mQueueHead; }
     inline uint8_t * QueueTail() const { return mQueue + ((static_cast<size_t>(mQueueHead - mQueue) + mQueueLength) % mQueueSize); }
     inline uint32_t DataLength() const { return mQueueLength; }
@@ -776,6 +776,7 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
+ *      * #CHIP_IM_MAX_COMMANDS_PER_INVOKE
  *
  *  @{
  */
@@ -878,6 +879,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_NUM_TIMED_HANDLER 8
 #endif
 
+/**
+ * @def CHIP_IM_MAX_COMMANDS_PER_INVOKE
+ *
+ * @brief Defines the maximum number of commands in a single InvokeRequest, both for the commands a CommandSender
+ *        sends and for the commands a CommandHandler accepts.  Each CommandHandler and CommandSender keeps an
+ *        entry per command to route the responses to its commands (16 bytes per entry for a CommandHandler), so
+ *        the default is kept small; platforms with more memory raise it.
+ */
+#ifndef CHIP_IM_MAX_COMMANDS_PER_INVOKE
+#define CHIP_IM_MAX_COMMANDS_PER_INVOKE 4
+#endif
+
 /**
  * @def CONFIG_BUILD_FOR_HOST_UNIT_TEST
  *
@@ -1136,6 +1149,41 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+ *
+ * @brief
+ *   Number of events per priority buffer whose envelope (event
+ *   number, position, path and fabric) is cached, so that event
+ *   reports can seek to the first event a subscriber has not seen
+ *   yet and skip uninteresting events without decoding them.  The
+ *   newest events are cached; older ones are found by scanning.
+ *
+ *   Each cached event costs about 32 bytes of RAM per buffer, so the
+ *   cache is disabled by default and enabled on platforms serving
+ *   many subscribers.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 0
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE */
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH
+ *
+ * @brief
+ *   File holding the event buffers when they are kept in a
+ *   memory-mapped file (chip_enable_mapped_event_log), unless the
+ *   application picks one.  It sits next to the key-value store, so
+ *   that every instance keeps its own events.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH
+#ifdef CHIP_CONFIG_KVS_PATH
+#define CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH CHIP_CONFIG_KVS_PATH "-events"
+#else
+#define CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH "/tmp/chip_event_log"
+#endif
+#endif /* CHIP_CONFIG_EVENT_LOGGING_STORAGE_PATH */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1160,6 +1208,28 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_RESUBSCRIBE_MAX_RETRY_WAIT_INTERVAL_MS 5538000
 #endif
 
+/**
+ *  @def CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_BURST
+ *
+ *  @brief
+ *    Maximum number of re-subscriptions the ResubscriptionScheduler admits at once, as the size of its token bucket.
+ *    Setting it to 0 admits all re-subscriptions as soon as they are due.
+ */
+#ifndef CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_BURST
+#define CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_BURST 8
+#endif
+
+/**
+ *  @def CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_INTERVAL_MS
+ *
+ *  @brief
+ *    Interval at which the ResubscriptionScheduler gains a token to admit another re-subscription, once its burst
+ *    is spent.
+ */
+#ifndef CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_INTERVAL_MS
+#define CHIP_CONFIG_RESUBSCRIPTION_ADMISSION_INTERVAL_MS 250
+#endif
+
 /**
  *  @def CHIP_RESUBSCRIBE_MAX_FIBONACCI_STEP_INDEX
  *
@@ -1246,6 +1316,30 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of serialized replies the minmdns responder keeps to answer
+ *        repeated queries without serializing their records again.
+ *        The cache takes a little over 512 bytes per entry, plus one
+ *        entry for the reply being captured, so it is disabled (0) by
+ *        default and enabled on platforms with RAM to spare.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE
+ *
+ * @brief How long a reply cached by the minmdns responder is reused.
+ *        Bounds how long stale IP addresses are sent after an interface
+ *        change, as these do not invalidate the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE chip::System::Clock::Seconds16(10)
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1291,6 +1385,40 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #ifndef CHIP_CONFIG_NUM_CD_KEY_SLOTS
 #define CHIP_CONFIG_NUM_CD_KEY_SLOTS 5
 #endif // CHIP_CONFIG_NUM_CD_KEY_SLOTS
+
+/**
+ * @def CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE
+ *
+ * @brief Number of PBKDF2 results (the Spake2+ w0s/w1s pair for a given passcode, salt and
+ *        iteration count) memoized by Spake2pVerifier::ComputeWS.
+ *
+ *        PBKDF2 runs up to 100000 iterations and dominates the cost of PASE establishment on a
+ *        commissioner and of verifier generation when opening commissioning windows. Each entry
+ *        holds secret material equivalent to the passcode, in memory that lives as long as the
+ *        process, so the cache is off by default: it is meant for commissioners, and should not be
+ *        enabled on devices.  The cache is guarded by a std::mutex.
+ *
+ */
+#ifndef CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE
+#define CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE 0
+#endif // CHIP_CONFIG_SPAKE2P_WS_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+ *
+ * @brief Encode and decode the structs, commands and events of the generated cluster objects
+ *        by walking a constant table of their fields (see app/data-model/StructCodec.h)
+ *        instead of with code unrolled for each of them.
+ *
+ *        The tables share one encode and one decode function per field type, at the cost of an
+ *        indirect call per field.  Measured at -Os on x86-64, this takes the code and read-only
+ *        data of cluster-objects.cpp from about 118 KB to about 111 KB; the tables are half
+ *        that size on 32-bit targets.
+ *
+ */
+#ifndef CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+#define CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC 0
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 /**
  * @}
  */
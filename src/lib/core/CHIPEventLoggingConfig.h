@@ -78,3 +78,16 @@
 #ifndef CHIP_CONFIG_EVENT_LOGGING_EXTERNAL_EVENT_SUPPORT
 #define CHIP_CONFIG_EVENT_LOGGING_EXTERNAL_EVENT_SUPPORT 0
 #endif
+
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_STORAGE_SYNC_INTERVAL
+ *
+ * @brief
+ *   Longest time the events logged to a memory-mapped event log
+ *   wait before the mapping is flushed to the file.  Flushes are
+ *   batched so that logging an event never waits for the file
+ *   system.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_STORAGE_SYNC_INTERVAL
+#define CHIP_CONFIG_EVENT_LOGGING_STORAGE_SYNC_INTERVAL (chip::System::Clock::Milliseconds32(1000))
+#endif
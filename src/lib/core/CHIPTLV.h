@@ -101,6 +101,7 @@ class DLL_EXPORT TLVReader
 {
     friend class TLVWriter;
     friend class TLVUpdater;
+    friend class TLVIndex;
 
 public:
     /**
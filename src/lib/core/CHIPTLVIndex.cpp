@@ -0,0 +1,275 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the TLVIndex class.
+ */
+
+#include <lib/core/CHIPTLVIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace TLV {
+
+constexpr TLVIndex::ElementId TLVIndex::kRootElement;
+constexpr TLVIndex::ElementId TLVIndex::kInvalidElement;
+
+namespace {
+
+template <typename T>
+CHIP_ERROR Resize(T *& array, uint32_t count)
+{
+    T * resized = static_cast<T *>(Platform::MemoryRealloc(array, count * sizeof(T)));
+    VerifyOrReturnError(resized != nullptr, CHIP_ERROR_NO_MEMORY);
+    array = resized;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR TLVIndex::Init(const uint8_t * data, uint32_t dataLen)
+{
+    TLVReader reader;
+
+    Clear();
+    reader.Init(data, dataLen);
+    mData    = data;
+    mDataLen = dataLen;
+
+    return Build(reader, false);
+}
+
+CHIP_ERROR TLVIndex::Init(const TLVReader & reader)
+{
+    TLVReader walker;
+    uint8_t headLen;
+
+    Clear();
+    VerifyOrReturnError(reader.mBackingStore == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(reader.GetType() != kTLVType_NotSpecified, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(reader.GetElementHeadLength(headLen));
+
+    // The read point of a reader positioned on an element is right after the head of the element.
+    mData                  = reader.mReadPoint - headLen;
+    mDataLen               = static_cast<uint32_t>(reader.mBufEnd - mData);
+    mTopLevelContainerType = reader.mContainerType;
+    mImplicitProfileId     = reader.ImplicitProfileId;
+
+    walker.Init(reader);
+    return Build(walker, true);
+}
+
+void TLVIndex::Clear()
+{
+    Platform::MemoryFree(mElements);
+    Platform::MemoryFree(mChildren);
+    Platform::MemoryFree(mPending);
+    mElements              = nullptr;
+    mChildren              = nullptr;
+    mPending               = nullptr;
+    mElementCount          = 0;
+    mCapacity              = 0;
+    mChildrenUsed          = 0;
+    mPendingCount          = 0;
+    mData                  = nullptr;
+    mDataLen               = 0;
+    mTopLevelContainerType = kTLVType_NotSpecified;
+    mImplicitProfileId     = kProfileIdNotSpecified;
+}
+
+TLVType TLVIndex::GetType(ElementId element) const
+{
+    VerifyOrReturnValue(element != kRootElement && element < mElementCount, kTLVType_NotSpecified);
+    return mElements[element].mType;
+}
+
+Tag TLVIndex::GetTag(ElementId element) const
+{
+    VerifyOrReturnValue(element != kRootElement && element < mElementCount, AnonymousTag());
+    return mElements[element].mTag;
+}
+
+uint32_t TLVIndex::GetChildCount(ElementId container) const
+{
+    VerifyOrReturnValue(container < mElementCount, 0);
+    return mElements[container].mChildCount;
+}
+
+TLVIndex::ElementId TLVIndex::GetChild(ElementId container, uint32_t position) const
+{
+    VerifyOrReturnValue(container < mElementCount && position < mElements[container].mChildCount, kInvalidElement);
+    return mChildren[mElements[container].mFirstChild + position];
+}
+
+TLVIndex::ElementId TLVIndex::FindChild(ElementId container, Tag tag) const
+{
+    VerifyOrReturnValue(container < mElementCount, kInvalidElement);
+
+    const Element & parent = mElements[container];
+    for (uint32_t i = 0; i < parent.mChildCount; i++)
+    {
+        ElementId child = mChildren[parent.mFirstChild + i];
+        if (mElements[child].mTag == tag)
+        {
+            return child;
+        }
+    }
+    return kInvalidElement;
+}
+
+CHIP_ERROR TLVIndex::GetReader(ElementId element, TLVReader & reader) const
+{
+    VerifyOrReturnError(element != kRootElement && element < mElementCount, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const Element & entry = mElements[element];
+    ElementId parent      = entry.mParent;
+
+    // The reader sees the encoding from the element on, as if it were in the container of the element.
+    reader.Init(mData + entry.mHeadOffset, mDataLen - entry.mHeadOffset);
+    reader.mContainerType    = (parent == kRootElement) ? mTopLevelContainerType : mElements[parent].mType;
+    reader.ImplicitProfileId = mImplicitProfileId;
+    return reader.Next();
+}
+
+CHIP_ERROR TLVIndex::Build(TLVReader & reader, bool singleElement)
+{
+    struct Level
+    {
+        ElementId mContainer;
+        TLVType mOuterContainerType;
+        uint32_t mFirstPending;
+    };
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    Level levels[kMaxDepth];
+    size_t depth = 0;
+
+    SuccessOrExit(err = Reserve(16));
+    mElements[0]  = { 0, kInvalidElement, 0, 0, AnonymousTag(), kTLVType_NotSpecified };
+    mElementCount = 1;
+    levels[0]     = { kRootElement, kTLVType_NotSpecified, 0 };
+
+    if (!singleElement)
+    {
+        err = reader.Next();
+    }
+
+    while (true)
+    {
+        if (err == CHIP_END_OF_TLV)
+        {
+            // The end of the current container, or of the encoding at the top level.
+            CloseContainer(levels[depth].mContainer, levels[depth].mFirstPending);
+            if (depth == 0)
+            {
+                break;
+            }
+            SuccessOrExit(err = reader.ExitContainer(levels[depth].mOuterContainerType));
+            depth--;
+        }
+        else
+        {
+            ElementId element;
+
+            SuccessOrExit(err);
+            SuccessOrExit(err = AddElement(reader, levels[depth].mContainer, element));
+
+            if (TLVTypeIsContainer(reader.GetType()))
+            {
+                TLVType outerContainerType;
+
+                VerifyOrExit(depth + 1 < kMaxDepth, err = CHIP_ERROR_NO_MEMORY);
+                SuccessOrExit(err = reader.EnterContainer(outerContainerType));
+                levels[++depth] = { element, outerContainerType, mPendingCount };
+            }
+        }
+
+        if (singleElement && depth == 0)
+        {
+            // The element has been indexed, along with its contents.
+            CloseContainer(kRootElement, 0);
+            break;
+        }
+        err = reader.Next();
+    }
+
+    Platform::MemoryFree(mPending);
+    mPending = nullptr;
+    err      = CHIP_NO_ERROR;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Clear();
+    }
+    return err;
+}
+
+CHIP_ERROR TLVIndex::AddElement(const TLVReader & reader, ElementId parent, ElementId & element)
+{
+    uint8_t headLen;
+
+    ReturnErrorOnFailure(Reserve(mElementCount + 1));
+    ReturnErrorOnFailure(reader.GetElementHeadLength(headLen));
+
+    uint32_t headOffset = static_cast<uint32_t>(reader.mReadPoint - headLen - mData);
+
+    element                   = mElementCount++;
+    mElements[element]        = { headOffset, parent, 0, 0, reader.GetTag(), reader.GetType() };
+    mPending[mPendingCount++] = element;
+    return CHIP_NO_ERROR;
+}
+
+void TLVIndex::CloseContainer(ElementId container, uint32_t firstPending)
+{
+    // The children of the container are the elements pending since it started, as those of its own children have
+    // been moved to mChildren already.
+    uint32_t count = mPendingCount - firstPending;
+
+    memcpy(&mChildren[mChildrenUsed], &mPending[firstPending], count * sizeof(ElementId));
+    mElements[container].mFirstChild = mChildrenUsed;
+    mElements[container].mChildCount = count;
+    mChildrenUsed += count;
+    mPendingCount = firstPending;
+}
+
+CHIP_ERROR TLVIndex::Reserve(uint32_t count)
+{
+    VerifyOrReturnError(count > mCapacity, CHIP_NO_ERROR);
+
+    uint32_t capacity = (mCapacity > 0) ? mCapacity : 16;
+    while (capacity < count)
+    {
+        VerifyOrReturnError(capacity <= UINT32_MAX / 2, CHIP_ERROR_NO_MEMORY);
+        capacity *= 2;
+    }
+
+    // Every element but the root is the child of a single container, and pending until then.
+    ReturnErrorOnFailure(Resize(mElements, capacity));
+    ReturnErrorOnFailure(Resize(mChildren, capacity));
+    ReturnErrorOnFailure(Resize(mPending, capacity));
+    mCapacity = capacity;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,161 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the TLVIndex class, a structural index giving random
+ *      access to the elements of a TLV encoding held in a contiguous buffer.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace TLV {
+
+/**
+ * Records, in a single pass over a TLV encoding, the position, tag and type of each of its elements and the children of
+ * each of its containers.
+ *
+ * Once built, the count of the elements of a container and the access to its N-th element take constant time, and
+ * looking up an element of a structure by tag compares the recorded tags instead of decoding the elements in turn.
+ * Any element can then be read with a TLVReader positioned on it, as if Next() had just returned it.
+ *
+ * This is meant for large payloads that are accessed many times, such as the lists of attributes cached by
+ * controllers; for a single pass over an encoding, a TLVReader alone is cheaper.
+ *
+ * Elements are identified by their index in pre-order: kRootElement is a virtual container holding the top-level
+ * elements, followed by the elements in the order of the encoding.  The buffer is not copied and must outlive the
+ * index.  Only readers over a contiguous buffer (without backing store) can be indexed.
+ */
+class DLL_EXPORT TLVIndex
+{
+public:
+    typedef uint32_t ElementId;
+
+    static constexpr ElementId kRootElement    = 0;
+    static constexpr ElementId kInvalidElement = UINT32_MAX;
+
+    TLVIndex() {}
+    ~TLVIndex() { Clear(); }
+
+    TLVIndex(const TLVIndex &) = delete;
+    TLVIndex & operator=(const TLVIndex &) = delete;
+
+    /**
+     * Index the top-level elements of a buffer and their contents.
+     *
+     * @retval #CHIP_NO_ERROR    If the buffer was indexed.
+     * @retval #CHIP_ERROR_NO_MEMORY If the index could not be allocated, or the nesting is too deep.
+     * @retval other             The errors of TLVReader for a malformed encoding.
+     */
+    CHIP_ERROR Init(const uint8_t * data, uint32_t dataLen);
+
+    /**
+     * Index the element a reader is positioned on, as the only child of kRootElement.  The reader must have been
+     * positioned by Next() and nothing read from the element.  The reader is not modified.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If the reader is not on an element, or has a backing store.
+     */
+    CHIP_ERROR Init(const TLVReader & reader);
+
+    /**
+     * Release the index.
+     */
+    void Clear();
+
+    /**
+     * @return The count of the elements indexed, including kRootElement; 0 if the index is not initialized.
+     */
+    uint32_t GetElementCount() const { return mElementCount; }
+
+    /**
+     * @return The type of an element, or kTLVType_NotSpecified for kRootElement and invalid elements.
+     */
+    TLVType GetType(ElementId element) const;
+
+    /**
+     * @return The tag of an element, or AnonymousTag() for kRootElement and invalid elements.
+     */
+    Tag GetTag(ElementId element) const;
+
+    /**
+     * @return The count of the elements of a container, in constant time; 0 for the other elements.
+     */
+    uint32_t GetChildCount(ElementId container) const;
+
+    /**
+     * @return The element at @p position in a container, in constant time, or kInvalidElement.
+     */
+    ElementId GetChild(ElementId container, uint32_t position) const;
+
+    /**
+     * @return The first element of a container with tag @p tag, or kInvalidElement.
+     */
+    ElementId FindChild(ElementId container, Tag tag) const;
+
+    /**
+     * Position a reader on an element, as if Next() had just returned it.  Calling Next() on the reader then moves it
+     * to the following elements of the same container, until it returns CHIP_END_OF_TLV at the end of the container.
+     *
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT If @p element is kRootElement or is not an element of the index.
+     */
+    CHIP_ERROR GetReader(ElementId element, TLVReader & reader) const;
+
+private:
+    struct Element
+    {
+        uint32_t mHeadOffset;
+        ElementId mParent;
+        uint32_t mFirstChild;
+        uint32_t mChildCount;
+        Tag mTag;
+        TLVType mType;
+    };
+
+    // Maximum nesting of the containers an encoding can be indexed with.
+    static constexpr size_t kMaxDepth = 32;
+
+    CHIP_ERROR Build(TLVReader & reader, bool singleElement);
+    CHIP_ERROR AddElement(const TLVReader & reader, ElementId parent, ElementId & element);
+    void CloseContainer(ElementId container, uint32_t firstPending);
+    CHIP_ERROR Reserve(uint32_t count);
+
+    const uint8_t * mData = nullptr;
+    uint32_t mDataLen     = 0;
+    // Type of the container of the top-level elements, which is not kTLVType_NotSpecified when indexing an element
+    // of a container.
+    TLVType mTopLevelContainerType = kTLVType_NotSpecified;
+    uint32_t mImplicitProfileId    = kProfileIdNotSpecified;
+
+    Element * mElements    = nullptr;
+    uint32_t mElementCount = 0;
+    uint32_t mCapacity     = 0;
+    // Children of the containers: the children of a container are contiguous, from its mFirstChild.
+    ElementId * mChildren  = nullptr;
+    uint32_t mChildrenUsed = 0;
+    // Elements of the containers being indexed whose container has not ended yet, only used while building.
+    ElementId * mPending   = nullptr;
+    uint32_t mPendingCount = 0;
+};
+
+} // namespace TLV
+} // namespace chip
@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmarks of TLVWriter and TLVReader.
+ */
+
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/benchmark/Benchmark.h>
+
+using namespace chip;
+using namespace chip::TLV;
+using chip::Benchmark::DoNotOptimize;
+using chip::Benchmark::State;
+
+namespace {
+
+constexpr size_t kBufferSize    = 1024;
+constexpr uint8_t kIntegerCount = 16;
+constexpr uint8_t kArrayLength  = 8;
+
+const char kString[]   = "Matter over Thread, room 42";
+const uint8_t kBytes[] = { 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xc3, 0x4f, 0x1a, 0x9b, 0x27, 0x5e, 0x61,
+                           0x8d, 0x0c, 0x36, 0x7e, 0x44, 0xf1, 0x02, 0xa8, 0xbe, 0x53, 0x99, 0x10, 0x6d, 0x2e, 0x71, 0xd4,
+                           0x0f, 0x83, 0x5b, 0xc9, 0x1e, 0x6a, 0x28, 0xe5, 0x77, 0x3d, 0x90, 0x04, 0xfb, 0x48, 0xa1, 0x62,
+                           0x19, 0xdc, 0x85, 0x3a, 0x7f, 0x26, 0xb0, 0x5c, 0xee, 0x13, 0x67, 0x94, 0x08, 0xcd, 0x31, 0xaa };
+
+/**
+ * Write a structure shaped like the payloads of the data model: integers of all sizes, a boolean, a string, an octet
+ * string and an array.
+ */
+CHIP_ERROR WritePayload(TLVWriter & writer)
+{
+    TLVType outer;
+    TLVType array;
+
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outer));
+    for (uint8_t i = 0; i < kIntegerCount; i++)
+    {
+        // Spread the values over the 1, 2, 4 and 8 byte encodings.
+        uint64_t value = (static_cast<uint64_t>(0x5a) << (i * 4)) + i;
+        ReturnErrorOnFailure(writer.Put(ContextTag(i), value));
+    }
+    ReturnErrorOnFailure(writer.PutBoolean(ContextTag(kIntegerCount), true));
+    ReturnErrorOnFailure(writer.PutString(ContextTag(kIntegerCount + 1), kString));
+    ReturnErrorOnFailure(writer.Put(ContextTag(kIntegerCount + 2), ByteSpan(kBytes)));
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(kIntegerCount + 3), kTLVType_Array, array));
+    for (uint8_t i = 0; i < kArrayLength; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(AnonymousTag(), static_cast<uint16_t>(i * 1000)));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(array));
+    return writer.EndContainer(outer);
+}
+
+CHIP_ERROR ReadPayload(TLVReader & reader)
+{
+    TLVType outer;
+    TLVType array;
+    uint64_t value;
+    bool flag;
+    CharSpan string;
+    ByteSpan bytes;
+
+    ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+    for (uint8_t i = 0; i < kIntegerCount; i++)
+    {
+        ReturnErrorOnFailure(reader.Next(ContextTag(i)));
+        ReturnErrorOnFailure(reader.Get(value));
+        DoNotOptimize(value);
+    }
+    ReturnErrorOnFailure(reader.Next(ContextTag(kIntegerCount)));
+    ReturnErrorOnFailure(reader.Get(flag));
+    ReturnErrorOnFailure(reader.Next(ContextTag(kIntegerCount + 1)));
+    ReturnErrorOnFailure(reader.Get(string));
+    ReturnErrorOnFailure(reader.Next(ContextTag(kIntegerCount + 2)));
+    ReturnErrorOnFailure(reader.Get(bytes));
+    DoNotOptimize(flag);
+    DoNotOptimize(string);
+    DoNotOptimize(bytes);
+    ReturnErrorOnFailure(reader.Next(kTLVType_Array, ContextTag(kIntegerCount + 3)));
+    ReturnErrorOnFailure(reader.EnterContainer(array));
+    for (uint8_t i = 0; i < kArrayLength; i++)
+    {
+        ReturnErrorOnFailure(reader.Next());
+        ReturnErrorOnFailure(reader.Get(value));
+        DoNotOptimize(value);
+    }
+    ReturnErrorOnFailure(reader.ExitContainer(array));
+    return reader.ExitContainer(outer);
+}
+
+void BenchmarkTLVWriter(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length = 0;
+
+    while (state.KeepRunning())
+    {
+        TLVWriter writer;
+        writer.Init(buffer);
+        if (WritePayload(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to write the payload");
+            return;
+        }
+        length = writer.GetLengthWritten();
+        DoNotOptimize(buffer);
+    }
+    state.SetBytesProcessed(state.Iterations() * length);
+    state.SetItemsProcessed(state.Iterations());
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkTLVWriter)
+
+void BenchmarkTLVReader(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    TLVWriter writer;
+
+    writer.Init(buffer);
+    if (WritePayload(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to write the payload");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        TLVReader reader;
+        reader.Init(buffer, writer.GetLengthWritten());
+        if (ReadPayload(reader) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to read the payload");
+            return;
+        }
+    }
+    state.SetBytesProcessed(state.Iterations() * writer.GetLengthWritten());
+    state.SetItemsProcessed(state.Iterations());
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkTLVReader)
+
+/**
+ * Go through the payload without decoding the values, like the parsers of the messages looking for a field.
+ */
+void BenchmarkTLVReaderSkip(State & state)
+{
+    uint8_t buffer[kBufferSize];
+    TLVWriter writer;
+
+    writer.Init(buffer);
+    if (WritePayload(writer) != CHIP_NO_ERROR || writer.Finalize() != CHIP_NO_ERROR)
+    {
+        state.SkipWithError("Failed to write the payload");
+        return;
+    }
+
+    while (state.KeepRunning())
+    {
+        TLVReader reader;
+        TLVType outer;
+        CHIP_ERROR err;
+
+        reader.Init(buffer, writer.GetLengthWritten());
+        if (reader.Next() != CHIP_NO_ERROR || reader.EnterContainer(outer) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to read the payload");
+            return;
+        }
+        while ((err = reader.Next()) == CHIP_NO_ERROR)
+        {
+        }
+        if (err != CHIP_END_OF_TLV || reader.ExitContainer(outer) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to skip the payload");
+            return;
+        }
+    }
+    state.SetBytesProcessed(state.Iterations() * writer.GetLengthWritten());
+    state.SetItemsProcessed(state.Iterations());
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkTLVReaderSkip)
+
+} // namespace
@@ -0,0 +1,255 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the TLVIndex class.
+ */
+
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/CHIPTLVIndex.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr uint32_t kListLength = 100;
+constexpr size_t kBufferSize   = 1024;
+
+/**
+ * Encode a structure with a long array of integers, a nested structure and a string:
+ *
+ * {
+ *     0 => [ 0, 3, 6, ... ],
+ *     1 => { 0 => "nested", 1 => true },
+ *     2 => "last",
+ * }
+ */
+CHIP_ERROR EncodePayload(uint8_t * buffer, uint32_t & length)
+{
+    TLVWriter writer;
+    TLVType outer;
+    TLVType inner;
+
+    writer.Init(buffer, kBufferSize);
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag(), kTLVType_Structure, outer));
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(0), kTLVType_Array, inner));
+    for (uint32_t i = 0; i < kListLength; i++)
+    {
+        ReturnErrorOnFailure(writer.Put(AnonymousTag(), i * 3));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(inner));
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(1), kTLVType_Structure, inner));
+    ReturnErrorOnFailure(writer.PutString(ContextTag(0), "nested"));
+    ReturnErrorOnFailure(writer.PutBoolean(ContextTag(1), true));
+    ReturnErrorOnFailure(writer.EndContainer(inner));
+    ReturnErrorOnFailure(writer.PutString(ContextTag(2), "last"));
+    ReturnErrorOnFailure(writer.EndContainer(outer));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    length = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+void CheckPayload(nlTestSuite * inSuite, const TLVIndex & index)
+{
+    TLVReader reader;
+    uint32_t value;
+    CharSpan string;
+    bool flag;
+
+    // Root, outer structure, array with its elements, nested structure with its 2 members, last string.
+    NL_TEST_ASSERT(inSuite, index.GetElementCount() == 1 + 1 + 1 + kListLength + 1 + 2 + 1);
+    NL_TEST_ASSERT(inSuite, index.GetChildCount(TLVIndex::kRootElement) == 1);
+
+    TLVIndex::ElementId outer = index.GetChild(TLVIndex::kRootElement, 0);
+    NL_TEST_ASSERT(inSuite, index.GetType(outer) == kTLVType_Structure);
+    NL_TEST_ASSERT(inSuite, index.GetChildCount(outer) == 3);
+
+    TLVIndex::ElementId list = index.FindChild(outer, ContextTag(0));
+    NL_TEST_ASSERT(inSuite, index.GetType(list) == kTLVType_Array);
+    NL_TEST_ASSERT(inSuite, index.GetChildCount(list) == kListLength);
+
+    // Random access into the array.
+    const uint32_t positions[] = { 73, 0, kListLength - 1, 42 };
+    for (uint32_t position : positions)
+    {
+        TLVIndex::ElementId element = index.GetChild(list, position);
+        NL_TEST_ASSERT(inSuite, index.GetType(element) == kTLVType_UnsignedInteger);
+        NL_TEST_ASSERT(inSuite, index.GetReader(element, reader) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Get(value) == CHIP_NO_ERROR && value == position * 3);
+    }
+    NL_TEST_ASSERT(inSuite, index.GetChild(list, kListLength) == TLVIndex::kInvalidElement);
+
+    // The reader goes on with the following elements of the array, up to its end.
+    NL_TEST_ASSERT(inSuite, index.GetReader(index.GetChild(list, kListLength - 2), reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Get(value) == CHIP_NO_ERROR && value == (kListLength - 1) * 3);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+
+    TLVIndex::ElementId nested = index.FindChild(outer, ContextTag(1));
+    NL_TEST_ASSERT(inSuite, index.GetType(nested) == kTLVType_Structure);
+    NL_TEST_ASSERT(inSuite, index.GetChildCount(nested) == 2);
+    NL_TEST_ASSERT(inSuite, index.GetReader(index.FindChild(nested, ContextTag(1)), reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(1));
+    NL_TEST_ASSERT(inSuite, reader.Get(flag) == CHIP_NO_ERROR && flag);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(inSuite, index.GetReader(index.FindChild(nested, ContextTag(0)), reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Get(string) == CHIP_NO_ERROR && string.data_equal(CharSpan::fromCharString("nested")));
+    NL_TEST_ASSERT(inSuite, index.FindChild(nested, ContextTag(2)) == TLVIndex::kInvalidElement);
+
+    // A container can be entered from the reader positioned on it.
+    TLVType containerType;
+    NL_TEST_ASSERT(inSuite, index.GetReader(nested, reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(containerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next(ContextTag(0)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next(ContextTag(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+    NL_TEST_ASSERT(inSuite, reader.ExitContainer(containerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(2));
+    NL_TEST_ASSERT(inSuite, reader.Get(string) == CHIP_NO_ERROR && string.data_equal(CharSpan::fromCharString("last")));
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+
+    NL_TEST_ASSERT(inSuite, index.GetReader(TLVIndex::kRootElement, reader) == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+void TestIndexBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length;
+    TLVIndex index;
+
+    NL_TEST_ASSERT(inSuite, EncodePayload(buffer, length) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Init(buffer, length) == CHIP_NO_ERROR);
+    CheckPayload(inSuite, index);
+
+    index.Clear();
+    NL_TEST_ASSERT(inSuite, index.GetElementCount() == 0);
+    NL_TEST_ASSERT(inSuite, index.GetChild(TLVIndex::kRootElement, 0) == TLVIndex::kInvalidElement);
+}
+
+void TestIndexReader(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length;
+    TLVIndex index;
+    TLVReader reader;
+    TLVType outer;
+
+    NL_TEST_ASSERT(inSuite, EncodePayload(buffer, length) == CHIP_NO_ERROR);
+    reader.Init(buffer, length);
+
+    // A reader not positioned on an element cannot be indexed.
+    NL_TEST_ASSERT(inSuite, index.Init(reader) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Init(reader) == CHIP_NO_ERROR);
+    CheckPayload(inSuite, index);
+
+    // Index the nested structure alone, from a reader inside the outer structure, which is left where it was.
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(outer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next(ContextTag(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.Init(reader) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.GetElementCount() == 1 + 1 + 2);
+    NL_TEST_ASSERT(inSuite, index.GetTag(index.GetChild(TLVIndex::kRootElement, 0)) == ContextTag(1));
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(1));
+    NL_TEST_ASSERT(inSuite, reader.Next(ContextTag(2)) == CHIP_NO_ERROR);
+
+    // The readers of the index see the following members of the outer structure.
+    TLVReader nested;
+    NL_TEST_ASSERT(inSuite, index.GetReader(index.GetChild(TLVIndex::kRootElement, 0), nested) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nested.Next(ContextTag(2)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nested.Next() == CHIP_END_OF_TLV);
+}
+
+void TestIndexMalformed(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buffer[kBufferSize];
+    uint32_t length;
+    TLVIndex index;
+
+    NL_TEST_ASSERT(inSuite, EncodePayload(buffer, length) == CHIP_NO_ERROR);
+
+    // The end of the outer structure is missing.
+    NL_TEST_ASSERT(inSuite, index.Init(buffer, length - 1) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.GetElementCount() == 0);
+
+    // The encoding stops in the middle of the array.
+    NL_TEST_ASSERT(inSuite, index.Init(buffer, length / 2) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.GetElementCount() == 0);
+
+    NL_TEST_ASSERT(inSuite, index.Init(buffer, 0) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, index.GetElementCount() == 1);
+    NL_TEST_ASSERT(inSuite, index.GetChildCount(TLVIndex::kRootElement) == 0);
+}
+
+int TestCHIPTLVIndex_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+    {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
+
+int TestCHIPTLVIndex_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Index a buffer", TestIndexBuffer),
+    NL_TEST_DEF("Index the element of a reader", TestIndexReader),
+    NL_TEST_DEF("Index a malformed encoding", TestIndexMalformed),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestCHIPTLVIndex()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-tlv-index",
+        &sTests[0],
+        TestCHIPTLVIndex_Setup,
+        TestCHIPTLVIndex_Teardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCHIPTLVIndex)
@@ -346,6 +346,9 @@ CHIP_ERROR AdvertiserMinMdns::Init(chip::Inet::EndPointManager<chip::Inet::UDPEn
     // GlobalMinimalMdnsServer (used for testing).
     mResponseSender.SetServer(&GlobalMinimalMdnsServer::Server());
 
+    // Interfaces and their addresses may have changed since replies were cached.
+    mResponseSender.InvalidateResponseCache();
+
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(udpEndPointManager, kMdnsPort));
 
     ChipLogProgress(Discovery, "CHIP minimal mDNS started advertising.");
@@ -367,6 +370,8 @@ void AdvertiserMinMdns::Shutdown()
 
 CHIP_ERROR AdvertiserMinMdns::RemoveServices()
 {
+    mResponseSender.InvalidateResponseCache();
+
     while (mOperationalResponders.begin() != mOperationalResponders.end())
     {
         auto it = mOperationalResponders.begin();
@@ -431,6 +436,8 @@ OperationalQueryAllocator::Allocator * AdvertiserMinMdns::FindEmptyOperationalAl
 
 CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters & params)
 {
+    // Cached replies were built from the records about to change
+    mResponseSender.InvalidateResponseCache();
 
     char nameBuffer[Operational::kInstanceNameMaxLength + 1] = "";
 
@@ -557,6 +564,9 @@ CHIP_ERROR AdvertiserMinMdns::UpdateCommissionableInstanceName()
 
 CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters & params)
 {
+    // Cached replies were built from the records about to change
+    mResponseSender.InvalidateResponseCache();
+
     // Advertising data changed. Send a TTL=0 for everything as a refresh,
     // which will clear caches (including things we are about to remove). Once this is done
     // we will re-advertise available records with a longer TTL again.
@@ -604,6 +604,16 @@ CHIP_ERROR DiscoveryImplPlatform::ResolveNodeId(const PeerId & peerId, Inet::IPA
     return mResolverProxy.ResolveNodeId(peerId, type);
 }
 
+void DiscoveryImplPlatform::NodeIdResolutionNoLongerValid(const PeerId & peerId)
+{
+    DnssdService service;
+
+    ReturnOnFailure(MakeInstanceName(service.mName, sizeof(service.mName), peerId));
+    strncpy(service.mType, kOperationalServiceName, sizeof(service.mType));
+    service.mProtocol = DnssdServiceProtocol::kDnssdProtocolTcp;
+    LogErrorOnFailure(ChipDnssdResolveNoLongerValid(&service));
+}
+
 CHIP_ERROR DiscoveryImplPlatform::DiscoverCommissionableNodes(DiscoveryFilter filter)
 {
     ReturnErrorOnFailure(InitImpl());
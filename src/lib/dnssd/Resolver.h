@@ -374,6 +374,14 @@ public:
      */
     virtual CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) = 0;
 
+    /**
+     * Tells the resolver that the address the given operational node resolved to did not work,
+     * e.g. because no session could be established with it.
+     *
+     * Results cached for the node are dropped, so that its next resolution goes to the network.
+     */
+    virtual void NodeIdResolutionNoLongerValid(const PeerId & peerId) = 0;
+
     /**
      * Finds all commissionable nodes matching the given filter.
      *
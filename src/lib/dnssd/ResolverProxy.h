@@ -150,6 +150,10 @@ public:
     }
 
     CHIP_ERROR ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type) override;
+    void NodeIdResolutionNoLongerValid(const PeerId & peerId) override
+    {
+        chip::Dnssd::Resolver::Instance().NodeIdResolutionNoLongerValid(peerId);
+    }
     CHIP_ERROR DiscoverCommissionableNodes(DiscoveryFilter filter = DiscoveryFilter()) override;
     CHIP_ERROR DiscoverCommissioners(DiscoveryFilter filter = DiscoveryFilter()) override;
 
@@ -31,7 +31,9 @@ class QueryReplyFilter : public ReplyFilter
 public:
     QueryReplyFilter(const QueryData & queryData) : mQueryData(queryData) {}
 
-    bool Accept(QType qType, QClass qClass, FullQName qname) override
+    bool Accept(QType qType, QClass qClass, FullQName qname) override { return Accept(qType, qClass, qname, qname.Hash()); }
+
+    bool Accept(QType qType, QClass qClass, FullQName qname, QNameHash qnameHash) override
     {
         if (!AcceptableQueryType(qType))
         {
@@ -43,7 +45,7 @@ public:
             return false;
         }
 
-        return AcceptablePath(qname);
+        return AcceptablePath(qname, qnameHash);
     }
 
     /// Ignore qname matches during Accept calls (if set to true, only qtype and qclass are matched).
@@ -79,19 +81,28 @@ private:
         return ((mQueryData.GetClass() == QClass::ANY) || (mQueryData.GetClass() == qClass));
     }
 
-    bool AcceptablePath(FullQName qname)
+    bool AcceptablePath(FullQName qname, QNameHash qnameHash)
     {
         if (mIgnoreNameMatch || mQueryData.IsInternalBroadcast())
         {
             return true;
         }
 
-        return (mQueryData.GetName() == qname);
+        // The query name is hashed once, on first use, and most names are then rejected by the hash alone
+        if (!mHasQueryNameHash)
+        {
+            mQueryNameHash    = mQueryData.GetName().Hash();
+            mHasQueryNameHash = true;
+        }
+
+        return (mQueryNameHash == qnameHash) && (mQueryData.GetName() == qname);
     }
 
     const QueryData & mQueryData;
     bool mIgnoreNameMatch        = false;
     bool mSendingAdditionalItems = false;
+    bool mHasQueryNameHash       = false;
+    QNameHash mQueryNameHash     = 0;
 };
 
 } // namespace Minimal
@@ -19,8 +19,11 @@
 
 #include "QueryReplyFilter.h"
 
+#include <lib/support/CodeUtils.h>
 #include <system/SystemClock.h>
 
+#include <string.h>
+
 namespace mdns {
 namespace Minimal {
 
@@ -28,12 +31,7 @@ namespace {
 
 constexpr uint16_t kMdnsStandardPort = 5353;
 
-// Restriction for UDP packets:  https://tools.ietf.org/html/rfc1035#section-4.2.1
-//
-//    Messages carried by UDP are restricted to 512 bytes (not counting the IP
-//    or UDP headers).  Longer messages are truncated and the TC bit is set in
-//    the header.
-constexpr uint16_t kPacketSizeBytes = 512;
+using Internal::kPacketSizeBytes;
 
 } // namespace
 namespace Internal {
@@ -48,6 +46,46 @@ bool ResponseSendingState::IncludeQuery() const
     return (mSource->SrcPort != kMdnsStandardPort);
 }
 
+bool ResponseCacheKey::Set(const ResponseSendingState & state, const ResponseConfiguration & configuration)
+{
+    const QueryData & query = *state.GetQuery();
+
+    // Internal broadcasts are sent with throttling disabled and are rare, not worth caching
+    VerifyOrReturnValue(!query.IsInternalBroadcast(), false);
+
+    // The query name is kept as received: it is also echoed back if IncludeQuery is set
+    SerializedQNameIterator name = query.GetName();
+    mNameLength                  = 0;
+    while (name.Next())
+    {
+        const size_t labelLength = strlen(name.Value());
+        VerifyOrReturnValue(mNameLength + 1 + labelLength <= sizeof(mName), false);
+
+        mName[mNameLength++] = static_cast<uint8_t>(labelLength);
+        memcpy(&mName[mNameLength], name.Value(), labelLength);
+        mNameLength += labelLength;
+    }
+    VerifyOrReturnValue(name.IsValid(), false);
+
+    mType               = query.GetType();
+    mClass              = query.GetClass();
+    mInterface          = state.GetSourceInterfaceId();
+    mAddressType        = state.GetSourceAddress().Type();
+    mTtlSecondsOverride = configuration.GetTtlSecondsOverride();
+    mSendUnicast        = state.SendUnicast();
+    mIncludeQuery       = state.IncludeQuery();
+
+    return true;
+}
+
+bool ResponseCacheKey::operator==(const ResponseCacheKey & other) const
+{
+    return (mNameLength == other.mNameLength) && (memcmp(mName, other.mName, mNameLength) == 0) && (mType == other.mType) &&
+        (mClass == other.mClass) && (mInterface == other.mInterface) && (mAddressType == other.mAddressType) &&
+        (mTtlSecondsOverride == other.mTtlSecondsOverride) && (mSendUnicast == other.mSendUnicast) &&
+        (mIncludeQuery == other.mIncludeQuery);
+}
+
 } // namespace Internal
 
 CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder)
@@ -60,12 +98,14 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
         if (*it == nullptr || *it == queryResponder)
         {
             *it = queryResponder;
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
 
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
     mResponders.push_back(queryResponder);
+    InvalidateResponseCache();
     return CHIP_NO_ERROR;
 #else
     return CHIP_ERROR_NO_MEMORY;
@@ -82,6 +122,7 @@ CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryRespon
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
             mResponders.erase(it);
 #endif
+            InvalidateResponseCache();
             return CHIP_NO_ERROR;
         }
     }
@@ -100,11 +141,164 @@ bool ResponseSender::HasQueryResponders() const
     return false;
 }
 
+void ResponseSender::InvalidateResponseCache()
+{
+    for (auto & entry : mResponseCache)
+    {
+        entry.valid = false;
+    }
+    mCapture = nullptr;
+}
+
+Internal::CachedResponse * ResponseSender::FindCachedResponse(const Internal::ResponseCacheKey & key,
+                                                              chip::System::Clock::Timestamp now)
+{
+    for (auto & entry : mResponseCache)
+    {
+        if (!entry.valid || !(entry.key == key))
+        {
+            continue;
+        }
+
+        if (now - entry.createdTime >= CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE)
+        {
+            entry.valid = false;
+            return nullptr;
+        }
+
+        return &entry;
+    }
+    return nullptr;
+}
+
+Internal::CachedResponse * ResponseSender::AllocateCachedResponse(const Internal::ResponseCacheKey & key,
+                                                                  chip::System::Clock::Timestamp now)
+{
+    Internal::CachedResponse * result = nullptr;
+
+    // Cached replies stay usable until this one is complete
+    for (auto & entry : mResponseCache)
+    {
+        if (!entry.valid)
+        {
+            result = &entry;
+            break;
+        }
+    }
+    VerifyOrReturnValue(result != nullptr, nullptr);
+
+    result->key          = key;
+    result->createdTime  = now;
+    result->lastUsedTime = now;
+    result->answerCount  = 0;
+    result->packetLength = 0;
+
+    return result;
+}
+
+void ResponseSender::CommitCachedResponse(Internal::CachedResponse & entry)
+{
+    Internal::CachedResponse * leastRecentlyUsed = nullptr;
+    size_t validCount                            = 0;
+
+    for (auto & other : mResponseCache)
+    {
+        if (!other.valid)
+        {
+            continue;
+        }
+        validCount++;
+        if ((leastRecentlyUsed == nullptr) || (other.lastUsedTime < leastRecentlyUsed->lastUsedTime))
+        {
+            leastRecentlyUsed = &other;
+        }
+    }
+
+    // Keep an unused entry for the next capture
+    if ((leastRecentlyUsed != nullptr) && (validCount >= kResponseCacheEntries - 1))
+    {
+        leastRecentlyUsed->valid = false;
+    }
+    entry.valid = true;
+}
+
+bool ResponseSender::IsMulticastThrottled(const Internal::QueryResponderInfo & record, chip::System::Clock::Timestamp now) const
+{
+    // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
+    //
+    // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
+    //       broadcasts on one interface to throttle broadcasts on another interface.
+    const chip::System::Clock::Timestamp multicastAllowedBefore = now - chip::System::Clock::Seconds32(1);
+
+    return (multicastAllowedBefore > chip::System::Clock::kZero) && (record.lastMulticastTime >= multicastAllowedBefore);
+}
+
+CHIP_ERROR ResponseSender::SendCachedResponse(Internal::CachedResponse & entry, chip::System::Clock::Timestamp now)
+{
+    chip::System::PacketBufferHandle packet = chip::System::PacketBufferHandle::NewWithData(entry.packet, entry.packetLength);
+    ReturnErrorCodeIf(packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    HeaderRef(packet->Start()).SetMessageId(static_cast<uint16_t>(mSendState.GetMessageId()));
+    entry.lastUsedTime = now;
+
+    if (!mSendState.SendUnicast())
+    {
+        for (size_t i = 0; i < entry.answerCount; i++)
+        {
+            entry.answers[i]->lastMulticastTime = now;
+        }
+    }
+
+    return SendReply(std::move(packet));
+}
+
 CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
                                    const ResponseConfiguration & configuration)
 {
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
     mSendState.Reset(messageId, query, querySource);
+    mCapture = nullptr;
+
+    Internal::ResponseCacheKey cacheKey;
+    if (!mResponseCache.empty() && cacheKey.Set(mSendState, configuration))
+    {
+        Internal::CachedResponse * entry = FindCachedResponse(cacheKey, kTimeNow);
+
+        if (entry == nullptr)
+        {
+            mCapture = AllocateCachedResponse(cacheKey, kTimeNow);
+        }
+        else
+        {
+            bool throttled = false;
+            for (size_t i = 0; !mSendState.SendUnicast() && (i < entry->answerCount); i++)
+            {
+                throttled = throttled || IsMulticastThrottled(*entry->answers[i], kTimeNow);
+            }
+
+            // A throttled record is left out of the reply, which then differs from the cached one
+            if (!throttled)
+            {
+                return SendCachedResponse(*entry, kTimeNow);
+            }
+        }
+    }
 
+    CHIP_ERROR err = SendAllResponses(query, querySource, configuration, kTimeNow);
+
+    if ((mCapture != nullptr) && (err == CHIP_NO_ERROR) && (mCapture->packetLength > 0))
+    {
+        CommitCachedResponse(*mCapture);
+    }
+    mCapture = nullptr;
+
+    return err;
+}
+
+CHIP_ERROR ResponseSender::SendAllResponses(const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                            const ResponseConfiguration & configuration, chip::System::Clock::Timestamp now)
+{
     // Responder has a stateful 'additional replies required' that is used within the response
     // loop. 'no additionals required' is set at the start and additionals are marked as the query
     // reply is built.
@@ -120,21 +314,11 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
         responseFilter.SetReplyFilter(&queryReplyFilter);
 
-        if (!mSendState.SendUnicast())
-        {
-            // According to https://tools.ietf.org/html/rfc6762#section-6  we should multicast at most 1/sec
-            //
-            // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
-            //       broadcasts on one interface to throttle broadcasts on another interface.
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
-        }
         for (auto responder = mResponders.begin(); responder != mResponders.end(); responder++)
         {
             if (*responder == nullptr)
@@ -143,6 +327,13 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
             }
             for (auto it = (*responder)->begin(&responseFilter); it != (*responder)->end(); it++)
             {
+                if (!mSendState.SendUnicast() && IsMulticastThrottled(*it.GetInternal(), now))
+                {
+                    // Repeating this query a moment later gets this record too, so the reply must not be reused
+                    AbortResponseCapture();
+                    continue;
+                }
+
                 it->responder->AddAllResponses(querySource, this, configuration);
                 ReturnErrorOnFailure(mSendState.GetError());
 
@@ -150,7 +341,19 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
 
                 if (!mSendState.SendUnicast())
                 {
-                    it->lastMulticastTime = kTimeNow;
+                    it->lastMulticastTime = now;
+                }
+
+                if (mCapture != nullptr)
+                {
+                    if (mCapture->answerCount < ArraySize(mCapture->answers))
+                    {
+                        mCapture->answers[mCapture->answerCount++] = it.GetInternal();
+                    }
+                    else
+                    {
+                        AbortResponseCapture();
+                    }
                 }
             }
         }
@@ -191,29 +394,47 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        chip::System::PacketBufferHandle packet = mResponseBuilder.ReleasePacket();
 
-        if (mSendState.SendUnicast())
+        if (mCapture != nullptr)
         {
-#if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
-#endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
+            // Only replies fitting in a single packet are cached
+            if ((mCapture->packetLength == 0) && !packet->HasChainedBuffer() && (packet->DataLength() <= sizeof(mCapture->packet)))
+            {
+                memcpy(mCapture->packet, packet->Start(), packet->DataLength());
+                mCapture->packetLength = packet->DataLength();
+            }
+            else
+            {
+                AbortResponseCapture();
+            }
         }
-        else
-        {
+
+        ReturnErrorOnFailure(SendReply(std::move(packet)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReply(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
-        }
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
     }
 
-    return CHIP_NO_ERROR;
+#if CHIP_MINMDNS_HIGH_VERBOSITY
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+#endif
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
 }
 
 CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
@@ -23,16 +23,18 @@
 
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
 
+#include <lib/core/Optional.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
+#include <array>
+
 #if CHIP_CONFIG_MINMDNS_DYNAMIC_OPERATIONAL_RESPONDER_LIST
 
 #include <list>
 using QueryResponderPtrPool = std::list<mdns::Minimal::QueryResponderBase *>;
 #else
 
-#include <array>
-
 // Note: ptr storage is 2 + number of operational networks required, based on
 // the current implementation of Advertiser_ImplMinimalMdns.cpp:
 //    - 1 for commissionable advertising
@@ -47,6 +49,13 @@ namespace Minimal {
 
 namespace Internal {
 
+// Restriction for UDP packets:  https://tools.ietf.org/html/rfc1035#section-4.2.1
+//
+//    Messages carried by UDP are restricted to 512 bytes (not counting the IP
+//    or UDP headers).  Longer messages are truncated and the TC bit is set in
+//    the header.
+constexpr uint16_t kPacketSizeBytes = 512;
+
 /// Represents the internal state for sending a currently active request
 class ResponseSendingState
 {
@@ -96,6 +105,51 @@ private:
     CHIP_ERROR mSendError                    = CHIP_NO_ERROR;
 };
 
+/// Identifies queries that get the same reply as long as the responders are unchanged.
+class ResponseCacheKey
+{
+public:
+    /// Set the key for the query of the given state.
+    ///
+    /// Returns false if replies to this query cannot be cached (internal broadcasts,
+    /// invalid or very long query names).
+    bool Set(const ResponseSendingState & state, const ResponseConfiguration & configuration);
+
+    bool operator==(const ResponseCacheKey & other) const;
+
+private:
+    static constexpr size_t kMaxNameBytes = 128;
+
+    uint8_t mName[kMaxNameBytes]; // query name, as length prefixed labels
+    size_t mNameLength                     = 0;
+    QType mType                            = QType::ANY;
+    QClass mClass                          = QClass::ANY;
+    chip::Inet::InterfaceId mInterface     = chip::Inet::InterfaceId::Null();
+    chip::Inet::IPAddressType mAddressType = chip::Inet::IPAddressType::kAny;
+    chip::Optional<uint32_t> mTtlSecondsOverride;
+    bool mSendUnicast  = false;
+    bool mIncludeQuery = false;
+};
+
+/// A serialized reply that fits into a single packet, kept to answer the same
+/// query again without going through the responders.
+struct CachedResponse
+{
+    static constexpr size_t kMaxAnswers = 8;
+
+    bool valid = false;
+    ResponseCacheKey key;
+    chip::System::Clock::Timestamp createdTime  = chip::System::Clock::kZero; // for CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE
+    chip::System::Clock::Timestamp lastUsedTime = chip::System::Clock::kZero; // least recently used entries are replaced first
+
+    // Records sent in the answer section, for the multicast throttling
+    QueryResponderInfo * answers[kMaxAnswers];
+    size_t answerCount = 0;
+
+    uint8_t packet[kPacketSizeBytes];
+    uint16_t packetLength = 0;
+};
+
 } // namespace Internal
 
 /// Sends responses to mDNS queries.
@@ -120,13 +174,39 @@ public:
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Forget all cached replies.
+    ///
+    /// Must be called whenever records of the registered query responders change.
+    void InvalidateResponseCache();
+
 private:
+    CHIP_ERROR SendAllResponses(const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
+                                const ResponseConfiguration & configuration, chip::System::Clock::Timestamp now);
     CHIP_ERROR FlushReply();
+    CHIP_ERROR SendReply(chip::System::PacketBufferHandle && packet);
     CHIP_ERROR PrepareNewReplyPacket();
 
+    Internal::CachedResponse * FindCachedResponse(const Internal::ResponseCacheKey & key, chip::System::Clock::Timestamp now);
+    Internal::CachedResponse * AllocateCachedResponse(const Internal::ResponseCacheKey & key, chip::System::Clock::Timestamp now);
+    void CommitCachedResponse(Internal::CachedResponse & entry);
+    bool IsMulticastThrottled(const Internal::QueryResponderInfo & record, chip::System::Clock::Timestamp now) const;
+    CHIP_ERROR SendCachedResponse(Internal::CachedResponse & entry, chip::System::Clock::Timestamp now);
+    void AbortResponseCapture() { mCapture = nullptr; }
+
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
 
+    /// Replies sent recently. Entries are rebuilt at most every
+    /// CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_MAX_AGE, as address records follow
+    /// interface changes without the responders changing.
+    ///
+    /// There is one entry more than cached replies: a reply is captured into an
+    /// unused entry, and only replaces a cached one once it was sent completely.
+    static constexpr size_t kResponseCacheEntries =
+        CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0 ? CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE + 1 : 0;
+    std::array<Internal::CachedResponse, kResponseCacheEntries> mResponseCache;
+    Internal::CachedResponse * mCapture = nullptr; // entry filled by the reply being built, if any
+
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
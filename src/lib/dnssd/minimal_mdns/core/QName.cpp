@@ -21,6 +21,31 @@
 
 namespace mdns {
 namespace Minimal {
+namespace {
+
+// 32-bit FNV-1a
+constexpr QNameHash kHashOffsetBasis = 2166136261u;
+constexpr QNameHash kHashPrime       = 16777619u;
+
+QNameHash HashByte(QNameHash hash, uint8_t value)
+{
+    return (hash ^ value) * kHashPrime;
+}
+
+/// Adds a part to the hash, folded like strcasecmp does in the C locale.
+QNameHash HashPart(QNameHash hash, QNamePart part)
+{
+    // The length separates parts, so that "ab"."c" and "a"."bc" differ
+    hash = HashByte(hash, static_cast<uint8_t>(strlen(part)));
+    for (const char * p = part; *p != '\0'; p++)
+    {
+        const uint8_t c = static_cast<uint8_t>(*p);
+        hash            = HashByte(hash, ((c >= 'A') && (c <= 'Z')) ? static_cast<uint8_t>(c - 'A' + 'a') : c);
+    }
+    return hash;
+}
+
+} // namespace
 
 bool SerializedQNameIterator::Next()
 {
@@ -61,9 +86,10 @@ bool SerializedQNameIterator::Next(bool followIndirectPointers)
             }
 
             size_t offset = ((*mCurrentPosition & 0x3F) << 8) | *(mCurrentPosition + 1);
-            if (offset > mLookBehindMax)
+            if (offset >= mLookBehindMax)
             {
-                // Potential infinite recursion.
+                // Potential infinite recursion: pointing at or after the start of the
+                // current segment would get back to this very pointer.
                 mIsValid = false;
                 return false;
             }
@@ -194,6 +220,29 @@ bool SerializedQNameIterator::operator==(const SerializedQNameIterator & other)
     return a.IsValid() && b.IsValid();
 }
 
+QNameHash SerializedQNameIterator::Hash() const
+{
+    SerializedQNameIterator self = *this; // allow iteration
+    QNameHash hash               = kHashOffsetBasis;
+
+    while (self.Next())
+    {
+        hash = HashPart(hash, self.Value());
+    }
+    return hash;
+}
+
+QNameHash FullQName::Hash() const
+{
+    QNameHash hash = kHashOffsetBasis;
+
+    for (size_t i = 0; i < nameCount; i++)
+    {
+        hash = HashPart(hash, names[i]);
+    }
+    return hash;
+}
+
 bool FullQName::operator==(const FullQName & other) const
 {
     if (nameCount != other.nameCount)
@@ -36,6 +36,12 @@ namespace Minimal {
 /// A QName part is a null-terminated string
 using QNamePart = const char *;
 
+/// Case insensitive hash of a QName.
+///
+/// QNames that compare equal have the same hash, so comparing hashes rejects
+/// most non-matching names without comparing their parts.
+using QNameHash = uint32_t;
+
 /// A list of QNames that is simple to pass around
 ///
 /// As the struct may be copied, the lifetime of 'names' has to extend beyond
@@ -55,6 +61,10 @@ struct FullQName
 
     bool operator==(const FullQName & other) const;
     bool operator!=(const FullQName & other) const { return !(*this == other); }
+
+    /// Computes the hash of the name. Not cached: keep the result for names
+    /// that are compared often.
+    QNameHash Hash() const;
 };
 
 /// A serialized QNAME is comprised of
@@ -100,6 +110,10 @@ public:
     bool operator==(const SerializedQNameIterator & other) const;
     bool operator!=(const SerializedQNameIterator & other) const { return !(*this == other); }
 
+    /// Computes the hash of the parts returned by Next(), following indirect
+    /// pointers once. Does not change the iterator state.
+    QNameHash Hash() const;
+
     size_t OffsetInCurrentValidData() const { return static_cast<size_t>(mCurrentPosition - mValidData.Start()); }
 
 private:
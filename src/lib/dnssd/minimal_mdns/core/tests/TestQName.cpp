@@ -19,6 +19,8 @@
 #include <lib/dnssd/minimal_mdns/core/QName.h>
 #include <lib/support/UnitTestRegistration.h>
 
+#include <random>
+
 #include <nlunit-test.h>
 
 namespace {
@@ -163,6 +165,17 @@ void InvalidReferencing(nlTestSuite * inSuite, void * inContext)
         NL_TEST_ASSERT(inSuite, !it.IsValid());
     }
 
+    {
+        // Infinite recursion by referencing again the target of the previous reference
+        static const uint8_t kData[] = "\01x\01a\xc0\x02";
+        SerializedQNameIterator it(BytesRange(kData, kData + sizeof(kData) - 1), kData + 4);
+
+        NL_TEST_ASSERT(inSuite, it.Next());
+        NL_TEST_ASSERT(inSuite, strcmp(it.Value(), "a") == 0);
+        NL_TEST_ASSERT(inSuite, !it.Next());
+        NL_TEST_ASSERT(inSuite, !it.IsValid());
+    }
+
     {
         // Reference that goes forwad instead of backward
         static const uint8_t kData[] = "\03test\xc0\x07";
@@ -301,6 +314,143 @@ void SerializedCompare(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIs) != thisIsATestPtr);
 }
 
+void Hash(nlTestSuite * inSuite, void * inContext)
+{
+    static const uint8_t kThisIsATest1[] = "\04this\02is\01a\04test\00";
+    static const uint8_t kThisIsATest2[] = "\04ThIs\02is\01A\04tESt\00";
+    static const uint8_t kThisIsA[]      = "\04this\02is\01a\00";
+    static const uint8_t kThisIsATes[]   = "\04this\02is\01a\03tes\00";
+    static const uint8_t kPtrItems[]     = "\03abc\02is\01a\04test\00\04this\xc0\04";
+    const QNamePart kThisIsATest[]       = { "THIS", "is", "A", "test" };
+    const QNamePart kThisIsATe[]         = { "this", "is", "ate", "st" };
+
+    SerializedQNameIterator thisIsATestPtr(BytesRange(kPtrItems, kPtrItems + sizeof(kPtrItems)), kPtrItems + 15);
+
+    NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIsATest1).Hash() == AsSerializedQName(kThisIsATest2).Hash());
+    NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIsATest1).Hash() == thisIsATestPtr.Hash());
+    NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIsATest1).Hash() == FullQName(kThisIsATest).Hash());
+    NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIsATest1).Hash() != AsSerializedQName(kThisIsA).Hash());
+    NL_TEST_ASSERT(inSuite, AsSerializedQName(kThisIsATest1).Hash() != AsSerializedQName(kThisIsATes).Hash());
+    NL_TEST_ASSERT(inSuite, FullQName(kThisIsATest).Hash() != FullQName(kThisIsATe).Hash());
+}
+
+/// Random name, in both forms, made of few short parts from a small alphabet so
+/// that random names often match.
+class RandomQName
+{
+public:
+    static constexpr size_t kMaxParts    = 4;
+    static constexpr size_t kMaxPartSize = 3;
+
+    RandomQName(std::minstd_rand & random)
+    {
+        static const char kAlphabet[] = "aAbB-";
+
+        mNameCount = random() % (kMaxParts + 1);
+        for (size_t i = 0; i < mNameCount; i++)
+        {
+            const size_t length = random() % (kMaxPartSize + 1);
+            for (size_t j = 0; j < length; j++)
+            {
+                mParts[i][j] = kAlphabet[random() % (sizeof(kAlphabet) - 1)];
+            }
+            mParts[i][length] = '\0';
+            mNames[i]         = mParts[i];
+        }
+
+        // Optionally write the last parts first and point to them, as name compression does
+        const size_t suffixStart = (mNameCount > 0 && random() % 2) ? random() % mNameCount : mNameCount;
+        size_t offset            = 0;
+        if (suffixStart < mNameCount)
+        {
+            offset                = WriteParts(offset, suffixStart, mNameCount);
+            mSerialized[offset++] = 0;
+        }
+        mStart = offset;
+        offset = WriteParts(offset, 0, suffixStart);
+        if (suffixStart < mNameCount)
+        {
+            mSerialized[offset++] = 0xC0;
+            mSerialized[offset++] = 0;
+        }
+        else
+        {
+            mSerialized[offset++] = 0;
+        }
+        mSerializedSize = offset;
+
+        // Sometimes corrupt the data, names with invalid data must not be accepted more often.
+        if (random() % 8 == 0)
+        {
+            mSerialized[random() % mSerializedSize] = static_cast<uint8_t>(random());
+        }
+    }
+
+    FullQName Full() const
+    {
+        FullQName result;
+        result.names     = mNames;
+        result.nameCount = mNameCount;
+        return result;
+    }
+
+    SerializedQNameIterator Serialized() const
+    {
+        return SerializedQNameIterator(BytesRange(mSerialized, mSerialized + mSerializedSize), mSerialized + mStart);
+    }
+
+private:
+    size_t WriteParts(size_t offset, size_t from, size_t to)
+    {
+        for (size_t i = from; i < to; i++)
+        {
+            const size_t length   = strlen(mParts[i]);
+            mSerialized[offset++] = static_cast<uint8_t>(length);
+            memcpy(&mSerialized[offset], mParts[i], length);
+            offset += length;
+        }
+        return offset;
+    }
+
+    char mParts[kMaxParts][kMaxPartSize + 1];
+    QNamePart mNames[kMaxParts];
+    size_t mNameCount;
+    uint8_t mSerialized[2 * kMaxParts * (kMaxPartSize + 1) + 2];
+    size_t mSerializedSize;
+    size_t mStart;
+};
+
+void HashMatchesComparison(nlTestSuite * inSuite, void * inContext)
+{
+    // Names that compare equal must hash the same, so that rejecting on a hash mismatch
+    // never changes the result of a comparison.
+    std::minstd_rand random(1234);
+    size_t matches = 0;
+
+    for (size_t i = 0; i < 20000; i++)
+    {
+        const RandomQName a(random);
+        const RandomQName b(random);
+
+        if (a.Serialized() == b.Full())
+        {
+            matches++;
+            NL_TEST_ASSERT(inSuite, a.Serialized().Hash() == b.Full().Hash());
+        }
+        if (a.Serialized() == b.Serialized())
+        {
+            NL_TEST_ASSERT(inSuite, a.Serialized().Hash() == b.Serialized().Hash());
+        }
+        if (a.Full() == b.Full())
+        {
+            NL_TEST_ASSERT(inSuite, a.Full().Hash() == b.Full().Hash());
+        }
+    }
+
+    // Make sure the comparisons were exercised with matching names too
+    NL_TEST_ASSERT(inSuite, matches > 100);
+}
+
 } // namespace
 
 // clang-format off
@@ -313,6 +463,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CaseInsensitiveFullQNameCompare", CaseInsensitiveFullQNameCompare),
     NL_TEST_DEF("SerializedCompare", SerializedCompare),
     NL_TEST_DEF("InvalidReferencing", InvalidReferencing),
+    NL_TEST_DEF("Hash", Hash),
+    NL_TEST_DEF("HashMatchesComparison", HashMatchesComparison),
 
     NL_TEST_SENTINEL()
 };
@@ -83,7 +83,8 @@ void QueryResponderBase::ResetAdditionals()
 
 size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
 {
-    size_t count = 0;
+    const QNameHash qnameHash = qname.Hash();
+    size_t count              = 0;
     for (size_t i = 0; i < mResponderInfoSize; i++)
     {
         if (mResponderInfos[i].responder == nullptr)
@@ -96,7 +97,7 @@ size_t QueryResponderBase::MarkAdditional(const FullQName & qname)
             continue; // already marked
         }
 
-        if (mResponderInfos[i].responder->GetQName() == qname)
+        if ((mResponderInfos[i].responder->GetQNameHash() == qnameHash) && (mResponderInfos[i].responder->GetQName() == qname))
         {
             mResponderInfos[i].reportNowAsAdditional = true;
             count++;
@@ -147,7 +147,8 @@ public:
         }
 
         if ((mReplyFilter != nullptr) &&
-            !mReplyFilter->Accept(record->responder->GetQType(), record->responder->GetQClass(), record->responder->GetQName()))
+            !mReplyFilter->Accept(record->responder->GetQType(), record->responder->GetQClass(), record->responder->GetQName(),
+                                  record->responder->GetQNameHash()))
         {
             return false;
         }
@@ -31,6 +31,9 @@ public:
 
     /// Returns true if specified answer should be sent back as a reply
     virtual bool Accept(QType qType, QClass qClass, FullQName qname) = 0;
+
+    /// Same as above, for callers that keep qname.Hash() around.
+    virtual bool Accept(QType qType, QClass qClass, FullQName qname, QNameHash qnameHash) { return Accept(qType, qClass, qname); }
 };
 
 } // namespace Minimal
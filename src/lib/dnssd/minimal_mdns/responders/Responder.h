@@ -71,7 +71,7 @@ private:
 class Responder
 {
 public:
-    Responder(QType qType, const FullQName & qName) : mQType(qType), mQName(qName) {}
+    Responder(QType qType, const FullQName & qName) : mQType(qType), mQName(qName), mQNameHash(qName.Hash()) {}
     virtual ~Responder() {}
 
     QClass GetQClass() const { return QClass::IN; }
@@ -80,6 +80,7 @@ public:
     /// Full name as: "Instance"."Servicer"."Domain"
     /// Domain name is generally just 'local'
     FullQName GetQName() const { return mQName; }
+    QNameHash GetQNameHash() const { return mQNameHash; }
 
     /// Report all reponses maintained by this responder
     ///
@@ -90,6 +91,7 @@ public:
 private:
     const QType mQType;
     const FullQName mQName;
+    const QNameHash mQNameHash;
 };
 
 } // namespace Minimal
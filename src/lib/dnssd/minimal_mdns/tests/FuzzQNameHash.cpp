@@ -0,0 +1,44 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/dnssd/minimal_mdns/core/HeapQName.h>
+#include <lib/dnssd/minimal_mdns/core/QName.h>
+#include <lib/support/CodeUtils.h>
+
+using namespace mdns::Minimal;
+
+/// Checks that names comparing equal always have the same hash, as name matching
+/// rejects names on a hash mismatch without comparing them.
+///
+/// The first two bytes are the offsets of the names to compare in the remaining data.
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t * data, size_t len)
+{
+    if (len < 3)
+    {
+        return 0;
+    }
+
+    BytesRange names(data + 2, data + len);
+    const size_t offsetA = data[0] % names.Size();
+    const size_t offsetB = data[1] % names.Size();
+
+    SerializedQNameIterator a(names, names.Start() + offsetA);
+    SerializedQNameIterator b(names, names.Start() + offsetB);
+
+    if (a == b)
+    {
+        VerifyOrDie(a.Hash() == b.Hash());
+    }
+
+    HeapQName fullB(b);
+    if (fullB.IsOk())
+    {
+        VerifyOrDie(fullB.Content().Hash() == b.Hash());
+        if (a == fullB.Content())
+        {
+            VerifyOrDie(a.Hash() == fullB.Content().Hash());
+        }
+    }
+
+    return 0;
+}
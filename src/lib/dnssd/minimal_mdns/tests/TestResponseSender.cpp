@@ -344,6 +344,100 @@ void PtrSrvTxtMultipleRespondersToServiceListing(nlTestSuite * inSuite, void * i
     NL_TEST_ASSERT(inSuite, common1.server.GetHeaderFound());
 }
 
+void CachedResponseToInstance(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    // Build a query for the instance name
+    common.recordWriter.WriteQName(common.instance);
+
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+
+    // Records are added behind the back of the response sender, so the same query is answered from the cache.
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+#if CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE > 0
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+#endif
+
+    // A different configuration does not share the cached reply.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    NL_TEST_ASSERT(inSuite,
+                   responseSender.Respond(3, queryData, &common.packetInfo, ResponseConfiguration().SetTtlSecondsOverride(0)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+
+    // Once invalidated, the reply has all the records.
+    responseSender.InvalidateResponseCache();
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    NL_TEST_ASSERT(inSuite, responseSender.Respond(4, queryData, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+    NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+}
+
+void AbortedCaptureKeepsCachedResponses(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common(inSuite, "test");
+    ResponseSender responseSender(&common.server);
+    NL_TEST_ASSERT(inSuite, responseSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    // Build a query for the instance name
+    common.recordWriter.WriteQName(common.instance);
+
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, false, common.requestNameStart, common.requestBytesRange);
+
+    // Fill the cache, one reply per TTL override.
+    for (uint32_t ttl = 1; ttl <= CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE; ttl++)
+    {
+        common.server.Reset();
+        common.server.AddExpectedRecord(&common.srvRecord);
+        NL_TEST_ASSERT(inSuite,
+                       responseSender.Respond(ttl, queryData, &common.packetInfo,
+                                              ResponseConfiguration().SetTtlSecondsOverride(MakeOptional(ttl))) == CHIP_NO_ERROR);
+    }
+
+    // Multicast replies are not sent by the test server, and the second one leaves out the throttled SRV record: neither
+    // is cached, and neither may replace a cached reply.
+    Inet::IPPacketInfo multicastPacketInfo = common.packetInfo;
+    multicastPacketInfo.SrcPort            = 5353;
+    for (uint32_t messageId = 100; messageId < 102; messageId++)
+    {
+        common.server.Reset();
+        responseSender.Respond(messageId, queryData, &multicastPacketInfo, ResponseConfiguration());
+    }
+
+    // Records are added behind the back of the response sender, so cached replies only have the SRV record.
+    common.queryResponder.AddResponder(&common.txtResponder);
+    for (uint32_t ttl = 1; ttl <= CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE; ttl++)
+    {
+        common.server.Reset();
+        common.server.AddExpectedRecord(&common.srvRecord);
+        NL_TEST_ASSERT(inSuite,
+                       responseSender.Respond(200 + ttl, queryData, &common.packetInfo,
+                                              ResponseConfiguration().SetTtlSecondsOverride(MakeOptional(ttl))) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, common.server.GetSendCalled());
+        NL_TEST_ASSERT(inSuite, common.server.GetHeaderFound());
+    }
+}
+
 const nlTest sTests[] = {
     NL_TEST_DEF("SrvAnyResponseToInstance", SrvAnyResponseToInstance),                                       //
     NL_TEST_DEF("SrvTxtAnyResponseToInstance", SrvTxtAnyResponseToInstance),                                 //
@@ -355,6 +449,8 @@ const nlTest sTests[] = {
     NL_TEST_DEF("AddManyQueryResponders", AddManyQueryResponders),                                           //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToInstance", PtrSrvTxtMultipleRespondersToInstance),             //
     NL_TEST_DEF("PtrSrvTxtMultipleRespondersToServiceListing", PtrSrvTxtMultipleRespondersToServiceListing), //
+    NL_TEST_DEF("CachedResponseToInstance", CachedResponseToInstance),                                       //
+    NL_TEST_DEF("AbortedCaptureKeepsCachedResponses", AbortedCaptureKeepsCachedResponses),                   //
 
     NL_TEST_SENTINEL() //
 };
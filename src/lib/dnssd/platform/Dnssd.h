@@ -228,5 +228,17 @@ CHIP_ERROR ChipDnssdBrowse(const char * type, DnssdServiceProtocol protocol, chi
 CHIP_ERROR ChipDnssdResolve(DnssdService * browseResult, chip::Inet::InterfaceId interface, DnssdResolveCallback callback,
                             void * context);
 
+/**
+ * This function drops the cached results of resolving a service, so that it is resolved
+ * from the network the next time.  It is called when the address it resolved to did not work.
+ *
+ * @param[in] service  The service entry passed to @ref ChipDnssdResolve
+ *
+ * @retval CHIP_NO_ERROR                The cached results, if any, are dropped.
+ * @retval CHIP_ERROR_INVALID_ARGUMENT  The service is nullptr.
+ *
+ */
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * service);
+
 } // namespace Dnssd
 } // namespace chip
@@ -0,0 +1,445 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/support/benchmark/Benchmark.h>
+
+#include <atomic>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+namespace chip {
+namespace Benchmark {
+
+namespace {
+
+// Upper bound of the iterations of a run, whatever the time it takes.
+constexpr uint64_t kMaxIterations = 1000000000;
+
+constexpr size_t kMaxParameters = 16;
+
+Registration * sFirst = nullptr;
+Registration * sLast  = nullptr;
+
+// The --benchmark_param values, as <name>=<value>.
+const char * sParameters[kMaxParameters];
+size_t sParameterCount = 0;
+
+std::atomic<uint64_t> sAllocationCount{ 0 };
+
+struct Options
+{
+    const char * mFilter = nullptr;
+    double mMinTimeS     = 0.5;
+    bool mJson           = false;
+    const char * mOut    = nullptr;
+};
+
+struct Result
+{
+    const char * mName;
+    uint64_t mIterations;
+    double mRealTimeNs;
+    double mCpuTimeNs;
+    double mBytesPerSecond;
+    double mItemsPerSecond;
+    const char * mErrorMessage;
+    State::Counter mCounters[State::kMaxCounters];
+    size_t mCounterCount;
+};
+
+uint64_t ReadClockNs(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+const char * MatchFlag(const char * arg, const char * flag)
+{
+    size_t len = strlen(flag);
+    if (strncmp(arg, flag, len) == 0 && arg[len] == '=')
+    {
+        return arg + len + 1;
+    }
+    return nullptr;
+}
+
+bool ParseOptions(int argc, char * argv[], Options & options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char * value;
+        if ((value = MatchFlag(argv[i], "--benchmark_filter")) != nullptr)
+        {
+            options.mFilter = value;
+        }
+        else if ((value = MatchFlag(argv[i], "--benchmark_min_time")) != nullptr)
+        {
+            options.mMinTimeS = atof(value);
+        }
+        else if ((value = MatchFlag(argv[i], "--benchmark_format")) != nullptr)
+        {
+            if (strcmp(value, "json") != 0 && strcmp(value, "console") != 0)
+            {
+                fprintf(stderr, "Unsupported format: %s\n", value);
+                return false;
+            }
+            options.mJson = strcmp(value, "json") == 0;
+        }
+        else if ((value = MatchFlag(argv[i], "--benchmark_out")) != nullptr)
+        {
+            options.mOut = value;
+        }
+        else if ((value = MatchFlag(argv[i], "--benchmark_param")) != nullptr)
+        {
+            if (strchr(value, '=') == nullptr || sParameterCount >= kMaxParameters)
+            {
+                fprintf(stderr, "Invalid parameter: %s\n", value);
+                return false;
+            }
+            sParameters[sParameterCount++] = value;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+Result Run(const Registration & registration, double minTimeS)
+{
+    uint64_t iterations = 1;
+
+    while (true)
+    {
+        State state(iterations);
+        registration.GetFunction()(state);
+
+        double realTimeS = static_cast<double>(state.GetRealTimeNs()) / 1e9;
+        if (state.GetErrorMessage() != nullptr || realTimeS >= minTimeS || iterations >= kMaxIterations)
+        {
+            Result result = { registration.GetName(), iterations, 0, 0, 0, 0, state.GetErrorMessage(), {}, 0 };
+            if (result.mErrorMessage == nullptr)
+            {
+                for (size_t i = 0; i < state.GetCounterCount(); i++)
+                {
+                    result.mCounters[result.mCounterCount++] = state.GetCounter(i);
+                }
+                result.mRealTimeNs = static_cast<double>(state.GetRealTimeNs()) / static_cast<double>(iterations);
+                result.mCpuTimeNs  = static_cast<double>(state.GetCpuTimeNs()) / static_cast<double>(iterations);
+                if (realTimeS > 0)
+                {
+                    result.mBytesPerSecond = static_cast<double>(state.GetBytesProcessed()) / realTimeS;
+                    result.mItemsPerSecond = static_cast<double>(state.GetItemsProcessed()) / realTimeS;
+                }
+            }
+            return result;
+        }
+
+        // Aim a bit past the minimum time from the rate measured so far, growing at most tenfold at a time.
+        double multiplier = (realTimeS > 0) ? minTimeS * 1.4 / realTimeS : 10;
+        multiplier        = (multiplier > 10) ? 10 : multiplier;
+        uint64_t next     = static_cast<uint64_t>(static_cast<double>(iterations) * multiplier);
+        iterations        = (next > iterations) ? next : iterations + 1;
+        iterations        = (iterations > kMaxIterations) ? kMaxIterations : iterations;
+    }
+}
+
+void PrintConsole(FILE * file, const Result & result)
+{
+    if (result.mErrorMessage != nullptr)
+    {
+        fprintf(file, "%-48s ERROR: %s\n", result.mName, result.mErrorMessage);
+        return;
+    }
+
+    fprintf(file, "%-48s %14.1f ns %14.1f ns %12" PRIu64, result.mName, result.mRealTimeNs, result.mCpuTimeNs, result.mIterations);
+    if (result.mBytesPerSecond > 0)
+    {
+        fprintf(file, " %10.2f MiB/s", result.mBytesPerSecond / (1024 * 1024));
+    }
+    if (result.mItemsPerSecond > 0)
+    {
+        fprintf(file, " %12.0f items/s", result.mItemsPerSecond);
+    }
+    for (size_t i = 0; i < result.mCounterCount; i++)
+    {
+        fprintf(file, " %s=%g", result.mCounters[i].mName, result.mCounters[i].mValue);
+    }
+    fprintf(file, "\n");
+}
+
+void PrintJsonHeader(FILE * file, const char * executable)
+{
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+
+    fprintf(file, "{\n  \"context\": {\n");
+    fprintf(file, "    \"date\": \"%s\",\n", date);
+    fprintf(file, "    \"executable\": \"%s\",\n", executable);
+    for (size_t i = 0; i < sParameterCount; i++)
+    {
+        const char * value = strchr(sParameters[i], '=');
+        fprintf(file, "    \"%.*s\": \"%s\",\n", static_cast<int>(value - sParameters[i]), sParameters[i], value + 1);
+    }
+#ifdef NDEBUG
+    fprintf(file, "    \"library_build_type\": \"release\"\n");
+#else
+    fprintf(file, "    \"library_build_type\": \"debug\"\n");
+#endif
+    fprintf(file, "  },\n  \"benchmarks\": [");
+}
+
+void PrintJson(FILE * file, const Result & result, bool first)
+{
+    fprintf(file, "%s\n    {\n", first ? "" : ",");
+    fprintf(file, "      \"name\": \"%s\",\n", result.mName);
+    fprintf(file, "      \"run_name\": \"%s\",\n", result.mName);
+    fprintf(file, "      \"run_type\": \"iteration\",\n");
+    if (result.mErrorMessage != nullptr)
+    {
+        fprintf(file, "      \"error_occurred\": true,\n");
+        fprintf(file, "      \"error_message\": \"%s\"\n    }", result.mErrorMessage);
+        return;
+    }
+    fprintf(file, "      \"iterations\": %" PRIu64 ",\n", result.mIterations);
+    fprintf(file, "      \"real_time\": %.3f,\n", result.mRealTimeNs);
+    fprintf(file, "      \"cpu_time\": %.3f,\n", result.mCpuTimeNs);
+    if (result.mBytesPerSecond > 0)
+    {
+        fprintf(file, "      \"bytes_per_second\": %.3f,\n", result.mBytesPerSecond);
+    }
+    if (result.mItemsPerSecond > 0)
+    {
+        fprintf(file, "      \"items_per_second\": %.3f,\n", result.mItemsPerSecond);
+    }
+    for (size_t i = 0; i < result.mCounterCount; i++)
+    {
+        fprintf(file, "      \"%s\": %.3f,\n", result.mCounters[i].mName, result.mCounters[i].mValue);
+    }
+    fprintf(file, "      \"time_unit\": \"ns\"\n    }");
+}
+
+void PrintJsonFooter(FILE * file)
+{
+    fprintf(file, "\n  ]\n}\n");
+}
+
+} // namespace
+
+void State::StartTimer()
+{
+    if (!mRunning)
+    {
+        mRealStartNs = ReadClockNs(CLOCK_MONOTONIC);
+        mCpuStartNs  = ReadClockNs(CLOCK_PROCESS_CPUTIME_ID);
+        mRunning     = true;
+    }
+}
+
+void State::StopTimer()
+{
+    if (mRunning)
+    {
+        mRealTimeNs += ReadClockNs(CLOCK_MONOTONIC) - mRealStartNs;
+        mCpuTimeNs += ReadClockNs(CLOCK_PROCESS_CPUTIME_ID) - mCpuStartNs;
+        mRunning = false;
+    }
+}
+
+void State::SetCounter(const char * name, double value)
+{
+    for (size_t i = 0; i < mCounterCount; i++)
+    {
+        if (strcmp(mCounters[i].mName, name) == 0)
+        {
+            mCounters[i].mValue = value;
+            return;
+        }
+    }
+    if (mCounterCount < kMaxCounters)
+    {
+        mCounters[mCounterCount++] = { name, value };
+    }
+}
+
+Registration::Registration(const char * name, BenchmarkFunction function) : mName(name), mFunction(function)
+{
+    // Keep the order of registration, which is the order of the benchmarks in their file.
+    if (sLast != nullptr)
+    {
+        sLast->mNext = this;
+    }
+    else
+    {
+        sFirst = this;
+    }
+    sLast = this;
+}
+
+const Registration * Registration::GetFirst()
+{
+    return sFirst;
+}
+
+uint64_t GetParameter(const char * name, uint64_t defaultValue)
+{
+    size_t length = strlen(name);
+
+    for (size_t i = 0; i < sParameterCount; i++)
+    {
+        if (strncmp(sParameters[i], name, length) == 0 && sParameters[i][length] == '=')
+        {
+            const char * value = sParameters[i] + length + 1;
+            char * end;
+            unsigned long long parsed = strtoull(value, &end, 0);
+            return (*value != '\0' && *end == '\0') ? static_cast<uint64_t>(parsed) : defaultValue;
+        }
+    }
+    return defaultValue;
+}
+
+uint64_t GetAllocationCount()
+{
+    return sAllocationCount.load(std::memory_order_relaxed);
+}
+
+bool IsAllocationCountingSupported()
+{
+#if CHIP_BENCHMARK_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+int RunRegisteredBenchmarks(int argc, char * argv[])
+{
+    Options options;
+    FILE * out = nullptr;
+    int status = 0;
+    bool first = true;
+
+    if (!ParseOptions(argc, argv, options))
+    {
+        return EXIT_FAILURE;
+    }
+
+    if (options.mOut != nullptr)
+    {
+        out = fopen(options.mOut, "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Failed to open %s\n", options.mOut);
+            return EXIT_FAILURE;
+        }
+        PrintJsonHeader(out, argv[0]);
+    }
+
+    if (options.mJson)
+    {
+        PrintJsonHeader(stdout, argv[0]);
+    }
+    else
+    {
+        printf("%-48s %17s %17s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+    }
+
+    for (const Registration * registration = Registration::GetFirst(); registration != nullptr;
+         registration                      = registration->GetNext())
+    {
+        if (options.mFilter != nullptr && strstr(registration->GetName(), options.mFilter) == nullptr)
+        {
+            continue;
+        }
+
+        Result result = Run(*registration, options.mMinTimeS);
+        if (result.mErrorMessage != nullptr)
+        {
+            status = EXIT_FAILURE;
+        }
+
+        if (options.mJson)
+        {
+            PrintJson(stdout, result, first);
+        }
+        else
+        {
+            PrintConsole(stdout, result);
+        }
+        if (out != nullptr)
+        {
+            PrintJson(out, result, first);
+        }
+        first = false;
+        fflush(stdout);
+    }
+
+    if (options.mJson)
+    {
+        PrintJsonFooter(stdout);
+    }
+    if (out != nullptr)
+    {
+        PrintJsonFooter(out);
+        fclose(out);
+    }
+
+    return status;
+}
+
+} // namespace Benchmark
+} // namespace chip
+
+#if CHIP_BENCHMARK_COUNT_ALLOCATIONS
+// The allocator is wrapped at link time (-Wl,--wrap=malloc, see BUILD.gn), which also catches the allocations of the
+// packet buffers and of the platform memory of the stack.
+extern "C" {
+void * __real_malloc(size_t size);
+void * __real_calloc(size_t count, size_t size);
+void * __real_realloc(void * ptr, size_t size);
+
+void * __wrap_malloc(size_t size)
+{
+    chip::Benchmark::sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __real_malloc(size);
+}
+
+void * __wrap_calloc(size_t count, size_t size)
+{
+    chip::Benchmark::sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __real_calloc(count, size);
+}
+
+void * __wrap_realloc(void * ptr, size_t size)
+{
+    chip::Benchmark::sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __real_realloc(ptr, size);
+}
+}
+#endif // CHIP_BENCHMARK_COUNT_ALLOCATIONS
+
+int main(int argc, char * argv[])
+{
+    return chip::Benchmark::RunRegisteredBenchmarks(argc, argv);
+}
@@ -0,0 +1,210 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Minimal micro-benchmark harness for the host builds.
+ *
+ *      Benchmarks are functions taking a chip::Benchmark::State, registered with
+ *      CHIP_REGISTER_BENCHMARK, and linked with the main() of the harness.  The
+ *      harness accepts the main flags of Google Benchmark and its JSON output has
+ *      the same layout, so that the results can be compared with its tools.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @def CHIP_REGISTER_BENCHMARK(FUNCTION)
+ *
+ * @brief
+ *   Registers a benchmark of the signature void(*)(chip::Benchmark::State &).
+ *
+ * Example:
+ *
+ * @code
+ * void BenchmarkSomething(chip::Benchmark::State & state)
+ * {
+ *     while (state.KeepRunning())
+ *     {
+ *         chip::Benchmark::DoNotOptimize(DoSomething());
+ *     }
+ *     state.SetItemsProcessed(state.Iterations());
+ * }
+ *
+ * CHIP_REGISTER_BENCHMARK(BenchmarkSomething)
+ * @endcode
+ */
+#define CHIP_REGISTER_BENCHMARK(FUNCTION) static ::chip::Benchmark::Registration sRegistration##FUNCTION(#FUNCTION, &FUNCTION);
+
+namespace chip {
+namespace Benchmark {
+
+/**
+ * The state of a run of a benchmark, which the benchmark loops on.
+ */
+class State
+{
+public:
+    explicit State(uint64_t iterations) : mIterations(iterations), mRemaining(iterations) {}
+
+    /**
+     * @return Whether the benchmark has to run its body once more.  The first call starts the timer, the last one stops it.
+     */
+    bool KeepRunning()
+    {
+        if (mRemaining == mIterations && !mRunning)
+        {
+            StartTimer();
+        }
+        if (mRemaining > 0)
+        {
+            mRemaining--;
+            return true;
+        }
+        StopTimer();
+        return false;
+    }
+
+    /**
+     * Exclude the time until ResumeTiming() from the measure, for the setup a benchmark cannot do out of its loop.
+     */
+    void PauseTiming() { StopTimer(); }
+    void ResumeTiming() { StartTimer(); }
+
+    uint64_t Iterations() const { return mIterations; }
+
+    /**
+     * Report throughputs, out of the count of bytes or items processed by all the iterations.
+     */
+    void SetBytesProcessed(uint64_t bytes) { mBytesProcessed = bytes; }
+    void SetItemsProcessed(uint64_t items) { mItemsProcessed = items; }
+
+    /**
+     * Report the benchmark as failed.  It is expected to return right after.
+     */
+    void SkipWithError(const char * message)
+    {
+        mErrorMessage = message;
+        mRemaining    = 0;
+        StopTimer();
+    }
+
+    /**
+     * Report a value measured by the benchmark, e.g. a latency percentile, along with its times.  A counter set again
+     * is updated.  Counters past the kMaxCounters-th are ignored.
+     */
+    void SetCounter(const char * name, double value);
+
+    uint64_t GetRealTimeNs() const { return mRealTimeNs; }
+    uint64_t GetCpuTimeNs() const { return mCpuTimeNs; }
+    uint64_t GetBytesProcessed() const { return mBytesProcessed; }
+    uint64_t GetItemsProcessed() const { return mItemsProcessed; }
+    const char * GetErrorMessage() const { return mErrorMessage; }
+
+    static constexpr size_t kMaxCounters = 8;
+
+    struct Counter
+    {
+        const char * mName;
+        double mValue;
+    };
+
+    size_t GetCounterCount() const { return mCounterCount; }
+    const Counter & GetCounter(size_t index) const { return mCounters[index]; }
+
+private:
+    void StartTimer();
+    void StopTimer();
+
+    uint64_t mIterations;
+    uint64_t mRemaining;
+    uint64_t mRealTimeNs       = 0;
+    uint64_t mCpuTimeNs        = 0;
+    uint64_t mRealStartNs      = 0;
+    uint64_t mCpuStartNs       = 0;
+    uint64_t mBytesProcessed   = 0;
+    uint64_t mItemsProcessed   = 0;
+    const char * mErrorMessage = nullptr;
+    bool mRunning              = false;
+    Counter mCounters[kMaxCounters];
+    size_t mCounterCount = 0;
+};
+
+typedef void (*BenchmarkFunction)(State & state);
+
+/**
+ * Entry of the list of the registered benchmarks.  Use CHIP_REGISTER_BENCHMARK rather than instantiating it.
+ */
+class Registration
+{
+public:
+    Registration(const char * name, BenchmarkFunction function);
+
+    const char * GetName() const { return mName; }
+    BenchmarkFunction GetFunction() const { return mFunction; }
+    const Registration * GetNext() const { return mNext; }
+
+    static const Registration * GetFirst();
+
+private:
+    const char * mName;
+    BenchmarkFunction mFunction;
+    Registration * mNext = nullptr;
+};
+
+/**
+ * Keep the compiler from optimizing out the computation of @p value.
+ */
+template <typename T>
+inline void DoNotOptimize(const T & value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Value of a parameter of the benchmarks, given on the command line as --benchmark_param=<name>=<value>, or
+ * defaultValue if it is not given or is not a number.
+ */
+uint64_t GetParameter(const char * name, uint64_t defaultValue);
+
+/**
+ * Count of the heap allocations made so far through malloc, calloc and realloc.  The allocations are only counted on
+ * Linux, where the harness wraps the allocator: elsewhere, this is always 0.
+ */
+uint64_t GetAllocationCount();
+bool IsAllocationCountingSupported();
+
+/**
+ * Run the registered benchmarks, as configured by the command line.
+ *
+ * Supported flags:
+ *   --benchmark_filter=<substring>     Only run the benchmarks whose name contains the substring.
+ *   --benchmark_min_time=<seconds>     Minimum time to run each benchmark for (default 0.5).
+ *   --benchmark_format=<console|json>  Format of the results printed on the standard output (default console).
+ *   --benchmark_out=<file>             Also write the results to a file, as JSON.
+ *   --benchmark_param=<name>=<value>   Set a parameter of the benchmarks (see GetParameter()).  It is reported in the
+ *                                      context of the JSON output.  Can be repeated.
+ *
+ * @return 0 if all the benchmarks ran successfully.
+ */
+int RunRegisteredBenchmarks(int argc, char * argv[]);
+
+} // namespace Benchmark
+} // namespace chip
@@ -0,0 +1,216 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a fixed capacity priority queue of deadlines, used by
+ *      the reliable message protocol to schedule standalone acks and
+ *      retransmissions.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/support/CodeUtils.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ * Bookkeeping embedded in every object that can be scheduled in a DeadlineQueue. It records where the
+ * object currently sits in the queue, so that it can be rescheduled or cancelled without a search.
+ */
+class DeadlineQueueNode
+{
+public:
+    bool IsQueued() const { return mHeapIndex != kNotQueued; }
+
+private:
+    template <typename T, DeadlineQueueNode T::*Node, size_t N>
+    friend class DeadlineQueue;
+
+    static constexpr uint16_t kNotQueued = UINT16_MAX;
+
+    uint16_t mHeapIndex = kNotQueued;
+};
+
+/**
+ * Binary min-heap of (deadline, object) pairs. Scheduling, rescheduling and cancellation are O(log n);
+ * retrieving the earliest deadline is O(1).
+ *
+ * The queue does not own the objects: an object must be cancelled before it is destroyed.
+ *
+ * @tparam T     Type of the scheduled objects.
+ * @tparam Node  Member of T holding its DeadlineQueueNode.
+ * @tparam N     Maximum number of objects scheduled at the same time.
+ */
+template <typename T, DeadlineQueueNode T::*Node, size_t N>
+class DeadlineQueue
+{
+public:
+    static_assert(N < DeadlineQueueNode::kNotQueued, "DeadlineQueue too large");
+
+    bool IsEmpty() const { return mSize == 0; }
+    size_t Size() const { return mSize; }
+
+    /**
+     * Schedule `item` at `deadline`, or move it there if it is already scheduled.
+     */
+    void Schedule(T & item, System::Clock::Timestamp deadline)
+    {
+        DeadlineQueueNode & node = item.*Node;
+        if (node.IsQueued())
+        {
+            uint16_t index        = node.mHeapIndex;
+            bool earlier          = deadline < mHeap[index].deadline;
+            mHeap[index].deadline = deadline;
+            if (earlier)
+            {
+                SiftUp(index);
+            }
+            else
+            {
+                SiftDown(index);
+            }
+            return;
+        }
+
+        // Capacity matches the pools the scheduled objects come from, so this cannot overflow.
+        VerifyOrDie(mSize < N);
+        uint16_t index  = mSize++;
+        mHeap[index]    = Entry{ deadline, &item };
+        node.mHeapIndex = index;
+        SiftUp(index);
+    }
+
+    void Cancel(T & item)
+    {
+        DeadlineQueueNode & node = item.*Node;
+        VerifyOrReturn(node.IsQueued());
+        RemoveAt(node.mHeapIndex);
+    }
+
+    /**
+     * Earliest scheduled deadline, or Timestamp::max() when the queue is empty.
+     */
+    System::Clock::Timestamp GetEarliestDeadline() const
+    {
+        return IsEmpty() ? System::Clock::Timestamp::max() : mHeap[0].deadline;
+    }
+
+    /**
+     * Peek at the object with the earliest deadline, nullptr when the queue is empty.
+     */
+    T * Front() const { return IsEmpty() ? nullptr : mHeap[0].item; }
+
+    /**
+     * Remove and return an object whose deadline is at or before `now`, nullptr if there is none.
+     */
+    T * PopExpired(System::Clock::Timestamp now)
+    {
+        VerifyOrReturnValue(!IsEmpty() && mHeap[0].deadline <= now, nullptr);
+        T * item = mHeap[0].item;
+        RemoveAt(0);
+        return item;
+    }
+
+    void Clear()
+    {
+        for (uint16_t i = 0; i < mSize; i++)
+        {
+            (mHeap[i].item->*Node).mHeapIndex = DeadlineQueueNode::kNotQueued;
+        }
+        mSize = 0;
+    }
+
+private:
+    struct Entry
+    {
+        System::Clock::Timestamp deadline;
+        T * item;
+    };
+
+    void RemoveAt(uint16_t index)
+    {
+        (mHeap[index].item->*Node).mHeapIndex = DeadlineQueueNode::kNotQueued;
+        mSize--;
+        if (index == mSize)
+        {
+            return;
+        }
+
+        // Move the last entry into the hole; it may belong either above or below it.
+        Place(index, mHeap[mSize]);
+        SiftUp(index);
+        SiftDown(index);
+    }
+
+    void Place(uint16_t index, const Entry & entry)
+    {
+        mHeap[index]                   = entry;
+        (entry.item->*Node).mHeapIndex = index;
+    }
+
+    void SiftUp(uint16_t index)
+    {
+        Entry entry = mHeap[index];
+        while (index > 0)
+        {
+            uint16_t parent = static_cast<uint16_t>((index - 1) / 2);
+            if (!(entry.deadline < mHeap[parent].deadline))
+            {
+                break;
+            }
+            Place(index, mHeap[parent]);
+            index = parent;
+        }
+        Place(index, entry);
+    }
+
+    void SiftDown(uint16_t index)
+    {
+        Entry entry = mHeap[index];
+        while (true)
+        {
+            size_t child = 2 * static_cast<size_t>(index) + 1;
+            if (child >= mSize)
+            {
+                break;
+            }
+            if (child + 1 < mSize && mHeap[child + 1].deadline < mHeap[child].deadline)
+            {
+                child++;
+            }
+            if (!(mHeap[child].deadline < entry.deadline))
+            {
+                break;
+            }
+            Place(index, mHeap[child]);
+            index = static_cast<uint16_t>(child);
+        }
+        Place(index, entry);
+    }
+
+    Entry mHeap[N];
+    uint16_t mSize = 0;
+};
+
+} // namespace Messaging
+} // namespace chip
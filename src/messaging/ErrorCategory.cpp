@@ -81,5 +81,25 @@ bool IsSendErrorNonCritical(CHIP_ERROR err)
             err == CHIP_ERROR_NO_MEMORY || CHIP_CONFIG_IsPlatformErrorNonCritical(err));
 }
 
+/**
+ *  Checks if error, while sending, is likely to clear up when the send is tried again shortly, such as a
+ *  temporary shortage of buffers.
+ *
+ *  @param[in]    err      The #CHIP_ERROR being checked.
+ *
+ *  @return    true if the send may succeed on a later attempt; false otherwise.
+ *
+ */
+bool IsSendErrorTransient(CHIP_ERROR err)
+{
+    return err == CHIP_ERROR_NO_MEMORY ||
+#if CHIP_SYSTEM_CONFIG_USE_LWIP
+        err == System::MapErrorLwIP(ERR_MEM)
+#else
+        err == CHIP_ERROR_POSIX(ENOBUFS) || err == CHIP_ERROR_POSIX(EAGAIN)
+#endif
+        ;
+}
+
 } // namespace Messaging
 } // namespace chip
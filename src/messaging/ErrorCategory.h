@@ -32,6 +32,7 @@ namespace Messaging {
 CHIP_ERROR FilterUDPSendError(CHIP_ERROR err, bool isMulticast);
 bool IsIgnoredMulticastSendError(CHIP_ERROR err);
 bool IsSendErrorNonCritical(CHIP_ERROR err);
+bool IsSendErrorTransient(CHIP_ERROR err);
 
 } // namespace Messaging
 } // namespace chip
@@ -357,6 +357,9 @@ ExchangeContext::~ExchangeContext()
     //
     VerifyOrDie(mFlags.Has(Flags::kFlagClosed));
 
+    // An ack we failed to flush may still be scheduled.
+    mExchangeMgr->GetReliableMessageMgr()->CancelStandaloneAck(this);
+
 #if CONFIG_DEVICE_LAYER && CHIP_DEVICE_CONFIG_ENABLE_SED
     // Make sure that the exchange withdraws the request for Sleepy End Device active mode.
     UpdateSEDIntervalMode(false);
@@ -536,7 +539,7 @@ CHIP_ERROR ExchangeContext::HandleMessage(uint32_t messageCounter, const Payload
         if (!msgFlags.Has(MessageFlagValues::kDuplicateMessage) && payloadHeader.IsAckMsg() &&
             payloadHeader.GetAckMessageCounter().HasValue())
         {
-            HandleRcvdAck(payloadHeader.GetAckMessageCounter().Value());
+            HandleRcvdAck(payloadHeader.GetAckMessageCounter().Value(), isStandaloneAck);
         }
 
         if (payloadHeader.NeedsAck())
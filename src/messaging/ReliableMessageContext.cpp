@@ -39,7 +39,7 @@
 namespace chip {
 namespace Messaging {
 
-ReliableMessageContext::ReliableMessageContext() : mNextAckTime(0), mPendingPeerAckMessageCounter(0) {}
+ReliableMessageContext::ReliableMessageContext() : mNextAckTime(0), mPendingPeerAckMessageCounter(0), mAckRetries(0) {}
 
 ExchangeContext * ReliableMessageContext::GetExchangeContext()
 {
@@ -79,11 +79,12 @@ CHIP_ERROR ReliableMessageContext::FlushAcks()
  *    This message is part of the CHIP Reliable Messaging protocol.
  *
  *  @param[in]    ackMessageCounter         The acknowledged message counter of the incoming message.
+ *  @param[in]    isStandaloneAck           Whether the incoming message is a standalone ack.
  */
-void ReliableMessageContext::HandleRcvdAck(uint32_t ackMessageCounter)
+void ReliableMessageContext::HandleRcvdAck(uint32_t ackMessageCounter, bool isStandaloneAck)
 {
     // Msg is an Ack; Check Retrans Table and remove message context
-    if (!GetReliableMessageMgr()->CheckAndRemRetransTable(this, ackMessageCounter))
+    if (!GetReliableMessageMgr()->CheckAndRemRetransTable(this, ackMessageCounter, isStandaloneAck))
     {
         // This can happen quite easily due to a packet with a piggyback ack
         // being lost and retransmitted.
@@ -158,12 +159,19 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAckInner(uint32_t messageCounter,
 
     // Replace the Pending ack message counter.
     SetPendingPeerAckMessageCounter(messageCounter);
+    mAckRetries = 0;
     using namespace System::Clock::Literals;
-    mNextAckTime = System::SystemClock().GetMonotonicTimestamp() + CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT;
+    System::Clock::Milliseconds32 ackTimeout = CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT;
+    if (GetExchangeContext()->HasSessionHandle())
+    {
+        ackTimeout = ReliableMessageMgr::GetPiggybackWindow(GetExchangeContext()->GetSessionHandle());
+    }
+    mNextAckTime = System::SystemClock().GetMonotonicTimestamp() + ackTimeout;
+    GetReliableMessageMgr()->ScheduleStandaloneAck(this);
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR ReliableMessageContext::SendStandaloneAckMessage()
+CHIP_ERROR ReliableMessageContext::TrySendStandaloneAckMessage()
 {
     // Allocate a buffer for the null message
     System::PacketBufferHandle msgBuf = MessagePacketBuffer::New(0);
@@ -174,6 +182,16 @@ CHIP_ERROR ReliableMessageContext::SendStandaloneAckMessage()
 
     CHIP_ERROR err = GetExchangeContext()->SendMessage(Protocols::SecureChannel::MsgType::StandaloneAck, std::move(msgBuf),
                                                        BitFlags<SendMessageFlags>{ SendMessageFlags::kNoAutoRequestAck });
+    if (err == CHIP_NO_ERROR)
+    {
+        GetReliableMessageMgr()->mCounters.standaloneAcks++;
+    }
+    return err;
+}
+
+CHIP_ERROR ReliableMessageContext::SendStandaloneAckMessage()
+{
+    CHIP_ERROR err = TrySendStandaloneAckMessage();
     if (IsSendErrorNonCritical(err))
     {
         ChipLogError(ExchangeManager,
@@ -193,6 +211,15 @@ CHIP_ERROR ReliableMessageContext::SendStandaloneAckMessage()
     return err;
 }
 
+void ReliableMessageContext::CountPiggybackedAck()
+{
+    ReliableMessageMgr * rm = GetReliableMessageMgr();
+    if (rm != nullptr)
+    {
+        rm->mCounters.piggybackedAcks++;
+    }
+}
+
 void ReliableMessageContext::SetPendingPeerAckMessageCounter(uint32_t aPeerAckMessageCounter)
 {
     mPendingPeerAckMessageCounter = aPeerAckMessageCounter;
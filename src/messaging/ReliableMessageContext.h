@@ -31,6 +31,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/DLLUtil.h>
+#include <messaging/DeadlineQueue.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemLayer.h>
 #include <transport/raw/MessageHeader.h>
@@ -172,7 +173,7 @@ protected:
     BitFlags<Flags> mFlags; // Internal state flags
 
 private:
-    void HandleRcvdAck(uint32_t ackMessageCounter);
+    void HandleRcvdAck(uint32_t ackMessageCounter, bool isStandaloneAck);
     CHIP_ERROR HandleNeedsAck(uint32_t messageCounter, BitFlags<MessageFlagValues> messageFlags);
     CHIP_ERROR HandleNeedsAckInner(uint32_t messageCounter, BitFlags<MessageFlagValues> messageFlags);
     ExchangeContext * GetExchangeContext();
@@ -190,12 +191,21 @@ private:
     // will send that ack at some point.
     void SetPendingPeerAckMessageCounter(uint32_t aPeerAckMessageCounter);
 
+    // Account for the pending ack being carried by an outgoing message rather than a standalone ack.
+    void CountPiggybackedAck();
+
+    // Send the pending ack in a standalone ack message, returning any send error as is, including the
+    // non-critical ones that SendStandaloneAckMessage() does not report.
+    CHIP_ERROR TrySendStandaloneAckMessage();
+
     friend class ReliableMessageMgr;
     friend class ExchangeContext;
     friend class ExchangeMessageDispatch;
 
     System::Clock::Timestamp mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckMessageCounter;
+    DeadlineQueueNode mAckDeadlineNode; // Position of mNextAckTime in the ReliableMessageMgr ack schedule
+    uint8_t mAckRetries;                // Standalone ack sends tried again after a transient failure
 };
 
 inline bool ReliableMessageContext::AutoRequestAck() const
@@ -21,6 +21,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
@@ -43,7 +44,7 @@ namespace chip {
 namespace Messaging {
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0), firstSendTime(0)
 {
     ec->SetMessageNotAcked(true);
 }
@@ -70,9 +71,10 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransEntry(entry);
         return Loop::Continue;
     });
+    mAckDeadlines.Clear();
 
     mSystemLayer = nullptr;
 }
@@ -102,24 +104,41 @@ void ReliableMessageMgr::ExecuteActions()
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions at % " PRIu64 "ms", now.count());
 #endif
 
-    ExecuteForAllContext([&](ReliableMessageContext * rc) {
+    while (ReliableMessageContext * rc = mAckDeadlines.PopExpired(now))
+    {
+        // The ack may have been piggybacked on a message since it was scheduled.
         if (rc->IsAckPending())
         {
-            if (rc->mNextAckTime <= now)
-            {
 #if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
+            ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
 #endif
-                rc->SendStandaloneAckMessage();
+            CHIP_ERROR err = rc->TrySendStandaloneAckMessage();
+            if (err != CHIP_NO_ERROR && IsSendErrorTransient(err) && rc->mAckRetries < CHIP_CONFIG_RMP_MAX_ACK_RETRIES)
+            {
+                // The ack was taken off the context for the failed send: keep it pending and try again shortly.
+                rc->mAckRetries++;
+                rc->SetPendingPeerAckMessageCounter(rc->mPendingPeerAckMessageCounter);
+                rc->mNextAckTime = now + CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL;
+                mAckDeadlines.Schedule(*rc, rc->mNextAckTime);
+                continue;
             }
+            if (err != CHIP_NO_ERROR)
+            {
+                // Give up on the ack, so that it does not keep the exchange alive; the peer will retransmit if it can.
+                ChipLogError(ExchangeManager,
+                             "Dropping solitary ack for MessageCounter:" ChipLogFormatMessageCounter
+                             " on exchange " ChipLogFormatExchange " after %u retries: %" CHIP_ERROR_FORMAT,
+                             rc->mPendingPeerAckMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()),
+                             static_cast<unsigned>(rc->mAckRetries), err.Format());
+                rc->SetAckPending(false);
+            }
+            rc->mAckRetries = 0;
         }
-    });
+    }
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
-
+    while (RetransTableEntry * entry = mRetransDeadlines.PopExpired(now))
+    {
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
         uint8_t sendCount = entry->sendCount;
@@ -151,11 +170,13 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
-            return Loop::Continue;
+            mCounters.retransmissionTimeouts++;
+            ReleaseRetransEntry(entry);
+            continue;
         }
 
         entry->sendCount++;
+        mCounters.retransmissions++;
         ChipLogDetail(ExchangeManager,
                       "Retransmitting MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
                       " Send Cnt %d",
@@ -165,10 +186,9 @@ void ReliableMessageMgr::ExecuteActions()
         System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
         System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
         entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+        mRetransDeadlines.Schedule(*entry, entry->nextRetransTime);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -265,21 +285,49 @@ System::Clock::Timestamp ReliableMessageMgr::GetBackoff(System::Clock::Timestamp
     return mrpBackoffTime;
 }
 
+System::Clock::Milliseconds32 ReliableMessageMgr::GetPiggybackWindow(const SessionHandle & session)
+{
+    System::Clock::Milliseconds32 rtt = session->GetSmoothedRoundTripTime();
+    VerifyOrReturnValue(rtt != System::Clock::kZero, CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT);
+
+    // The peer retransmits no earlier than our active retransmission interval, and the ack still needs a one way
+    // trip to get there; keep a whole round trip of margin to absorb jitter.
+    System::Clock::Milliseconds32 window = GetLocalMRPConfig().ValueOr(GetDefaultMRPConfig()).mActiveRetransTimeout;
+    window                               = (window > rtt) ? window - rtt : System::Clock::kZero;
+
+    return std::min(std::max(window, System::Clock::Milliseconds32(CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT)),
+                    System::Clock::Milliseconds32(CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT));
+}
+
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
+    System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
     // Choose active/idle timeout from PeerActiveMode of session per 4.11.2.1. Retransmissions.
     System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
     System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
-    entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    entry->firstSendTime                 = now;
+    entry->nextRetransTime               = now + backoff;
+    mRetransDeadlines.Schedule(*entry, entry->nextRetransTime);
     StartTimer();
 }
 
-bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
+bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter, bool isStandaloneAck)
 {
     bool removed = false;
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+            // Only messages that were never retransmitted give an unambiguous round-trip time (Karn's algorithm), and
+            // only piggybacked acks leave the peer's ack delay out of it: a standalone ack may have been held back for
+            // the peer's whole piggyback window.
+            if (entry->sendCount == 0 && !isStandaloneAck && entry->ec->HasSessionHandle())
+            {
+                System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+                entry->ec->GetSessionHandle()->UpdateRoundTripTime(
+                    std::chrono::duration_cast<System::Clock::Milliseconds32>(now - entry->firstSendTime));
+            }
+
             // Clear the entry from the retransmision table.
             ClearRetransTable(*entry);
 
@@ -359,31 +407,21 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(&entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
 void ReliableMessageMgr::StartTimer()
 {
-    // When do we need to next wake up to send an ACK?
-    System::Clock::Timestamp nextWakeTime = System::Clock::Timestamp::max();
-
-    ExecuteForAllContext([&](ReliableMessageContext * rc) {
-        if (rc->IsAckPending() && rc->mNextAckTime < nextWakeTime)
-        {
-            nextWakeTime = rc->mNextAckTime;
-        }
-    });
+    // Drop acks that were piggybacked since they were scheduled, so they do not cause a spurious wakeup.
+    for (ReliableMessageContext * rc = mAckDeadlines.Front(); rc != nullptr && !rc->IsAckPending(); rc = mAckDeadlines.Front())
+    {
+        mAckDeadlines.Cancel(*rc);
+    }
 
-    // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    // When do we need to next wake up to send an ACK or for ReliableMessageProtocol retransmit?
+    System::Clock::Timestamp nextWakeTime = std::min(mAckDeadlines.GetEarliestDeadline(), mRetransDeadlines.GetEarliestDeadline());
 
     if (nextWakeTime != System::Clock::Timestamp::max())
     {
@@ -408,6 +446,44 @@ void ReliableMessageMgr::StartTimer()
     TicklessDebugDumpRetransTable("ReliableMessageMgr::StartTimer Dumping mRetransTable entries after setting wakeup times");
 }
 
+void ReliableMessageMgr::ScheduleStandaloneAck(ReliableMessageContext * rc)
+{
+    ExchangeContext * ec = rc->GetExchangeContext();
+
+    if (CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW != System::Clock::kZero && ec->HasSessionHandle())
+    {
+        // Go out with the first ack of a burst on the same session if it is due shortly before this one. Sending an ack
+        // earlier is always allowed, so it does not matter whether that ack has been piggybacked since.
+        const SessionHandle session             = ec->GetSessionHandle();
+        const System::Clock::Timestamp now      = System::SystemClock().GetMonotonicTimestamp();
+        const System::Clock::Timestamp anchor   = session->GetStandaloneAckAnchor();
+        const System::Clock::Timestamp deadline = rc->mNextAckTime;
+
+        if (anchor > now && anchor < deadline && deadline - anchor <= CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW)
+        {
+            rc->mNextAckTime = anchor;
+            mCounters.coalescedAcks++;
+        }
+        else
+        {
+            session->SetStandaloneAckAnchor(deadline);
+        }
+    }
+
+    mAckDeadlines.Schedule(*rc, rc->mNextAckTime);
+}
+
+void ReliableMessageMgr::CancelStandaloneAck(ReliableMessageContext * rc)
+{
+    mAckDeadlines.Cancel(*rc);
+}
+
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry * entry)
+{
+    mRetransDeadlines.Cancel(*entry);
+    mRetransTable.ReleaseObject(entry);
+}
+
 void ReliableMessageMgr::StopTimer()
 {
     mSystemLayer->CancelTimer(Timeout, this);
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/support/BitFlags.h>
 #include <lib/support/Pool.h>
+#include <messaging/DeadlineQueue.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemLayer.h>
@@ -65,6 +66,20 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
+        System::Clock::Timestamp firstSendTime;   /**< When the message was first sent, for round-trip time sampling. */
+        DeadlineQueueNode deadlineNode;           /**< Position of nextRetransTime in the retransmission schedule. */
+    };
+
+    /**
+     *  Counters of the actions taken by the reliable message protocol since Init() or ResetCounters().
+     */
+    struct Counters
+    {
+        uint32_t retransmissions        = 0; /**< Messages sent again because they were not acknowledged in time. */
+        uint32_t retransmissionTimeouts = 0; /**< Messages given up on after CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS retries. */
+        uint32_t standaloneAcks         = 0; /**< Standalone acks sent, i.e. acks that could not be piggybacked. */
+        uint32_t piggybackedAcks        = 0; /**< Acks carried by an outgoing message, each saving a datagram. */
+        uint32_t coalescedAcks          = 0; /**< Standalone acks moved to share a wakeup with another ack of the session. */
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -74,9 +89,8 @@ public:
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
-     * action needs to be triggered by ReliableMessageProtocol time facilities,
-     * execute that action.
+     * Send the standalone acks and retransmissions whose deadline has passed.  Only
+     * expired deadlines are visited.
      */
     void ExecuteActions();
 
@@ -112,6 +126,22 @@ public:
      */
     static System::Clock::Timestamp GetBackoff(System::Clock::Timestamp baseInterval, uint8_t sendCount);
 
+    /**
+     *  Calculate how long an acknowledgment for a message received on the session may wait for an outgoing message
+     *  to piggyback on before a standalone ack is sent.
+     *
+     *  Until a round-trip time has been measured on the session this is CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT.  After
+     *  that the ack is held back for as long as it can still reach the peer before the peer retransmits, i.e. our
+     *  active retransmission interval minus the smoothed round-trip time, clamped to
+     *  [CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT, CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT].  With the default maximum the window never
+     *  exceeds CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT.
+     *
+     *  @param[in]   session   The session the message to acknowledge was received on.
+     *
+     *  @retval  The piggyback window.
+     */
+    static System::Clock::Milliseconds32 GetPiggybackWindow(const SessionHandle & session);
+
     /**
      *  Start retranmisttion of cached encryped packet for current entry.
      *
@@ -127,10 +157,12 @@ public:
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
+     *  @param[in]    isStandaloneAck    Whether the ack came in a standalone ack, which the peer may have held back
+     *                                   for its whole piggyback window, rather than piggybacked on a message.
      *
      *  @retval  #CHIP_NO_ERROR On success.
      */
-    bool CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter);
+    bool CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter, bool isStandaloneAck);
 
     /**
      *  Send the specified entry from the retransmission table.
@@ -158,10 +190,8 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
-     * Determine how many ReliableMessageProtocol ticks we need to sleep before we
-     * need to physically wake the CPU to perform an action.  Set a timer to go off
-     * when we next need to wake the system.
+     * Set a timer to go off at the earliest scheduled standalone ack or
+     * retransmission deadline.
      *
      */
     void StartTimer();
@@ -182,6 +212,28 @@ public:
      */
     void RegisterSessionUpdateDelegate(SessionUpdateDelegate * sessionUpdateDelegate);
 
+    /**
+     *  Schedule (or reschedule) a standalone ack for the exchange at its mNextAckTime.  If the first standalone ack
+     *  of a burst on the same session is due up to CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW earlier, the ack is moved
+     *  to that deadline instead so both are sent in the same wakeup.
+     *
+     *  @param[in]    rc    A pointer to the ExchangeContext object.
+     *
+     */
+    void ScheduleStandaloneAck(ReliableMessageContext * rc);
+
+    /**
+     *  Remove any standalone ack scheduled for the exchange.  Must be called before the
+     *  exchange is destroyed.
+     *
+     *  @param[in]    rc    A pointer to the ExchangeContext object.
+     *
+     */
+    void CancelStandaloneAck(ReliableMessageContext * rc);
+
+    const Counters & GetCounters() const { return mCounters; }
+    void ResetCounters() { mCounters = Counters(); }
+
     /**
      * Map a send error code to the error code we should actually use for
      * success checks.  This maps some error codes to CHIP_NO_ERROR as
@@ -210,9 +262,22 @@ private:
 
     void TicklessDebugDumpRetransTable(const char * log);
 
+    // Release a retrans table entry, without rescheduling the timer.
+    void ReleaseRetransEntry(RetransTableEntry * entry);
+
+    friend class ReliableMessageContext;
+
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Pending deadlines, earliest first. Every exchange has at most one pending ack and every
+    // retrans table entry at most one pending retransmission.
+    DeadlineQueue<ReliableMessageContext, &ReliableMessageContext::mAckDeadlineNode, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS>
+        mAckDeadlines;
+    DeadlineQueue<RetransTableEntry, &RetransTableEntry::deadlineNode, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransDeadlines;
+
+    Counters mCounters;
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 };
 
@@ -71,6 +71,69 @@ namespace chip {
 #define CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT (200_ms32)
 #endif // CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT
 
+/**
+ *  @def CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT
+ *
+ *  @brief
+ *    The shortest time an acknowledgment is held back waiting for a message to piggyback on, once the round-trip
+ *    time of the session is known.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT
+#define CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT (20_ms32)
+#endif // CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT
+ *
+ *  @brief
+ *    The longest time an acknowledgment is held back waiting for a message to piggyback on, once the round-trip
+ *    time of the session is known.  The default never holds an ack back longer than the specified
+ *    CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT, so the round-trip time only ever shortens the window.  Raising it, up to
+ *    CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL, opts in to letting fast sessions hold acks back longer.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT
+#define CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT
+#endif // CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+ *
+ *  @brief
+ *    A standalone acknowledgment due at most this long after another one on the same session is sent
+ *    together with it, so that bursts of exchanges are acknowledged in a single wakeup.  Zero disables
+ *    coalescing.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+#define CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW (50_ms32)
+#endif // CHIP_CONFIG_RMP_ACK_COALESCING_WINDOW
+
+/**
+ *  @def CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL
+ *
+ *  @brief
+ *    How long to wait before trying again to send a standalone acknowledgment whose send failed, so that a
+ *    transient failure does not leave the peer to retransmit.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL
+#define CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL (50_ms32)
+#endif // CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_RMP_MAX_ACK_RETRIES
+ *
+ *  @brief
+ *    How many times a standalone acknowledgment that failed with a transient error is tried again before it
+ *    is dropped and left to the peer's retransmissions.  Acks that fail with any other error are dropped at once.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_MAX_ACK_RETRIES
+#define CHIP_CONFIG_RMP_MAX_ACK_RETRIES 3
+#endif // CHIP_CONFIG_RMP_MAX_ACK_RETRIES
+
 /**
  *  @def CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE
  *
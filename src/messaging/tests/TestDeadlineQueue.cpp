@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the DeadlineQueue used to schedule
+ *      MRP standalone acks and retransmissions.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <messaging/DeadlineQueue.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+using namespace chip::System::Clock::Literals;
+
+struct Item
+{
+    System::Clock::Timestamp deadline;
+    bool scheduled = false;
+    DeadlineQueueNode node;
+};
+
+constexpr size_t kItemCount = 32;
+using TestQueue             = DeadlineQueue<Item, &Item::node, kItemCount>;
+
+void CheckOrdering(nlTestSuite * inSuite, void * inContext)
+{
+    TestQueue queue;
+    Item items[4];
+
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+    NL_TEST_ASSERT(inSuite, queue.GetEarliestDeadline() == System::Clock::Timestamp::max());
+    NL_TEST_ASSERT(inSuite, queue.PopExpired(1000_ms64) == nullptr);
+
+    queue.Schedule(items[0], 300_ms64);
+    queue.Schedule(items[1], 100_ms64);
+    queue.Schedule(items[2], 200_ms64);
+    queue.Schedule(items[3], 400_ms64);
+    NL_TEST_ASSERT(inSuite, queue.Size() == 4);
+    NL_TEST_ASSERT(inSuite, queue.GetEarliestDeadline() == 100_ms64);
+    NL_TEST_ASSERT(inSuite, queue.Front() == &items[1]);
+
+    // Nothing has expired yet
+    NL_TEST_ASSERT(inSuite, queue.PopExpired(99_ms64) == nullptr);
+
+    NL_TEST_ASSERT(inSuite, queue.PopExpired(250_ms64) == &items[1]);
+    NL_TEST_ASSERT(inSuite, !items[1].node.IsQueued());
+    NL_TEST_ASSERT(inSuite, queue.PopExpired(250_ms64) == &items[2]);
+    NL_TEST_ASSERT(inSuite, queue.PopExpired(250_ms64) == nullptr);
+
+    // Rescheduling moves an item rather than adding it twice
+    queue.Schedule(items[3], 50_ms64);
+    NL_TEST_ASSERT(inSuite, queue.Size() == 2);
+    NL_TEST_ASSERT(inSuite, queue.Front() == &items[3]);
+    queue.Schedule(items[3], 500_ms64);
+    NL_TEST_ASSERT(inSuite, queue.Front() == &items[0]);
+
+    queue.Cancel(items[0]);
+    NL_TEST_ASSERT(inSuite, !items[0].node.IsQueued());
+    NL_TEST_ASSERT(inSuite, queue.Front() == &items[3]);
+
+    // Cancelling an item which is not scheduled is a no-op
+    queue.Cancel(items[0]);
+    NL_TEST_ASSERT(inSuite, queue.Size() == 1);
+
+    queue.Clear();
+    NL_TEST_ASSERT(inSuite, queue.IsEmpty());
+    NL_TEST_ASSERT(inSuite, !items[3].node.IsQueued());
+}
+
+void CheckRandomOperations(nlTestSuite * inSuite, void * inContext)
+{
+    TestQueue queue;
+    Item items[kItemCount];
+    uint32_t state = 1;
+
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        state       = state * 1103515245u + 12345u;
+        Item & item = items[(state >> 8) % kItemCount];
+
+        switch ((state >> 4) % 3)
+        {
+        case 0:
+            item.deadline  = System::Clock::Timestamp((state >> 16) % 1000);
+            item.scheduled = true;
+            queue.Schedule(item, item.deadline);
+            break;
+        case 1:
+            item.scheduled = false;
+            queue.Cancel(item);
+            break;
+        default: {
+            System::Clock::Timestamp now((state >> 16) % 1000);
+            Item * expired = queue.PopExpired(now);
+
+            // The popped item must be the earliest one, and only if it expired
+            Item * earliest = nullptr;
+            for (auto & candidate : items)
+            {
+                if (candidate.scheduled && (earliest == nullptr || candidate.deadline < earliest->deadline))
+                {
+                    earliest = &candidate;
+                }
+            }
+
+            if (earliest == nullptr || earliest->deadline > now)
+            {
+                NL_TEST_ASSERT(inSuite, expired == nullptr);
+            }
+            else
+            {
+                NL_TEST_ASSERT(inSuite, expired != nullptr && expired->deadline == earliest->deadline);
+                if (expired != nullptr)
+                {
+                    expired->scheduled = false;
+                }
+            }
+            break;
+        }
+        }
+
+        size_t scheduledCount = 0;
+        for (auto & candidate : items)
+        {
+            NL_TEST_ASSERT(inSuite, candidate.scheduled == candidate.node.IsQueued());
+            scheduledCount += candidate.scheduled ? 1 : 0;
+        }
+        NL_TEST_ASSERT(inSuite, queue.Size() == scheduledCount);
+    }
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test DeadlineQueue ordering",          CheckOrdering),
+    NL_TEST_DEF("Test DeadlineQueue random operations", CheckRandomOperations),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+/**
+ *  Main
+ */
+int TestDeadlineQueue()
+{
+    nlTestSuite theSuite = { "Messaging-TestDeadlineQueue", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeadlineQueue);
@@ -352,6 +352,7 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
 
     // Ensure the retransmit table is empty right now
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    rm->ResetCounters();
 
     // Ensure the exchange stays open after we send (unlike the CheckCloseExchangeAndResendApplicationMessage case), by claiming to
     // expect a response.
@@ -431,6 +432,8 @@ void CheckResendApplicationMessage(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount >= 5);
     NL_TEST_ASSERT(inSuite, loopback.mDroppedMessageCount == 4);
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().retransmissions == 4);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().retransmissionTimeouts == 0);
 
     exchange->Close();
 }
@@ -1232,8 +1235,10 @@ void CheckSendStandaloneAckMessage(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, rm != nullptr);
     NL_TEST_ASSERT(inSuite, rc != nullptr);
 
+    rm->ResetCounters();
     NL_TEST_ASSERT(inSuite, rc->SendStandaloneAckMessage() == CHIP_NO_ERROR);
     ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().standaloneAcks == 1);
 
     // Need manual close because standalone acks don't close exchanges.
     exchange->Close();
@@ -1646,6 +1651,171 @@ void CheckLostStandaloneAck(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
 }
 
+void CheckStandaloneAckSendFailure(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    MockAppDelegate mockReceiver;
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    mockReceiver.mTestSuite = inSuite;
+
+    MockAppDelegate mockSender;
+    ExchangeContext * exchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    mockSender.mTestSuite = inSuite;
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    // Keep the sender from retransmitting while the ack is held back, so that only a retried standalone ack can
+    // acknowledge the message.
+    exchange->GetSessionHandle()->AsSecureSession()->SetRemoteMRPConfig({
+        System::Clock::Timestamp(2000), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Timestamp(2000), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    });
+
+    auto & loopback               = ctx.GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 0;
+    loopback.mDroppedMessageCount = 0;
+    mockReceiver.mRetainExchange  = true;
+    rm->ResetCounters();
+
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    // Ensure the message was sent and received, and that the receiver holds the ack back.
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == 1);
+    NL_TEST_ASSERT(inSuite, mockReceiver.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+
+    ReliableMessageContext * receiverRc = mockReceiver.mExchange->GetReliableMessageContext();
+    NL_TEST_ASSERT(inSuite, receiverRc->IsAckPending());
+
+    // Fail the standalone ack with a transient error when it comes due.
+    System::Clock::Milliseconds32 ackWindow = ReliableMessageMgr::GetPiggybackWindow(mockReceiver.mExchange->GetSessionHandle());
+    loopback.mMessageSendError              = CHIP_ERROR_NO_MEMORY;
+    ctx.GetIOContext().DriveIOUntil(ackWindow + CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL / 2, [&] { return false; });
+
+    // The ack is still pending rather than forgotten.
+    NL_TEST_ASSERT(inSuite, receiverRc->IsAckPending());
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == 1);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().standaloneAcks == 0);
+
+    // Once sending works again, the ack goes out without waiting for the sender to retransmit.
+    loopback.mMessageSendError = CHIP_NO_ERROR;
+    ctx.GetIOContext().DriveIOUntil(1000_ms32, [&] { return loopback.mSentMessageCount >= 2; });
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == 2);
+    NL_TEST_ASSERT(inSuite, !receiverRc->IsAckPending());
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().standaloneAcks == 1);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().retransmissions == 0);
+
+    mockReceiver.mExchange->Close();
+    exchange->Close();
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void CheckStandaloneAckSendFailureDropped(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    // A permanent error drops the ack at once; a transient one only once the retries are used up.
+    struct
+    {
+        CHIP_ERROR sendError;
+        System::Clock::Milliseconds32 failFor;
+    } cases[] = {
+        { CHIP_ERROR_NOT_CONNECTED, CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL / 2 },
+        { CHIP_ERROR_NO_MEMORY, CHIP_CONFIG_RMP_ACK_RETRY_INTERVAL * (CHIP_CONFIG_RMP_MAX_ACK_RETRIES + 2) },
+    };
+
+    for (const auto & testCase : cases)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+        MockAppDelegate mockReceiver;
+        CHIP_ERROR err =
+            ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+        mockReceiver.mTestSuite = inSuite;
+
+        MockAppDelegate mockSender;
+        ExchangeContext * exchange = ctx.NewExchangeToAlice(&mockSender);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+        mockSender.mTestSuite = inSuite;
+
+        exchange->GetSessionHandle()->AsSecureSession()->SetRemoteMRPConfig({
+            System::Clock::Timestamp(2000), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+            System::Clock::Timestamp(2000), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+        });
+
+        auto & loopback               = ctx.GetLoopback();
+        loopback.mSentMessageCount    = 0;
+        loopback.mNumMessagesToDrop   = 0;
+        loopback.mDroppedMessageCount = 0;
+        mockReceiver.mRetainExchange  = true;
+        rm->ResetCounters();
+
+        err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == 1);
+        NL_TEST_ASSERT(inSuite, mockReceiver.IsOnMessageReceivedCalled);
+
+        ReliableMessageContext * receiverRc = mockReceiver.mExchange->GetReliableMessageContext();
+        NL_TEST_ASSERT(inSuite, receiverRc->IsAckPending());
+
+        System::Clock::Milliseconds32 ackWindow =
+            ReliableMessageMgr::GetPiggybackWindow(mockReceiver.mExchange->GetSessionHandle());
+        loopback.mMessageSendError = testCase.sendError;
+        ctx.GetIOContext().DriveIOUntil(ackWindow + testCase.failFor, [&] { return false; });
+
+        // The ack is dropped rather than kept pending, and is not sent once sending works again.
+        NL_TEST_ASSERT(inSuite, !receiverRc->IsAckPending());
+        loopback.mMessageSendError = CHIP_NO_ERROR;
+        ctx.GetIOContext().DriveIOUntil(ackWindow, [&] { return false; });
+
+        NL_TEST_ASSERT(inSuite, loopback.mSentMessageCount == 1);
+        NL_TEST_ASSERT(inSuite, rm->GetCounters().standaloneAcks == 0);
+        NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+
+        // The sender's retransmission is a duplicate, which the receiver acknowledges right away.
+        ctx.GetIOContext().DriveIOUntil(3000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+        ctx.DrainAndServiceIO();
+
+        NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+        NL_TEST_ASSERT(inSuite, rm->GetCounters().retransmissions == 1);
+        NL_TEST_ASSERT(inSuite, rm->GetCounters().standaloneAcks == 1);
+
+        mockReceiver.mExchange->Close();
+        exchange->Close();
+
+        err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+}
+
 void CheckGetBackoff(nlTestSuite * inSuite, void * inContext)
 {
     // Run 3x iterations to thoroughly test random jitter always results in backoff within bounds.
@@ -1664,6 +1834,189 @@ void CheckGetBackoff(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+void CheckPiggybackWindow(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    SessionHandle session                        = ctx.GetSessionAliceToBob();
+    System::Clock::Milliseconds32 activeInterval = GetLocalMRPConfig().ValueOr(GetDefaultMRPConfig()).mActiveRetransTimeout;
+
+    // Without a round-trip time measurement the default ack timeout applies.
+    session->ResetRoundTripTime();
+    NL_TEST_ASSERT(inSuite, session->GetSmoothedRoundTripTime() == System::Clock::kZero);
+    NL_TEST_ASSERT(inSuite, ReliableMessageMgr::GetPiggybackWindow(session) == CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT);
+
+    // Samples are smoothed with a gain of 1/8.
+    session->UpdateRoundTripTime(100_ms32);
+    NL_TEST_ASSERT(inSuite, session->GetSmoothedRoundTripTime() == 100_ms32);
+    session->UpdateRoundTripTime(200_ms32);
+    NL_TEST_ASSERT(inSuite, session->GetSmoothedRoundTripTime() == 112_ms32);
+
+    // A fast session holds acks back as long as the peer does not retransmit in the meantime, but no longer than the
+    // configured maximum, which by default is the standalone ack timeout.
+    session->ResetRoundTripTime();
+    session->UpdateRoundTripTime(1_ms32);
+    System::Clock::Milliseconds32 fastWindow = ReliableMessageMgr::GetPiggybackWindow(session);
+    NL_TEST_ASSERT(inSuite, fastWindow <= CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT);
+    NL_TEST_ASSERT(inSuite, fastWindow + 1_ms32 <= activeInterval || fastWindow == CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT);
+    if (activeInterval - 1_ms32 <= CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT)
+    {
+        // Not capped by the maximum ack timeout.
+        NL_TEST_ASSERT(inSuite, fastWindow == activeInterval - 1_ms32);
+    }
+    else
+    {
+        NL_TEST_ASSERT(inSuite, fastWindow == CHIP_CONFIG_RMP_MAX_ACK_TIMEOUT);
+    }
+
+    // A session slower than our retransmission interval acks as soon as allowed.
+    session->ResetRoundTripTime();
+    session->UpdateRoundTripTime(activeInterval);
+    NL_TEST_ASSERT(inSuite, ReliableMessageMgr::GetPiggybackWindow(session) == CHIP_CONFIG_RMP_MIN_ACK_TIMEOUT);
+
+    session->ResetRoundTripTime();
+}
+
+void CheckRoundTripTimeSampling(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    MockAppDelegate mockReceiver;
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    mockReceiver.mTestSuite      = inSuite;
+    mockReceiver.mRetainExchange = true;
+
+    MockAppDelegate mockSender;
+    ExchangeContext * exchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    mockSender.mTestSuite = inSuite;
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+
+    SessionHandle session = exchange->GetSessionHandle();
+    session->ResetRoundTripTime();
+
+    // A message acked by a standalone ack: the peer may have held the ack back, so no sample is taken.
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, mockReceiver.IsOnMessageReceivedCalled);
+
+    mockReceiver.mExchange->GetReliableMessageContext()->SendStandaloneAckMessage();
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, session->GetSmoothedRoundTripTime() == System::Clock::kZero);
+
+    // A message acked by a piggybacked ack gives a sample.
+    exchange->Close();
+    exchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    err = exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+
+    // Sending a response that expects none closes the receiver's exchange.
+    err = mockReceiver.mExchange->SendMessage(Echo::MsgType::EchoResponse, std::move(buffer));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    mockReceiver.mExchange = nullptr;
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, mockSender.IsOnMessageReceivedCalled);
+    NL_TEST_ASSERT(inSuite, mockSender.mReceivedPiggybackAck);
+    NL_TEST_ASSERT(inSuite, session->GetSmoothedRoundTripTime() != System::Clock::kZero);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+
+    session->ResetRoundTripTime();
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+void CheckStandaloneAckCoalescing(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    // Two receivers, so that both exchanges stay open with an ack pending.
+    MockAppDelegate firstReceiver;
+    MockAppDelegate secondReceiver;
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &firstReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoResponse, &secondReceiver);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    firstReceiver.mTestSuite       = inSuite;
+    firstReceiver.mRetainExchange  = true;
+    secondReceiver.mTestSuite      = inSuite;
+    secondReceiver.mRetainExchange = true;
+
+    MockAppDelegate mockSender;
+    ExchangeContext * firstExchange  = ctx.NewExchangeToAlice(&mockSender);
+    ExchangeContext * secondExchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, firstExchange != nullptr);
+    NL_TEST_ASSERT(inSuite, secondExchange != nullptr);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    rm->ResetCounters();
+
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    err = firstExchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    // The ack of the second exchange is due shortly after the first one, on the same session, and shares its wakeup.
+    ctx.GetIOContext().DriveIOUntil(10_ms32, [] { return false; });
+    uint32_t coalescedAcks = rm->GetCounters().coalescedAcks;
+
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    err = secondExchange->SendMessage(Echo::MsgType::EchoResponse, std::move(buffer), SendFlags(SendMessageFlags::kExpectResponse));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite,
+                   firstReceiver.mExchange != nullptr && firstReceiver.mExchange->GetReliableMessageContext()->IsAckPending());
+    NL_TEST_ASSERT(inSuite,
+                   secondReceiver.mExchange != nullptr && secondReceiver.mExchange->GetReliableMessageContext()->IsAckPending());
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().coalescedAcks == coalescedAcks + 1);
+
+    // Both acks still go out.
+    ctx.GetIOContext().DriveIOUntil(1000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().standaloneAcks == 2);
+    NL_TEST_ASSERT(inSuite, rm->GetCounters().retransmissions == 0);
+
+    firstReceiver.CloseExchangeIfNeeded();
+    secondReceiver.CloseExchangeIfNeeded();
+    firstExchange->Close();
+    secondExchange->Close();
+
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoResponse);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
 int InitializeTestCase(void * inContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(inContext);
@@ -1712,7 +2065,12 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test that unencrypted message is dropped if exchange requires encryption", CheckUnencryptedMessageReceiveFailure),
     NL_TEST_DEF("Test that dropping an application-level message with a piggyback ack works ok once both sides retransmit", CheckLostResponseWithPiggyback),
     NL_TEST_DEF("Test that an application-level response-to-response after a lost standalone ack to the initial message works", CheckLostStandaloneAck),
+    NL_TEST_DEF("Test that a standalone ack whose send fails is sent again", CheckStandaloneAckSendFailure),
+    NL_TEST_DEF("Test that a standalone ack failing for good is dropped", CheckStandaloneAckSendFailureDropped),
     NL_TEST_DEF("Test MRP backoff algorithm", CheckGetBackoff),
+    NL_TEST_DEF("Test MRP piggyback window adapts to the round-trip time", CheckPiggybackWindow),
+    NL_TEST_DEF("Test that only piggybacked acks sample the round-trip time", CheckRoundTripTimeSampling),
+    NL_TEST_DEF("Test that standalone acks of the same session share a wakeup", CheckStandaloneAckCoalescing),
 
     NL_TEST_SENTINEL()
 };
@@ -108,5 +108,11 @@ CHIP_ERROR ChipDnssdResolve(DnssdService * /*service*/, chip::Inet::InterfaceId
     return CHIP_ERROR_NOT_IMPLEMENTED;
 }
 
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * /*service*/)
+{
+    // Resolve results are not cached
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Dnssd
 } // namespace chip
@@ -59,6 +59,18 @@
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 16
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 2
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
+#ifndef CHIP_IM_MAX_COMMANDS_PER_INVOKE
+#define CHIP_IM_MAX_COMMANDS_PER_INVOKE 20
+#endif // CHIP_IM_MAX_COMMANDS_PER_INVOKE
+
 // TODO - Fine tune MRP default parameters for Darwin platform
 #define CHIP_CONFIG_MRP_DEFAULT_INITIAL_RETRY_INTERVAL (15000)
 #define CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL (2000_ms32)
@@ -420,5 +420,11 @@ CHIP_ERROR ChipDnssdResolve(DnssdService * service, chip::Inet::InterfaceId inte
     return Resolve(context, callback, interfaceId, service->mAddressType, regtype.c_str(), service->mName);
 }
 
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * service)
+{
+    // Resolve results are not cached
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Dnssd
 } // namespace chip
@@ -28,26 +28,121 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+DeviceSafeQueue::DeviceSafeQueue()
+{
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
 void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    if (!mOverflowing.load(std::memory_order_acquire) && PushToRing(event))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mOverflowLock);
+    mOverflow.push(event);
+    mOverflowing.store(true, std::memory_order_release);
+    mOverflowCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool DeviceSafeQueue::PushToRing(const ChipDeviceEvent & event)
+{
+    size_t position = mTail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Slot & slot     = mSlots[position % kCapacity];
+        size_t sequence = slot.mSequence.load(std::memory_order_acquire);
+
+        if (sequence == position)
+        {
+            // The slot is free; claim the position unless another pusher took it first.
+            if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.mEvent = event;
+                slot.mSequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (sequence < position)
+        {
+            // The slot still holds the event pushed a lap earlier: the ring is full.
+            return false;
+        }
+        else
+        {
+            // Another pusher claimed the position meanwhile.
+            position = mTail.load(std::memory_order_relaxed);
+        }
+    }
 }
 
 bool DeviceSafeQueue::Empty()
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    return mSlots[mHead % kCapacity].mSequence.load(std::memory_order_acquire) != mHead + 1 &&
+        !mOverflowing.load(std::memory_order_acquire);
 }
 
-const ChipDeviceEvent DeviceSafeQueue::PopFront()
+size_t DeviceSafeQueue::PopFront(ChipDeviceEvent * events, size_t maxEvents)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    size_t count = 0;
+
+    while (count < maxEvents)
+    {
+        Slot & slot = mSlots[mHead % kCapacity];
+        if (slot.mSequence.load(std::memory_order_acquire) != mHead + 1)
+        {
+            if (!mOverflowing.load(std::memory_order_acquire))
+            {
+                break;
+            }
+
+            size_t popped = PopFromOverflow(&events[count], maxEvents - count);
+            if (popped == 0 && slot.mSequence.load(std::memory_order_acquire) != mHead + 1)
+            {
+                // A pusher is still writing the head slot; the event loop is woken up again once it is done.
+                break;
+            }
+            count += popped;
+            continue;
+        }
+
+        events[count++] = slot.mEvent;
+        // Free the slot for the push one lap later.
+        slot.mSequence.store(mHead + kCapacity, std::memory_order_release);
+        mHead++;
+    }
+
+    return count;
+}
+
+size_t DeviceSafeQueue::PopFromOverflow(ChipDeviceEvent * events, size_t maxEvents)
+{
+    std::lock_guard<std::mutex> lock(mOverflowLock);
+    size_t count = 0;
+
+    // The positions a thread claimed in the ring before falling back to the list are visible once the list is
+    // locked, and their events must be popped before the list.
+    if (mTail.load(std::memory_order_relaxed) != mHead)
+    {
+        return 0;
+    }
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    while (count < maxEvents && !mOverflow.empty())
+    {
+        events[count++] = mOverflow.front();
+        mOverflow.pop();
+    }
+    if (mOverflow.empty())
+    {
+        mOverflowing.store(false, std::memory_order_release);
+    }
 
-    return event;
+    return count;
 }
 
 } // namespace Internal
@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 #include <queue>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <lib/core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
@@ -36,27 +39,68 @@ namespace DeviceLayer {
 namespace Internal {
 
 /**
- *  @class DeviceSafeQueue
+ * A queue of device events for any number of threads pushing and a single thread (the CHIP thread) popping.
  *
- *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ * Events are stored in a ring of CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE slots, without locks.  Each slot carries
+ * a sequence number telling whether it is free for the push at a given position or holds the event for the pop at
+ * that position, so a pusher only contends with other pushers on the tail position and never with the popping thread.
  *
+ * Events that do not fit in the ring go to an unbounded, mutex protected overflow list, as the whole queue used to
+ * be, so a push never fails.  Once the list is in use, all events go through it until the popping thread drained
+ * it, which keeps the events pushed by a thread in order.
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    static constexpr size_t kCapacity = CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE;
+
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
+    /**
+     * Add an event at the end of the queue.  May be called from any thread.
+     */
     void Push(const ChipDeviceEvent & event);
+
+    /**
+     * Whether the queue holds no event.  Only meaningful on the popping thread.
+     */
     bool Empty();
-    const ChipDeviceEvent PopFront();
+
+    /**
+     * Move up to @p maxEvents events from the front of the queue to @p events.  Must only be called from a single thread.
+     *
+     * @return The number of events moved, 0 if the queue is empty.
+     */
+    size_t PopFront(ChipDeviceEvent * events, size_t maxEvents);
+
+    /**
+     * The number of events that went through the overflow list.
+     */
+    uint32_t GetOverflowCount() const { return mOverflowCount.load(std::memory_order_relaxed); }
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    struct Slot
+    {
+        // Equal to the position for a slot free for the push at that position, to the position + 1 for a slot
+        // holding the event of that position.
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+    };
+
+    bool PushToRing(const ChipDeviceEvent & event);
+    size_t PopFromOverflow(ChipDeviceEvent * events, size_t maxEvents);
+
+    Slot mSlots[kCapacity];
+    // Kept on separate cache lines so pushers and the popping thread do not invalidate each other's position.
+    alignas(64) std::atomic<size_t> mTail{ 0 };
+    alignas(64) size_t mHead = 0;
+    std::atomic<uint32_t> mOverflowCount{ 0 };
+
+    // Whether mOverflow holds events.  Only changed with mOverflowLock held.
+    std::atomic<bool> mOverflowing{ false };
+    std::mutex mOverflowLock;
+    std::queue<ChipDeviceEvent> mOverflow;
 
     DeviceSafeQueue(const DeviceSafeQueue &) = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
@@ -505,5 +505,11 @@ CHIP_ERROR ChipDnssdResolve(DnssdService * service, chip::Inet::InterfaceId inte
     return error;
 }
 
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * service)
+{
+    // Resolve results are not cached
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Dnssd
 } // namespace chip
@@ -68,6 +68,17 @@
 #define CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG 1
 #endif // CHIP_DEVICE_LAYER_BLE_CONN_CFG_TAG
 
+/**
+ * @def CHIP_DEVICE_CONFIG_NETWORK_DIAGNOSTICS_MAX_AGE_MS
+ *
+ * The longest time the network interface snapshot serving the diagnostics clusters
+ * is used for.  Changes to links and addresses refresh it right away; the interface
+ * statistics are not notified, so this bounds how stale the reported counts can be.
+ */
+#ifndef CHIP_DEVICE_CONFIG_NETWORK_DIAGNOSTICS_MAX_AGE_MS
+#define CHIP_DEVICE_CONFIG_NETWORK_DIAGNOSTICS_MAX_AGE_MS 1000
+#endif // CHIP_DEVICE_CONFIG_NETWORK_DIAGNOSTICS_MAX_AGE_MS
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
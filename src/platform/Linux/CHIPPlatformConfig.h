@@ -64,6 +64,18 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 16
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 2
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
+#ifndef CHIP_IM_MAX_COMMANDS_PER_INVOKE
+#define CHIP_IM_MAX_COMMANDS_PER_INVOKE 20
+#endif // CHIP_IM_MAX_COMMANDS_PER_INVOKE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
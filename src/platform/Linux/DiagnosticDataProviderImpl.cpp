@@ -33,7 +33,6 @@
 
 #include <arpa/inet.h>
 #include <dirent.h>
-#include <ifaddrs.h>
 #include <linux/ethtool.h>
 #include <linux/if_link.h>
 #include <linux/netlink.h>
@@ -74,133 +73,89 @@ enum class WiFiStatsCountType
     kWiFiOverrunCount
 };
 
-CHIP_ERROR GetEthernetStatsCount(EthernetStatsCountType type, uint64_t & count)
+CHIP_ERROR GetEthernetStatsCount(NetworkDiagnosticsCache & cache, EthernetStatsCountType type, uint64_t & count)
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
-
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
+    CHIP_ERROR err = CHIP_ERROR_READ_FAILED;
 
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceType::EMBER_ZCL_INTERFACE_TYPE_ETHERNET)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary Ethernet interface:%s", ifa->ifa_name);
-                break;
-            }
-        }
+    ReturnErrorOnFailure(cache.Update());
 
-        if (ifa != nullptr)
+    const NetworkDiagnosticsCache::Interface * ifp = cache.FindInterface(InterfaceType::EMBER_ZCL_INTERFACE_TYPE_ETHERNET);
+    if (ifp != nullptr && ifp->mHasStats)
+    {
+        const struct rtnl_link_stats64 & stats = ifp->mStats;
+        switch (type)
         {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-                switch (type)
-                {
-                case EthernetStatsCountType::kEthPacketRxCount:
-                    count = stats->rx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthPacketTxCount:
-                    count = stats->tx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthTxErrCount:
-                    count = stats->tx_errors;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthCollisionCount:
-                    count = stats->collisions;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case EthernetStatsCountType::kEthOverrunCount:
-                    count = stats->rx_over_errors;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                default:
-                    ChipLogError(DeviceLayer, "Unknown Ethernet statistic metric type");
-                    break;
-                }
-            }
+        case EthernetStatsCountType::kEthPacketRxCount:
+            count = stats.rx_packets;
+            err   = CHIP_NO_ERROR;
+            break;
+        case EthernetStatsCountType::kEthPacketTxCount:
+            count = stats.tx_packets;
+            err   = CHIP_NO_ERROR;
+            break;
+        case EthernetStatsCountType::kEthTxErrCount:
+            count = stats.tx_errors;
+            err   = CHIP_NO_ERROR;
+            break;
+        case EthernetStatsCountType::kEthCollisionCount:
+            count = stats.collisions;
+            err   = CHIP_NO_ERROR;
+            break;
+        case EthernetStatsCountType::kEthOverrunCount:
+            count = stats.rx_over_errors;
+            err   = CHIP_NO_ERROR;
+            break;
+        default:
+            ChipLogError(DeviceLayer, "Unknown Ethernet statistic metric type");
+            break;
         }
-
-        freeifaddrs(ifaddr);
     }
 
     return err;
 }
 
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFI
-CHIP_ERROR GetWiFiStatsCount(WiFiStatsCountType type, uint64_t & count)
+CHIP_ERROR GetWiFiStatsCount(NetworkDiagnosticsCache & cache, WiFiStatsCountType type, uint64_t & count)
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
+    CHIP_ERROR err = CHIP_ERROR_READ_FAILED;
 
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
+    ReturnErrorOnFailure(cache.Update());
 
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceType::EMBER_ZCL_INTERFACE_TYPE_WI_FI)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary WiFi interface:%s", ifa->ifa_name);
-                break;
-            }
-        }
+    const NetworkDiagnosticsCache::Interface * ifp = cache.FindInterface(InterfaceType::EMBER_ZCL_INTERFACE_TYPE_WI_FI);
+    if (ifp != nullptr && ifp->mHasStats)
+    {
+        // The usecase of this function is embedded devices,on which we can interact with the WiFi
+        // driver to get the accurate number of muticast and unicast packets accurately.
+        // On Linux simulation, we can only get the total packets received, the total bytes transmitted,
+        // the multicast packets received and receiver ring buff overflow.
 
-        if (ifa != nullptr)
+        const struct rtnl_link_stats64 & stats = ifp->mStats;
+        switch (type)
         {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                // The usecase of this function is embedded devices,on which we can interact with the WiFi
-                // driver to get the accurate number of muticast and unicast packets accurately.
-                // On Linux simulation, we can only get the total packets received, the total bytes transmitted,
-                // the multicast packets received and receiver ring buff overflow.
-
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-                switch (type)
-                {
-                case WiFiStatsCountType::kWiFiUnicastPacketRxCount:
-                    count = stats->rx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiUnicastPacketTxCount:
-                    count = stats->tx_packets;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiMulticastPacketRxCount:
-                    count = stats->multicast;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiMulticastPacketTxCount:
-                    count = 0;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                case WiFiStatsCountType::kWiFiOverrunCount:
-                    count = stats->rx_over_errors;
-                    err   = CHIP_NO_ERROR;
-                    break;
-                default:
-                    ChipLogError(DeviceLayer, "Unknown WiFi statistic metric type");
-                    break;
-                }
-            }
+        case WiFiStatsCountType::kWiFiUnicastPacketRxCount:
+            count = stats.rx_packets;
+            err   = CHIP_NO_ERROR;
+            break;
+        case WiFiStatsCountType::kWiFiUnicastPacketTxCount:
+            count = stats.tx_packets;
+            err   = CHIP_NO_ERROR;
+            break;
+        case WiFiStatsCountType::kWiFiMulticastPacketRxCount:
+            count = stats.multicast;
+            err   = CHIP_NO_ERROR;
+            break;
+        case WiFiStatsCountType::kWiFiMulticastPacketTxCount:
+            count = 0;
+            err   = CHIP_NO_ERROR;
+            break;
+        case WiFiStatsCountType::kWiFiOverrunCount:
+            count = stats.rx_over_errors;
+            err   = CHIP_NO_ERROR;
+            break;
+        default:
+            ChipLogError(DeviceLayer, "Unknown WiFi statistic metric type");
+            break;
         }
-
-        freeifaddrs(ifaddr);
     }
 
     return err;
@@ -434,73 +389,61 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetActiveNetworkFaults(GeneralFaults<kMax
 
 CHIP_ERROR DiagnosticDataProviderImpl::GetNetworkInterfaces(NetworkInterface ** netifpp)
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
+    NetworkInterface * head = nullptr;
 
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
+    ReturnErrorOnFailure(mNetworkCache.Update());
+
+    for (const NetworkDiagnosticsCache::Interface & interface : mNetworkCache.GetInterfaces())
     {
-        NetworkInterface * head = nullptr;
+        NetworkInterface * ifp = new NetworkInterface();
+
+        strncpy(ifp->Name, interface.mName, Inet::InterfaceId::kMaxIfNameLength);
+        ifp->Name[Inet::InterfaceId::kMaxIfNameLength - 1] = '\0';
+
+        ifp->name          = CharSpan::fromCharString(ifp->Name);
+        ifp->isOperational = interface.mFlags & IFF_RUNNING;
+        ifp->type          = interface.mType;
+        ifp->offPremiseServicesReachableIPv4.SetNull();
+        ifp->offPremiseServicesReachableIPv6.SetNull();
 
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (struct ifaddrs * ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
+        for (uint8_t i = 0; i < interface.mIPv4AddressCount; i++)
         {
-            if (ifa->ifa_addr && ifa->ifa_addr->sa_family == AF_PACKET)
-            {
-                uint8_t size           = 0;
-                NetworkInterface * ifp = new NetworkInterface();
-
-                strncpy(ifp->Name, ifa->ifa_name, Inet::InterfaceId::kMaxIfNameLength);
-                ifp->Name[Inet::InterfaceId::kMaxIfNameLength - 1] = '\0';
-
-                ifp->name          = CharSpan::fromCharString(ifp->Name);
-                ifp->isOperational = ifa->ifa_flags & IFF_RUNNING;
-                ifp->type          = ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name);
-                ifp->offPremiseServicesReachableIPv4.SetNull();
-                ifp->offPremiseServicesReachableIPv6.SetNull();
-
-                if (ConnectivityUtils::GetInterfaceIPv4Addrs(ifa->ifa_name, size, ifp) == CHIP_NO_ERROR)
-                {
-                    if (size > 0)
-                    {
-                        ifp->IPv4Addresses = DataModel::List<const chip::ByteSpan>(ifp->Ipv4AddressSpans, size);
-                    }
-                }
-
-                if (ConnectivityUtils::GetInterfaceIPv6Addrs(ifa->ifa_name, size, ifp) == CHIP_NO_ERROR)
-                {
-                    if (size > 0)
-                    {
-                        ifp->IPv6Addresses = DataModel::List<const chip::ByteSpan>(ifp->Ipv6AddressSpans, size);
-                    }
-                }
-
-                if (ConnectivityUtils::GetInterfaceHardwareAddrs(ifa->ifa_name, ifp->MacAddress, kMaxHardwareAddrSize) !=
-                    CHIP_NO_ERROR)
-                {
-                    ChipLogError(DeviceLayer, "Failed to get network hardware address");
-                }
-                else
-                {
-                    // Set 48-bit IEEE MAC Address
-                    ifp->hardwareAddress = ByteSpan(ifp->MacAddress, 6);
-                }
-
-                ifp->Next = head;
-                head      = ifp;
-            }
+            memcpy(ifp->Ipv4AddressesBuffer[i], interface.mIPv4Addresses[i], kMaxIPv4AddrSize);
+            ifp->Ipv4AddressSpans[i] = ByteSpan(ifp->Ipv4AddressesBuffer[i], kMaxIPv4AddrSize);
+        }
+        if (interface.mIPv4AddressCount > 0)
+        {
+            ifp->IPv4Addresses = DataModel::List<const chip::ByteSpan>(ifp->Ipv4AddressSpans, interface.mIPv4AddressCount);
         }
 
-        *netifpp = head;
-        err      = CHIP_NO_ERROR;
+        for (uint8_t i = 0; i < interface.mIPv6AddressCount; i++)
+        {
+            memcpy(ifp->Ipv6AddressesBuffer[i], interface.mIPv6Addresses[i], kMaxIPv6AddrSize);
+            ifp->Ipv6AddressSpans[i] = ByteSpan(ifp->Ipv6AddressesBuffer[i], kMaxIPv6AddrSize);
+        }
+        if (interface.mIPv6AddressCount > 0)
+        {
+            ifp->IPv6Addresses = DataModel::List<const chip::ByteSpan>(ifp->Ipv6AddressSpans, interface.mIPv6AddressCount);
+        }
 
-        freeifaddrs(ifaddr);
+        if (interface.mHardwareAddressLength < 6)
+        {
+            ChipLogError(DeviceLayer, "Failed to get network hardware address");
+        }
+        else
+        {
+            // Set 48-bit IEEE MAC Address
+            memcpy(ifp->MacAddress, interface.mHardwareAddress, 6);
+            ifp->hardwareAddress = ByteSpan(ifp->MacAddress, 6);
+        }
+
+        ifp->Next = head;
+        head      = ifp;
     }
 
-    return err;
+    *netifpp = head;
+
+    return CHIP_NO_ERROR;
 }
 
 void DiagnosticDataProviderImpl::ReleaseNetworkInterfaces(NetworkInterface * netifp)
@@ -542,7 +485,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthPacketRxCount(uint64_t & packetRxCo
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthPacketRxCount, count));
+    ReturnErrorOnFailure(GetEthernetStatsCount(mNetworkCache, EthernetStatsCountType::kEthPacketRxCount, count));
     VerifyOrReturnError(count >= mEthPacketRxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     packetRxCount = count - mEthPacketRxCount;
@@ -554,7 +497,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthPacketTxCount(uint64_t & packetTxCo
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthPacketTxCount, count));
+    ReturnErrorOnFailure(GetEthernetStatsCount(mNetworkCache, EthernetStatsCountType::kEthPacketTxCount, count));
     VerifyOrReturnError(count >= mEthPacketTxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     packetTxCount = count - mEthPacketTxCount;
@@ -566,7 +509,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthTxErrCount(uint64_t & txErrCount)
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthTxErrCount, count));
+    ReturnErrorOnFailure(GetEthernetStatsCount(mNetworkCache, EthernetStatsCountType::kEthTxErrCount, count));
     VerifyOrReturnError(count >= mEthTxErrCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     txErrCount = count - mEthTxErrCount;
@@ -578,7 +521,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthCollisionCount(uint64_t & collision
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthCollisionCount, count));
+    ReturnErrorOnFailure(GetEthernetStatsCount(mNetworkCache, EthernetStatsCountType::kEthCollisionCount, count));
     VerifyOrReturnError(count >= mEthCollisionCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     collisionCount = count - mEthCollisionCount;
@@ -590,7 +533,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthOverrunCount(uint64_t & overrunCoun
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetEthernetStatsCount(EthernetStatsCountType::kEthOverrunCount, count));
+    ReturnErrorOnFailure(GetEthernetStatsCount(mNetworkCache, EthernetStatsCountType::kEthOverrunCount, count));
     VerifyOrReturnError(count >= mEthOverrunCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     overrunCount = count - mEthOverrunCount;
@@ -600,46 +543,20 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetEthOverrunCount(uint64_t & overrunCoun
 
 CHIP_ERROR DiagnosticDataProviderImpl::ResetEthNetworkDiagnosticsCounts()
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
-
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
-
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceType::EMBER_ZCL_INTERFACE_TYPE_ETHERNET)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary Ethernet interface:%s", ifa->ifa_name);
-                break;
-            }
-        }
+    // The counts are reset to their current values, not to those of the last snapshot.
+    mNetworkCache.Invalidate();
+    ReturnErrorOnFailure(mNetworkCache.Update());
 
-        if (ifa != nullptr)
-        {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-
-                mEthPacketRxCount  = stats->rx_packets;
-                mEthPacketTxCount  = stats->tx_packets;
-                mEthTxErrCount     = stats->tx_errors;
-                mEthCollisionCount = stats->collisions;
-                mEthOverrunCount   = stats->rx_over_errors;
-                err                = CHIP_NO_ERROR;
-            }
-        }
+    const NetworkDiagnosticsCache::Interface * ifp = mNetworkCache.FindInterface(InterfaceType::EMBER_ZCL_INTERFACE_TYPE_ETHERNET);
+    VerifyOrReturnError(ifp != nullptr && ifp->mHasStats, CHIP_ERROR_READ_FAILED);
 
-        freeifaddrs(ifaddr);
-    }
+    mEthPacketRxCount  = ifp->mStats.rx_packets;
+    mEthPacketTxCount  = ifp->mStats.tx_packets;
+    mEthTxErrCount     = ifp->mStats.tx_errors;
+    mEthCollisionCount = ifp->mStats.collisions;
+    mEthOverrunCount   = ifp->mStats.rx_over_errors;
 
-    return err;
+    return CHIP_NO_ERROR;
 }
 
 #if CHIP_DEVICE_CONFIG_ENABLE_WIFI
@@ -693,7 +610,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketMulticastRxCount(uint32_t &
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiMulticastPacketRxCount, count));
+    ReturnErrorOnFailure(GetWiFiStatsCount(mNetworkCache, WiFiStatsCountType::kWiFiMulticastPacketRxCount, count));
     VerifyOrReturnError(count >= mPacketMulticastRxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketMulticastRxCount;
@@ -708,7 +625,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketMulticastTxCount(uint32_t &
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiMulticastPacketTxCount, count));
+    ReturnErrorOnFailure(GetWiFiStatsCount(mNetworkCache, WiFiStatsCountType::kWiFiMulticastPacketTxCount, count));
     VerifyOrReturnError(count >= mPacketMulticastTxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketMulticastTxCount;
@@ -723,7 +640,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketUnicastRxCount(uint32_t & pa
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiUnicastPacketRxCount, count));
+    ReturnErrorOnFailure(GetWiFiStatsCount(mNetworkCache, WiFiStatsCountType::kWiFiUnicastPacketRxCount, count));
     VerifyOrReturnError(count >= mPacketUnicastRxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketUnicastRxCount;
@@ -738,7 +655,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiPacketUnicastTxCount(uint32_t & pa
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiUnicastPacketTxCount, count));
+    ReturnErrorOnFailure(GetWiFiStatsCount(mNetworkCache, WiFiStatsCountType::kWiFiUnicastPacketTxCount, count));
     VerifyOrReturnError(count >= mPacketUnicastTxCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     count -= mPacketUnicastTxCount;
@@ -753,7 +670,7 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiOverrunCount(uint64_t & overrunCou
 {
     uint64_t count;
 
-    ReturnErrorOnFailure(GetWiFiStatsCount(WiFiStatsCountType::kWiFiOverrunCount, count));
+    ReturnErrorOnFailure(GetWiFiStatsCount(mNetworkCache, WiFiStatsCountType::kWiFiOverrunCount, count));
     VerifyOrReturnError(count >= mOverrunCount, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     overrunCount = count - mOverrunCount;
@@ -763,49 +680,22 @@ CHIP_ERROR DiagnosticDataProviderImpl::GetWiFiOverrunCount(uint64_t & overrunCou
 
 CHIP_ERROR DiagnosticDataProviderImpl::ResetWiFiNetworkDiagnosticsCounts()
 {
-    CHIP_ERROR err          = CHIP_ERROR_READ_FAILED;
-    struct ifaddrs * ifaddr = nullptr;
-
     ReturnErrorOnFailure(GetWiFiBeaconLostCount(mBeaconLostCount));
 
-    if (getifaddrs(&ifaddr) == -1)
-    {
-        ChipLogError(DeviceLayer, "Failed to get network interfaces");
-    }
-    else
-    {
-        struct ifaddrs * ifa = nullptr;
-
-        // Walk through linked list, maintaining head pointer so we can free list later.
-        for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
-        {
-            if (ConnectivityUtils::GetInterfaceConnectionType(ifa->ifa_name) == InterfaceType::EMBER_ZCL_INTERFACE_TYPE_WI_FI)
-            {
-                ChipLogProgress(DeviceLayer, "Found the primary WiFi interface:%s", ifa->ifa_name);
-                break;
-            }
-        }
+    // The counts are reset to their current values, not to those of the last snapshot.
+    mNetworkCache.Invalidate();
+    ReturnErrorOnFailure(mNetworkCache.Update());
 
-        if (ifa != nullptr)
-        {
-            if (ifa->ifa_addr->sa_family == AF_PACKET && ifa->ifa_data != nullptr)
-            {
-                struct rtnl_link_stats * stats = (struct rtnl_link_stats *) ifa->ifa_data;
-
-                mPacketMulticastRxCount = stats->multicast;
-                mPacketMulticastTxCount = 0;
-                mPacketUnicastRxCount   = stats->rx_packets;
-                mPacketUnicastTxCount   = stats->tx_packets;
-                mOverrunCount           = stats->rx_over_errors;
-
-                err = CHIP_NO_ERROR;
-            }
-        }
+    const NetworkDiagnosticsCache::Interface * ifp = mNetworkCache.FindInterface(InterfaceType::EMBER_ZCL_INTERFACE_TYPE_WI_FI);
+    VerifyOrReturnError(ifp != nullptr && ifp->mHasStats, CHIP_ERROR_READ_FAILED);
 
-        freeifaddrs(ifaddr);
-    }
+    mPacketMulticastRxCount = static_cast<uint32_t>(ifp->mStats.multicast);
+    mPacketMulticastTxCount = 0;
+    mPacketUnicastRxCount   = static_cast<uint32_t>(ifp->mStats.rx_packets);
+    mPacketUnicastTxCount   = static_cast<uint32_t>(ifp->mStats.tx_packets);
+    mOverrunCount           = ifp->mStats.rx_over_errors;
 
-    return err;
+    return CHIP_NO_ERROR;
 }
 #endif // CHIP_DEVICE_CONFIG_ENABLE_WIFI
 
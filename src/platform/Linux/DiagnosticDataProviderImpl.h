@@ -25,6 +25,7 @@
 #include <memory>
 
 #include <platform/DiagnosticDataProvider.h>
+#include <platform/Linux/NetworkDiagnosticsCache.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -89,6 +90,8 @@ public:
 #endif
 
 private:
+    Internal::NetworkDiagnosticsCache mNetworkCache;
+
     uint64_t mEthPacketRxCount  = 0;
     uint64_t mEthPacketTxCount  = 0;
     uint64_t mEthTxErrCount     = 0;
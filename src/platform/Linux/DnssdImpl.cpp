@@ -42,6 +42,9 @@ using std::chrono::steady_clock;
 
 namespace {
 
+// A cached browser that no browse asked for during this time is stopped.
+constexpr seconds kCachedBrowserIdleTimeout(600);
+
 AvahiProtocol ToAvahiProtocol(chip::Inet::IPAddressType addressType)
 {
 #if INET_CONFIG_ENABLE_IPV4
@@ -346,6 +349,7 @@ exit:
 
 void MdnsAvahi::Shutdown()
 {
+    ClearCache(CHIP_ERROR_CANCELLED);
     if (mGroup)
     {
         avahi_entry_group_free(mGroup);
@@ -403,6 +407,8 @@ void MdnsAvahi::HandleClientState(AvahiClient * client, AvahiClientState state)
         break;
     case AVAHI_CLIENT_FAILURE:
         ChipLogError(DeviceLayer, "Avahi client failure");
+        // The browsers stopped with the client.
+        ClearCache(CHIP_ERROR_INTERNAL);
         mErrorCallback(mAsyncReturnContext, CHIP_ERROR_INTERNAL);
         break;
     case AVAHI_CLIENT_S_COLLISION:
@@ -542,28 +548,139 @@ exit:
 CHIP_ERROR MdnsAvahi::Browse(const char * type, DnssdServiceProtocol protocol, chip::Inet::IPAddressType addressType,
                              chip::Inet::InterfaceId interface, DnssdBrowseCallback callback, void * context)
 {
-    AvahiServiceBrowser * browser;
-    BrowseContext * browseContext = chip::Platform::New<BrowseContext>();
-    AvahiIfIndex avahiInterface   = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
+    CachedBrowser * browser;
+    BrowseContext * browseContext;
+    AvahiIfIndex avahiInterface = static_cast<AvahiIfIndex>(interface.GetPlatformInterface());
+    std::string fullType        = GetFullType(type, protocol);
+    CHIP_ERROR error            = CHIP_NO_ERROR;
+
+    if (!interface.IsPresent())
+    {
+        avahiInterface = AVAHI_IF_UNSPEC;
+    }
 
+    FreeIdleCachedBrowsers();
+
+    browseContext = chip::Platform::New<BrowseContext>();
+    VerifyOrReturnError(browseContext != nullptr, CHIP_ERROR_NO_MEMORY);
     browseContext->mInstance    = this;
     browseContext->mContext     = context;
     browseContext->mCallback    = callback;
     browseContext->mAddressType = addressType;
-    if (!interface.IsPresent())
+
+    browser = FindCachedBrowser(fullType, avahiInterface);
+    if (browser == nullptr)
     {
-        avahiInterface = AVAHI_IF_UNSPEC;
+        auto newBrowser        = std::make_unique<CachedBrowser>();
+        newBrowser->mInstance  = this;
+        newBrowser->mFullType  = fullType;
+        newBrowser->mInterface = avahiInterface;
+        newBrowser->mBrowser   = avahi_service_browser_new(mClient, avahiInterface, AVAHI_PROTO_UNSPEC, fullType.c_str(), nullptr,
+                                                         static_cast<AvahiLookupFlags>(0), HandleBrowse, newBrowser.get());
+        if (newBrowser->mBrowser == nullptr)
+        {
+            chip::Platform::Delete(browseContext);
+            return CHIP_ERROR_INTERNAL;
+        }
+        browser = newBrowser.get();
+        mBrowsers.push_back(std::move(newBrowser));
     }
+    browser->mLastUsed = steady_clock::now();
 
-    browser = avahi_service_browser_new(mClient, avahiInterface, AVAHI_PROTO_UNSPEC, GetFullType(type, protocol).c_str(), nullptr,
-                                        static_cast<AvahiLookupFlags>(0), HandleBrowse, browseContext);
-    // Otherwise the browser will be freed in the callback
-    if (browser == nullptr)
+    if (!browser->mAllForNow)
+    {
+        // Answered from HandleBrowse once the browser has reported what it found.
+        browser->mPendingBrowses.push_back(browseContext);
+        return CHIP_NO_ERROR;
+    }
+
+    // The browser keeps its services up to date, answer from them as if the browse went to the network.
+    browseContext->mServices = browser->mServices;
+    for (auto & service : browseContext->mServices)
+    {
+        service.mAddressType = addressType;
+    }
+    error = DeviceLayer::SystemLayer().ScheduleWork(DeliverCachedBrowse, browseContext);
+    if (error != CHIP_NO_ERROR)
     {
         chip::Platform::Delete(browseContext);
     }
 
-    return browser == nullptr ? CHIP_ERROR_INTERNAL : CHIP_NO_ERROR;
+    return error;
+}
+
+MdnsAvahi::CachedBrowser * MdnsAvahi::FindCachedBrowser(const std::string & fullType, AvahiIfIndex interface)
+{
+    for (auto & browser : mBrowsers)
+    {
+        if (browser->mInterface == interface && browser->mFullType == fullType)
+        {
+            return browser.get();
+        }
+    }
+    return nullptr;
+}
+
+void MdnsAvahi::FreeCachedBrowser(CachedBrowser * browser, CHIP_ERROR error)
+{
+    std::vector<BrowseContext *> pendingBrowses;
+
+    pendingBrowses.swap(browser->mPendingBrowses);
+    avahi_service_browser_free(browser->mBrowser);
+    mBrowsers.erase(std::remove_if(mBrowsers.begin(), mBrowsers.end(),
+                                   [browser](const std::unique_ptr<CachedBrowser> & aValue) { return aValue.get() == browser; }),
+                    mBrowsers.end());
+
+    for (BrowseContext * context : pendingBrowses)
+    {
+        context->mCallback(context->mContext, nullptr, 0, true, error);
+        chip::Platform::Delete(context);
+    }
+}
+
+void MdnsAvahi::FreeIdleCachedBrowsers()
+{
+    steady_clock::time_point now = steady_clock::now();
+    std::vector<CachedBrowser *> idleBrowsers;
+
+    for (auto & browser : mBrowsers)
+    {
+        if (browser->mPendingBrowses.empty() && now - browser->mLastUsed > kCachedBrowserIdleTimeout)
+        {
+            idleBrowsers.push_back(browser.get());
+        }
+    }
+    for (CachedBrowser * browser : idleBrowsers)
+    {
+        FreeCachedBrowser(browser, CHIP_NO_ERROR);
+    }
+}
+
+void MdnsAvahi::DeliverCachedBrowse(System::Layer * layer, void * context)
+{
+    BrowseContext * browseContext = static_cast<BrowseContext *>(context);
+
+    browseContext->mCallback(browseContext->mContext, browseContext->mServices.data(), browseContext->mServices.size(), true,
+                             CHIP_NO_ERROR);
+    chip::Platform::Delete(browseContext);
+}
+
+void MdnsAvahi::DeliverCachedResolve(System::Layer * layer, void * context)
+{
+    CachedResolveDelivery * delivery = static_cast<CachedResolveDelivery *>(context);
+
+    delivery->mResult.Deliver(delivery->mCallback, delivery->mContext);
+    chip::Platform::Delete(delivery);
+}
+
+void MdnsAvahi::ClearCache(CHIP_ERROR error)
+{
+    // Pending browses are answered with the error, so that their callers release what they hold for them.
+    while (!mBrowsers.empty())
+    {
+        FreeCachedBrowser(mBrowsers.front().get(), error);
+    }
+    mResolves.Clear();
 }
 
 DnssdServiceProtocol GetProtocolInType(const char * type)
@@ -611,14 +728,12 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
                              const char * name, const char * type, const char * domain, AvahiLookupResultFlags /*flags*/,
                              void * userdata)
 {
-    BrowseContext * context = static_cast<BrowseContext *>(userdata);
+    CachedBrowser * cachedBrowser = static_cast<CachedBrowser *>(userdata);
 
     switch (event)
     {
     case AVAHI_BROWSER_FAILURE:
-        context->mCallback(context->mContext, nullptr, 0, true, CHIP_ERROR_INTERNAL);
-        avahi_service_browser_free(browser);
-        chip::Platform::Delete(context);
+        cachedBrowser->mInstance->FreeCachedBrowser(cachedBrowser, CHIP_ERROR_INTERNAL);
         break;
     case AVAHI_BROWSER_NEW:
         ChipLogProgress(DeviceLayer, "Avahi browse: cache new");
@@ -629,7 +744,7 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
             Platform::CopyString(service.mName, name);
             CopyTypeWithoutProtocol(service.mType, type);
             service.mProtocol      = GetProtocolInType(type);
-            service.mAddressType   = context->mAddressType;
+            service.mAddressType   = Inet::IPAddressType::kAny; // Set per browse when delivered.
             service.mTransportType = ToAddressType(protocol);
             service.mInterface     = Inet::InterfaceId::Null();
             if (interface != AVAHI_IF_UNSPEC)
@@ -637,23 +752,40 @@ void MdnsAvahi::HandleBrowse(AvahiServiceBrowser * browser, AvahiIfIndex interfa
                 service.mInterface = static_cast<chip::Inet::InterfaceId>(interface);
             }
             service.mType[kDnssdTypeMaxSize] = 0;
-            context->mServices.push_back(service);
+            cachedBrowser->mServices.push_back(service);
         }
         break;
-    case AVAHI_BROWSER_ALL_FOR_NOW:
+    case AVAHI_BROWSER_ALL_FOR_NOW: {
         ChipLogProgress(DeviceLayer, "Avahi browse: all for now");
-        context->mCallback(context->mContext, context->mServices.data(), context->mServices.size(), true, CHIP_NO_ERROR);
-        avahi_service_browser_free(browser);
-        chip::Platform::Delete(context);
+        std::vector<BrowseContext *> pendingBrowses;
+
+        // The browser keeps running to track the services for later browses.
+        cachedBrowser->mAllForNow = true;
+        pendingBrowses.swap(cachedBrowser->mPendingBrowses);
+        for (BrowseContext * context : pendingBrowses)
+        {
+            context->mServices = cachedBrowser->mServices;
+            for (auto & service : context->mServices)
+            {
+                service.mAddressType = context->mAddressType;
+            }
+            context->mCallback(context->mContext, context->mServices.data(), context->mServices.size(), true, CHIP_NO_ERROR);
+            chip::Platform::Delete(context);
+        }
         break;
+    }
     case AVAHI_BROWSER_REMOVE:
         ChipLogProgress(DeviceLayer, "Avahi browse: remove");
         if (strcmp("local", domain) == 0)
         {
-            context->mServices.erase(
-                std::remove_if(context->mServices.begin(), context->mServices.end(), [name, type](const DnssdService & service) {
-                    return strcmp(name, service.mName) == 0 && type == GetFullType(service.mType, service.mProtocol);
-                }));
+            auto & services = cachedBrowser->mServices;
+            services.erase(std::remove_if(services.begin(), services.end(),
+                                          [name, type](const DnssdService & service) {
+                                              return strcmp(name, service.mName) == 0 &&
+                                                  type == GetFullType(service.mType, service.mProtocol);
+                                          }),
+                           services.end());
+            cachedBrowser->mInstance->mResolves.Remove(name, type);
         }
         break;
     case AVAHI_BROWSER_CACHE_EXHAUSTED:
@@ -671,6 +803,7 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdService
     ResolveContext * resolveContext = chip::Platform::New<ResolveContext>();
     CHIP_ERROR error                = CHIP_NO_ERROR;
 
+    VerifyOrReturnError(resolveContext != nullptr, CHIP_ERROR_NO_MEMORY);
     resolveContext->mInstance = this;
     resolveContext->mCallback = callback;
     resolveContext->mContext  = context;
@@ -686,6 +819,24 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdService
     resolveContext->mAddressType = ToAvahiProtocol(addressType);
     resolveContext->mFullType    = GetFullType(type, protocol);
 
+    const ResolveResult * cached = mResolves.Find(resolveContext->GetCacheKey(), steady_clock::now());
+    if (cached != nullptr)
+    {
+        CachedResolveDelivery * delivery = chip::Platform::New<CachedResolveDelivery>();
+
+        chip::Platform::Delete(resolveContext);
+        VerifyOrReturnError(delivery != nullptr, CHIP_ERROR_NO_MEMORY);
+        delivery->mCallback = callback;
+        delivery->mContext  = context;
+        delivery->mResult   = *cached;
+        error               = DeviceLayer::SystemLayer().ScheduleWork(DeliverCachedResolve, delivery);
+        if (error != CHIP_NO_ERROR)
+        {
+            chip::Platform::Delete(delivery);
+        }
+        return error;
+    }
+
     resolver = avahi_service_resolver_new(mClient, avahiInterface, resolveContext->mTransport, name,
                                           resolveContext->mFullType.c_str(), nullptr, resolveContext->mAddressType,
                                           static_cast<AvahiLookupFlags>(0), HandleResolve, resolveContext);
@@ -699,13 +850,17 @@ CHIP_ERROR MdnsAvahi::Resolve(const char * name, const char * type, DnssdService
     return error;
 }
 
+void MdnsAvahi::ResolveNoLongerValid(const char * name, const char * type, DnssdServiceProtocol protocol)
+{
+    mResolves.Remove(name, GetFullType(type, protocol).c_str());
+}
+
 void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex interface, AvahiProtocol protocol,
                               AvahiResolverEvent event, const char * name, const char * type, const char * /*domain*/,
                               const char * host_name, const AvahiAddress * address, uint16_t port, AvahiStringList * txt,
                               AvahiLookupResultFlags flags, void * userdata)
 {
     ResolveContext * context = reinterpret_cast<ResolveContext *>(userdata);
-    std::vector<TextEntry> textEntries;
 
     switch (event)
     {
@@ -729,7 +884,8 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
         context->mCallback(context->mContext, nullptr, Span<Inet::IPAddress>(), CHIP_ERROR_INTERNAL);
         break;
     case AVAHI_RESOLVER_FOUND:
-        DnssdService result = {};
+        ResolveResult resolveResult;
+        DnssdService & result = resolveResult.mService;
 
         ChipLogError(DeviceLayer, "Avahi resolve found");
 
@@ -754,7 +910,7 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
         }
 
         CHIP_ERROR result_err = CHIP_ERROR_INVALID_ADDRESS;
-        chip::Inet::IPAddress ipAddress; // Will be set of result_err is set to CHIP_NO_ERROR
+        chip::Inet::IPAddress & ipAddress = resolveResult.mAddress; // Will be set of result_err is set to CHIP_NO_ERROR
         if (address)
         {
             switch (address->proto)
@@ -788,23 +944,18 @@ void MdnsAvahi::HandleResolve(AvahiServiceResolver * resolver, AvahiIfIndex inte
             {
                 if (txt->text[i] == '=')
                 {
-                    txt->text[i] = '\0';
-                    textEntries.push_back(TextEntry{ reinterpret_cast<char *>(txt->text), &txt->text[i + 1], txt->size - i - 1 });
+                    resolveResult.mTextKeys.emplace_back(reinterpret_cast<char *>(txt->text), i);
+                    resolveResult.mTextValues.emplace_back(txt->text + i + 1, txt->text + txt->size);
                     break;
                 }
             }
             txt = txt->next;
         }
 
-        if (!textEntries.empty())
-        {
-            result.mTextEntries = textEntries.data();
-        }
-        result.mTextEntrySize = textEntries.size();
-
         if (result_err == CHIP_NO_ERROR)
         {
-            context->mCallback(context->mContext, &result, Span<Inet::IPAddress>(&ipAddress, 1), CHIP_NO_ERROR);
+            context->mInstance->mResolves.Add(context->GetCacheKey(), resolveResult, steady_clock::now());
+            resolveResult.Deliver(context->mCallback, context->mContext);
         }
         else
         {
@@ -865,5 +1016,13 @@ CHIP_ERROR ChipDnssdResolve(DnssdService * browseResult, chip::Inet::InterfaceId
                                             browseResult->mAddressType, Inet::IPAddressType::kAny, interface, callback, context);
 }
 
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * service)
+{
+    VerifyOrReturnError(service != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    MdnsAvahi::GetInstance().ResolveNoLongerValid(service->mName, service->mType, service->mProtocol);
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Dnssd
 } // namespace chip
@@ -34,6 +34,7 @@
 #include <avahi-common/error.h>
 #include <avahi-common/watch.h>
 
+#include "DnssdResolveCache.h"
 #include "lib/dnssd/platform/Dnssd.h"
 
 struct AvahiWatch
@@ -114,6 +115,7 @@ public:
     CHIP_ERROR Resolve(const char * name, const char * type, DnssdServiceProtocol protocol, chip::Inet::IPAddressType addressType,
                        chip::Inet::IPAddressType transportType, chip::Inet::InterfaceId interface, DnssdResolveCallback callback,
                        void * context);
+    void ResolveNoLongerValid(const char * name, const char * type, DnssdServiceProtocol protocol);
 
     Poller & GetPoller() { return mPoller; }
 
@@ -140,6 +142,32 @@ private:
         AvahiProtocol mAddressType;
         std::string mFullType;
         uint8_t mAttempts = 0;
+
+        ResolveCache::Key GetCacheKey() const
+        {
+            return ResolveCache::Key{ mName, mFullType, mInterface, mTransport, mAddressType };
+        }
+    };
+
+    /// A browser kept running after the browse that started it, so that the services it
+    /// tracks answer later browses of the same type without going to the network.
+    struct CachedBrowser
+    {
+        MdnsAvahi * mInstance;
+        AvahiServiceBrowser * mBrowser = nullptr;
+        std::string mFullType;
+        AvahiIfIndex mInterface;
+        bool mAllForNow = false; ///< Whether the services found by the initial browse were all reported.
+        std::vector<DnssdService> mServices;
+        std::vector<BrowseContext *> mPendingBrowses; ///< Browses waiting for mAllForNow.
+        std::chrono::steady_clock::time_point mLastUsed;
+    };
+
+    struct CachedResolveDelivery
+    {
+        DnssdResolveCallback mCallback;
+        void * mContext;
+        ResolveResult mResult;
     };
 
     MdnsAvahi() : mClient(nullptr), mGroup(nullptr) {}
@@ -159,11 +187,22 @@ private:
                               const char * host_name, const AvahiAddress * address, uint16_t port, AvahiStringList * txt,
                               AvahiLookupResultFlags flags, void * userdata);
 
+    CachedBrowser * FindCachedBrowser(const std::string & fullType, AvahiIfIndex interface);
+    void FreeCachedBrowser(CachedBrowser * browser, CHIP_ERROR error);
+    void FreeIdleCachedBrowsers();
+    static void DeliverCachedBrowse(System::Layer * layer, void * context);
+
+    static void DeliverCachedResolve(System::Layer * layer, void * context);
+
+    void ClearCache(CHIP_ERROR error);
+
     DnssdAsyncReturnCallback mInitCallback;
     DnssdAsyncReturnCallback mErrorCallback;
     void * mAsyncReturnContext;
 
     std::set<std::string> mPublishedServices;
+    std::vector<std::unique_ptr<CachedBrowser>> mBrowsers;
+    ResolveCache mResolves;
     AvahiClient * mClient;
     AvahiEntryGroup * mGroup;
     Poller mPoller;
@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "DnssdResolveCache.h"
+
+#include <algorithm>
+
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+namespace chip {
+namespace Dnssd {
+
+void ResolveResult::Deliver(DnssdResolveCallback callback, void * context) const
+{
+    std::vector<TextEntry> textEntries;
+    DnssdService service    = mService;
+    Inet::IPAddress address = mAddress;
+
+    for (size_t i = 0; i < mTextKeys.size(); i++)
+    {
+        textEntries.push_back(TextEntry{ mTextKeys[i].c_str(), mTextValues[i].data(), mTextValues[i].size() });
+    }
+    service.mTextEntries   = textEntries.empty() ? nullptr : textEntries.data();
+    service.mTextEntrySize = textEntries.size();
+
+    callback(context, &service, Span<Inet::IPAddress>(&address, 1), CHIP_NO_ERROR);
+}
+
+const ResolveResult * ResolveCache::Find(const Key & key, steady_clock::time_point now)
+{
+    mEntries.erase(
+        std::remove_if(mEntries.begin(), mEntries.end(), [now](const Entry & entry) { return entry.mExpiry <= now; }),
+        mEntries.end());
+
+    for (const auto & entry : mEntries)
+    {
+        if (entry.mKey == key)
+        {
+            return &entry.mResult;
+        }
+    }
+    return nullptr;
+}
+
+void ResolveCache::Add(const Key & key, const ResolveResult & result, steady_clock::time_point now)
+{
+    if (Find(key, now) != nullptr)
+    {
+        // Already cached by a concurrent resolve of the same service.
+        return;
+    }
+
+    if (mEntries.size() >= kMaxEntries)
+    {
+        mEntries.erase(std::min_element(mEntries.begin(), mEntries.end(),
+                                        [](const Entry & a, const Entry & b) { return a.mExpiry < b.mExpiry; }));
+    }
+
+    mEntries.push_back(Entry{ key, result, now + seconds(result.mService.mTtlSeconds) });
+}
+
+void ResolveCache::Remove(const char * name, const char * fullType)
+{
+    mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(),
+                                  [name, fullType](const Entry & entry) {
+                                      return entry.mKey.mName == name && entry.mKey.mFullType == fullType;
+                                  }),
+                   mEntries.end());
+}
+
+} // namespace Dnssd
+} // namespace chip
@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Cache of the services resolved through Avahi, answering repeated
+ *          resolves of a service without a round trip to the daemon.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <inet/IPAddress.h>
+#include <lib/dnssd/platform/Dnssd.h>
+
+namespace chip {
+namespace Dnssd {
+
+/// A resolve result, owning the strings the DnssdService points to.
+struct ResolveResult
+{
+    DnssdService mService = {};
+    Inet::IPAddress mAddress;
+    std::vector<std::string> mTextKeys;
+    std::vector<std::vector<uint8_t>> mTextValues;
+
+    void Deliver(DnssdResolveCallback callback, void * context) const;
+};
+
+/**
+ * Keeps resolve results for the TTL of their service, at most kMaxEntries of them.
+ *
+ * Avahi does not report the TTL of the records it resolved, so the TTL is the one the
+ * result was added with.  A result is removed earlier when its service goes away, or when
+ * the address it gave did not work: the next resolve of the service then goes to Avahi.
+ */
+class ResolveCache
+{
+public:
+    /// What a resolve was asked for.  The interface and protocols are the Avahi values.
+    struct Key
+    {
+        std::string mName;
+        std::string mFullType;
+        int mInterface;
+        int mTransport;
+        int mAddressType;
+
+        bool operator==(const Key & other) const
+        {
+            return mInterface == other.mInterface && mTransport == other.mTransport && mAddressType == other.mAddressType &&
+                mName == other.mName && mFullType == other.mFullType;
+        }
+    };
+
+    static constexpr size_t kMaxEntries = 32;
+
+    /// Returns the result cached for the key, or nullptr.  Expired results are dropped.
+    const ResolveResult * Find(const Key & key, std::chrono::steady_clock::time_point now);
+
+    /// Caches the result until its TTL elapsed, replacing the result closest to expiry when full.
+    void Add(const Key & key, const ResolveResult & result, std::chrono::steady_clock::time_point now);
+
+    /// Removes the results for the service, whatever interface and protocols they were resolved with.
+    void Remove(const char * name, const char * fullType);
+
+    void Clear() { mEntries.clear(); }
+    size_t Size() const { return mEntries.size(); }
+
+private:
+    struct Entry
+    {
+        Key mKey;
+        ResolveResult mResult;
+        std::chrono::steady_clock::time_point mExpiry;
+    };
+
+    std::vector<Entry> mEntries;
+};
+
+} // namespace Dnssd
+} // namespace chip
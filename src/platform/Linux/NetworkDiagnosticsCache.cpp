@@ -0,0 +1,367 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Implementation of the snapshot of the network interfaces serving the
+ *          diagnostics clusters on Linux platforms.
+ */
+
+#include <platform/Linux/NetworkDiagnosticsCache.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/ConnectivityUtils.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+using namespace ::chip::app::Clusters::GeneralDiagnostics;
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+NetworkDiagnosticsCache::Interface * FindInterfaceByIndex(std::vector<NetworkDiagnosticsCache::Interface> & interfaces, int index)
+{
+    for (auto & interface : interfaces)
+    {
+        if (interface.mIndex == index)
+        {
+            return &interface;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+CHIP_ERROR NetworkDiagnosticsCache::Update()
+{
+    if (mEventSocket < 0)
+    {
+        ReturnErrorOnFailure(Open());
+    }
+
+    DrainEvents();
+
+    if (!mStale &&
+        System::SystemClock().GetMonotonicTimestamp() - mRefreshTime <
+            System::Clock::Milliseconds32(CHIP_DEVICE_CONFIG_NETWORK_DIAGNOSTICS_MAX_AGE_MS))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    return Refresh();
+}
+
+const NetworkDiagnosticsCache::Interface * NetworkDiagnosticsCache::FindInterface(InterfaceType type) const
+{
+    for (const auto & interface : mInterfaces)
+    {
+        if (interface.mType == type)
+        {
+            return &interface;
+        }
+    }
+    return nullptr;
+}
+
+void NetworkDiagnosticsCache::Close()
+{
+    if (mEventSocket >= 0)
+    {
+        close(mEventSocket);
+        mEventSocket = -1;
+    }
+
+    if (mRequestSocket >= 0)
+    {
+        close(mRequestSocket);
+        mRequestSocket = -1;
+    }
+
+    mInterfaces.clear();
+    mStale = true;
+}
+
+CHIP_ERROR NetworkDiagnosticsCache::Open()
+{
+    CHIP_ERROR err          = CHIP_NO_ERROR;
+    struct sockaddr_nl addr = {};
+
+    mEventSocket = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_ROUTE);
+    VerifyOrExit(mEventSocket >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+    VerifyOrExit(bind(mEventSocket, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    mRequestSocket = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    VerifyOrExit(mRequestSocket >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    // Everything before the subscription is unknown.
+    mStale = true;
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to open rtnetlink sockets: %" CHIP_ERROR_FORMAT, err.Format());
+        Close();
+    }
+    return err;
+}
+
+void NetworkDiagnosticsCache::DrainEvents()
+{
+    // The content of the notifications does not matter: any of them invalidates the snapshot, so they are
+    // discarded without being copied.  MSG_TRUNC makes recv return their actual length rather than 0.
+    while (true)
+    {
+        ssize_t len = recv(mEventSocket, nullptr, 0, MSG_DONTWAIT | MSG_TRUNC);
+        if (len > 0 || (len < 0 && errno == ENOBUFS))
+        {
+            // ENOBUFS means notifications were dropped, which has to be treated like a notification too.
+            mStale = true;
+        }
+        else if (len < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+CHIP_ERROR NetworkDiagnosticsCache::Refresh()
+{
+    std::vector<Interface> interfaces;
+
+    ReturnErrorOnFailure(Dump(RTM_GETLINK, interfaces));
+    ReturnErrorOnFailure(Dump(RTM_GETADDR, interfaces));
+
+    // The type of a link does not change, so only the links new to the snapshot need the ioctls telling it.
+    for (auto & interface : interfaces)
+    {
+        Interface * previous = FindInterfaceByIndex(mInterfaces, interface.mIndex);
+        if (previous != nullptr && strcmp(previous->mName, interface.mName) == 0)
+        {
+            interface.mType = previous->mType;
+        }
+        else
+        {
+            interface.mType = ConnectivityUtils::GetInterfaceConnectionType(interface.mName);
+        }
+    }
+
+    mInterfaces.swap(interfaces);
+    mRefreshTime = System::SystemClock().GetMonotonicTimestamp();
+    mStale       = false;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR NetworkDiagnosticsCache::Dump(uint16_t type, std::vector<Interface> & interfaces)
+{
+    struct
+    {
+        struct nlmsghdr header;
+        struct rtgenmsg message;
+    } request = {};
+
+    request.header.nlmsg_len     = NLMSG_LENGTH(sizeof(request.message));
+    request.header.nlmsg_type    = type;
+    request.header.nlmsg_flags   = NLM_F_REQUEST | NLM_F_DUMP;
+    request.header.nlmsg_seq     = ++mSequence;
+    request.message.rtgen_family = AF_UNSPEC;
+
+    VerifyOrReturnError(send(mRequestSocket, &request, request.header.nlmsg_len, 0) >= 0, CHIP_ERROR_POSIX(errno));
+
+    while (true)
+    {
+        // Peek at the length of the next message first: the kernel may batch a dump into messages larger than the
+        // buffer, and the part of a message which does not fit in it would be silently lost.
+        ssize_t len = recv(mRequestSocket, nullptr, 0, MSG_PEEK | MSG_TRUNC);
+        if (len < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(len >= 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(len > 0, CHIP_ERROR_READ_FAILED);
+
+        if (mBuffer.size() < static_cast<size_t>(len))
+        {
+            mBuffer.resize(std::max(static_cast<size_t>(len), kReceiveBufferSize));
+        }
+
+        struct iovec segment  = { mBuffer.data(), mBuffer.size() };
+        struct msghdr message = {};
+        message.msg_iov       = &segment;
+        message.msg_iovlen    = 1;
+
+        do
+        {
+            len = recvmsg(mRequestSocket, &message, 0);
+        } while (len < 0 && errno == EINTR);
+        VerifyOrReturnError(len >= 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(len > 0 && (message.msg_flags & MSG_TRUNC) == 0, CHIP_ERROR_READ_FAILED);
+
+        uint32_t remaining      = static_cast<uint32_t>(len);
+        struct nlmsghdr * first = reinterpret_cast<struct nlmsghdr *>(mBuffer.data());
+        for (struct nlmsghdr * header = first; NLMSG_OK(header, remaining); header = NLMSG_NEXT(header, remaining))
+        {
+            if (header->nlmsg_seq != mSequence)
+            {
+                // Left over from a dump that failed.
+                continue;
+            }
+
+            switch (header->nlmsg_type)
+            {
+            case NLMSG_DONE:
+                return CHIP_NO_ERROR;
+            case NLMSG_ERROR: {
+                const struct nlmsgerr * error = reinterpret_cast<const struct nlmsgerr *>(NLMSG_DATA(header));
+                return error->error != 0 ? CHIP_ERROR_POSIX(-error->error) : CHIP_ERROR_READ_FAILED;
+            }
+            case RTM_NEWLINK:
+                ParseLink(header, interfaces);
+                break;
+            case RTM_NEWADDR:
+                ParseAddress(header, interfaces);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
+
+void NetworkDiagnosticsCache::ParseLink(const struct nlmsghdr * header, std::vector<Interface> & interfaces)
+{
+    const struct ifinfomsg * message = reinterpret_cast<const struct ifinfomsg *>(NLMSG_DATA(header));
+    bool hasStats64                  = false;
+    Interface interface;
+
+    memset(&interface, 0, sizeof(interface));
+    interface.mIndex = message->ifi_index;
+    interface.mFlags = message->ifi_flags;
+
+    uint32_t remaining               = IFLA_PAYLOAD(header);
+    const struct rtattr * attributes = IFLA_RTA(message);
+    for (const struct rtattr * attribute = attributes; RTA_OK(attribute, remaining); attribute = RTA_NEXT(attribute, remaining))
+    {
+        const void * data = RTA_DATA(attribute);
+        size_t size       = RTA_PAYLOAD(attribute);
+
+        switch (attribute->rta_type)
+        {
+        case IFLA_IFNAME:
+            strncpy(interface.mName, static_cast<const char *>(data), std::min(size, sizeof(interface.mName) - 1));
+            break;
+        case IFLA_ADDRESS:
+            interface.mHardwareAddressLength = static_cast<uint8_t>(std::min(size, sizeof(interface.mHardwareAddress)));
+            memcpy(interface.mHardwareAddress, data, interface.mHardwareAddressLength);
+            break;
+        case IFLA_STATS64:
+            if (size >= sizeof(interface.mStats))
+            {
+                memcpy(&interface.mStats, data, sizeof(interface.mStats));
+                interface.mHasStats = true;
+                hasStats64          = true;
+            }
+            break;
+        case IFLA_STATS:
+            // Only for the kernels without 64-bit statistics.
+            if (!hasStats64 && size >= sizeof(struct rtnl_link_stats))
+            {
+                const struct rtnl_link_stats * stats = static_cast<const struct rtnl_link_stats *>(data);
+
+                interface.mStats.rx_packets     = stats->rx_packets;
+                interface.mStats.tx_packets     = stats->tx_packets;
+                interface.mStats.tx_errors      = stats->tx_errors;
+                interface.mStats.multicast      = stats->multicast;
+                interface.mStats.collisions     = stats->collisions;
+                interface.mStats.rx_over_errors = stats->rx_over_errors;
+                interface.mHasStats             = true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    VerifyOrReturn(interface.mName[0] != '\0');
+    interfaces.push_back(interface);
+}
+
+void NetworkDiagnosticsCache::ParseAddress(const struct nlmsghdr * header, std::vector<Interface> & interfaces)
+{
+    const struct ifaddrmsg * message = reinterpret_cast<const struct ifaddrmsg *>(NLMSG_DATA(header));
+    const struct rtattr * address    = nullptr;
+    const struct rtattr * local      = nullptr;
+
+    Interface * interface = FindInterfaceByIndex(interfaces, static_cast<int>(message->ifa_index));
+    VerifyOrReturn(interface != nullptr);
+
+    uint32_t remaining               = IFA_PAYLOAD(header);
+    const struct rtattr * attributes = IFA_RTA(message);
+    for (const struct rtattr * attribute = attributes; RTA_OK(attribute, remaining); attribute = RTA_NEXT(attribute, remaining))
+    {
+        if (attribute->rta_type == IFA_ADDRESS)
+        {
+            address = attribute;
+        }
+        else if (attribute->rta_type == IFA_LOCAL)
+        {
+            local = attribute;
+        }
+    }
+
+    // Like getifaddrs, prefer the local address, which differs from IFA_ADDRESS on point-to-point links.
+    if (local != nullptr)
+    {
+        address = local;
+    }
+    VerifyOrReturn(address != nullptr);
+
+    if (message->ifa_family == AF_INET && RTA_PAYLOAD(address) >= kMaxIPv4AddrSize &&
+        interface->mIPv4AddressCount < kMaxIPv4AddrCount)
+    {
+        memcpy(interface->mIPv4Addresses[interface->mIPv4AddressCount++], RTA_DATA(address), kMaxIPv4AddrSize);
+    }
+    else if (message->ifa_family == AF_INET6 && RTA_PAYLOAD(address) >= kMaxIPv6AddrSize &&
+             interface->mIPv6AddressCount < kMaxIPv6AddrCount)
+    {
+        memcpy(interface->mIPv6Addresses[interface->mIPv6AddressCount++], RTA_DATA(address), kMaxIPv6AddrSize);
+    }
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
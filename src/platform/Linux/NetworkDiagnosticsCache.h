@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Snapshot of the network interfaces of the system, taken over rtnetlink,
+ *          from which the diagnostics clusters are served on Linux platforms.
+ */
+
+#pragma once
+
+#include <platform/DiagnosticDataProvider.h>
+#include <platform/internal/CHIPDeviceLayerInternal.h>
+#include <system/SystemClock.h>
+
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <net/if.h>
+
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ * Keeps the links of the system, their addresses and statistics, as dumped over rtnetlink.
+ *
+ * The snapshot is refreshed lazily by Update(): when a link or address change was notified on the rtnetlink
+ * socket it subscribes to, or when it is older than CHIP_DEVICE_CONFIG_NETWORK_DIAGNOSTICS_MAX_AGE_MS.  Otherwise
+ * reading it costs a single non-blocking receive, rather than the getifaddrs and ioctl calls each attribute read
+ * used to make.
+ *
+ * Not thread-safe; it is used with the CHIP stack lock held.
+ */
+class NetworkDiagnosticsCache
+{
+public:
+    struct Interface
+    {
+        char mName[IFNAMSIZ];
+        int mIndex;
+        unsigned mFlags;
+        app::Clusters::GeneralDiagnostics::InterfaceType mType;
+        uint8_t mHardwareAddress[kMaxHardwareAddrSize];
+        uint8_t mHardwareAddressLength;
+        uint8_t mIPv4AddressCount;
+        uint8_t mIPv6AddressCount;
+        bool mHasStats;
+        struct rtnl_link_stats64 mStats;
+        uint8_t mIPv4Addresses[kMaxIPv4AddrCount][kMaxIPv4AddrSize];
+        uint8_t mIPv6Addresses[kMaxIPv6AddrCount][kMaxIPv6AddrSize];
+    };
+
+    NetworkDiagnosticsCache() = default;
+    ~NetworkDiagnosticsCache() { Close(); }
+
+    NetworkDiagnosticsCache(const NetworkDiagnosticsCache &) = delete;
+    NetworkDiagnosticsCache & operator=(const NetworkDiagnosticsCache &) = delete;
+
+    /**
+     * Refresh the snapshot if it is out of date.  The previous snapshot is kept if the refresh fails.
+     */
+    CHIP_ERROR Update();
+
+    /**
+     * Make the next Update() refresh the snapshot, for instance to take the baseline of counts being reset.
+     */
+    void Invalidate() { mStale = true; }
+
+    const std::vector<Interface> & GetInterfaces() const { return mInterfaces; }
+
+    /**
+     * @return The first interface of the snapshot of type @p type, or nullptr.
+     */
+    const Interface * FindInterface(app::Clusters::GeneralDiagnostics::InterfaceType type) const;
+
+    /**
+     * Close the rtnetlink sockets and drop the snapshot.
+     */
+    void Close();
+
+private:
+    friend class TestNetworkDiagnosticsCache;
+
+    // The initial size of the receive buffer, which grows to the size of the largest message of a dump.
+    static constexpr size_t kReceiveBufferSize = 16384;
+
+    CHIP_ERROR Open();
+    void DrainEvents();
+    CHIP_ERROR Refresh();
+    CHIP_ERROR Dump(uint16_t type, std::vector<Interface> & interfaces);
+    static void ParseLink(const struct nlmsghdr * header, std::vector<Interface> & interfaces);
+    static void ParseAddress(const struct nlmsghdr * header, std::vector<Interface> & interfaces);
+
+    std::vector<Interface> mInterfaces;
+    System::Clock::Timestamp mRefreshTime = System::Clock::kZero;
+    int mEventSocket                      = -1;
+    int mRequestSocket                    = -1;
+    uint32_t mSequence                    = 0;
+    bool mStale                           = true;
+    std::vector<uint8_t> mBuffer;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -116,5 +116,11 @@ CHIP_ERROR ChipDnssdResolve(DnssdService * browseResult, Inet::InterfaceId inter
 #endif // CHIP_DEVICE_CONFIG_ENABLE_THREAD_SRP_CLIENT && CHIP_DEVICE_CONFIG_ENABLE_THREAD_DNS_CLIENT
 }
 
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * service)
+{
+    // Resolve results are not cached
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Dnssd
 } // namespace chip
@@ -771,5 +771,11 @@ CHIP_ERROR ChipDnssdResolve(DnssdService * browseResult, chip::Inet::InterfaceId
     return DnssdTizen::GetInstance().Resolve(*browseResult, interface, callback, context);
 }
 
+CHIP_ERROR ChipDnssdResolveNoLongerValid(const DnssdService * service)
+{
+    // Resolve results are not cached
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Dnssd
 } // namespace chip
@@ -0,0 +1,134 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      Throughput benchmarks of the device event queue of the POSIX platforms, against the mutex protected
+ *      std::queue it replaced.
+ */
+
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <lib/support/benchmark/Benchmark.h>
+#include <platform/DeviceSafeQueue.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using chip::Benchmark::State;
+using chip::DeviceLayer::Internal::DeviceSafeQueue;
+
+namespace {
+
+constexpr size_t kProducerCount     = 4;
+constexpr size_t kEventsPerProducer = 4096;
+constexpr size_t kEventBatchSize    = 8;
+
+/**
+ * The queue DeviceSafeQueue used to be, kept as the baseline.
+ */
+class MutexEventQueue
+{
+public:
+    void Push(const ChipDeviceEvent & event)
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        mQueue.push(event);
+    }
+
+    size_t PopFront(ChipDeviceEvent * events, size_t maxEvents)
+    {
+        size_t count = 0;
+        while (count < maxEvents)
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            if (mQueue.empty())
+            {
+                break;
+            }
+            events[count++] = mQueue.front();
+            mQueue.pop();
+        }
+        return count;
+    }
+
+private:
+    std::queue<ChipDeviceEvent> mQueue;
+    std::mutex mLock;
+};
+
+/**
+ * Each iteration, kProducerCount threads push kEventsPerProducer events each while the benchmark thread pops them in
+ * batches, as the CHIP thread does.
+ */
+template <typename Queue>
+void RunProducers(State & state)
+{
+    auto queue = std::make_unique<Queue>();
+    ChipDeviceEvent events[kEventBatchSize];
+
+    while (state.KeepRunning())
+    {
+        std::vector<std::thread> producers;
+        size_t remaining = kProducerCount * kEventsPerProducer;
+
+        for (size_t producer = 0; producer < kProducerCount; producer++)
+        {
+            producers.emplace_back([&queue]() {
+                ChipDeviceEvent event;
+                event.Type = DeviceEventType::kCallWorkFunct;
+                for (size_t i = 0; i < kEventsPerProducer; i++)
+                {
+                    event.CallWorkFunct.Arg = static_cast<intptr_t>(i);
+                    queue->Push(event);
+                }
+            });
+        }
+
+        while (remaining > 0)
+        {
+            size_t count = queue->PopFront(events, kEventBatchSize);
+            remaining -= count;
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        for (auto & thread : producers)
+        {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.Iterations() * kProducerCount * kEventsPerProducer);
+}
+
+void BenchmarkDeviceSafeQueue(State & state)
+{
+    RunProducers<DeviceSafeQueue>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkDeviceSafeQueue)
+
+void BenchmarkMutexEventQueue(State & state)
+{
+    RunProducers<MutexEventQueue>(state);
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkMutexEventQueue)
+
+} // namespace
@@ -0,0 +1,232 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the device event queue of the
+ *      POSIX platforms.
+ *
+ */
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <platform/DeviceSafeQueue.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+constexpr size_t kProducerCount         = 4;
+constexpr intptr_t kEventsPerProducer   = 20000;
+constexpr intptr_t kProducerShift       = 24;
+constexpr intptr_t kSequenceMask        = (1 << kProducerShift) - 1;
+constexpr size_t kTestBatchSize         = 8;
+constexpr std::chrono::seconds kTimeout = std::chrono::seconds(30);
+
+ChipDeviceEvent MakeEvent(intptr_t arg)
+{
+    ChipDeviceEvent event;
+    event.Type              = DeviceEventType::kCallWorkFunct;
+    event.CallWorkFunct.Arg = arg;
+    return event;
+}
+
+/**
+ * Push kEventsPerProducer events from each of kProducerCount threads while the calling thread pops them.
+ *
+ * @return false if the events were not all popped, or not in the order each producer pushed them.
+ */
+bool RunProducers(DeviceSafeQueue & queue)
+{
+    std::vector<std::thread> producers;
+    intptr_t nextSequence[kProducerCount] = {};
+    size_t remaining                      = kProducerCount * kEventsPerProducer;
+    bool inOrder                          = true;
+    ChipDeviceEvent events[kTestBatchSize];
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (intptr_t sequence = 0; sequence < kEventsPerProducer; sequence++)
+            {
+                queue.Push(MakeEvent((static_cast<intptr_t>(producer) << kProducerShift) | sequence));
+            }
+        });
+    }
+
+    while (remaining > 0 && std::chrono::steady_clock::now() - start < kTimeout)
+    {
+        size_t count = queue.PopFront(events, kTestBatchSize);
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t producer   = static_cast<size_t>(events[i].CallWorkFunct.Arg >> kProducerShift);
+            intptr_t sequence = events[i].CallWorkFunct.Arg & kSequenceMask;
+
+            inOrder = inOrder && producer < kProducerCount && sequence == nextSequence[producer]++;
+        }
+        remaining -= count;
+        if (count == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    for (auto & thread : producers)
+    {
+        thread.join();
+    }
+
+    return remaining == 0 && inOrder;
+}
+
+// =================================
+//      Unit tests
+// =================================
+
+void TestDeviceSafeQueue_Fifo(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceSafeQueue queue;
+    ChipDeviceEvent events[kTestBatchSize];
+
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+    NL_TEST_ASSERT(inSuite, queue.PopFront(events, kTestBatchSize) == 0);
+
+    for (intptr_t i = 0; i < 3; i++)
+    {
+        queue.Push(MakeEvent(i));
+    }
+    NL_TEST_ASSERT(inSuite, !queue.Empty());
+
+    // A batch stops at the requested count.
+    NL_TEST_ASSERT(inSuite, queue.PopFront(events, 2) == 2);
+    NL_TEST_ASSERT(inSuite, events[0].CallWorkFunct.Arg == 0);
+    NL_TEST_ASSERT(inSuite, events[1].CallWorkFunct.Arg == 1);
+
+    NL_TEST_ASSERT(inSuite, queue.PopFront(events, kTestBatchSize) == 1);
+    NL_TEST_ASSERT(inSuite, events[0].Type == DeviceEventType::kCallWorkFunct);
+    NL_TEST_ASSERT(inSuite, events[0].CallWorkFunct.Arg == 2);
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+}
+
+void TestDeviceSafeQueue_Overflow(nlTestSuite * inSuite, void * inContext)
+{
+    auto queue         = std::make_unique<DeviceSafeQueue>();
+    const auto kEvents = static_cast<intptr_t>(DeviceSafeQueue::kCapacity + 3);
+    ChipDeviceEvent event;
+
+    for (intptr_t i = 0; i < static_cast<intptr_t>(DeviceSafeQueue::kCapacity); i++)
+    {
+        queue->Push(MakeEvent(i));
+    }
+    NL_TEST_ASSERT(inSuite, queue->GetOverflowCount() == 0);
+
+    // The events that do not fit in the ring are kept rather than dropped.
+    for (intptr_t i = static_cast<intptr_t>(DeviceSafeQueue::kCapacity); i < kEvents; i++)
+    {
+        queue->Push(MakeEvent(i));
+    }
+    NL_TEST_ASSERT(inSuite, queue->GetOverflowCount() == 3);
+
+    // Popping one event frees a slot of the ring, which must not be used before the overflow list drained.
+    NL_TEST_ASSERT(inSuite, queue->PopFront(&event, 1) == 1);
+    NL_TEST_ASSERT(inSuite, event.CallWorkFunct.Arg == 0);
+    queue->Push(MakeEvent(kEvents));
+    NL_TEST_ASSERT(inSuite, queue->GetOverflowCount() == 4);
+
+    for (intptr_t i = 1; i <= kEvents; i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue->PopFront(&event, 1) == 1);
+        NL_TEST_ASSERT(inSuite, event.CallWorkFunct.Arg == i);
+    }
+    NL_TEST_ASSERT(inSuite, queue->Empty());
+
+    // Once drained, the ring is used again.
+    queue->Push(MakeEvent(0));
+    NL_TEST_ASSERT(inSuite, queue->GetOverflowCount() == 4);
+    NL_TEST_ASSERT(inSuite, queue->PopFront(&event, 1) == 1);
+    NL_TEST_ASSERT(inSuite, queue->Empty());
+}
+
+void TestDeviceSafeQueue_WrapAround(nlTestSuite * inSuite, void * inContext)
+{
+    auto queue = std::make_unique<DeviceSafeQueue>();
+    ChipDeviceEvent events[kTestBatchSize];
+    intptr_t pushed = 0;
+    intptr_t popped = 0;
+
+    // Keep the queue partly filled over several laps of the ring.
+    while (popped < static_cast<intptr_t>(5 * DeviceSafeQueue::kCapacity))
+    {
+        for (size_t i = 0; i < kTestBatchSize - 1; i++)
+        {
+            queue->Push(MakeEvent(pushed++));
+        }
+        size_t count = queue->PopFront(events, kTestBatchSize / 2);
+        for (size_t i = 0; i < count; i++)
+        {
+            NL_TEST_ASSERT(inSuite, events[i].CallWorkFunct.Arg == popped++);
+        }
+        while (pushed - popped > static_cast<intptr_t>(DeviceSafeQueue::kCapacity / 2))
+        {
+            NL_TEST_ASSERT(inSuite, queue->PopFront(events, 1) == 1);
+            NL_TEST_ASSERT(inSuite, events[0].CallWorkFunct.Arg == popped++);
+        }
+    }
+}
+
+void TestDeviceSafeQueue_ConcurrentPush(nlTestSuite * inSuite, void * inContext)
+{
+    auto queue = std::make_unique<DeviceSafeQueue>();
+
+    NL_TEST_ASSERT(inSuite, RunProducers(*queue));
+    NL_TEST_ASSERT(inSuite, queue->Empty());
+}
+
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test DeviceSafeQueue FIFO order", TestDeviceSafeQueue_Fifo),
+    NL_TEST_DEF("Test DeviceSafeQueue overflow", TestDeviceSafeQueue_Overflow),
+    NL_TEST_DEF("Test DeviceSafeQueue wrap around", TestDeviceSafeQueue_WrapAround),
+    NL_TEST_DEF("Test DeviceSafeQueue concurrent push", TestDeviceSafeQueue_ConcurrentPush),
+
+    NL_TEST_SENTINEL()
+};
+
+} // namespace
+
+int TestDeviceSafeQueue()
+{
+    nlTestSuite theSuite = { "DeviceSafeQueue tests", &sTests[0], nullptr, nullptr };
+
+    // Run test suit againt one context.
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeviceSafeQueue);
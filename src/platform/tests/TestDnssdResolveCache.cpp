@@ -0,0 +1,180 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the cache of the services
+ *      resolved through Avahi.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <platform/Linux/DnssdResolveCache.h>
+
+using namespace chip;
+using namespace chip::Dnssd;
+using std::chrono::seconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+constexpr const char * kOperationalType = "_matter._tcp";
+
+ResolveCache::Key MakeKey(const char * name, int interface = 1, const char * fullType = kOperationalType)
+{
+    return ResolveCache::Key{ name, fullType, interface, 0, 0 };
+}
+
+ResolveResult MakeResult(uint16_t port, uint32_t ttlSeconds = 120)
+{
+    ResolveResult result;
+    result.mService.mPort       = port;
+    result.mService.mTtlSeconds = ttlSeconds;
+    return result;
+}
+
+void CheckExpiry(nlTestSuite * inSuite, void * inContext)
+{
+    ResolveCache cache;
+    steady_clock::time_point now = steady_clock::now();
+
+    cache.Add(MakeKey("node"), MakeResult(5540), now);
+
+    const ResolveResult * result = cache.Find(MakeKey("node"), now + seconds(119));
+    NL_TEST_ASSERT(inSuite, result != nullptr);
+    NL_TEST_ASSERT(inSuite, result != nullptr && result->mService.mPort == 5540);
+
+    // Another interface or service is resolved again.
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node", 2), now) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("other"), now) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node", 1, "_matterc._udp"), now) == nullptr);
+
+    // Once the TTL elapsed, the result is gone.
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node"), now + seconds(120)) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Size() == 0);
+}
+
+void CheckRemove(nlTestSuite * inSuite, void * inContext)
+{
+    ResolveCache cache;
+    steady_clock::time_point now = steady_clock::now();
+
+    cache.Add(MakeKey("node", 1), MakeResult(5540), now);
+    cache.Add(MakeKey("node", 2), MakeResult(5541), now);
+    cache.Add(MakeKey("other"), MakeResult(5542), now);
+    NL_TEST_ASSERT(inSuite, cache.Size() == 3);
+
+    // A session failure drops the service on every interface, and only that service.
+    cache.Remove("node", kOperationalType);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node", 1), now) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node", 2), now) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("other"), now) != nullptr);
+
+    // The next resolve is cached again.
+    cache.Add(MakeKey("node", 1), MakeResult(5543), now);
+    const ResolveResult * result = cache.Find(MakeKey("node", 1), now);
+    NL_TEST_ASSERT(inSuite, result != nullptr && result->mService.mPort == 5543);
+
+    cache.Clear();
+    NL_TEST_ASSERT(inSuite, cache.Size() == 0);
+}
+
+void CheckBound(nlTestSuite * inSuite, void * inContext)
+{
+    ResolveCache cache;
+    steady_clock::time_point now = steady_clock::now();
+    char name[16];
+
+    for (size_t i = 0; i <= ResolveCache::kMaxEntries; i++)
+    {
+        snprintf(name, sizeof(name), "node%u", static_cast<unsigned>(i));
+        // The first result expires last, the second one first.
+        cache.Add(MakeKey(name), MakeResult(5540, i == 0 ? 1000 : static_cast<uint32_t>(100 + i)), now);
+    }
+
+    NL_TEST_ASSERT(inSuite, cache.Size() == ResolveCache::kMaxEntries);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node0"), now) != nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node1"), now) == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.Find(MakeKey("node2"), now) != nullptr);
+
+    // A result already cached is not added twice.
+    cache.Add(MakeKey("node0"), MakeResult(5541), now);
+    const ResolveResult * result = cache.Find(MakeKey("node0"), now);
+    NL_TEST_ASSERT(inSuite, cache.Size() == ResolveCache::kMaxEntries);
+    NL_TEST_ASSERT(inSuite, result != nullptr && result->mService.mPort == 5540);
+}
+
+struct DeliveredResult
+{
+    nlTestSuite * mSuite;
+    bool mCalled = false;
+};
+
+void HandleResolve(void * context, DnssdService * service, const Span<Inet::IPAddress> & addresses, CHIP_ERROR error)
+{
+    DeliveredResult * delivered = static_cast<DeliveredResult *>(context);
+    nlTestSuite * inSuite       = delivered->mSuite;
+
+    delivered->mCalled = true;
+    NL_TEST_ASSERT(inSuite, error == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, addresses.size() == 1);
+    NL_TEST_ASSERT(inSuite, service->mPort == 5540);
+    NL_TEST_ASSERT(inSuite, service->mTextEntrySize == 2);
+    NL_TEST_ASSERT(inSuite, strcmp(service->mTextEntries[0].mKey, "SII") == 0);
+    NL_TEST_ASSERT(inSuite, service->mTextEntries[0].mDataSize == 4);
+    NL_TEST_ASSERT(inSuite, memcmp(service->mTextEntries[0].mData, "5000", 4) == 0);
+    NL_TEST_ASSERT(inSuite, strcmp(service->mTextEntries[1].mKey, "T") == 0);
+    NL_TEST_ASSERT(inSuite, service->mTextEntries[1].mDataSize == 0);
+}
+
+void CheckDeliver(nlTestSuite * inSuite, void * inContext)
+{
+    ResolveResult result = MakeResult(5540);
+    DeliveredResult delivered{ inSuite };
+
+    result.mTextKeys.push_back("SII");
+    result.mTextValues.push_back({ '5', '0', '0', '0' });
+    result.mTextKeys.push_back("T");
+    result.mTextValues.push_back({});
+
+    result.Deliver(HandleResolve, &delivered);
+    NL_TEST_ASSERT(inSuite, delivered.mCalled);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("CheckExpiry", CheckExpiry),   //
+    NL_TEST_DEF("CheckRemove", CheckRemove),   //
+    NL_TEST_DEF("CheckBound", CheckBound),     //
+    NL_TEST_DEF("CheckDeliver", CheckDeliver), //
+    NL_TEST_SENTINEL()                         //
+};
+
+} // namespace
+
+int TestDnssdResolveCache()
+{
+    nlTestSuite theSuite = { "DnssdResolveCache", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDnssdResolveCache)
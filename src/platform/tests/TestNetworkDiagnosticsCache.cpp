@@ -0,0 +1,280 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the parsing of the rtnetlink
+ *      messages from which the snapshot of the network interfaces is built.
+ *
+ */
+
+#include <string.h>
+
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+
+#include <platform/Linux/NetworkDiagnosticsCache.h>
+
+#include <linux/rtnetlink.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+/**
+ * Builds a single rtnetlink message, as the kernel would send it in a dump.
+ */
+class MessageBuilder
+{
+public:
+    template <typename Payload>
+    MessageBuilder(uint16_t type, const Payload & payload)
+    {
+        memset(mBuffer, 0, sizeof(mBuffer));
+        Header()->nlmsg_len  = static_cast<uint32_t>(NLMSG_LENGTH(sizeof(payload)));
+        Header()->nlmsg_type = type;
+        memcpy(NLMSG_DATA(Header()), &payload, sizeof(payload));
+    }
+
+    MessageBuilder & AddAttribute(uint16_t type, const void * data, size_t size)
+    {
+        struct rtattr * attribute = reinterpret_cast<struct rtattr *>(mBuffer + NLMSG_ALIGN(Header()->nlmsg_len));
+        attribute->rta_type       = type;
+        attribute->rta_len        = static_cast<uint16_t>(RTA_LENGTH(size));
+        memcpy(RTA_DATA(attribute), data, size);
+        Header()->nlmsg_len = static_cast<uint32_t>(NLMSG_ALIGN(Header()->nlmsg_len) + RTA_ALIGN(attribute->rta_len));
+        return *this;
+    }
+
+    MessageBuilder & AddAttribute(uint16_t type, const char * string) { return AddAttribute(type, string, strlen(string) + 1); }
+
+    struct nlmsghdr * Header() { return reinterpret_cast<struct nlmsghdr *>(mBuffer); }
+
+private:
+    alignas(struct nlmsghdr) uint8_t mBuffer[1024];
+};
+
+struct ifinfomsg MakeLink(int index, unsigned flags)
+{
+    struct ifinfomsg link = {};
+    link.ifi_family       = AF_UNSPEC;
+    link.ifi_index        = index;
+    link.ifi_flags        = flags;
+    return link;
+}
+
+struct ifaddrmsg MakeAddress(uint8_t family, uint32_t index)
+{
+    struct ifaddrmsg address = {};
+    address.ifa_family       = family;
+    address.ifa_index        = index;
+    return address;
+}
+
+} // namespace
+
+class TestNetworkDiagnosticsCache
+{
+public:
+    static void CheckParseLink(nlTestSuite * inSuite, void * inContext);
+    static void CheckParseLinkStats(nlTestSuite * inSuite, void * inContext);
+    static void CheckParseAddress(nlTestSuite * inSuite, void * inContext);
+    static void CheckParseAddressBounds(nlTestSuite * inSuite, void * inContext);
+};
+
+void TestNetworkDiagnosticsCache::CheckParseLink(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<NetworkDiagnosticsCache::Interface> interfaces;
+    const uint8_t hardwareAddress[] = { 0x02, 0x11, 0x22, 0x33, 0x44, 0x55 };
+    struct rtnl_link_stats64 stats  = {};
+
+    stats.rx_packets     = 0x100000001;
+    stats.tx_packets     = 2;
+    stats.tx_errors      = 3;
+    stats.multicast      = 4;
+    stats.collisions     = 5;
+    stats.rx_over_errors = 6;
+
+    MessageBuilder link(RTM_NEWLINK, MakeLink(3, IFF_UP | IFF_RUNNING));
+    link.AddAttribute(IFLA_IFNAME, "eth0")
+        .AddAttribute(IFLA_ADDRESS, hardwareAddress, sizeof(hardwareAddress))
+        .AddAttribute(IFLA_STATS64, &stats, sizeof(stats));
+    NetworkDiagnosticsCache::ParseLink(link.Header(), interfaces);
+
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 1);
+    const NetworkDiagnosticsCache::Interface & interface = interfaces[0];
+    NL_TEST_ASSERT(inSuite, strcmp(interface.mName, "eth0") == 0);
+    NL_TEST_ASSERT(inSuite, interface.mIndex == 3);
+    NL_TEST_ASSERT(inSuite, interface.mFlags == (IFF_UP | IFF_RUNNING));
+    NL_TEST_ASSERT(inSuite, interface.mHardwareAddressLength == sizeof(hardwareAddress));
+    NL_TEST_ASSERT(inSuite, memcmp(interface.mHardwareAddress, hardwareAddress, sizeof(hardwareAddress)) == 0);
+    NL_TEST_ASSERT(inSuite, interface.mIPv4AddressCount == 0);
+    NL_TEST_ASSERT(inSuite, interface.mIPv6AddressCount == 0);
+    NL_TEST_ASSERT(inSuite, interface.mHasStats);
+    NL_TEST_ASSERT(inSuite, interface.mStats.rx_packets == 0x100000001);
+    NL_TEST_ASSERT(inSuite, interface.mStats.rx_over_errors == 6);
+
+    // A link without a name is not kept.
+    MessageBuilder anonymous(RTM_NEWLINK, MakeLink(4, 0));
+    anonymous.AddAttribute(IFLA_ADDRESS, hardwareAddress, sizeof(hardwareAddress));
+    NetworkDiagnosticsCache::ParseLink(anonymous.Header(), interfaces);
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 1);
+
+    // A name too long for the interface is truncated, and an oversized hardware address is clamped.
+    uint8_t longHardwareAddress[kMaxHardwareAddrSize + 4] = {};
+    MessageBuilder longNames(RTM_NEWLINK, MakeLink(5, 0));
+    longNames.AddAttribute(IFLA_IFNAME, "a-name-longer-than-ifnamsiz")
+        .AddAttribute(IFLA_ADDRESS, longHardwareAddress, sizeof(longHardwareAddress));
+    NetworkDiagnosticsCache::ParseLink(longNames.Header(), interfaces);
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 2);
+    NL_TEST_ASSERT(inSuite, strlen(interfaces[1].mName) == IFNAMSIZ - 1);
+    NL_TEST_ASSERT(inSuite, interfaces[1].mHardwareAddressLength == kMaxHardwareAddrSize);
+    NL_TEST_ASSERT(inSuite, !interfaces[1].mHasStats);
+}
+
+void TestNetworkDiagnosticsCache::CheckParseLinkStats(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<NetworkDiagnosticsCache::Interface> interfaces;
+    struct rtnl_link_stats stats     = {};
+    struct rtnl_link_stats64 stats64 = {};
+
+    stats.rx_packets   = 10;
+    stats.collisions   = 11;
+    stats64.rx_packets = 20;
+    stats64.collisions = 21;
+
+    // The 32-bit statistics are used by the kernels which do not have 64-bit ones.
+    MessageBuilder legacy(RTM_NEWLINK, MakeLink(1, 0));
+    legacy.AddAttribute(IFLA_IFNAME, "wlan0").AddAttribute(IFLA_STATS, &stats, sizeof(stats));
+    NetworkDiagnosticsCache::ParseLink(legacy.Header(), interfaces);
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 1);
+    NL_TEST_ASSERT(inSuite, interfaces[0].mHasStats);
+    NL_TEST_ASSERT(inSuite, interfaces[0].mStats.rx_packets == 10);
+    NL_TEST_ASSERT(inSuite, interfaces[0].mStats.collisions == 11);
+
+    // Otherwise the 64-bit statistics win, whatever the order of the attributes.
+    MessageBuilder both(RTM_NEWLINK, MakeLink(2, 0));
+    both.AddAttribute(IFLA_IFNAME, "wlan1")
+        .AddAttribute(IFLA_STATS64, &stats64, sizeof(stats64))
+        .AddAttribute(IFLA_STATS, &stats, sizeof(stats));
+    NetworkDiagnosticsCache::ParseLink(both.Header(), interfaces);
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 2);
+    NL_TEST_ASSERT(inSuite, interfaces[1].mStats.rx_packets == 20);
+    NL_TEST_ASSERT(inSuite, interfaces[1].mStats.collisions == 21);
+
+    // Truncated statistics are ignored.
+    MessageBuilder truncated(RTM_NEWLINK, MakeLink(3, 0));
+    truncated.AddAttribute(IFLA_IFNAME, "wlan2").AddAttribute(IFLA_STATS64, &stats64, sizeof(stats64) / 2);
+    NetworkDiagnosticsCache::ParseLink(truncated.Header(), interfaces);
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 3);
+    NL_TEST_ASSERT(inSuite, !interfaces[2].mHasStats);
+}
+
+void TestNetworkDiagnosticsCache::CheckParseAddress(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<NetworkDiagnosticsCache::Interface> interfaces;
+    const uint8_t ipv4Address[]  = { 192, 168, 1, 10 };
+    const uint8_t ipv4Peer[]     = { 10, 0, 0, 1 };
+    const uint8_t ipv4Local[]    = { 10, 0, 0, 2 };
+    const uint8_t ipv6Address[]  = { 0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0x11, 0x22, 0xff, 0xfe, 0x33, 0x44, 0x55 };
+    const uint8_t otherAddress[] = { 172, 16, 0, 1 };
+
+    MessageBuilder link(RTM_NEWLINK, MakeLink(2, 0));
+    link.AddAttribute(IFLA_IFNAME, "eth0");
+    NetworkDiagnosticsCache::ParseLink(link.Header(), interfaces);
+    NL_TEST_ASSERT(inSuite, interfaces.size() == 1);
+
+    MessageBuilder ipv4(RTM_NEWADDR, MakeAddress(AF_INET, 2));
+    ipv4.AddAttribute(IFA_ADDRESS, ipv4Address, sizeof(ipv4Address));
+    NetworkDiagnosticsCache::ParseAddress(ipv4.Header(), interfaces);
+
+    // On point-to-point links, IFA_ADDRESS is the peer and IFA_LOCAL the address of the interface.
+    MessageBuilder pointToPoint(RTM_NEWADDR, MakeAddress(AF_INET, 2));
+    pointToPoint.AddAttribute(IFA_ADDRESS, ipv4Peer, sizeof(ipv4Peer)).AddAttribute(IFA_LOCAL, ipv4Local, sizeof(ipv4Local));
+    NetworkDiagnosticsCache::ParseAddress(pointToPoint.Header(), interfaces);
+
+    MessageBuilder ipv6(RTM_NEWADDR, MakeAddress(AF_INET6, 2));
+    ipv6.AddAttribute(IFA_ADDRESS, ipv6Address, sizeof(ipv6Address));
+    NetworkDiagnosticsCache::ParseAddress(ipv6.Header(), interfaces);
+
+    // The addresses of the links missing from the dump are dropped.
+    MessageBuilder unknown(RTM_NEWADDR, MakeAddress(AF_INET, 7));
+    unknown.AddAttribute(IFA_ADDRESS, otherAddress, sizeof(otherAddress));
+    NetworkDiagnosticsCache::ParseAddress(unknown.Header(), interfaces);
+
+    // So are the addresses without an address attribute, or too short for their family.
+    MessageBuilder empty(RTM_NEWADDR, MakeAddress(AF_INET, 2));
+    NetworkDiagnosticsCache::ParseAddress(empty.Header(), interfaces);
+    MessageBuilder shortIPv6(RTM_NEWADDR, MakeAddress(AF_INET6, 2));
+    shortIPv6.AddAttribute(IFA_ADDRESS, otherAddress, sizeof(otherAddress));
+    NetworkDiagnosticsCache::ParseAddress(shortIPv6.Header(), interfaces);
+
+    const NetworkDiagnosticsCache::Interface & interface = interfaces[0];
+    NL_TEST_ASSERT(inSuite, interface.mIPv4AddressCount == 2);
+    NL_TEST_ASSERT(inSuite, memcmp(interface.mIPv4Addresses[0], ipv4Address, sizeof(ipv4Address)) == 0);
+    NL_TEST_ASSERT(inSuite, memcmp(interface.mIPv4Addresses[1], ipv4Local, sizeof(ipv4Local)) == 0);
+    NL_TEST_ASSERT(inSuite, interface.mIPv6AddressCount == 1);
+    NL_TEST_ASSERT(inSuite, memcmp(interface.mIPv6Addresses[0], ipv6Address, sizeof(ipv6Address)) == 0);
+}
+
+void TestNetworkDiagnosticsCache::CheckParseAddressBounds(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<NetworkDiagnosticsCache::Interface> interfaces;
+
+    MessageBuilder link(RTM_NEWLINK, MakeLink(1, 0));
+    link.AddAttribute(IFLA_IFNAME, "eth0");
+    NetworkDiagnosticsCache::ParseLink(link.Header(), interfaces);
+
+    // The addresses beyond the capacity of the interface are dropped.
+    for (uint8_t i = 0; i < kMaxIPv4AddrCount + 2; i++)
+    {
+        const uint8_t address[] = { 10, 0, 0, i };
+        MessageBuilder message(RTM_NEWADDR, MakeAddress(AF_INET, 1));
+        message.AddAttribute(IFA_ADDRESS, address, sizeof(address));
+        NetworkDiagnosticsCache::ParseAddress(message.Header(), interfaces);
+    }
+
+    NL_TEST_ASSERT(inSuite, interfaces[0].mIPv4AddressCount == kMaxIPv4AddrCount);
+    NL_TEST_ASSERT(inSuite, interfaces[0].mIPv4Addresses[kMaxIPv4AddrCount - 1][3] == kMaxIPv4AddrCount - 1);
+}
+
+namespace {
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("CheckParseLink", TestNetworkDiagnosticsCache::CheckParseLink),                   //
+    NL_TEST_DEF("CheckParseLinkStats", TestNetworkDiagnosticsCache::CheckParseLinkStats),         //
+    NL_TEST_DEF("CheckParseAddress", TestNetworkDiagnosticsCache::CheckParseAddress),             //
+    NL_TEST_DEF("CheckParseAddressBounds", TestNetworkDiagnosticsCache::CheckParseAddressBounds), //
+    NL_TEST_SENTINEL()                                                                            //
+};
+
+} // namespace
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
+
+int TestNetworkDiagnosticsCache()
+{
+    nlTestSuite theSuite = { "NetworkDiagnosticsCache", chip::DeviceLayer::Internal::sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestNetworkDiagnosticsCache)
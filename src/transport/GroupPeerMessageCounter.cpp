@@ -34,225 +34,122 @@ CHIP_ERROR GroupPeerTable::FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId,
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    for (auto & groupFabric : mGroupFabrics)
+    GroupSender * sender =
+        isControl ? mControlGroupSenders.Find(fabricIndex, nodeId) : mDataGroupSenders.Find(fabricIndex, nodeId);
+    if (sender != nullptr)
     {
-        if (groupFabric.mFabricIndex == kUndefinedFabricIndex)
-        {
-            // Already iterated through all known fabricIndex
-            // Add the new peer to save some processing time
-            groupFabric.mFabricIndex = fabricIndex;
-            if (isControl)
-            {
-                groupFabric.mControlGroupSenders[0].mNodeId = nodeId;
-                counter                                     = &(groupFabric.mControlGroupSenders[0].msgCounter);
-                groupFabric.mControlPeerCount++;
-            }
-            else
-            {
-                groupFabric.mDataGroupSenders[0].mNodeId = nodeId;
-                counter                                  = &(groupFabric.mDataGroupSenders[0].msgCounter);
-                groupFabric.mDataPeerCount++;
-            }
-            return CHIP_NO_ERROR;
-        }
+        counter = &sender->msgCounter;
+        return CHIP_NO_ERROR;
+    }
 
-        if (fabricIndex == groupFabric.mFabricIndex)
+    GroupFabric * groupFabric = FindFabric(fabricIndex);
+    if (groupFabric == nullptr)
+    {
+        groupFabric = FindFabric(kUndefinedFabricIndex);
+        if (groupFabric == nullptr)
         {
-            if (isControl)
-            {
-                for (auto & node : groupFabric.mControlGroupSenders)
-                {
-                    if (node.mNodeId == kUndefinedNodeId)
-                    {
-                        // Already iterated through all known NodeIds
-                        // Add the new peer to save some processing time
-                        node.mNodeId = nodeId;
-                        counter      = &(node.msgCounter);
-                        groupFabric.mControlPeerCount++;
-                        return CHIP_NO_ERROR;
-                    }
-
-                    if (node.mNodeId == nodeId)
-                    {
-                        counter = &(node.msgCounter);
-                        return CHIP_NO_ERROR;
-                    }
-                }
-            }
-            else
-            {
-                for (auto & node : groupFabric.mDataGroupSenders)
-                {
-                    if (node.mNodeId == kUndefinedNodeId)
-                    {
-                        // Already iterated through all known NodeIds
-                        // Add the new peer to save some processing time
-                        node.mNodeId = nodeId;
-                        counter      = &(node.msgCounter);
-                        groupFabric.mDataPeerCount++;
-                        return CHIP_NO_ERROR;
-                    }
-
-                    if (node.mNodeId == nodeId)
-                    {
-                        counter = &(node.msgCounter);
-                        return CHIP_NO_ERROR;
-                    }
-                }
-            }
-            // Exceeded the Max number of Group peers
+            // Exceeded the Max number of Fabrics
             return CHIP_ERROR_TOO_MANY_PEER_NODES;
         }
+        groupFabric->mFabricIndex = fabricIndex;
     }
 
-    // Exceeded the Max number of Group peers
-    return CHIP_ERROR_TOO_MANY_PEER_NODES;
-}
-
-// Used in case of MCSP failure
-CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
-{
-    CHIP_ERROR err    = CHIP_ERROR_NOT_FOUND;
-    uint32_t fabricIt = CHIP_CONFIG_MAX_FABRICS;
-
-    if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
-    {
-        return CHIP_ERROR_INVALID_ARGUMENT;
-    }
-
-    for (uint32_t it = 0; it < CHIP_CONFIG_MAX_FABRICS; it++)
+    if (isControl)
     {
-        if (fabricIndex == mGroupFabrics[it].mFabricIndex)
+        if (groupFabric->mControlPeerCount < CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS)
+        {
+            groupFabric->mControlPeerCount++;
+        }
+        else
         {
-            if (isControl)
-            {
-                if (RemoveSpecificPeer(mGroupFabrics[it].mControlGroupSenders, nodeId, CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS))
-                {
-                    fabricIt = it;
-                    mGroupFabrics[it].mControlPeerCount--;
-                    err = CHIP_NO_ERROR;
-                }
-            }
-            else
-            {
-                if (RemoveSpecificPeer(mGroupFabrics[it].mDataGroupSenders, nodeId, CHIP_CONFIG_MAX_GROUP_DATA_PEERS))
-                {
-                    fabricIt = it;
-                    mGroupFabrics[it].mDataPeerCount--;
-                    err = CHIP_NO_ERROR;
-                }
-            }
-            break;
+            mControlGroupSenders.EvictLeastRecentlyUsed(fabricIndex);
         }
+        sender = mControlGroupSenders.Add(fabricIndex, nodeId);
     }
-
-    // Remove Fabric entry from PeerTable if empty
-    if (fabricIt < CHIP_CONFIG_MAX_FABRICS)
+    else
     {
-        if (mGroupFabrics[fabricIt].mDataPeerCount == 0 && mGroupFabrics[fabricIt].mControlPeerCount == 0)
+        if (groupFabric->mDataPeerCount < CHIP_CONFIG_MAX_GROUP_DATA_PEERS)
         {
-            RemoveAndCompactFabric(fabricIt);
+            groupFabric->mDataPeerCount++;
         }
+        else
+        {
+            mDataGroupSenders.EvictLeastRecentlyUsed(fabricIndex);
+        }
+        sender = mDataGroupSenders.Add(fabricIndex, nodeId);
     }
 
-    // Cannot find Peer to remove
-    return err;
+    VerifyOrReturnError(sender != nullptr, CHIP_ERROR_INTERNAL);
+    counter = &sender->msgCounter;
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR GroupPeerTable::FabricRemoved(FabricIndex fabricIndex)
+// Used in case of MCSP failure
+CHIP_ERROR GroupPeerTable::RemovePeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl)
 {
-    CHIP_ERROR err = CHIP_ERROR_NOT_FOUND;
-
-    if (fabricIndex == kUndefinedFabricIndex)
+    if (fabricIndex == kUndefinedFabricIndex || nodeId == kUndefinedNodeId)
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    for (uint32_t it = 0; it < CHIP_CONFIG_MAX_FABRICS; it++)
+    GroupFabric * groupFabric = FindFabric(fabricIndex);
+    if (groupFabric == nullptr)
     {
-        if (fabricIndex == mGroupFabrics[it].mFabricIndex)
-        {
-            RemoveAndCompactFabric(it);
-            return CHIP_NO_ERROR;
-        }
+        // Cannot find Peer to remove
+        return CHIP_ERROR_NOT_FOUND;
     }
 
-    // Cannot find Fabric to remove
-    return err;
-}
-
-bool GroupPeerTable::RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size)
-{
-    bool removed = false;
-    for (uint32_t nodeIt = 0; nodeIt < size; nodeIt++)
+    if (isControl)
     {
-        if (list[nodeIt].mNodeId == nodeId)
-        {
-            list[nodeIt].mNodeId = kUndefinedNodeId;
-            list[nodeIt].msgCounter.Reset();
-            removed = true;
-            break;
-        }
+        VerifyOrReturnError(mControlGroupSenders.Remove(fabricIndex, nodeId), CHIP_ERROR_NOT_FOUND);
+        groupFabric->mControlPeerCount--;
+    }
+    else
+    {
+        VerifyOrReturnError(mDataGroupSenders.Remove(fabricIndex, nodeId), CHIP_ERROR_NOT_FOUND);
+        groupFabric->mDataPeerCount--;
     }
 
-    if (removed)
+    // Remove Fabric entry from PeerTable if empty
+    if (groupFabric->mDataPeerCount == 0 && groupFabric->mControlPeerCount == 0)
     {
-        CompactPeers(list, size);
+        *groupFabric = GroupFabric();
     }
 
-    return removed;
+    return CHIP_NO_ERROR;
 }
 
-void GroupPeerTable::CompactPeers(GroupSender * list, uint32_t size)
+CHIP_ERROR GroupPeerTable::FabricRemoved(FabricIndex fabricIndex)
 {
-    if (list == nullptr || size == 0)
+    if (fabricIndex == kUndefinedFabricIndex)
     {
-        return;
+        return CHIP_ERROR_INVALID_ARGUMENT;
     }
 
-    for (uint32_t peerIndex = 0; peerIndex < size; peerIndex++)
+    GroupFabric * groupFabric = FindFabric(fabricIndex);
+    if (groupFabric == nullptr)
     {
-        if (list[peerIndex].mNodeId != kUndefinedNodeId)
-        {
-            continue;
-        }
-
-        for (uint32_t i = (size - 1); i > peerIndex; i--)
-        {
-            if (list[i].mNodeId != kUndefinedNodeId)
-            {
-                // Logic works since all buffer are static
-                // move it up front
-                new (&list[peerIndex]) GroupSender(list[i]);
-                new (&list[i]) GroupSender();
-                break;
-            }
-        }
+        // Cannot find Fabric to remove
+        return CHIP_ERROR_NOT_FOUND;
     }
+
+    mControlGroupSenders.RemoveFabric(fabricIndex);
+    mDataGroupSenders.RemoveFabric(fabricIndex);
+    *groupFabric = GroupFabric();
+
+    return CHIP_NO_ERROR;
 }
 
-void GroupPeerTable::RemoveAndCompactFabric(uint32_t tableIndex)
+GroupFabric * GroupPeerTable::FindFabric(FabricIndex fabricIndex)
 {
-    if (tableIndex >= CHIP_CONFIG_MAX_FABRICS)
-    {
-        return;
-    }
-    mGroupFabrics[tableIndex].mFabricIndex = kUndefinedFabricIndex;
-    new (&mGroupFabrics[tableIndex]) GroupFabric();
-
-    // To maintain logic integrity Fabric array cannot have empty slot in between data
-    // Find the last non empty element
-    for (uint32_t i = CHIP_CONFIG_MAX_FABRICS - 1; i > tableIndex; i--)
+    for (auto & groupFabric : mGroupFabrics)
     {
-        if (mGroupFabrics[i].mFabricIndex != kUndefinedFabricIndex)
+        if (groupFabric.mFabricIndex == fabricIndex)
         {
-            // Logic works since all buffer are static
-            // move it up front
-            new (&mGroupFabrics[tableIndex]) GroupFabric(mGroupFabrics[i]);
-            new (&mGroupFabrics[i]) GroupFabric();
-            break;
+            return &groupFabric;
         }
     }
+    return nullptr;
 }
 
 GroupOutgoingCounters::GroupOutgoingCounters(chip::PersistentStorageDelegate * storage_delegate)
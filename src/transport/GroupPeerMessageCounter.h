@@ -39,8 +39,13 @@ namespace Transport {
 class GroupSender
 {
 public:
-    NodeId mNodeId = kUndefinedNodeId;
+    FabricIndex mFabricIndex = kUndefinedFabricIndex;
+    NodeId mNodeId           = kUndefinedNodeId;
+    // Recency stamp used to pick the sender to evict when a fabric runs out of slots.
+    uint32_t mLastUse = 0;
     PeerMessageCounter msgCounter;
+
+    bool IsFree() const { return mNodeId == kUndefinedNodeId; }
 };
 
 class GroupFabric
@@ -49,13 +54,175 @@ public:
     FabricIndex mFabricIndex  = kUndefinedFabricIndex;
     uint8_t mControlPeerCount = 0;
     uint8_t mDataPeerCount    = 0;
-    GroupSender mDataGroupSenders[CHIP_CONFIG_MAX_GROUP_DATA_PEERS];
-    GroupSender mControlGroupSenders[CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS];
+};
+
+/**
+ * Fixed-capacity table of group senders, indexed by an open-addressing hash of (fabric index, node id).
+ *
+ * Senders never move once added, so the PeerMessageCounter pointers handed out stay valid until the
+ * sender is removed or evicted. Lookup is O(1) on average; only insertion of a new sender into a full
+ * fabric pays for a scan to find the least recently used sender of that fabric.
+ */
+template <size_t kMaxPeersPerFabric>
+class GroupSenderTable
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_MAX_FABRICS * kMaxPeersPerFabric;
+
+    GroupSender * Find(FabricIndex fabricIndex, NodeId nodeId)
+    {
+        for (size_t bucket = HomeBucket(fabricIndex, nodeId); mBuckets[bucket] != kEmptyBucket; bucket = NextBucket(bucket))
+        {
+            GroupSender & sender = mSenders[mBuckets[bucket] - 1];
+            if (sender.mFabricIndex == fabricIndex && sender.mNodeId == nodeId)
+            {
+                sender.mLastUse = ++mUseCounter;
+                return &sender;
+            }
+        }
+        return nullptr;
+    }
+
+    // Caller is responsible for enforcing per-fabric quotas, so a free slot is always available.
+    GroupSender * Add(FabricIndex fabricIndex, NodeId nodeId)
+    {
+        for (size_t index = 0; index < kCapacity; index++)
+        {
+            GroupSender & sender = mSenders[index];
+            if (!sender.IsFree())
+            {
+                continue;
+            }
+
+            sender.mFabricIndex = fabricIndex;
+            sender.mNodeId      = nodeId;
+            sender.mLastUse     = ++mUseCounter;
+
+            size_t bucket = HomeBucket(fabricIndex, nodeId);
+            while (mBuckets[bucket] != kEmptyBucket)
+            {
+                bucket = NextBucket(bucket);
+            }
+            mBuckets[bucket] = static_cast<uint16_t>(index + 1);
+            return &sender;
+        }
+        return nullptr;
+    }
+
+    bool Remove(FabricIndex fabricIndex, NodeId nodeId)
+    {
+        for (size_t bucket = HomeBucket(fabricIndex, nodeId); mBuckets[bucket] != kEmptyBucket; bucket = NextBucket(bucket))
+        {
+            GroupSender & sender = mSenders[mBuckets[bucket] - 1];
+            if (sender.mFabricIndex == fabricIndex && sender.mNodeId == nodeId)
+            {
+                EraseBucket(bucket);
+                sender.msgCounter.Reset();
+                sender = GroupSender();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void EvictLeastRecentlyUsed(FabricIndex fabricIndex)
+    {
+        GroupSender * victim = nullptr;
+        for (auto & sender : mSenders)
+        {
+            if (!sender.IsFree() && sender.mFabricIndex == fabricIndex &&
+                (victim == nullptr || static_cast<int32_t>(sender.mLastUse - victim->mLastUse) < 0))
+            {
+                victim = &sender;
+            }
+        }
+
+        if (victim != nullptr)
+        {
+            Remove(victim->mFabricIndex, victim->mNodeId);
+        }
+    }
+
+    void RemoveFabric(FabricIndex fabricIndex)
+    {
+        for (auto & sender : mSenders)
+        {
+            if (!sender.IsFree() && sender.mFabricIndex == fabricIndex)
+            {
+                Remove(sender.mFabricIndex, sender.mNodeId);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t BucketCountFor(size_t capacity)
+    {
+        // Power of two, at least twice the capacity to keep probe sequences short.
+        size_t count = 1;
+        while (count < 2 * capacity)
+        {
+            count <<= 1;
+        }
+        return count;
+    }
+
+    static constexpr size_t kBucketCount = BucketCountFor(kCapacity);
+    static constexpr uint16_t kEmptyBucket = 0;
+    static_assert(kCapacity < UINT16_MAX, "Group sender indexes must fit in a bucket");
+
+    static size_t HomeBucket(FabricIndex fabricIndex, NodeId nodeId)
+    {
+        uint64_t hash = (nodeId ^ (static_cast<uint64_t>(fabricIndex) << 56)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(hash >> 32) & (kBucketCount - 1);
+    }
+
+    static size_t NextBucket(size_t bucket) { return (bucket + 1) & (kBucketCount - 1); }
+
+    // Backward-shift deletion: keeps probe sequences intact without tombstones.
+    void EraseBucket(size_t hole)
+    {
+        size_t bucket = hole;
+        while (true)
+        {
+            mBuckets[hole] = kEmptyBucket;
+            while (true)
+            {
+                bucket = NextBucket(bucket);
+                if (mBuckets[bucket] == kEmptyBucket)
+                {
+                    return;
+                }
+
+                const GroupSender & sender = mSenders[mBuckets[bucket] - 1];
+                size_t home                = HomeBucket(sender.mFabricIndex, sender.mNodeId);
+                // The entry can fill the hole unless its home lies cyclically in (hole, bucket].
+                bool homeInRange = (hole <= bucket) ? (hole < home && home <= bucket) : (hole < home || home <= bucket);
+                if (!homeInRange)
+                {
+                    break;
+                }
+            }
+            mBuckets[hole] = mBuckets[bucket];
+            hole           = bucket;
+        }
+    }
+
+    GroupSender mSenders[kCapacity];
+    // 1-based index into mSenders, kEmptyBucket if unused.
+    uint16_t mBuckets[kBucketCount] = {};
+    uint32_t mUseCounter            = 0;
 };
 
 class GroupPeerTable
 {
 public:
+    /**
+     * Find the message counter of a group sender, adding it if needed.
+     *
+     * When the fabric already tracks its maximum number of senders of this kind, the least recently
+     * used one is evicted to make room. CHIP_ERROR_TOO_MANY_PEER_NODES is only returned when
+     * CHIP_CONFIG_MAX_FABRICS other fabrics are already tracked.
+     */
     CHIP_ERROR FindOrAddPeer(FabricIndex fabricIndex, NodeId nodeId, bool isControl,
                              chip::Transport::PeerMessageCounter *& counter);
 
@@ -66,11 +233,11 @@ public:
 
     // Protected for Unit Tests inheritance
 protected:
-    bool RemoveSpecificPeer(GroupSender * list, NodeId nodeId, uint32_t size);
-    void CompactPeers(GroupSender * list, uint32_t size);
-    void RemoveAndCompactFabric(uint32_t tableIndex);
+    GroupFabric * FindFabric(FabricIndex fabricIndex);
 
     GroupFabric mGroupFabrics[CHIP_CONFIG_MAX_FABRICS];
+    GroupSenderTable<CHIP_CONFIG_MAX_GROUP_DATA_PEERS> mDataGroupSenders;
+    GroupSenderTable<CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS> mControlGroupSenders;
 };
 
 // Might want to rename this so that it is explicitly the sending side of counters
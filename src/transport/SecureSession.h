@@ -176,7 +176,15 @@ public:
     }
 
     const PeerAddress & GetPeerAddress() const { return mPeerAddress; }
-    void SetPeerAddress(const PeerAddress & address) { mPeerAddress = address; }
+    void SetPeerAddress(const PeerAddress & address)
+    {
+        // Round-trip times measured on the old path say nothing about the new one.
+        if (address != mPeerAddress)
+        {
+            ResetRoundTripTime();
+        }
+        mPeerAddress = address;
+    }
 
     Type GetSecureSessionType() const { return mSecureSessionType; }
     bool IsCASESession() const { return GetSecureSessionType() == Type::kCASE; }
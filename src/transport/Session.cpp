@@ -14,6 +14,8 @@
  *    limitations under the License.
  */
 
+#include <algorithm>
+
 #include <transport/GroupSession.h>
 #include <transport/SecureSession.h>
 #include <transport/Session.h>
@@ -55,6 +57,19 @@ System::Clock::Timeout Session::ComputeRoundTripTimeout(System::Clock::Timeout u
     return GetAckTimeout() + upperlayerProcessingTimeout;
 }
 
+void Session::UpdateRoundTripTime(System::Clock::Milliseconds32 sample)
+{
+    // Samples below the clock granularity still mean that a measurement exists.
+    sample = std::max(sample, System::Clock::Milliseconds32(1));
+
+    if (mSmoothedRoundTripTime == System::Clock::kZero)
+    {
+        mSmoothedRoundTripTime = sample;
+        return;
+    }
+    mSmoothedRoundTripTime = (mSmoothedRoundTripTime * 7 + sample) / 8;
+}
+
 const char * GetSessionTypeString(const SessionHandle & session)
 {
     switch (session->GetSessionType())
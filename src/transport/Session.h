@@ -208,6 +208,17 @@ public:
     // the target For group sessions, this function will always return 0.
     System::Clock::Timeout ComputeRoundTripTimeout(System::Clock::Timeout upperlayerProcessingTimeout);
 
+    // Round-trip time observed by MRP between sending a message and receiving its ack, smoothed like TCP's SRTT (RFC 6298) with
+    // a gain of 1/8. Returns kZero until a first sample has been recorded.
+    System::Clock::Milliseconds32 GetSmoothedRoundTripTime() const { return mSmoothedRoundTripTime; }
+    void UpdateRoundTripTime(System::Clock::Milliseconds32 sample);
+    void ResetRoundTripTime() { mSmoothedRoundTripTime = System::Clock::kZero; }
+
+    // Deadline of the standalone ack that MRP last scheduled on its own on this session. Acks due shortly after it are
+    // sent in the same wakeup.
+    System::Clock::Timestamp GetStandaloneAckAnchor() const { return mStandaloneAckAnchor; }
+    void SetStandaloneAckAnchor(System::Clock::Timestamp deadline) { mStandaloneAckAnchor = deadline; }
+
     FabricIndex GetFabricIndex() const { return mFabricIndex; }
 
     SecureSession * AsSecureSession();
@@ -251,7 +262,9 @@ protected:
     IntrusiveList<SessionHolder> mHolders;
 
 private:
-    FabricIndex mFabricIndex = kUndefinedFabricIndex;
+    FabricIndex mFabricIndex                             = kUndefinedFabricIndex;
+    System::Clock::Milliseconds32 mSmoothedRoundTripTime = System::Clock::kZero;
+    System::Clock::Timestamp mStandaloneAckAnchor        = System::Clock::kZero;
 };
 
 //
@@ -0,0 +1,107 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+/**
+ *    @file
+ *      Throughput benchmarks of the group sender table used to check the message counters of group messages.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/benchmark/Benchmark.h>
+#include <transport/GroupPeerMessageCounter.h>
+#include <transport/PeerMessageCounter.h>
+
+using namespace chip;
+using chip::Benchmark::DoNotOptimize;
+using chip::Benchmark::State;
+using chip::Transport::GroupPeerTable;
+using chip::Transport::PeerMessageCounter;
+
+namespace {
+
+constexpr uint32_t kNodesPerFabric = 4 * CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+
+/**
+ * Churn every fabric with far more senders than the table can hold, mixing lookups, evictions and removals.
+ */
+void BenchmarkGroupPeerTableChurn(State & state)
+{
+    GroupPeerTable table;
+    PeerMessageCounter * counter = nullptr;
+    uint32_t seed                = 1;
+
+    while (state.KeepRunning())
+    {
+        seed                    = seed * 1103515245u + 12345u;
+        FabricIndex fabricIndex = static_cast<FabricIndex>(1 + (seed >> 8) % CHIP_CONFIG_MAX_FABRICS);
+        NodeId nodeId           = 1 + (seed >> 16) % kNodesPerFabric;
+        bool isControl          = (seed & 0x80) != 0;
+
+        if ((seed & 0x7) == 0)
+        {
+            DoNotOptimize(table.RemovePeer(fabricIndex, nodeId, isControl));
+            continue;
+        }
+        if (table.FindOrAddPeer(fabricIndex, nodeId, isControl, counter) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to add a group sender");
+            return;
+        }
+        DoNotOptimize(counter);
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupPeerTableChurn)
+
+/**
+ * Look up senders that are all already tracked, the common case of a steady group.
+ */
+void BenchmarkGroupPeerTableLookup(State & state)
+{
+    GroupPeerTable table;
+    PeerMessageCounter * counter = nullptr;
+    uint32_t index               = 0;
+
+    for (uint8_t fabric = 0; fabric < CHIP_CONFIG_MAX_FABRICS; fabric++)
+    {
+        for (NodeId node = 1; node <= CHIP_CONFIG_MAX_GROUP_DATA_PEERS; node++)
+        {
+            if (table.FindOrAddPeer(static_cast<FabricIndex>(fabric + 1), node, false, counter) != CHIP_NO_ERROR)
+            {
+                state.SkipWithError("Failed to fill the table");
+                return;
+            }
+        }
+    }
+
+    while (state.KeepRunning())
+    {
+        FabricIndex fabricIndex = static_cast<FabricIndex>(1 + index % CHIP_CONFIG_MAX_FABRICS);
+        NodeId nodeId           = 1 + (index / CHIP_CONFIG_MAX_FABRICS) % CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+        index++;
+
+        if (table.FindOrAddPeer(fabricIndex, nodeId, false, counter) != CHIP_NO_ERROR)
+        {
+            state.SkipWithError("Failed to find a group sender");
+            return;
+        }
+        DoNotOptimize(counter);
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+CHIP_REGISTER_BENCHMARK(BenchmarkGroupPeerTableLookup)
+
+} // namespace
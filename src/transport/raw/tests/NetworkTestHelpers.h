@@ -115,6 +115,16 @@ public:
             dropMessage = true;
             --mNumMessagesToDrop;
         }
+        else if (mMessageLossPerMille > 0)
+        {
+            // Spread the losses evenly rather than at random, so that runs can be reproduced.
+            mMessageLossAccumulator += mMessageLossPerMille;
+            if (mMessageLossAccumulator >= 1000)
+            {
+                dropMessage = true;
+                mMessageLossAccumulator -= 1000;
+            }
+        }
 
         if (dropMessage)
         {
@@ -143,6 +153,8 @@ public:
         mDroppedMessageCount              = 0;
         mSentMessageCount                 = 0;
         mNumMessagesToAllowBeforeDropping = 0;
+        mMessageLossPerMille              = 0;
+        mMessageLossAccumulator           = 0;
         mMessageSendError                 = CHIP_NO_ERROR;
     }
 
@@ -163,6 +175,9 @@ public:
     uint32_t mDroppedMessageCount              = 0;
     uint32_t mSentMessageCount                 = 0;
     uint32_t mNumMessagesToAllowBeforeDropping = 0;
+    // Share of the messages to drop, in thousandths, once the messages set up to be dropped above are.
+    uint32_t mMessageLossPerMille              = 0;
+    uint32_t mMessageLossAccumulator           = 0;
     CHIP_ERROR mMessageSendError               = CHIP_NO_ERROR;
     LoopbackTransportDelegate * mDelegate      = nullptr;
 };
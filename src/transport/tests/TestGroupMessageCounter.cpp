@@ -82,22 +82,15 @@ public:
 
         return kUndefinedFabricIndex;
     }
-    NodeId GetNodeIdAt(uint8_t fabricIndex, uint8_t index, bool isControl)
+    uint8_t GetPeerCount(FabricIndex fabricIndex, bool isControl)
     {
-        if (fabricIndex < CHIP_CONFIG_MAX_FABRICS)
+        chip::Transport::GroupFabric * groupFabric = FindFabric(fabricIndex);
+        if (groupFabric == nullptr)
         {
-            if (isControl && index < CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS)
-            {
-                return mGroupFabrics[fabricIndex].mControlGroupSenders[index].mNodeId;
-            }
-
-            if (!isControl && index < CHIP_CONFIG_MAX_GROUP_DATA_PEERS)
-            {
-                return mGroupFabrics[fabricIndex].mDataGroupSenders[index].mNodeId;
-            }
+            return 0;
         }
 
-        return kUndefinedNodeId;
+        return isControl ? groupFabric->mControlPeerCount : groupFabric->mDataPeerCount;
     }
 };
 
@@ -108,16 +101,19 @@ void AddPeerTest(nlTestSuite * inSuite, void * inContext)
     uint32_t i                                    = 0;
     CHIP_ERROR err                                = CHIP_NO_ERROR;
     chip::Transport::PeerMessageCounter * counter = nullptr;
-    chip::Transport::GroupPeerTable mGroupPeerMsgCounter;
+    TestGroupPeerTable mGroupPeerMsgCounter;
 
-    do
+    // A full fabric evicts its least recently used sender instead of refusing new ones
+    for (i = 0; i < CHIP_CONFIG_MAX_GROUP_DATA_PEERS + 1; i++)
     {
         err = mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, peerNodeId++, false, counter);
-        i++;
-
-    } while (err != CHIP_ERROR_TOO_MANY_PEER_NODES);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(fabricIndex, false) == CHIP_CONFIG_MAX_GROUP_DATA_PEERS);
 
-    NL_TEST_ASSERT(inSuite, i == CHIP_CONFIG_MAX_GROUP_DATA_PEERS + 1);
+    // The first sender was evicted
+    err = mGroupPeerMsgCounter.RemovePeer(fabricIndex, 1234, false);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_FOUND);
 
     i = 1;
     do
@@ -185,8 +181,9 @@ void RemovePeerTest(nlTestSuite * inSuite, void * inContext)
     err = mGroupPeerMsgCounter.FabricRemoved(99);
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_FOUND);
 
-    // Verify that the Fabric List was compacted.
-    NL_TEST_ASSERT(inSuite, 106 == mGroupPeerMsgCounter.GetFabricIndexAt(0));
+    // Fabric entries never move, the freed one is simply reused.
+    NL_TEST_ASSERT(inSuite, kUndefinedFabricIndex == mGroupPeerMsgCounter.GetFabricIndexAt(0));
+    NL_TEST_ASSERT(inSuite, 106 == mGroupPeerMsgCounter.GetFabricIndexAt(3));
 }
 
 void PeerRetrievalTest(nlTestSuite * inSuite, void * inContext)
@@ -320,32 +317,45 @@ void ReorderPeerRemovalTest(nlTestSuite * inSuite, void * inContext)
 
     err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1, true, counter);
     err = mGroupPeerMsgCounter.FindOrAddPeer(1, 2, true, counter);
+    chip::Transport::PeerMessageCounter * counter2 = counter;
     err = mGroupPeerMsgCounter.RemovePeer(1, 1, true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(0, 0, true) == 2);
+    // The remaining sender keeps its counter
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 2, true, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter == counter2);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(1, true) == 1);
 
     // with other list
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 1, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 2, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 3, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 4, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 5, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 6, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 7, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 8, false, counter);
-    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 9, false, counter);
+    for (NodeId nodeId = 1; nodeId <= 9; nodeId++)
+    {
+        err = mGroupPeerMsgCounter.FindOrAddPeer(2, nodeId, false, counter);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err = counter->VerifyOrTrustFirstGroup(static_cast<uint32_t>(nodeId * 1000));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        counter->CommitGroup(static_cast<uint32_t>(nodeId * 1000));
+    }
 
     err = mGroupPeerMsgCounter.RemovePeer(2, 7, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(1, 6, false) == 9);
-
     err = mGroupPeerMsgCounter.RemovePeer(2, 4, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(1, 3, false) == 8);
-
     err = mGroupPeerMsgCounter.RemovePeer(2, 1, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetNodeIdAt(1, 0, false) == 9);
+    err = mGroupPeerMsgCounter.RemovePeer(2, 1, false);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_FOUND);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(2, false) == 6);
+
+    // Validate that removals did not disturb the other senders' counters
+    for (NodeId nodeId = 1; nodeId <= 9; nodeId++)
+    {
+        err = mGroupPeerMsgCounter.FindOrAddPeer(2, nodeId, false, counter);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        err             = counter->VerifyOrTrustFirstGroup(static_cast<uint32_t>(nodeId * 1000));
+        bool wasRemoved = (nodeId == 1 || nodeId == 4 || nodeId == 7);
+        NL_TEST_ASSERT(inSuite, (err == CHIP_NO_ERROR) == wasRemoved);
+    }
 }
 
 void ReorderFabricRemovalTest(nlTestSuite * inSuite, void * inContext)
@@ -376,7 +386,7 @@ void ReorderFabricRemovalTest(nlTestSuite * inSuite, void * inContext)
     err = counter->VerifyOrTrustFirstGroup(1234);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 
-    // Set a counter that will be moved around
+    // Set a counter that must survive the removal of other fabrics
     err = counter->VerifyOrTrustFirstGroup(5656);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     counter->CommitGroup(5656);
@@ -387,18 +397,95 @@ void ReorderFabricRemovalTest(nlTestSuite * inSuite, void * inContext)
     // Per Spec CHIP_CONFIG_MAX_FABRICS can only be as low as 4
     err = mGroupPeerMsgCounter.RemovePeer(3, 1, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(2) == CHIP_CONFIG_MAX_FABRICS);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(2) == kUndefinedFabricIndex);
     err = mGroupPeerMsgCounter.RemovePeer(2, 1, false);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
-    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(1) == CHIP_CONFIG_MAX_FABRICS - 1);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetFabricIndexAt(1) == kUndefinedFabricIndex);
 
-    // Validate that counter value were moved around correctly
+    // Validate that counter values were preserved
     err = mGroupPeerMsgCounter.FindOrAddPeer(CHIP_CONFIG_MAX_FABRICS, 1, false, counter);
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     err = counter->VerifyOrTrustFirstGroup(4756);
     NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
 }
 
+void LeastRecentlyUsedEvictionTest(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err                                = CHIP_NO_ERROR;
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    TestGroupPeerTable mGroupPeerMsgCounter;
+
+    // Fill the control senders of fabric 1, and add a sender on fabric 2
+    for (NodeId nodeId = 1; nodeId <= CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS; nodeId++)
+    {
+        err = mGroupPeerMsgCounter.FindOrAddPeer(1, nodeId, true, counter);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+    err = mGroupPeerMsgCounter.FindOrAddPeer(2, 1, true, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Touch the first sender so the second one becomes the least recently used
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1, true, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = counter->VerifyOrTrustFirstGroup(5656);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    counter->CommitGroup(5656);
+
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 100, true, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(1, true) == CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS);
+
+    err = mGroupPeerMsgCounter.RemovePeer(1, 2, true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_NOT_FOUND);
+
+    // The recently used sender kept its counter, and the other fabric was not affected
+    err = mGroupPeerMsgCounter.FindOrAddPeer(1, 1, true, counter);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = counter->VerifyOrTrustFirstGroup(5656);
+    NL_TEST_ASSERT(inSuite, err != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(2, true) == 1);
+}
+
+void PeerTableChurnTest(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kIterations                = 2000;
+    constexpr uint32_t kNodesPerFabric            = 4 * CHIP_CONFIG_MAX_GROUP_DATA_PEERS;
+    CHIP_ERROR err                                = CHIP_NO_ERROR;
+    chip::Transport::PeerMessageCounter * counter = nullptr;
+    TestGroupPeerTable mGroupPeerMsgCounter;
+
+    // Churn every fabric with far more senders than the table can hold, mixing lookups, evictions and removals.
+    // The throughput of the same workload is measured by the transport benchmarks.
+    uint32_t state = 1;
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        state                   = state * 1103515245u + 12345u;
+        FabricIndex fabricIndex = static_cast<FabricIndex>(1 + (state >> 8) % CHIP_CONFIG_MAX_FABRICS);
+        NodeId nodeId           = 1 + (state >> 16) % kNodesPerFabric;
+        bool isControl          = (state & 0x80) != 0;
+
+        if ((state & 0x7) == 0)
+        {
+            err = mGroupPeerMsgCounter.RemovePeer(fabricIndex, nodeId, isControl);
+            NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_FOUND);
+            continue;
+        }
+
+        err = mGroupPeerMsgCounter.FindOrAddPeer(fabricIndex, nodeId, isControl, counter);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(fabricIndex, false) <= CHIP_CONFIG_MAX_GROUP_DATA_PEERS);
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(fabricIndex, true) <= CHIP_CONFIG_MAX_GROUP_CONTROL_PEERS);
+    }
+
+    for (uint8_t i = 0; i < CHIP_CONFIG_MAX_FABRICS; i++)
+    {
+        FabricIndex fabricIndex = static_cast<FabricIndex>(i + 1);
+        err                     = mGroupPeerMsgCounter.FabricRemoved(fabricIndex);
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR || err == CHIP_ERROR_NOT_FOUND);
+        NL_TEST_ASSERT(inSuite, mGroupPeerMsgCounter.GetPeerCount(fabricIndex, false) == 0);
+    }
+}
+
 void GroupMessageCounterTest(nlTestSuite * inSuite, void * inContext)
 {
 
@@ -468,6 +555,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("Counter Trust first",    CounterTrustFirstTest),
     NL_TEST_DEF("Reorder Peer removal",   ReorderPeerRemovalTest),
     NL_TEST_DEF("Reorder Fabric Removal", ReorderFabricRemovalTest),
+    NL_TEST_DEF("LRU eviction",           LeastRecentlyUsedEvictionTest),
+    NL_TEST_DEF("Peer table churn",       PeerTableChurnTest),
     NL_TEST_DEF("Group Message Counter",  GroupMessageCounterTest),
     NL_TEST_SENTINEL()
 };
@@ -19,6 +19,13 @@
 
 #include <app-common/zap-generated/cluster-objects.h>
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+#include <app/data-model/StructCodec.h>
+
+#include <stddef.h>
+#include <type_traits>
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+
 namespace chip {
 namespace app {
 namespace Clusters {
@@ -27,6 +34,26 @@ namespace detail {
 // Structs shared across multiple clusters.
 namespace Structs {
 namespace LabelStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::label), to_underlying(Fields::kLabel), offsetof(Type, label)>(),
+    DataModel::Field<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -68,6 +95,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace LabelStruct
 } // namespace Structs
@@ -77,6 +105,46 @@ namespace Identify {
 
 namespace Commands {
 namespace Identify {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::identifyTime), to_underlying(Fields::kIdentifyTime), offsetof(Type, identifyTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::identifyTime), to_underlying(Fields::kIdentifyTime), offsetof(T, identifyTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::identifyTime), &T::identifyTime, to_underlying(Fields::kIdentifyTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -112,8 +180,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Identify.
 namespace TriggerEffect {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::effectIdentifier), to_underlying(Fields::kEffectIdentifier),
+                              offsetof(Type, effectIdentifier)>(),
+    DataModel::EncodableField<decltype(Type::effectVariant), to_underlying(Fields::kEffectVariant),
+                              offsetof(Type, effectVariant)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::effectIdentifier), to_underlying(Fields::kEffectIdentifier),
+                                  offsetof(T, effectIdentifier)>(),
+        DataModel::DecodableField<decltype(T::effectVariant), to_underlying(Fields::kEffectVariant), offsetof(T, effectVariant)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::effectIdentifier), &T::effectIdentifier,
+                                        to_underlying(Fields::kEffectIdentifier)>(),
+        DataModel::DecodableMemberField<T, decltype(T::effectVariant), &T::effectVariant, to_underlying(Fields::kEffectVariant)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -153,6 +269,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TriggerEffect.
 } // namespace Commands
 
@@ -198,6 +315,49 @@ namespace Groups {
 
 namespace Commands {
 namespace AddGroup {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::groupName), to_underlying(Fields::kGroupName), offsetof(Type, groupName)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::groupName), to_underlying(Fields::kGroupName), offsetof(T, groupName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupName), &T::groupName, to_underlying(Fields::kGroupName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -237,8 +397,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddGroup.
 namespace AddGroupResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -278,8 +482,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddGroupResponse.
 namespace ViewGroup {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -315,8 +560,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ViewGroup.
 namespace ViewGroupResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::groupName), to_underlying(Fields::kGroupName), offsetof(Type, groupName)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::groupName), to_underlying(Fields::kGroupName), offsetof(T, groupName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupName), &T::groupName, to_underlying(Fields::kGroupName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -360,8 +652,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ViewGroupResponse.
 namespace GetGroupMembership {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupList), to_underlying(Fields::kGroupList), offsetof(Type, groupList)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupList), to_underlying(Fields::kGroupList), offsetof(T, groupList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupList), &T::groupList, to_underlying(Fields::kGroupList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -397,8 +730,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetGroupMembership.
 namespace GetGroupMembershipResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::capacity), to_underlying(Fields::kCapacity), offsetof(Type, capacity)>(),
+    DataModel::EncodableField<decltype(Type::groupList), to_underlying(Fields::kGroupList), offsetof(Type, groupList)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::capacity), to_underlying(Fields::kCapacity), offsetof(T, capacity)>(),
+        DataModel::DecodableField<decltype(T::groupList), to_underlying(Fields::kGroupList), offsetof(T, groupList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::capacity), &T::capacity, to_underlying(Fields::kCapacity)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupList), &T::groupList, to_underlying(Fields::kGroupList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -438,8 +815,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetGroupMembershipResponse.
 namespace RemoveGroup {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -475,8 +893,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveGroup.
 namespace RemoveGroupResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -516,8 +978,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveGroupResponse.
 namespace RemoveAllGroups {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -549,8 +1049,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveAllGroups.
 namespace AddGroupIfIdentifying {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::groupName), to_underlying(Fields::kGroupName), offsetof(Type, groupName)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::groupName), to_underlying(Fields::kGroupName), offsetof(T, groupName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupName), &T::groupName, to_underlying(Fields::kGroupName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -590,6 +1134,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddGroupIfIdentifying.
 } // namespace Commands
 
@@ -631,6 +1176,33 @@ namespace Events {
 namespace Scenes {
 namespace Structs {
 namespace AttributeValuePair {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::attributeId), to_underlying(Fields::kAttributeId), offsetof(Type, attributeId)>(),
+    DataModel::EncodableField<decltype(Type::attributeValue), to_underlying(Fields::kAttributeValue),
+                              offsetof(Type, attributeValue)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::attributeId), &DecodableType::attributeId,
+                                    to_underlying(Fields::kAttributeId)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::attributeValue), &DecodableType::attributeValue,
+                                    to_underlying(Fields::kAttributeValue)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -672,9 +1244,37 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace AttributeValuePair
 namespace ExtensionFieldSet {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::clusterId), to_underlying(Fields::kClusterId), offsetof(Type, clusterId)>(),
+    DataModel::EncodableField<decltype(Type::attributeValueList), to_underlying(Fields::kAttributeValueList),
+                              offsetof(Type, attributeValueList)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::clusterId), &DecodableType::clusterId,
+                                    to_underlying(Fields::kClusterId)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::attributeValueList), &DecodableType::attributeValueList,
+                                    to_underlying(Fields::kAttributeValueList)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -717,12 +1317,71 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ExtensionFieldSet
 } // namespace Structs
 
 namespace Commands {
 namespace AddScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::sceneName), to_underlying(Fields::kSceneName), offsetof(Type, sceneName)>(),
+    DataModel::EncodableField<decltype(Type::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                              offsetof(Type, extensionFieldSets)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::sceneName), to_underlying(Fields::kSceneName), offsetof(T, sceneName)>(),
+        DataModel::DecodableField<decltype(T::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                                  offsetof(T, extensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneName), &T::sceneName, to_underlying(Fields::kSceneName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::extensionFieldSets), &T::extensionFieldSets,
+                                        to_underlying(Fields::kExtensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -775,8 +1434,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddScene.
 namespace AddSceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -820,8 +1526,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddSceneResponse.
 namespace ViewScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -861,8 +1611,70 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ViewScene.
 namespace ViewSceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::sceneName), to_underlying(Fields::kSceneName), offsetof(Type, sceneName)>(),
+    DataModel::EncodableField<decltype(Type::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                              offsetof(Type, extensionFieldSets)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::sceneName), to_underlying(Fields::kSceneName), offsetof(T, sceneName)>(),
+        DataModel::DecodableField<decltype(T::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                                  offsetof(T, extensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneName), &T::sceneName, to_underlying(Fields::kSceneName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::extensionFieldSets), &T::extensionFieldSets,
+                                        to_underlying(Fields::kExtensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -919,8 +1731,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ViewSceneResponse.
 namespace RemoveScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -960,8 +1816,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveScene.
 namespace RemoveSceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1005,8 +1908,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveSceneResponse.
 namespace RemoveAllScenes {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1042,8 +1986,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveAllScenes.
 namespace RemoveAllScenesResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1083,8 +2071,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveAllScenesResponse.
 namespace StoreScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1124,8 +2156,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StoreScene.
 namespace StoreSceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1169,8 +2248,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StoreSceneResponse.
 namespace RecallScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1214,8 +2343,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RecallScene.
 namespace GetSceneMembership {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1251,8 +2421,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetSceneMembership.
 namespace GetSceneMembershipResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::capacity), to_underlying(Fields::kCapacity), offsetof(Type, capacity)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneList), to_underlying(Fields::kSceneList), offsetof(Type, sceneList)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::capacity), to_underlying(Fields::kCapacity), offsetof(T, capacity)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneList), to_underlying(Fields::kSceneList), offsetof(T, sceneList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::capacity), &T::capacity, to_underlying(Fields::kCapacity)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneList), &T::sceneList, to_underlying(Fields::kSceneList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1300,8 +2520,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetSceneMembershipResponse.
 namespace EnhancedAddScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::sceneName), to_underlying(Fields::kSceneName), offsetof(Type, sceneName)>(),
+    DataModel::EncodableField<decltype(Type::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                              offsetof(Type, extensionFieldSets)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::sceneName), to_underlying(Fields::kSceneName), offsetof(T, sceneName)>(),
+        DataModel::DecodableField<decltype(T::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                                  offsetof(T, extensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneName), &T::sceneName, to_underlying(Fields::kSceneName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::extensionFieldSets), &T::extensionFieldSets,
+                                        to_underlying(Fields::kExtensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1354,8 +2633,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedAddScene.
 namespace EnhancedAddSceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1399,8 +2725,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedAddSceneResponse.
 namespace EnhancedViewScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1440,8 +2810,70 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedViewScene.
 namespace EnhancedViewSceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::sceneId), to_underlying(Fields::kSceneId), offsetof(Type, sceneId)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::sceneName), to_underlying(Fields::kSceneName), offsetof(Type, sceneName)>(),
+    DataModel::EncodableField<decltype(Type::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                              offsetof(Type, extensionFieldSets)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupId), to_underlying(Fields::kGroupId), offsetof(T, groupId)>(),
+        DataModel::DecodableField<decltype(T::sceneId), to_underlying(Fields::kSceneId), offsetof(T, sceneId)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::sceneName), to_underlying(Fields::kSceneName), offsetof(T, sceneName)>(),
+        DataModel::DecodableField<decltype(T::extensionFieldSets), to_underlying(Fields::kExtensionFieldSets),
+                                  offsetof(T, extensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupId), &T::groupId, to_underlying(Fields::kGroupId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneId), &T::sceneId, to_underlying(Fields::kSceneId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneName), &T::sceneName, to_underlying(Fields::kSceneName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::extensionFieldSets), &T::extensionFieldSets,
+                                        to_underlying(Fields::kExtensionFieldSets)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1498,8 +2930,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedViewSceneResponse.
 namespace CopyScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::mode), to_underlying(Fields::kMode), offsetof(Type, mode)>(),
+    DataModel::EncodableField<decltype(Type::groupIdFrom), to_underlying(Fields::kGroupIdFrom), offsetof(Type, groupIdFrom)>(),
+    DataModel::EncodableField<decltype(Type::sceneIdFrom), to_underlying(Fields::kSceneIdFrom), offsetof(Type, sceneIdFrom)>(),
+    DataModel::EncodableField<decltype(Type::groupIdTo), to_underlying(Fields::kGroupIdTo), offsetof(Type, groupIdTo)>(),
+    DataModel::EncodableField<decltype(Type::sceneIdTo), to_underlying(Fields::kSceneIdTo), offsetof(Type, sceneIdTo)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::mode), to_underlying(Fields::kMode), offsetof(T, mode)>(),
+        DataModel::DecodableField<decltype(T::groupIdFrom), to_underlying(Fields::kGroupIdFrom), offsetof(T, groupIdFrom)>(),
+        DataModel::DecodableField<decltype(T::sceneIdFrom), to_underlying(Fields::kSceneIdFrom), offsetof(T, sceneIdFrom)>(),
+        DataModel::DecodableField<decltype(T::groupIdTo), to_underlying(Fields::kGroupIdTo), offsetof(T, groupIdTo)>(),
+        DataModel::DecodableField<decltype(T::sceneIdTo), to_underlying(Fields::kSceneIdTo), offsetof(T, sceneIdTo)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::mode), &T::mode, to_underlying(Fields::kMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupIdFrom), &T::groupIdFrom, to_underlying(Fields::kGroupIdFrom)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneIdFrom), &T::sceneIdFrom, to_underlying(Fields::kSceneIdFrom)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupIdTo), &T::groupIdTo, to_underlying(Fields::kGroupIdTo)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneIdTo), &T::sceneIdTo, to_underlying(Fields::kSceneIdTo)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1551,8 +3036,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CopyScene.
 namespace CopySceneResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::groupIdFrom), to_underlying(Fields::kGroupIdFrom), offsetof(Type, groupIdFrom)>(),
+    DataModel::EncodableField<decltype(Type::sceneIdFrom), to_underlying(Fields::kSceneIdFrom), offsetof(Type, sceneIdFrom)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::groupIdFrom), to_underlying(Fields::kGroupIdFrom), offsetof(T, groupIdFrom)>(),
+        DataModel::DecodableField<decltype(T::sceneIdFrom), to_underlying(Fields::kSceneIdFrom), offsetof(T, sceneIdFrom)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::groupIdFrom), &T::groupIdFrom, to_underlying(Fields::kGroupIdFrom)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sceneIdFrom), &T::sceneIdFrom, to_underlying(Fields::kSceneIdFrom)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1596,6 +3128,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CopySceneResponse.
 } // namespace Commands
 
@@ -1653,6 +3186,43 @@ namespace OnOff {
 
 namespace Commands {
 namespace Off {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1684,8 +3254,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Off.
 namespace On {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1717,8 +3325,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace On.
 namespace Toggle {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1750,8 +3396,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Toggle.
 namespace OffWithEffect {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::effectId), to_underlying(Fields::kEffectId), offsetof(Type, effectId)>(),
+    DataModel::EncodableField<decltype(Type::effectVariant), to_underlying(Fields::kEffectVariant),
+                              offsetof(Type, effectVariant)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::effectId), to_underlying(Fields::kEffectId), offsetof(T, effectId)>(),
+        DataModel::DecodableField<decltype(T::effectVariant), to_underlying(Fields::kEffectVariant), offsetof(T, effectVariant)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::effectId), &T::effectId, to_underlying(Fields::kEffectId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::effectVariant), &T::effectVariant, to_underlying(Fields::kEffectVariant)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1791,8 +3482,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace OffWithEffect.
 namespace OnWithRecallGlobalScene {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1824,8 +3553,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace OnWithRecallGlobalScene.
 namespace OnWithTimedOff {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::onOffControl), to_underlying(Fields::kOnOffControl), offsetof(Type, onOffControl)>(),
+    DataModel::EncodableField<decltype(Type::onTime), to_underlying(Fields::kOnTime), offsetof(Type, onTime)>(),
+    DataModel::EncodableField<decltype(Type::offWaitTime), to_underlying(Fields::kOffWaitTime), offsetof(Type, offWaitTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::onOffControl), to_underlying(Fields::kOnOffControl), offsetof(T, onOffControl)>(),
+        DataModel::DecodableField<decltype(T::onTime), to_underlying(Fields::kOnTime), offsetof(T, onTime)>(),
+        DataModel::DecodableField<decltype(T::offWaitTime), to_underlying(Fields::kOffWaitTime), offsetof(T, offWaitTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::onOffControl), &T::onOffControl, to_underlying(Fields::kOnOffControl)>(),
+        DataModel::DecodableMemberField<T, decltype(T::onTime), &T::onTime, to_underlying(Fields::kOnTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::offWaitTime), &T::offWaitTime, to_underlying(Fields::kOffWaitTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -1869,6 +3645,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace OnWithTimedOff.
 } // namespace Commands
 
@@ -1966,6 +3743,61 @@ namespace LevelControl {
 
 namespace Commands {
 namespace MoveToLevel {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::level), to_underlying(Fields::kLevel), offsetof(Type, level)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::level), to_underlying(Fields::kLevel), offsetof(T, level)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::level), &T::level, to_underlying(Fields::kLevel)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2013,8 +3845,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToLevel.
 namespace Move {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::moveMode), to_underlying(Fields::kMoveMode), offsetof(Type, moveMode)>(),
+    DataModel::EncodableField<decltype(Type::rate), to_underlying(Fields::kRate), offsetof(Type, rate)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::moveMode), to_underlying(Fields::kMoveMode), offsetof(T, moveMode)>(),
+        DataModel::DecodableField<decltype(T::rate), to_underlying(Fields::kRate), offsetof(T, rate)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::moveMode), &T::moveMode, to_underlying(Fields::kMoveMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rate), &T::rate, to_underlying(Fields::kRate)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2062,8 +3947,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Move.
 namespace Step {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepMode), to_underlying(Fields::kStepMode), offsetof(Type, stepMode)>(),
+    DataModel::EncodableField<decltype(Type::stepSize), to_underlying(Fields::kStepSize), offsetof(Type, stepSize)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepMode), to_underlying(Fields::kStepMode), offsetof(T, stepMode)>(),
+        DataModel::DecodableField<decltype(T::stepSize), to_underlying(Fields::kStepSize), offsetof(T, stepSize)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepMode), &T::stepMode, to_underlying(Fields::kStepMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepSize), &T::stepSize, to_underlying(Fields::kStepSize)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2115,8 +4059,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Step.
 namespace Stop {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2156,8 +4147,64 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Stop.
 namespace MoveToLevelWithOnOff {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::level), to_underlying(Fields::kLevel), offsetof(Type, level)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::level), to_underlying(Fields::kLevel), offsetof(T, level)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::level), &T::level, to_underlying(Fields::kLevel)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2205,8 +4252,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToLevelWithOnOff.
 namespace MoveWithOnOff {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::moveMode), to_underlying(Fields::kMoveMode), offsetof(Type, moveMode)>(),
+    DataModel::EncodableField<decltype(Type::rate), to_underlying(Fields::kRate), offsetof(Type, rate)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::moveMode), to_underlying(Fields::kMoveMode), offsetof(T, moveMode)>(),
+        DataModel::DecodableField<decltype(T::rate), to_underlying(Fields::kRate), offsetof(T, rate)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::moveMode), &T::moveMode, to_underlying(Fields::kMoveMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rate), &T::rate, to_underlying(Fields::kRate)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2254,8 +4354,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveWithOnOff.
 namespace StepWithOnOff {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepMode), to_underlying(Fields::kStepMode), offsetof(Type, stepMode)>(),
+    DataModel::EncodableField<decltype(Type::stepSize), to_underlying(Fields::kStepSize), offsetof(Type, stepSize)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepMode), to_underlying(Fields::kStepMode), offsetof(T, stepMode)>(),
+        DataModel::DecodableField<decltype(T::stepSize), to_underlying(Fields::kStepSize), offsetof(T, stepSize)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepMode), &T::stepMode, to_underlying(Fields::kStepMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepSize), &T::stepSize, to_underlying(Fields::kStepSize)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2307,8 +4466,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StepWithOnOff.
 namespace StopWithOnOff {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2348,8 +4554,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StopWithOnOff.
 namespace MoveToClosestFrequency {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::frequency), to_underlying(Fields::kFrequency), offsetof(Type, frequency)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::frequency), to_underlying(Fields::kFrequency), offsetof(T, frequency)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::frequency), &T::frequency, to_underlying(Fields::kFrequency)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2385,6 +4632,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToClosestFrequency.
 } // namespace Commands
 
@@ -2566,6 +4814,26 @@ namespace Events {
 namespace Descriptor {
 namespace Structs {
 namespace DeviceTypeStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::Field<decltype(Type::revision), to_underlying(Fields::kRevision), offsetof(Type, revision)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2607,6 +4875,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace DeviceTypeStruct
 } // namespace Structs
@@ -2671,6 +4940,30 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::node), to_underlying(Fields::kNode), offsetof(Type, node)>(),
+    DataModel::Field<decltype(Type::group), to_underlying(Fields::kGroup), offsetof(Type, group)>(),
+    DataModel::Field<decltype(Type::endpoint), to_underlying(Fields::kEndpoint), offsetof(Type, endpoint)>(),
+    DataModel::Field<decltype(Type::cluster), to_underlying(Fields::kCluster), offsetof(Type, cluster)>(),
+    DataModel::Field<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                     offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     TLV::TLVType outer;
@@ -2727,6 +5020,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace TargetStruct
 } // namespace Structs
@@ -2772,6 +5066,27 @@ namespace Events {
 namespace AccessControl {
 namespace Structs {
 namespace Target {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::cluster), to_underlying(Fields::kCluster), offsetof(Type, cluster)>(),
+    DataModel::Field<decltype(Type::endpoint), to_underlying(Fields::kEndpoint), offsetof(Type, endpoint)>(),
+    DataModel::Field<decltype(Type::deviceType), to_underlying(Fields::kDeviceType), offsetof(Type, deviceType)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -2817,6 +5132,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace Target
 namespace AccessControlEntry {
@@ -2830,6 +5146,46 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::privilege), to_underlying(Fields::kPrivilege),
+                              offsetof(Type, privilege)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::authMode), to_underlying(Fields::kAuthMode),
+                              offsetof(Type, authMode)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::subjects), to_underlying(Fields::kSubjects),
+                              offsetof(Type, subjects)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::targets), to_underlying(Fields::kTargets),
+                              offsetof(Type, targets)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                              offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::privilege), &DecodableType::privilege,
+                                    to_underlying(Fields::kPrivilege)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::authMode), &DecodableType::authMode,
+                                    to_underlying(Fields::kAuthMode)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::subjects), &DecodableType::subjects,
+                                    to_underlying(Fields::kSubjects)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::targets), &DecodableType::targets,
+                                    to_underlying(Fields::kTargets)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricIndex), &DecodableType::fabricIndex,
+                                    to_underlying(Fields::kFabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     bool includeSensitive = !accessingFabricIndex.HasValue() || (accessingFabricIndex.Value() == fabricIndex);
@@ -2899,6 +5255,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace AccessControlEntry
 namespace ExtensionEntry {
@@ -2912,6 +5269,28 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::data), to_underlying(Fields::kData),
+                     offsetof(Type, data)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::Field<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                     offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     bool includeSensitive = !accessingFabricIndex.HasValue() || (accessingFabricIndex.Value() == fabricIndex);
@@ -2960,6 +5339,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ExtensionEntry
 } // namespace Structs
@@ -3012,6 +5392,62 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace AccessControlEntryChanged {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::adminNodeID), to_underlying(Fields::kAdminNodeID), offsetof(Type, adminNodeID)>(),
+    DataModel::EncodableField<decltype(Type::adminPasscodeID), to_underlying(Fields::kAdminPasscodeID),
+                              offsetof(Type, adminPasscodeID)>(),
+    DataModel::EncodableField<decltype(Type::changeType), to_underlying(Fields::kChangeType), offsetof(Type, changeType)>(),
+    DataModel::EncodableForReadField<decltype(Type::latestValue), to_underlying(Fields::kLatestValue),
+                                     offsetof(Type, latestValue)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::adminNodeID), to_underlying(Fields::kAdminNodeID), offsetof(T, adminNodeID)>(),
+        DataModel::DecodableField<decltype(T::adminPasscodeID), to_underlying(Fields::kAdminPasscodeID),
+                                  offsetof(T, adminPasscodeID)>(),
+        DataModel::DecodableField<decltype(T::changeType), to_underlying(Fields::kChangeType), offsetof(T, changeType)>(),
+        DataModel::DecodableField<decltype(T::latestValue), to_underlying(Fields::kLatestValue), offsetof(T, latestValue)>(),
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::adminNodeID), &T::adminNodeID, to_underlying(Fields::kAdminNodeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::adminPasscodeID), &T::adminPasscodeID,
+                                        to_underlying(Fields::kAdminPasscodeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::changeType), &T::changeType, to_underlying(Fields::kChangeType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::latestValue), &T::latestValue, to_underlying(Fields::kLatestValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields, GetFabricIndex());
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3064,8 +5500,65 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AccessControlEntryChanged.
 namespace AccessControlExtensionChanged {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::adminNodeID), to_underlying(Fields::kAdminNodeID), offsetof(Type, adminNodeID)>(),
+    DataModel::EncodableField<decltype(Type::adminPasscodeID), to_underlying(Fields::kAdminPasscodeID),
+                              offsetof(Type, adminPasscodeID)>(),
+    DataModel::EncodableField<decltype(Type::changeType), to_underlying(Fields::kChangeType), offsetof(Type, changeType)>(),
+    DataModel::EncodableForReadField<decltype(Type::latestValue), to_underlying(Fields::kLatestValue),
+                                     offsetof(Type, latestValue)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::adminNodeID), to_underlying(Fields::kAdminNodeID), offsetof(T, adminNodeID)>(),
+        DataModel::DecodableField<decltype(T::adminPasscodeID), to_underlying(Fields::kAdminPasscodeID),
+                                  offsetof(T, adminPasscodeID)>(),
+        DataModel::DecodableField<decltype(T::changeType), to_underlying(Fields::kChangeType), offsetof(T, changeType)>(),
+        DataModel::DecodableField<decltype(T::latestValue), to_underlying(Fields::kLatestValue), offsetof(T, latestValue)>(),
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::adminNodeID), &T::adminNodeID, to_underlying(Fields::kAdminNodeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::adminPasscodeID), &T::adminPasscodeID,
+                                        to_underlying(Fields::kAdminPasscodeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::changeType), &T::changeType, to_underlying(Fields::kChangeType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::latestValue), &T::latestValue, to_underlying(Fields::kLatestValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields, GetFabricIndex());
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3118,6 +5611,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AccessControlExtensionChanged.
 } // namespace Events
 
@@ -3125,6 +5619,31 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Actions {
 namespace Structs {
 namespace ActionStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::Field<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::Field<decltype(Type::endpointListID), to_underlying(Fields::kEndpointListID), offsetof(Type, endpointListID)>(),
+    DataModel::Field<decltype(Type::supportedCommands), to_underlying(Fields::kSupportedCommands),
+                     offsetof(Type, supportedCommands)>(),
+    DataModel::Field<decltype(Type::state), to_underlying(Fields::kState), offsetof(Type, state)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3182,9 +5701,43 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ActionStruct
 namespace EndpointListStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::endpointListID), to_underlying(Fields::kEndpointListID),
+                              offsetof(Type, endpointListID)>(),
+    DataModel::EncodableField<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::EncodableField<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::EncodableField<decltype(Type::endpoints), to_underlying(Fields::kEndpoints), offsetof(Type, endpoints)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::endpointListID), &DecodableType::endpointListID,
+                                    to_underlying(Fields::kEndpointListID)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::name), &DecodableType::name,
+                                    to_underlying(Fields::kName)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::type), &DecodableType::type,
+                                    to_underlying(Fields::kType)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::endpoints), &DecodableType::endpoints,
+                                    to_underlying(Fields::kEndpoints)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3234,12 +5787,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace EndpointListStruct
 } // namespace Structs
 
 namespace Commands {
 namespace InstantAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3279,8 +5876,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace InstantAction.
 namespace InstantActionWithTransition {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3324,8 +5971,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace InstantActionWithTransition.
 namespace StartAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3365,8 +6056,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StartAction.
 namespace StartActionWithDuration {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::duration), to_underlying(Fields::kDuration), offsetof(Type, duration)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::duration), to_underlying(Fields::kDuration), offsetof(T, duration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::duration), &T::duration, to_underlying(Fields::kDuration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3410,8 +6148,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StartActionWithDuration.
 namespace StopAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3451,8 +6233,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StopAction.
 namespace PauseAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3492,8 +6318,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace PauseAction.
 namespace PauseActionWithDuration {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::duration), to_underlying(Fields::kDuration), offsetof(Type, duration)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::duration), to_underlying(Fields::kDuration), offsetof(T, duration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::duration), &T::duration, to_underlying(Fields::kDuration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3537,8 +6410,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace PauseActionWithDuration.
 namespace ResumeAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3578,8 +6495,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ResumeAction.
 namespace EnableAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3619,8 +6580,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnableAction.
 namespace EnableActionWithDuration {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::duration), to_underlying(Fields::kDuration), offsetof(Type, duration)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::duration), to_underlying(Fields::kDuration), offsetof(T, duration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::duration), &T::duration, to_underlying(Fields::kDuration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3664,8 +6672,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnableActionWithDuration.
 namespace DisableAction {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3705,8 +6757,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DisableAction.
 namespace DisableActionWithDuration {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::duration), to_underlying(Fields::kDuration), offsetof(Type, duration)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::duration), to_underlying(Fields::kDuration), offsetof(T, duration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::duration), &T::duration, to_underlying(Fields::kDuration)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3750,6 +6849,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DisableActionWithDuration.
 } // namespace Commands
 
@@ -3792,6 +6892,52 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace StateChanged {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::newState), to_underlying(Fields::kNewState), offsetof(Type, newState)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::newState), to_underlying(Fields::kNewState), offsetof(T, newState)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::newState), &T::newState, to_underlying(Fields::kNewState)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3835,8 +6981,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StateChanged.
 namespace ActionFailed {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::actionID), to_underlying(Fields::kActionID), offsetof(Type, actionID)>(),
+    DataModel::EncodableField<decltype(Type::invokeID), to_underlying(Fields::kInvokeID), offsetof(Type, invokeID)>(),
+    DataModel::EncodableField<decltype(Type::newState), to_underlying(Fields::kNewState), offsetof(Type, newState)>(),
+    DataModel::EncodableField<decltype(Type::error), to_underlying(Fields::kError), offsetof(Type, error)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::actionID), to_underlying(Fields::kActionID), offsetof(T, actionID)>(),
+        DataModel::DecodableField<decltype(T::invokeID), to_underlying(Fields::kInvokeID), offsetof(T, invokeID)>(),
+        DataModel::DecodableField<decltype(T::newState), to_underlying(Fields::kNewState), offsetof(T, newState)>(),
+        DataModel::DecodableField<decltype(T::error), to_underlying(Fields::kError), offsetof(T, error)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::actionID), &T::actionID, to_underlying(Fields::kActionID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::invokeID), &T::invokeID, to_underlying(Fields::kInvokeID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::newState), &T::newState, to_underlying(Fields::kNewState)>(),
+        DataModel::DecodableMemberField<T, decltype(T::error), &T::error, to_underlying(Fields::kError)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3884,6 +7080,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ActionFailed.
 } // namespace Events
 
@@ -3891,6 +7088,28 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Basic {
 namespace Structs {
 namespace CapabilityMinimaStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::caseSessionsPerFabric), to_underlying(Fields::kCaseSessionsPerFabric),
+                     offsetof(Type, caseSessionsPerFabric)>(),
+    DataModel::Field<decltype(Type::subscriptionsPerFabric), to_underlying(Fields::kSubscriptionsPerFabric),
+                     offsetof(Type, subscriptionsPerFabric)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3934,12 +7153,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace CapabilityMinimaStruct
 } // namespace Structs
 
 namespace Commands {
 namespace MfgSpecificPing {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -3971,6 +7228,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MfgSpecificPing.
 } // namespace Commands
 
@@ -4064,6 +7322,49 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace StartUp {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4099,8 +7400,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StartUp.
 namespace ShutDown {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4132,8 +7471,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ShutDown.
 namespace Leave {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4169,8 +7549,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Leave.
 namespace ReachableChanged {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::reachableNewValue), to_underlying(Fields::kReachableNewValue),
+                              offsetof(Type, reachableNewValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::reachableNewValue), to_underlying(Fields::kReachableNewValue),
+                                  offsetof(T, reachableNewValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::reachableNewValue), &T::reachableNewValue,
+                                        to_underlying(Fields::kReachableNewValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4206,6 +7630,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ReachableChanged.
 } // namespace Events
 
@@ -4214,6 +7639,82 @@ namespace OtaSoftwareUpdateProvider {
 
 namespace Commands {
 namespace QueryImage {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::vendorId), to_underlying(Fields::kVendorId), offsetof(Type, vendorId)>(),
+    DataModel::EncodableField<decltype(Type::productId), to_underlying(Fields::kProductId), offsetof(Type, productId)>(),
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::EncodableField<decltype(Type::protocolsSupported), to_underlying(Fields::kProtocolsSupported),
+                              offsetof(Type, protocolsSupported)>(),
+    DataModel::EncodableField<decltype(Type::hardwareVersion), to_underlying(Fields::kHardwareVersion),
+                              offsetof(Type, hardwareVersion)>(),
+    DataModel::EncodableField<decltype(Type::location), to_underlying(Fields::kLocation), offsetof(Type, location)>(),
+    DataModel::EncodableField<decltype(Type::requestorCanConsent), to_underlying(Fields::kRequestorCanConsent),
+                              offsetof(Type, requestorCanConsent)>(),
+    DataModel::EncodableField<decltype(Type::metadataForProvider), to_underlying(Fields::kMetadataForProvider),
+                              offsetof(Type, metadataForProvider)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::vendorId), to_underlying(Fields::kVendorId), offsetof(T, vendorId)>(),
+        DataModel::DecodableField<decltype(T::productId), to_underlying(Fields::kProductId), offsetof(T, productId)>(),
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::DecodableField<decltype(T::protocolsSupported), to_underlying(Fields::kProtocolsSupported),
+                                  offsetof(T, protocolsSupported)>(),
+        DataModel::DecodableField<decltype(T::hardwareVersion), to_underlying(Fields::kHardwareVersion),
+                                  offsetof(T, hardwareVersion)>(),
+        DataModel::DecodableField<decltype(T::location), to_underlying(Fields::kLocation), offsetof(T, location)>(),
+        DataModel::DecodableField<decltype(T::requestorCanConsent), to_underlying(Fields::kRequestorCanConsent),
+                                  offsetof(T, requestorCanConsent)>(),
+        DataModel::DecodableField<decltype(T::metadataForProvider), to_underlying(Fields::kMetadataForProvider),
+                                  offsetof(T, metadataForProvider)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::vendorId), &T::vendorId, to_underlying(Fields::kVendorId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::productId), &T::productId, to_underlying(Fields::kProductId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::DecodableMemberField<T, decltype(T::protocolsSupported), &T::protocolsSupported,
+                                        to_underlying(Fields::kProtocolsSupported)>(),
+        DataModel::DecodableMemberField<T, decltype(T::hardwareVersion), &T::hardwareVersion,
+                                        to_underlying(Fields::kHardwareVersion)>(),
+        DataModel::DecodableMemberField<T, decltype(T::location), &T::location, to_underlying(Fields::kLocation)>(),
+        DataModel::DecodableMemberField<T, decltype(T::requestorCanConsent), &T::requestorCanConsent,
+                                        to_underlying(Fields::kRequestorCanConsent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::metadataForProvider), &T::metadataForProvider,
+                                        to_underlying(Fields::kMetadataForProvider)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4280,8 +7781,85 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace QueryImage.
 namespace QueryImageResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::delayedActionTime), to_underlying(Fields::kDelayedActionTime),
+                              offsetof(Type, delayedActionTime)>(),
+    DataModel::EncodableField<decltype(Type::imageURI), to_underlying(Fields::kImageURI), offsetof(Type, imageURI)>(),
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::EncodableField<decltype(Type::softwareVersionString), to_underlying(Fields::kSoftwareVersionString),
+                              offsetof(Type, softwareVersionString)>(),
+    DataModel::EncodableField<decltype(Type::updateToken), to_underlying(Fields::kUpdateToken), offsetof(Type, updateToken)>(),
+    DataModel::EncodableField<decltype(Type::userConsentNeeded), to_underlying(Fields::kUserConsentNeeded),
+                              offsetof(Type, userConsentNeeded)>(),
+    DataModel::EncodableField<decltype(Type::metadataForRequestor), to_underlying(Fields::kMetadataForRequestor),
+                              offsetof(Type, metadataForRequestor)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::delayedActionTime), to_underlying(Fields::kDelayedActionTime),
+                                  offsetof(T, delayedActionTime)>(),
+        DataModel::DecodableField<decltype(T::imageURI), to_underlying(Fields::kImageURI), offsetof(T, imageURI)>(),
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::DecodableField<decltype(T::softwareVersionString), to_underlying(Fields::kSoftwareVersionString),
+                                  offsetof(T, softwareVersionString)>(),
+        DataModel::DecodableField<decltype(T::updateToken), to_underlying(Fields::kUpdateToken), offsetof(T, updateToken)>(),
+        DataModel::DecodableField<decltype(T::userConsentNeeded), to_underlying(Fields::kUserConsentNeeded),
+                                  offsetof(T, userConsentNeeded)>(),
+        DataModel::DecodableField<decltype(T::metadataForRequestor), to_underlying(Fields::kMetadataForRequestor),
+                                  offsetof(T, metadataForRequestor)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::delayedActionTime), &T::delayedActionTime,
+                                        to_underlying(Fields::kDelayedActionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::imageURI), &T::imageURI, to_underlying(Fields::kImageURI)>(),
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersionString), &T::softwareVersionString,
+                                        to_underlying(Fields::kSoftwareVersionString)>(),
+        DataModel::DecodableMemberField<T, decltype(T::updateToken), &T::updateToken, to_underlying(Fields::kUpdateToken)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userConsentNeeded), &T::userConsentNeeded,
+                                        to_underlying(Fields::kUserConsentNeeded)>(),
+        DataModel::DecodableMemberField<T, decltype(T::metadataForRequestor), &T::metadataForRequestor,
+                                        to_underlying(Fields::kMetadataForRequestor)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4347,8 +7925,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace QueryImageResponse.
 namespace ApplyUpdateRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::updateToken), to_underlying(Fields::kUpdateToken), offsetof(Type, updateToken)>(),
+    DataModel::EncodableField<decltype(Type::newVersion), to_underlying(Fields::kNewVersion), offsetof(Type, newVersion)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::updateToken), to_underlying(Fields::kUpdateToken), offsetof(T, updateToken)>(),
+        DataModel::DecodableField<decltype(T::newVersion), to_underlying(Fields::kNewVersion), offsetof(T, newVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::updateToken), &T::updateToken, to_underlying(Fields::kUpdateToken)>(),
+        DataModel::DecodableMemberField<T, decltype(T::newVersion), &T::newVersion, to_underlying(Fields::kNewVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4388,8 +8010,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ApplyUpdateRequest.
 namespace ApplyUpdateResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::action), to_underlying(Fields::kAction), offsetof(Type, action)>(),
+    DataModel::EncodableField<decltype(Type::delayedActionTime), to_underlying(Fields::kDelayedActionTime),
+                              offsetof(Type, delayedActionTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::action), to_underlying(Fields::kAction), offsetof(T, action)>(),
+        DataModel::DecodableField<decltype(T::delayedActionTime), to_underlying(Fields::kDelayedActionTime),
+                                  offsetof(T, delayedActionTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::action), &T::action, to_underlying(Fields::kAction)>(),
+        DataModel::DecodableMemberField<T, decltype(T::delayedActionTime), &T::delayedActionTime,
+                                        to_underlying(Fields::kDelayedActionTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4429,8 +8098,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ApplyUpdateResponse.
 namespace NotifyUpdateApplied {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::updateToken), to_underlying(Fields::kUpdateToken), offsetof(Type, updateToken)>(),
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::updateToken), to_underlying(Fields::kUpdateToken), offsetof(T, updateToken)>(),
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::updateToken), &T::updateToken, to_underlying(Fields::kUpdateToken)>(),
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4470,6 +8186,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NotifyUpdateApplied.
 } // namespace Commands
 
@@ -4518,6 +8235,28 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::providerNodeID), to_underlying(Fields::kProviderNodeID), offsetof(Type, providerNodeID)>(),
+    DataModel::Field<decltype(Type::endpoint), to_underlying(Fields::kEndpoint), offsetof(Type, endpoint)>(),
+    DataModel::Field<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                     offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     TLV::TLVType outer;
@@ -4566,12 +8305,74 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ProviderLocation
 } // namespace Structs
 
 namespace Commands {
 namespace AnnounceOtaProvider {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::providerNodeId), to_underlying(Fields::kProviderNodeId),
+                              offsetof(Type, providerNodeId)>(),
+    DataModel::EncodableField<decltype(Type::vendorId), to_underlying(Fields::kVendorId), offsetof(Type, vendorId)>(),
+    DataModel::EncodableField<decltype(Type::announcementReason), to_underlying(Fields::kAnnouncementReason),
+                              offsetof(Type, announcementReason)>(),
+    DataModel::EncodableField<decltype(Type::metadataForNode), to_underlying(Fields::kMetadataForNode),
+                              offsetof(Type, metadataForNode)>(),
+    DataModel::EncodableField<decltype(Type::endpoint), to_underlying(Fields::kEndpoint), offsetof(Type, endpoint)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::providerNodeId), to_underlying(Fields::kProviderNodeId),
+                                  offsetof(T, providerNodeId)>(),
+        DataModel::DecodableField<decltype(T::vendorId), to_underlying(Fields::kVendorId), offsetof(T, vendorId)>(),
+        DataModel::DecodableField<decltype(T::announcementReason), to_underlying(Fields::kAnnouncementReason),
+                                  offsetof(T, announcementReason)>(),
+        DataModel::DecodableField<decltype(T::metadataForNode), to_underlying(Fields::kMetadataForNode),
+                                  offsetof(T, metadataForNode)>(),
+        DataModel::DecodableField<decltype(T::endpoint), to_underlying(Fields::kEndpoint), offsetof(T, endpoint)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::providerNodeId), &T::providerNodeId,
+                                        to_underlying(Fields::kProviderNodeId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::vendorId), &T::vendorId, to_underlying(Fields::kVendorId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::announcementReason), &T::announcementReason,
+                                        to_underlying(Fields::kAnnouncementReason)>(),
+        DataModel::DecodableMemberField<T, decltype(T::metadataForNode), &T::metadataForNode,
+                                        to_underlying(Fields::kMetadataForNode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::endpoint), &T::endpoint, to_underlying(Fields::kEndpoint)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4624,6 +8425,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AnnounceOtaProvider.
 } // namespace Commands
 
@@ -4669,6 +8471,59 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace StateTransition {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::previousState), to_underlying(Fields::kPreviousState),
+                              offsetof(Type, previousState)>(),
+    DataModel::EncodableField<decltype(Type::newState), to_underlying(Fields::kNewState), offsetof(Type, newState)>(),
+    DataModel::EncodableField<decltype(Type::reason), to_underlying(Fields::kReason), offsetof(Type, reason)>(),
+    DataModel::EncodableField<decltype(Type::targetSoftwareVersion), to_underlying(Fields::kTargetSoftwareVersion),
+                              offsetof(Type, targetSoftwareVersion)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::previousState), to_underlying(Fields::kPreviousState), offsetof(T, previousState)>(),
+        DataModel::DecodableField<decltype(T::newState), to_underlying(Fields::kNewState), offsetof(T, newState)>(),
+        DataModel::DecodableField<decltype(T::reason), to_underlying(Fields::kReason), offsetof(T, reason)>(),
+        DataModel::DecodableField<decltype(T::targetSoftwareVersion), to_underlying(Fields::kTargetSoftwareVersion),
+                                  offsetof(T, targetSoftwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::previousState), &T::previousState, to_underlying(Fields::kPreviousState)>(),
+        DataModel::DecodableMemberField<T, decltype(T::newState), &T::newState, to_underlying(Fields::kNewState)>(),
+        DataModel::DecodableMemberField<T, decltype(T::reason), &T::reason, to_underlying(Fields::kReason)>(),
+        DataModel::DecodableMemberField<T, decltype(T::targetSoftwareVersion), &T::targetSoftwareVersion,
+                                        to_underlying(Fields::kTargetSoftwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4717,8 +8572,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StateTransition.
 namespace VersionApplied {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::EncodableField<decltype(Type::productID), to_underlying(Fields::kProductID), offsetof(Type, productID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::DecodableField<decltype(T::productID), to_underlying(Fields::kProductID), offsetof(T, productID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::DecodableMemberField<T, decltype(T::productID), &T::productID, to_underlying(Fields::kProductID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4758,8 +8660,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace VersionApplied.
 namespace DownloadError {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::EncodableField<decltype(Type::bytesDownloaded), to_underlying(Fields::kBytesDownloaded),
+                              offsetof(Type, bytesDownloaded)>(),
+    DataModel::EncodableField<decltype(Type::progressPercent), to_underlying(Fields::kProgressPercent),
+                              offsetof(Type, progressPercent)>(),
+    DataModel::EncodableField<decltype(Type::platformCode), to_underlying(Fields::kPlatformCode), offsetof(Type, platformCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::DecodableField<decltype(T::bytesDownloaded), to_underlying(Fields::kBytesDownloaded),
+                                  offsetof(T, bytesDownloaded)>(),
+        DataModel::DecodableField<decltype(T::progressPercent), to_underlying(Fields::kProgressPercent),
+                                  offsetof(T, progressPercent)>(),
+        DataModel::DecodableField<decltype(T::platformCode), to_underlying(Fields::kPlatformCode), offsetof(T, platformCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::DecodableMemberField<T, decltype(T::bytesDownloaded), &T::bytesDownloaded,
+                                        to_underlying(Fields::kBytesDownloaded)>(),
+        DataModel::DecodableMemberField<T, decltype(T::progressPercent), &T::progressPercent,
+                                        to_underlying(Fields::kProgressPercent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::platformCode), &T::platformCode, to_underlying(Fields::kPlatformCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -4807,6 +8768,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DownloadError.
 } // namespace Events
 
@@ -4983,6 +8945,32 @@ namespace Events {
 namespace PowerSource {
 namespace Structs {
 namespace BatChargeFaultChangeType {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::current), &DecodableType::current,
+                                    to_underlying(Fields::kCurrent)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::previous), &DecodableType::previous,
+                                    to_underlying(Fields::kPrevious)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5024,9 +9012,36 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace BatChargeFaultChangeType
 namespace BatFaultChangeType {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::current), &DecodableType::current,
+                                    to_underlying(Fields::kCurrent)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::previous), &DecodableType::previous,
+                                    to_underlying(Fields::kPrevious)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5068,9 +9083,36 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace BatFaultChangeType
 namespace WiredFaultChangeType {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::current), &DecodableType::current,
+                                    to_underlying(Fields::kCurrent)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::previous), &DecodableType::previous,
+                                    to_underlying(Fields::kPrevious)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5112,6 +9154,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace WiredFaultChangeType
 } // namespace Structs
@@ -5247,13 +9290,35 @@ namespace Events {
 namespace GeneralCommissioning {
 namespace Structs {
 namespace BasicCommissioningInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::failSafeExpiryLengthSeconds), to_underlying(Fields::kFailSafeExpiryLengthSeconds),
+                     offsetof(Type, failSafeExpiryLengthSeconds)>(),
+    DataModel::Field<decltype(Type::maxCumulativeFailsafeSeconds), to_underlying(Fields::kMaxCumulativeFailsafeSeconds),
+                     offsetof(Type, maxCumulativeFailsafeSeconds)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFailSafeExpiryLengthSeconds)),
-                                           failSafeExpiryLengthSeconds));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMaxCumulativeFailsafeSeconds)),
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kFailSafeExpiryLengthSeconds)),
+                                           failSafeExpiryLengthSeconds));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kMaxCumulativeFailsafeSeconds)),
                                            maxCumulativeFailsafeSeconds));
     ReturnErrorOnFailure(writer.EndContainer(outer));
     return CHIP_NO_ERROR;
@@ -5290,12 +9355,59 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace BasicCommissioningInfo
 } // namespace Structs
 
 namespace Commands {
 namespace ArmFailSafe {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::expiryLengthSeconds), to_underlying(Fields::kExpiryLengthSeconds),
+                              offsetof(Type, expiryLengthSeconds)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::expiryLengthSeconds), to_underlying(Fields::kExpiryLengthSeconds),
+                                  offsetof(T, expiryLengthSeconds)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::expiryLengthSeconds), &T::expiryLengthSeconds,
+                                        to_underlying(Fields::kExpiryLengthSeconds)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5336,8 +9448,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ArmFailSafe.
 namespace ArmFailSafeResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::errorCode), to_underlying(Fields::kErrorCode), offsetof(Type, errorCode)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::errorCode), to_underlying(Fields::kErrorCode), offsetof(T, errorCode)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::errorCode), &T::errorCode, to_underlying(Fields::kErrorCode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5377,8 +9533,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ArmFailSafeResponse.
 namespace SetRegulatoryConfig {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newRegulatoryConfig), to_underlying(Fields::kNewRegulatoryConfig),
+                              offsetof(Type, newRegulatoryConfig)>(),
+    DataModel::EncodableField<decltype(Type::countryCode), to_underlying(Fields::kCountryCode), offsetof(Type, countryCode)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newRegulatoryConfig), to_underlying(Fields::kNewRegulatoryConfig),
+                                  offsetof(T, newRegulatoryConfig)>(),
+        DataModel::DecodableField<decltype(T::countryCode), to_underlying(Fields::kCountryCode), offsetof(T, countryCode)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newRegulatoryConfig), &T::newRegulatoryConfig,
+                                        to_underlying(Fields::kNewRegulatoryConfig)>(),
+        DataModel::DecodableMemberField<T, decltype(T::countryCode), &T::countryCode, to_underlying(Fields::kCountryCode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5423,8 +9629,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetRegulatoryConfig.
 namespace SetRegulatoryConfigResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::errorCode), to_underlying(Fields::kErrorCode), offsetof(Type, errorCode)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::errorCode), to_underlying(Fields::kErrorCode), offsetof(T, errorCode)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::errorCode), &T::errorCode, to_underlying(Fields::kErrorCode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5464,8 +9714,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetRegulatoryConfigResponse.
 namespace CommissioningComplete {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5497,8 +9785,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CommissioningComplete.
 namespace CommissioningCompleteResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::errorCode), to_underlying(Fields::kErrorCode), offsetof(Type, errorCode)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::errorCode), to_underlying(Fields::kErrorCode), offsetof(T, errorCode)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::errorCode), &T::errorCode, to_underlying(Fields::kErrorCode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5538,6 +9870,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CommissioningCompleteResponse.
 } // namespace Commands
 
@@ -5591,6 +9924,26 @@ namespace Events {
 namespace NetworkCommissioning {
 namespace Structs {
 namespace NetworkInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::networkID), to_underlying(Fields::kNetworkID), offsetof(Type, networkID)>(),
+    DataModel::Field<decltype(Type::connected), to_underlying(Fields::kConnected), offsetof(Type, connected)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5632,9 +9985,36 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NetworkInfo
 namespace ThreadInterfaceScanResult {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::panId), to_underlying(Fields::kPanId), offsetof(Type, panId)>(),
+    DataModel::Field<decltype(Type::extendedPanId), to_underlying(Fields::kExtendedPanId), offsetof(Type, extendedPanId)>(),
+    DataModel::Field<decltype(Type::networkName), to_underlying(Fields::kNetworkName), offsetof(Type, networkName)>(),
+    DataModel::Field<decltype(Type::channel), to_underlying(Fields::kChannel), offsetof(Type, channel)>(),
+    DataModel::Field<decltype(Type::version), to_underlying(Fields::kVersion), offsetof(Type, version)>(),
+    DataModel::Field<decltype(Type::extendedAddress), to_underlying(Fields::kExtendedAddress), offsetof(Type, extendedAddress)>(),
+    DataModel::Field<decltype(Type::rssi), to_underlying(Fields::kRssi), offsetof(Type, rssi)>(),
+    DataModel::Field<decltype(Type::lqi), to_underlying(Fields::kLqi), offsetof(Type, lqi)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5700,9 +10080,34 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ThreadInterfaceScanResult
 namespace WiFiInterfaceScanResult {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::security), to_underlying(Fields::kSecurity), offsetof(Type, security)>(),
+    DataModel::Field<decltype(Type::ssid), to_underlying(Fields::kSsid), offsetof(Type, ssid)>(),
+    DataModel::Field<decltype(Type::bssid), to_underlying(Fields::kBssid), offsetof(Type, bssid)>(),
+    DataModel::Field<decltype(Type::channel), to_underlying(Fields::kChannel), offsetof(Type, channel)>(),
+    DataModel::Field<decltype(Type::wiFiBand), to_underlying(Fields::kWiFiBand), offsetof(Type, wiFiBand)>(),
+    DataModel::Field<decltype(Type::rssi), to_underlying(Fields::kRssi), offsetof(Type, rssi)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5760,12 +10165,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace WiFiInterfaceScanResult
 } // namespace Structs
 
 namespace Commands {
 namespace ScanNetworks {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::ssid), to_underlying(Fields::kSsid), offsetof(Type, ssid)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::ssid), to_underlying(Fields::kSsid), offsetof(T, ssid)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::ssid), &T::ssid, to_underlying(Fields::kSsid)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5805,8 +10254,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ScanNetworks.
 namespace ScanNetworksResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::networkingStatus), to_underlying(Fields::kNetworkingStatus),
+                              offsetof(Type, networkingStatus)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::EncodableField<decltype(Type::wiFiScanResults), to_underlying(Fields::kWiFiScanResults),
+                              offsetof(Type, wiFiScanResults)>(),
+    DataModel::EncodableField<decltype(Type::threadScanResults), to_underlying(Fields::kThreadScanResults),
+                              offsetof(Type, threadScanResults)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::networkingStatus), to_underlying(Fields::kNetworkingStatus),
+                                  offsetof(T, networkingStatus)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::DecodableField<decltype(T::wiFiScanResults), to_underlying(Fields::kWiFiScanResults),
+                                  offsetof(T, wiFiScanResults)>(),
+        DataModel::DecodableField<decltype(T::threadScanResults), to_underlying(Fields::kThreadScanResults),
+                                  offsetof(T, threadScanResults)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::networkingStatus), &T::networkingStatus,
+                                        to_underlying(Fields::kNetworkingStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::DecodableMemberField<T, decltype(T::wiFiScanResults), &T::wiFiScanResults,
+                                        to_underlying(Fields::kWiFiScanResults)>(),
+        DataModel::DecodableMemberField<T, decltype(T::threadScanResults), &T::threadScanResults,
+                                        to_underlying(Fields::kThreadScanResults)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5854,8 +10362,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ScanNetworksResponse.
 namespace AddOrUpdateWiFiNetwork {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::ssid), to_underlying(Fields::kSsid), offsetof(Type, ssid)>(),
+    DataModel::EncodableField<decltype(Type::credentials), to_underlying(Fields::kCredentials), offsetof(Type, credentials)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::ssid), to_underlying(Fields::kSsid), offsetof(T, ssid)>(),
+        DataModel::DecodableField<decltype(T::credentials), to_underlying(Fields::kCredentials), offsetof(T, credentials)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::ssid), &T::ssid, to_underlying(Fields::kSsid)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentials), &T::credentials, to_underlying(Fields::kCredentials)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5899,8 +10454,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddOrUpdateWiFiNetwork.
 namespace AddOrUpdateThreadNetwork {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::operationalDataset), to_underlying(Fields::kOperationalDataset),
+                              offsetof(Type, operationalDataset)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::operationalDataset), to_underlying(Fields::kOperationalDataset),
+                                  offsetof(T, operationalDataset)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::operationalDataset), &T::operationalDataset,
+                                        to_underlying(Fields::kOperationalDataset)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5941,8 +10543,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddOrUpdateThreadNetwork.
 namespace RemoveNetwork {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::networkID), to_underlying(Fields::kNetworkID), offsetof(Type, networkID)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::networkID), to_underlying(Fields::kNetworkID), offsetof(T, networkID)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::networkID), &T::networkID, to_underlying(Fields::kNetworkID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -5982,8 +10628,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveNetwork.
 namespace NetworkConfigResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::networkingStatus), to_underlying(Fields::kNetworkingStatus),
+                              offsetof(Type, networkingStatus)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::EncodableField<decltype(Type::networkIndex), to_underlying(Fields::kNetworkIndex), offsetof(Type, networkIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::networkingStatus), to_underlying(Fields::kNetworkingStatus),
+                                  offsetof(T, networkingStatus)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::DecodableField<decltype(T::networkIndex), to_underlying(Fields::kNetworkIndex), offsetof(T, networkIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::networkingStatus), &T::networkingStatus,
+                                        to_underlying(Fields::kNetworkingStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::DecodableMemberField<T, decltype(T::networkIndex), &T::networkIndex, to_underlying(Fields::kNetworkIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6027,8 +10723,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NetworkConfigResponse.
 namespace ConnectNetwork {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::networkID), to_underlying(Fields::kNetworkID), offsetof(Type, networkID)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::networkID), to_underlying(Fields::kNetworkID), offsetof(T, networkID)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::networkID), &T::networkID, to_underlying(Fields::kNetworkID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6068,8 +10808,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ConnectNetwork.
 namespace ConnectNetworkResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::networkingStatus), to_underlying(Fields::kNetworkingStatus),
+                              offsetof(Type, networkingStatus)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::EncodableField<decltype(Type::errorValue), to_underlying(Fields::kErrorValue), offsetof(Type, errorValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::networkingStatus), to_underlying(Fields::kNetworkingStatus),
+                                  offsetof(T, networkingStatus)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::DecodableField<decltype(T::errorValue), to_underlying(Fields::kErrorValue), offsetof(T, errorValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::networkingStatus), &T::networkingStatus,
+                                        to_underlying(Fields::kNetworkingStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::DecodableMemberField<T, decltype(T::errorValue), &T::errorValue, to_underlying(Fields::kErrorValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6113,8 +10903,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ConnectNetworkResponse.
 namespace ReorderNetwork {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::networkID), to_underlying(Fields::kNetworkID), offsetof(Type, networkID)>(),
+    DataModel::EncodableField<decltype(Type::networkIndex), to_underlying(Fields::kNetworkIndex), offsetof(Type, networkIndex)>(),
+    DataModel::EncodableField<decltype(Type::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(Type, breadcrumb)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::networkID), to_underlying(Fields::kNetworkID), offsetof(T, networkID)>(),
+        DataModel::DecodableField<decltype(T::networkIndex), to_underlying(Fields::kNetworkIndex), offsetof(T, networkIndex)>(),
+        DataModel::DecodableField<decltype(T::breadcrumb), to_underlying(Fields::kBreadcrumb), offsetof(T, breadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::networkID), &T::networkID, to_underlying(Fields::kNetworkID)>(),
+        DataModel::DecodableMemberField<T, decltype(T::networkIndex), &T::networkIndex, to_underlying(Fields::kNetworkIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::breadcrumb), &T::breadcrumb, to_underlying(Fields::kBreadcrumb)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6158,6 +10995,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ReorderNetwork.
 } // namespace Commands
 
@@ -6221,6 +11059,58 @@ namespace DiagnosticLogs {
 
 namespace Commands {
 namespace RetrieveLogsRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::intent), to_underlying(Fields::kIntent), offsetof(Type, intent)>(),
+    DataModel::EncodableField<decltype(Type::requestedProtocol), to_underlying(Fields::kRequestedProtocol),
+                              offsetof(Type, requestedProtocol)>(),
+    DataModel::EncodableField<decltype(Type::transferFileDesignator), to_underlying(Fields::kTransferFileDesignator),
+                              offsetof(Type, transferFileDesignator)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::intent), to_underlying(Fields::kIntent), offsetof(T, intent)>(),
+        DataModel::DecodableField<decltype(T::requestedProtocol), to_underlying(Fields::kRequestedProtocol),
+                                  offsetof(T, requestedProtocol)>(),
+        DataModel::DecodableField<decltype(T::transferFileDesignator), to_underlying(Fields::kTransferFileDesignator),
+                                  offsetof(T, transferFileDesignator)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::intent), &T::intent, to_underlying(Fields::kIntent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::requestedProtocol), &T::requestedProtocol,
+                                        to_underlying(Fields::kRequestedProtocol)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transferFileDesignator), &T::transferFileDesignator,
+                                        to_underlying(Fields::kTransferFileDesignator)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6265,8 +11155,59 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RetrieveLogsRequest.
 namespace RetrieveLogsResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::content), to_underlying(Fields::kContent), offsetof(Type, content)>(),
+    DataModel::EncodableField<decltype(Type::timeStamp), to_underlying(Fields::kTimeStamp), offsetof(Type, timeStamp)>(),
+    DataModel::EncodableField<decltype(Type::timeSinceBoot), to_underlying(Fields::kTimeSinceBoot),
+                              offsetof(Type, timeSinceBoot)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::content), to_underlying(Fields::kContent), offsetof(T, content)>(),
+        DataModel::DecodableField<decltype(T::timeStamp), to_underlying(Fields::kTimeStamp), offsetof(T, timeStamp)>(),
+        DataModel::DecodableField<decltype(T::timeSinceBoot), to_underlying(Fields::kTimeSinceBoot), offsetof(T, timeSinceBoot)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::content), &T::content, to_underlying(Fields::kContent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::timeStamp), &T::timeStamp, to_underlying(Fields::kTimeStamp)>(),
+        DataModel::DecodableMemberField<T, decltype(T::timeSinceBoot), &T::timeSinceBoot, to_underlying(Fields::kTimeSinceBoot)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6314,6 +11255,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RetrieveLogsResponse.
 } // namespace Commands
 
@@ -6352,6 +11294,60 @@ namespace Events {
 namespace GeneralDiagnostics {
 namespace Structs {
 namespace NetworkInterfaceType {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::EncodableField<decltype(Type::isOperational), to_underlying(Fields::kIsOperational),
+                              offsetof(Type, isOperational)>(),
+    DataModel::EncodableField<decltype(Type::offPremiseServicesReachableIPv4),
+                              to_underlying(Fields::kOffPremiseServicesReachableIPv4),
+                              offsetof(Type, offPremiseServicesReachableIPv4)>(),
+    DataModel::EncodableField<decltype(Type::offPremiseServicesReachableIPv6),
+                              to_underlying(Fields::kOffPremiseServicesReachableIPv6),
+                              offsetof(Type, offPremiseServicesReachableIPv6)>(),
+    DataModel::EncodableField<decltype(Type::hardwareAddress), to_underlying(Fields::kHardwareAddress),
+                              offsetof(Type, hardwareAddress)>(),
+    DataModel::EncodableField<decltype(Type::IPv4Addresses), to_underlying(Fields::kIPv4Addresses),
+                              offsetof(Type, IPv4Addresses)>(),
+    DataModel::EncodableField<decltype(Type::IPv6Addresses), to_underlying(Fields::kIPv6Addresses),
+                              offsetof(Type, IPv6Addresses)>(),
+    DataModel::EncodableField<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::name), &DecodableType::name,
+                                    to_underlying(Fields::kName)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::isOperational), &DecodableType::isOperational,
+                                    to_underlying(Fields::kIsOperational)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::offPremiseServicesReachableIPv4),
+                                    &DecodableType::offPremiseServicesReachableIPv4,
+                                    to_underlying(Fields::kOffPremiseServicesReachableIPv4)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::offPremiseServicesReachableIPv6),
+                                    &DecodableType::offPremiseServicesReachableIPv6,
+                                    to_underlying(Fields::kOffPremiseServicesReachableIPv6)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::hardwareAddress), &DecodableType::hardwareAddress,
+                                    to_underlying(Fields::kHardwareAddress)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::IPv4Addresses), &DecodableType::IPv4Addresses,
+                                    to_underlying(Fields::kIPv4Addresses)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::IPv6Addresses), &DecodableType::IPv6Addresses,
+                                    to_underlying(Fields::kIPv6Addresses)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::type), &DecodableType::type,
+                                    to_underlying(Fields::kType)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6419,12 +11415,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NetworkInterfaceType
 } // namespace Structs
 
 namespace Commands {
 namespace TestEventTrigger {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::enableKey), to_underlying(Fields::kEnableKey), offsetof(Type, enableKey)>(),
+    DataModel::EncodableField<decltype(Type::eventTrigger), to_underlying(Fields::kEventTrigger), offsetof(Type, eventTrigger)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::enableKey), to_underlying(Fields::kEnableKey), offsetof(T, enableKey)>(),
+        DataModel::DecodableField<decltype(T::eventTrigger), to_underlying(Fields::kEventTrigger), offsetof(T, eventTrigger)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::enableKey), &T::enableKey, to_underlying(Fields::kEnableKey)>(),
+        DataModel::DecodableMemberField<T, decltype(T::eventTrigger), &T::eventTrigger, to_underlying(Fields::kEventTrigger)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6464,6 +11504,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEventTrigger.
 } // namespace Commands
 
@@ -6524,6 +11565,49 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace HardwareFaultChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::current), to_underlying(Fields::kCurrent), offsetof(T, current)>(),
+        DataModel::DecodableField<decltype(T::previous), to_underlying(Fields::kPrevious), offsetof(T, previous)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::current), &T::current, to_underlying(Fields::kCurrent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::previous), &T::previous, to_underlying(Fields::kPrevious)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6563,8 +11647,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace HardwareFaultChange.
 namespace RadioFaultChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::current), to_underlying(Fields::kCurrent), offsetof(T, current)>(),
+        DataModel::DecodableField<decltype(T::previous), to_underlying(Fields::kPrevious), offsetof(T, previous)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::current), &T::current, to_underlying(Fields::kCurrent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::previous), &T::previous, to_underlying(Fields::kPrevious)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6604,8 +11732,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RadioFaultChange.
 namespace NetworkFaultChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::current), to_underlying(Fields::kCurrent), offsetof(T, current)>(),
+        DataModel::DecodableField<decltype(T::previous), to_underlying(Fields::kPrevious), offsetof(T, previous)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::current), &T::current, to_underlying(Fields::kCurrent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::previous), &T::previous, to_underlying(Fields::kPrevious)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6645,8 +11817,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NetworkFaultChange.
 namespace BootReason {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::bootReason), to_underlying(Fields::kBootReason), offsetof(Type, bootReason)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::bootReason), to_underlying(Fields::kBootReason), offsetof(T, bootReason)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::bootReason), &T::bootReason, to_underlying(Fields::kBootReason)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6682,6 +11895,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace BootReason.
 } // namespace Events
 
@@ -6689,6 +11903,31 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace SoftwareDiagnostics {
 namespace Structs {
 namespace ThreadMetrics {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::id), to_underlying(Fields::kId), offsetof(Type, id)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::Field<decltype(Type::stackFreeCurrent), to_underlying(Fields::kStackFreeCurrent),
+                     offsetof(Type, stackFreeCurrent)>(),
+    DataModel::Field<decltype(Type::stackFreeMinimum), to_underlying(Fields::kStackFreeMinimum),
+                     offsetof(Type, stackFreeMinimum)>(),
+    DataModel::Field<decltype(Type::stackSize), to_underlying(Fields::kStackSize), offsetof(Type, stackSize)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6742,15 +11981,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ThreadMetrics
 } // namespace Structs
 
 namespace Commands {
 namespace ResetWatermarks {
-CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
 {
-    TLV::TLVType outer;
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    TLV::TLVType outer;
     ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
     ReturnErrorOnFailure(writer.EndContainer(outer));
     return CHIP_NO_ERROR;
@@ -6779,6 +12056,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ResetWatermarks.
 } // namespace Commands
 
@@ -6824,6 +12102,55 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace SoftwareFault {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::id), to_underlying(Fields::kId), offsetof(Type, id)>(),
+    DataModel::EncodableField<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::EncodableField<decltype(Type::faultRecording), to_underlying(Fields::kFaultRecording),
+                              offsetof(Type, faultRecording)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::id), to_underlying(Fields::kId), offsetof(T, id)>(),
+        DataModel::DecodableField<decltype(T::name), to_underlying(Fields::kName), offsetof(T, name)>(),
+        DataModel::DecodableField<decltype(T::faultRecording), to_underlying(Fields::kFaultRecording),
+                                  offsetof(T, faultRecording)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::id), &T::id, to_underlying(Fields::kId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::name), &T::name, to_underlying(Fields::kName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::faultRecording), &T::faultRecording,
+                                        to_underlying(Fields::kFaultRecording)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6867,6 +12194,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SoftwareFault.
 } // namespace Events
 
@@ -6874,6 +12202,41 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ThreadNetworkDiagnostics {
 namespace Structs {
 namespace NeighborTable {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::extAddress), to_underlying(Fields::kExtAddress), offsetof(Type, extAddress)>(),
+    DataModel::Field<decltype(Type::age), to_underlying(Fields::kAge), offsetof(Type, age)>(),
+    DataModel::Field<decltype(Type::rloc16), to_underlying(Fields::kRloc16), offsetof(Type, rloc16)>(),
+    DataModel::Field<decltype(Type::linkFrameCounter), to_underlying(Fields::kLinkFrameCounter),
+                     offsetof(Type, linkFrameCounter)>(),
+    DataModel::Field<decltype(Type::mleFrameCounter), to_underlying(Fields::kMleFrameCounter), offsetof(Type, mleFrameCounter)>(),
+    DataModel::Field<decltype(Type::lqi), to_underlying(Fields::kLqi), offsetof(Type, lqi)>(),
+    DataModel::Field<decltype(Type::averageRssi), to_underlying(Fields::kAverageRssi), offsetof(Type, averageRssi)>(),
+    DataModel::Field<decltype(Type::lastRssi), to_underlying(Fields::kLastRssi), offsetof(Type, lastRssi)>(),
+    DataModel::Field<decltype(Type::frameErrorRate), to_underlying(Fields::kFrameErrorRate), offsetof(Type, frameErrorRate)>(),
+    DataModel::Field<decltype(Type::messageErrorRate), to_underlying(Fields::kMessageErrorRate),
+                     offsetof(Type, messageErrorRate)>(),
+    DataModel::Field<decltype(Type::rxOnWhenIdle), to_underlying(Fields::kRxOnWhenIdle), offsetof(Type, rxOnWhenIdle)>(),
+    DataModel::Field<decltype(Type::fullThreadDevice), to_underlying(Fields::kFullThreadDevice),
+                     offsetof(Type, fullThreadDevice)>(),
+    DataModel::Field<decltype(Type::fullNetworkData), to_underlying(Fields::kFullNetworkData), offsetof(Type, fullNetworkData)>(),
+    DataModel::Field<decltype(Type::isChild), to_underlying(Fields::kIsChild), offsetof(Type, isChild)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -6963,9 +12326,48 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NeighborTable
 namespace OperationalDatasetComponents {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::activeTimestampPresent), to_underlying(Fields::kActiveTimestampPresent),
+                     offsetof(Type, activeTimestampPresent)>(),
+    DataModel::Field<decltype(Type::pendingTimestampPresent), to_underlying(Fields::kPendingTimestampPresent),
+                     offsetof(Type, pendingTimestampPresent)>(),
+    DataModel::Field<decltype(Type::masterKeyPresent), to_underlying(Fields::kMasterKeyPresent),
+                     offsetof(Type, masterKeyPresent)>(),
+    DataModel::Field<decltype(Type::networkNamePresent), to_underlying(Fields::kNetworkNamePresent),
+                     offsetof(Type, networkNamePresent)>(),
+    DataModel::Field<decltype(Type::extendedPanIdPresent), to_underlying(Fields::kExtendedPanIdPresent),
+                     offsetof(Type, extendedPanIdPresent)>(),
+    DataModel::Field<decltype(Type::meshLocalPrefixPresent), to_underlying(Fields::kMeshLocalPrefixPresent),
+                     offsetof(Type, meshLocalPrefixPresent)>(),
+    DataModel::Field<decltype(Type::delayPresent), to_underlying(Fields::kDelayPresent), offsetof(Type, delayPresent)>(),
+    DataModel::Field<decltype(Type::panIdPresent), to_underlying(Fields::kPanIdPresent), offsetof(Type, panIdPresent)>(),
+    DataModel::Field<decltype(Type::channelPresent), to_underlying(Fields::kChannelPresent), offsetof(Type, channelPresent)>(),
+    DataModel::Field<decltype(Type::pskcPresent), to_underlying(Fields::kPskcPresent), offsetof(Type, pskcPresent)>(),
+    DataModel::Field<decltype(Type::securityPolicyPresent), to_underlying(Fields::kSecurityPolicyPresent),
+                     offsetof(Type, securityPolicyPresent)>(),
+    DataModel::Field<decltype(Type::channelMaskPresent), to_underlying(Fields::kChannelMaskPresent),
+                     offsetof(Type, channelMaskPresent)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7054,9 +12456,38 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace OperationalDatasetComponents
 namespace RouteTable {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::extAddress), to_underlying(Fields::kExtAddress), offsetof(Type, extAddress)>(),
+    DataModel::Field<decltype(Type::rloc16), to_underlying(Fields::kRloc16), offsetof(Type, rloc16)>(),
+    DataModel::Field<decltype(Type::routerId), to_underlying(Fields::kRouterId), offsetof(Type, routerId)>(),
+    DataModel::Field<decltype(Type::nextHop), to_underlying(Fields::kNextHop), offsetof(Type, nextHop)>(),
+    DataModel::Field<decltype(Type::pathCost), to_underlying(Fields::kPathCost), offsetof(Type, pathCost)>(),
+    DataModel::Field<decltype(Type::LQIIn), to_underlying(Fields::kLQIIn), offsetof(Type, LQIIn)>(),
+    DataModel::Field<decltype(Type::LQIOut), to_underlying(Fields::kLQIOut), offsetof(Type, LQIOut)>(),
+    DataModel::Field<decltype(Type::age), to_underlying(Fields::kAge), offsetof(Type, age)>(),
+    DataModel::Field<decltype(Type::allocated), to_underlying(Fields::kAllocated), offsetof(Type, allocated)>(),
+    DataModel::Field<decltype(Type::linkEstablished), to_underlying(Fields::kLinkEstablished), offsetof(Type, linkEstablished)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7130,9 +12561,30 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace RouteTable
 namespace SecurityPolicy {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::rotationTime), to_underlying(Fields::kRotationTime), offsetof(Type, rotationTime)>(),
+    DataModel::Field<decltype(Type::flags), to_underlying(Fields::kFlags), offsetof(Type, flags)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7174,12 +12626,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace SecurityPolicy
 } // namespace Structs
 
 namespace Commands {
 namespace ResetCounts {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7211,6 +12701,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ResetCounts.
 } // namespace Commands
 
@@ -7433,6 +12924,49 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace ConnectionStatus {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::connectionStatus), to_underlying(Fields::kConnectionStatus),
+                              offsetof(Type, connectionStatus)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::connectionStatus), to_underlying(Fields::kConnectionStatus),
+                                  offsetof(T, connectionStatus)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::connectionStatus), &T::connectionStatus,
+                                        to_underlying(Fields::kConnectionStatus)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7468,8 +13002,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ConnectionStatus.
 namespace NetworkFaultChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::current), to_underlying(Fields::kCurrent), offsetof(Type, current)>(),
+    DataModel::EncodableField<decltype(Type::previous), to_underlying(Fields::kPrevious), offsetof(Type, previous)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::current), to_underlying(Fields::kCurrent), offsetof(T, current)>(),
+        DataModel::DecodableField<decltype(T::previous), to_underlying(Fields::kPrevious), offsetof(T, previous)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::current), &T::current, to_underlying(Fields::kCurrent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::previous), &T::previous, to_underlying(Fields::kPrevious)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7509,6 +13087,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NetworkFaultChange.
 } // namespace Events
 
@@ -7517,6 +13096,43 @@ namespace WiFiNetworkDiagnostics {
 
 namespace Commands {
 namespace ResetCounts {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7548,6 +13164,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ResetCounts.
 } // namespace Commands
 
@@ -7620,6 +13237,46 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace Disconnection {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::reasonCode), to_underlying(Fields::kReasonCode), offsetof(Type, reasonCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::reasonCode), to_underlying(Fields::kReasonCode), offsetof(T, reasonCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::reasonCode), &T::reasonCode, to_underlying(Fields::kReasonCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7655,8 +13312,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Disconnection.
 namespace AssociationFailure {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::associationFailure), to_underlying(Fields::kAssociationFailure),
+                              offsetof(Type, associationFailure)>(),
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::associationFailure), to_underlying(Fields::kAssociationFailure),
+                                  offsetof(T, associationFailure)>(),
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::associationFailure), &T::associationFailure,
+                                        to_underlying(Fields::kAssociationFailure)>(),
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7697,8 +13401,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AssociationFailure.
 namespace ConnectionStatus {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::connectionStatus), to_underlying(Fields::kConnectionStatus),
+                              offsetof(Type, connectionStatus)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::connectionStatus), to_underlying(Fields::kConnectionStatus),
+                                  offsetof(T, connectionStatus)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::connectionStatus), &T::connectionStatus,
+                                        to_underlying(Fields::kConnectionStatus)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7734,6 +13482,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ConnectionStatus.
 } // namespace Events
 
@@ -7742,6 +13491,43 @@ namespace EthernetNetworkDiagnostics {
 
 namespace Commands {
 namespace ResetCounts {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7773,6 +13559,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ResetCounts.
 } // namespace Commands
 
@@ -7838,6 +13625,27 @@ namespace Events {
 namespace TimeSynchronization {
 namespace Structs {
 namespace DstOffsetType {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::offset), to_underlying(Fields::kOffset), offsetof(Type, offset)>(),
+    DataModel::Field<decltype(Type::validStarting), to_underlying(Fields::kValidStarting), offsetof(Type, validStarting)>(),
+    DataModel::Field<decltype(Type::validUntil), to_underlying(Fields::kValidUntil), offsetof(Type, validUntil)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7883,9 +13691,31 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace DstOffsetType
 namespace TimeZoneType {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::offset), to_underlying(Fields::kOffset), offsetof(Type, offset)>(),
+    DataModel::Field<decltype(Type::validAt), to_underlying(Fields::kValidAt), offsetof(Type, validAt)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7931,12 +13761,59 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace TimeZoneType
 } // namespace Structs
 
 namespace Commands {
 namespace SetUtcTime {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::utcTime), to_underlying(Fields::kUtcTime), offsetof(Type, utcTime)>(),
+    DataModel::EncodableField<decltype(Type::granularity), to_underlying(Fields::kGranularity), offsetof(Type, granularity)>(),
+    DataModel::EncodableField<decltype(Type::timeSource), to_underlying(Fields::kTimeSource), offsetof(Type, timeSource)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::utcTime), to_underlying(Fields::kUtcTime), offsetof(T, utcTime)>(),
+        DataModel::DecodableField<decltype(T::granularity), to_underlying(Fields::kGranularity), offsetof(T, granularity)>(),
+        DataModel::DecodableField<decltype(T::timeSource), to_underlying(Fields::kTimeSource), offsetof(T, timeSource)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::utcTime), &T::utcTime, to_underlying(Fields::kUtcTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::granularity), &T::granularity, to_underlying(Fields::kGranularity)>(),
+        DataModel::DecodableMemberField<T, decltype(T::timeSource), &T::timeSource, to_underlying(Fields::kTimeSource)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -7980,6 +13857,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetUtcTime.
 } // namespace Commands
 
@@ -8125,6 +14003,49 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace StartUp {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                              offsetof(Type, softwareVersion)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::softwareVersion), to_underlying(Fields::kSoftwareVersion),
+                                  offsetof(T, softwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::softwareVersion), &T::softwareVersion,
+                                        to_underlying(Fields::kSoftwareVersion)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8160,8 +14081,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StartUp.
 namespace ShutDown {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8193,8 +14152,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ShutDown.
 namespace Leave {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8226,8 +14223,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Leave.
 namespace ReachableChanged {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::reachableNewValue), to_underlying(Fields::kReachableNewValue),
+                              offsetof(Type, reachableNewValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::reachableNewValue), to_underlying(Fields::kReachableNewValue),
+                                  offsetof(T, reachableNewValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::reachableNewValue), &T::reachableNewValue,
+                                        to_underlying(Fields::kReachableNewValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8263,6 +14304,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ReachableChanged.
 } // namespace Events
 
@@ -8311,6 +14353,46 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace SwitchLatched {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newPosition), to_underlying(Fields::kNewPosition), offsetof(Type, newPosition)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newPosition), to_underlying(Fields::kNewPosition), offsetof(T, newPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newPosition), &T::newPosition, to_underlying(Fields::kNewPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8346,8 +14428,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SwitchLatched.
 namespace InitialPress {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newPosition), to_underlying(Fields::kNewPosition), offsetof(Type, newPosition)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newPosition), to_underlying(Fields::kNewPosition), offsetof(T, newPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newPosition), &T::newPosition, to_underlying(Fields::kNewPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8383,8 +14506,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace InitialPress.
 namespace LongPress {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newPosition), to_underlying(Fields::kNewPosition), offsetof(Type, newPosition)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newPosition), to_underlying(Fields::kNewPosition), offsetof(T, newPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newPosition), &T::newPosition, to_underlying(Fields::kNewPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8420,8 +14584,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LongPress.
 namespace ShortRelease {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::previousPosition), to_underlying(Fields::kPreviousPosition),
+                              offsetof(Type, previousPosition)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::previousPosition), to_underlying(Fields::kPreviousPosition),
+                                  offsetof(T, previousPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::previousPosition), &T::previousPosition,
+                                        to_underlying(Fields::kPreviousPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8457,8 +14665,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ShortRelease.
 namespace LongRelease {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::previousPosition), to_underlying(Fields::kPreviousPosition),
+                              offsetof(Type, previousPosition)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::previousPosition), to_underlying(Fields::kPreviousPosition),
+                                  offsetof(T, previousPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::previousPosition), &T::previousPosition,
+                                        to_underlying(Fields::kPreviousPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8494,13 +14746,60 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LongRelease.
 namespace MultiPressOngoing {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newPosition), to_underlying(Fields::kNewPosition), offsetof(Type, newPosition)>(),
+    DataModel::EncodableField<decltype(Type::currentNumberOfPressesCounted), to_underlying(Fields::kCurrentNumberOfPressesCounted),
+                              offsetof(Type, currentNumberOfPressesCounted)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newPosition), to_underlying(Fields::kNewPosition), offsetof(T, newPosition)>(),
+        DataModel::DecodableField<decltype(T::currentNumberOfPressesCounted), to_underlying(Fields::kCurrentNumberOfPressesCounted),
+                                  offsetof(T, currentNumberOfPressesCounted)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newPosition), &T::newPosition, to_underlying(Fields::kNewPosition)>(),
+        DataModel::DecodableMemberField<T, decltype(T::currentNumberOfPressesCounted), &T::currentNumberOfPressesCounted,
+                                        to_underlying(Fields::kCurrentNumberOfPressesCounted)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition));
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kNewPosition)), newPosition));
     ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kCurrentNumberOfPressesCounted)),
                                            currentNumberOfPressesCounted));
     ReturnErrorOnFailure(writer.EndContainer(outer));
@@ -8536,8 +14835,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MultiPressOngoing.
 namespace MultiPressComplete {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newPosition), to_underlying(Fields::kNewPosition), offsetof(Type, newPosition)>(),
+    DataModel::EncodableField<decltype(Type::totalNumberOfPressesCounted), to_underlying(Fields::kTotalNumberOfPressesCounted),
+                              offsetof(Type, totalNumberOfPressesCounted)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newPosition), to_underlying(Fields::kNewPosition), offsetof(T, newPosition)>(),
+        DataModel::DecodableField<decltype(T::totalNumberOfPressesCounted), to_underlying(Fields::kTotalNumberOfPressesCounted),
+                                  offsetof(T, totalNumberOfPressesCounted)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newPosition), &T::newPosition, to_underlying(Fields::kNewPosition)>(),
+        DataModel::DecodableMemberField<T, decltype(T::totalNumberOfPressesCounted), &T::totalNumberOfPressesCounted,
+                                        to_underlying(Fields::kTotalNumberOfPressesCounted)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8578,6 +14924,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MultiPressComplete.
 } // namespace Events
 
@@ -8586,6 +14933,62 @@ namespace AdministratorCommissioning {
 
 namespace Commands {
 namespace OpenCommissioningWindow {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::commissioningTimeout), to_underlying(Fields::kCommissioningTimeout),
+                              offsetof(Type, commissioningTimeout)>(),
+    DataModel::EncodableField<decltype(Type::PAKEVerifier), to_underlying(Fields::kPAKEVerifier), offsetof(Type, PAKEVerifier)>(),
+    DataModel::EncodableField<decltype(Type::discriminator), to_underlying(Fields::kDiscriminator),
+                              offsetof(Type, discriminator)>(),
+    DataModel::EncodableField<decltype(Type::iterations), to_underlying(Fields::kIterations), offsetof(Type, iterations)>(),
+    DataModel::EncodableField<decltype(Type::salt), to_underlying(Fields::kSalt), offsetof(Type, salt)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::commissioningTimeout), to_underlying(Fields::kCommissioningTimeout),
+                                  offsetof(T, commissioningTimeout)>(),
+        DataModel::DecodableField<decltype(T::PAKEVerifier), to_underlying(Fields::kPAKEVerifier), offsetof(T, PAKEVerifier)>(),
+        DataModel::DecodableField<decltype(T::discriminator), to_underlying(Fields::kDiscriminator), offsetof(T, discriminator)>(),
+        DataModel::DecodableField<decltype(T::iterations), to_underlying(Fields::kIterations), offsetof(T, iterations)>(),
+        DataModel::DecodableField<decltype(T::salt), to_underlying(Fields::kSalt), offsetof(T, salt)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::commissioningTimeout), &T::commissioningTimeout,
+                                        to_underlying(Fields::kCommissioningTimeout)>(),
+        DataModel::DecodableMemberField<T, decltype(T::PAKEVerifier), &T::PAKEVerifier, to_underlying(Fields::kPAKEVerifier)>(),
+        DataModel::DecodableMemberField<T, decltype(T::discriminator), &T::discriminator, to_underlying(Fields::kDiscriminator)>(),
+        DataModel::DecodableMemberField<T, decltype(T::iterations), &T::iterations, to_underlying(Fields::kIterations)>(),
+        DataModel::DecodableMemberField<T, decltype(T::salt), &T::salt, to_underlying(Fields::kSalt)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8638,8 +15041,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace OpenCommissioningWindow.
 namespace OpenBasicCommissioningWindow {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::commissioningTimeout), to_underlying(Fields::kCommissioningTimeout),
+                              offsetof(Type, commissioningTimeout)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::commissioningTimeout), to_underlying(Fields::kCommissioningTimeout),
+                                  offsetof(T, commissioningTimeout)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::commissioningTimeout), &T::commissioningTimeout,
+                                        to_underlying(Fields::kCommissioningTimeout)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8676,8 +15123,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace OpenBasicCommissioningWindow.
 namespace RevokeCommissioning {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8709,6 +15194,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RevokeCommissioning.
 } // namespace Commands
 
@@ -8766,6 +15252,31 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::rootPublicKey), to_underlying(Fields::kRootPublicKey), offsetof(Type, rootPublicKey)>(),
+    DataModel::Field<decltype(Type::vendorId), to_underlying(Fields::kVendorId), offsetof(Type, vendorId)>(),
+    DataModel::Field<decltype(Type::fabricId), to_underlying(Fields::kFabricId), offsetof(Type, fabricId)>(),
+    DataModel::Field<decltype(Type::nodeId), to_underlying(Fields::kNodeId), offsetof(Type, nodeId)>(),
+    DataModel::Field<decltype(Type::label), to_underlying(Fields::kLabel), offsetof(Type, label)>(),
+    DataModel::Field<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                     offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     TLV::TLVType outer;
@@ -8826,6 +15337,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace FabricDescriptor
 namespace NOCStruct {
@@ -8839,6 +15351,30 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::noc), to_underlying(Fields::kNoc),
+                     offsetof(Type, noc)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::Field<decltype(Type::icac), to_underlying(Fields::kIcac),
+                     offsetof(Type, icac)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::Field<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                     offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     bool includeSensitive = !accessingFabricIndex.HasValue() || (accessingFabricIndex.Value() == fabricIndex);
@@ -8894,12 +15430,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NOCStruct
 } // namespace Structs
 
 namespace Commands {
 namespace AttestationRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::attestationNonce), to_underlying(Fields::kAttestationNonce),
+                              offsetof(Type, attestationNonce)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::attestationNonce), to_underlying(Fields::kAttestationNonce),
+                                  offsetof(T, attestationNonce)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::attestationNonce), &T::attestationNonce,
+                                        to_underlying(Fields::kAttestationNonce)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8935,8 +15515,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AttestationRequest.
 namespace AttestationResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::attestationElements), to_underlying(Fields::kAttestationElements),
+                              offsetof(Type, attestationElements)>(),
+    DataModel::EncodableField<decltype(Type::signature), to_underlying(Fields::kSignature), offsetof(Type, signature)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::attestationElements), to_underlying(Fields::kAttestationElements),
+                                  offsetof(T, attestationElements)>(),
+        DataModel::DecodableField<decltype(T::signature), to_underlying(Fields::kSignature), offsetof(T, signature)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::attestationElements), &T::attestationElements,
+                                        to_underlying(Fields::kAttestationElements)>(),
+        DataModel::DecodableMemberField<T, decltype(T::signature), &T::signature, to_underlying(Fields::kSignature)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -8977,8 +15604,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AttestationResponse.
 namespace CertificateChainRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::certificateType), to_underlying(Fields::kCertificateType),
+                              offsetof(Type, certificateType)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::certificateType), to_underlying(Fields::kCertificateType),
+                                  offsetof(T, certificateType)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::certificateType), &T::certificateType,
+                                        to_underlying(Fields::kCertificateType)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9014,8 +15685,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CertificateChainRequest.
 namespace CertificateChainResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::certificate), to_underlying(Fields::kCertificate), offsetof(Type, certificate)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::certificate), to_underlying(Fields::kCertificate), offsetof(T, certificate)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::certificate), &T::certificate, to_underlying(Fields::kCertificate)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9051,8 +15763,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CertificateChainResponse.
 namespace CSRRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::CSRNonce), to_underlying(Fields::kCSRNonce), offsetof(Type, CSRNonce)>(),
+    DataModel::EncodableField<decltype(Type::isForUpdateNOC), to_underlying(Fields::kIsForUpdateNOC),
+                              offsetof(Type, isForUpdateNOC)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::CSRNonce), to_underlying(Fields::kCSRNonce), offsetof(T, CSRNonce)>(),
+        DataModel::DecodableField<decltype(T::isForUpdateNOC), to_underlying(Fields::kIsForUpdateNOC),
+                                  offsetof(T, isForUpdateNOC)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::CSRNonce), &T::CSRNonce, to_underlying(Fields::kCSRNonce)>(),
+        DataModel::DecodableMemberField<T, decltype(T::isForUpdateNOC), &T::isForUpdateNOC,
+                                        to_underlying(Fields::kIsForUpdateNOC)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9092,8 +15851,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CSRRequest.
 namespace CSRResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::NOCSRElements), to_underlying(Fields::kNOCSRElements),
+                              offsetof(Type, NOCSRElements)>(),
+    DataModel::EncodableField<decltype(Type::attestationSignature), to_underlying(Fields::kAttestationSignature),
+                              offsetof(Type, attestationSignature)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::NOCSRElements), to_underlying(Fields::kNOCSRElements), offsetof(T, NOCSRElements)>(),
+        DataModel::DecodableField<decltype(T::attestationSignature), to_underlying(Fields::kAttestationSignature),
+                                  offsetof(T, attestationSignature)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::NOCSRElements), &T::NOCSRElements, to_underlying(Fields::kNOCSRElements)>(),
+        DataModel::DecodableMemberField<T, decltype(T::attestationSignature), &T::attestationSignature,
+                                        to_underlying(Fields::kAttestationSignature)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9134,8 +15941,65 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace CSRResponse.
 namespace AddNOC {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::NOCValue), to_underlying(Fields::kNOCValue), offsetof(Type, NOCValue)>(),
+    DataModel::EncodableField<decltype(Type::ICACValue), to_underlying(Fields::kICACValue), offsetof(Type, ICACValue)>(),
+    DataModel::EncodableField<decltype(Type::IPKValue), to_underlying(Fields::kIPKValue), offsetof(Type, IPKValue)>(),
+    DataModel::EncodableField<decltype(Type::caseAdminSubject), to_underlying(Fields::kCaseAdminSubject),
+                              offsetof(Type, caseAdminSubject)>(),
+    DataModel::EncodableField<decltype(Type::adminVendorId), to_underlying(Fields::kAdminVendorId),
+                              offsetof(Type, adminVendorId)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::NOCValue), to_underlying(Fields::kNOCValue), offsetof(T, NOCValue)>(),
+        DataModel::DecodableField<decltype(T::ICACValue), to_underlying(Fields::kICACValue), offsetof(T, ICACValue)>(),
+        DataModel::DecodableField<decltype(T::IPKValue), to_underlying(Fields::kIPKValue), offsetof(T, IPKValue)>(),
+        DataModel::DecodableField<decltype(T::caseAdminSubject), to_underlying(Fields::kCaseAdminSubject),
+                                  offsetof(T, caseAdminSubject)>(),
+        DataModel::DecodableField<decltype(T::adminVendorId), to_underlying(Fields::kAdminVendorId), offsetof(T, adminVendorId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::NOCValue), &T::NOCValue, to_underlying(Fields::kNOCValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::ICACValue), &T::ICACValue, to_underlying(Fields::kICACValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::IPKValue), &T::IPKValue, to_underlying(Fields::kIPKValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::caseAdminSubject), &T::caseAdminSubject,
+                                        to_underlying(Fields::kCaseAdminSubject)>(),
+        DataModel::DecodableMemberField<T, decltype(T::adminVendorId), &T::adminVendorId, to_underlying(Fields::kAdminVendorId)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9187,8 +16051,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddNOC.
 namespace UpdateNOC {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::NOCValue), to_underlying(Fields::kNOCValue), offsetof(Type, NOCValue)>(),
+    DataModel::EncodableField<decltype(Type::ICACValue), to_underlying(Fields::kICACValue), offsetof(Type, ICACValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::NOCValue), to_underlying(Fields::kNOCValue), offsetof(T, NOCValue)>(),
+        DataModel::DecodableField<decltype(T::ICACValue), to_underlying(Fields::kICACValue), offsetof(T, ICACValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::NOCValue), &T::NOCValue, to_underlying(Fields::kNOCValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::ICACValue), &T::ICACValue, to_underlying(Fields::kICACValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9228,8 +16136,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace UpdateNOC.
 namespace NOCResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::statusCode), to_underlying(Fields::kStatusCode), offsetof(Type, statusCode)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::debugText), to_underlying(Fields::kDebugText), offsetof(Type, debugText)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::statusCode), to_underlying(Fields::kStatusCode), offsetof(T, statusCode)>(),
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::DecodableField<decltype(T::debugText), to_underlying(Fields::kDebugText), offsetof(T, debugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::statusCode), &T::statusCode, to_underlying(Fields::kStatusCode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::debugText), &T::debugText, to_underlying(Fields::kDebugText)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9273,8 +16228,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NOCResponse.
 namespace UpdateFabricLabel {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::label), to_underlying(Fields::kLabel), offsetof(Type, label)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::label), to_underlying(Fields::kLabel), offsetof(T, label)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::label), &T::label, to_underlying(Fields::kLabel)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9310,8 +16306,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace UpdateFabricLabel.
 namespace RemoveFabric {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9347,8 +16384,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RemoveFabric.
 namespace AddTrustedRootCertificate {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::rootCertificate), to_underlying(Fields::kRootCertificate),
+                              offsetof(Type, rootCertificate)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::rootCertificate), to_underlying(Fields::kRootCertificate),
+                                  offsetof(T, rootCertificate)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::rootCertificate), &T::rootCertificate,
+                                        to_underlying(Fields::kRootCertificate)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9384,6 +16465,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AddTrustedRootCertificate.
 } // namespace Commands
 
@@ -9450,6 +16532,39 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::EncodableField<decltype(Type::endpoints), to_underlying(Fields::kEndpoints), offsetof(Type, endpoints)>(),
+    DataModel::EncodableField<decltype(Type::groupName), to_underlying(Fields::kGroupName), offsetof(Type, groupName)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                              offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::groupId), &DecodableType::groupId,
+                                    to_underlying(Fields::kGroupId)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::endpoints), &DecodableType::endpoints,
+                                    to_underlying(Fields::kEndpoints)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::groupName), &DecodableType::groupName,
+                                    to_underlying(Fields::kGroupName)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricIndex), &DecodableType::fabricIndex,
+                                    to_underlying(Fields::kFabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     TLV::TLVType outer;
@@ -9502,6 +16617,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace GroupInfoMapStruct
 namespace GroupKeyMapStruct {
@@ -9515,6 +16631,28 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::groupId), to_underlying(Fields::kGroupId), offsetof(Type, groupId)>(),
+    DataModel::Field<decltype(Type::groupKeySetID), to_underlying(Fields::kGroupKeySetID), offsetof(Type, groupKeySetID)>(),
+    DataModel::Field<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                     offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     TLV::TLVType outer;
@@ -9563,9 +16701,37 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace GroupKeyMapStruct
 namespace GroupKeySetStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::groupKeySetID), to_underlying(Fields::kGroupKeySetID), offsetof(Type, groupKeySetID)>(),
+    DataModel::Field<decltype(Type::groupKeySecurityPolicy), to_underlying(Fields::kGroupKeySecurityPolicy),
+                     offsetof(Type, groupKeySecurityPolicy)>(),
+    DataModel::Field<decltype(Type::epochKey0), to_underlying(Fields::kEpochKey0), offsetof(Type, epochKey0)>(),
+    DataModel::Field<decltype(Type::epochStartTime0), to_underlying(Fields::kEpochStartTime0), offsetof(Type, epochStartTime0)>(),
+    DataModel::Field<decltype(Type::epochKey1), to_underlying(Fields::kEpochKey1), offsetof(Type, epochKey1)>(),
+    DataModel::Field<decltype(Type::epochStartTime1), to_underlying(Fields::kEpochStartTime1), offsetof(Type, epochStartTime1)>(),
+    DataModel::Field<decltype(Type::epochKey2), to_underlying(Fields::kEpochKey2), offsetof(Type, epochKey2)>(),
+    DataModel::Field<decltype(Type::epochStartTime2), to_underlying(Fields::kEpochStartTime2), offsetof(Type, epochStartTime2)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9632,12 +16798,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace GroupKeySetStruct
 } // namespace Structs
 
 namespace Commands {
 namespace KeySetWrite {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupKeySet), to_underlying(Fields::kGroupKeySet), offsetof(Type, groupKeySet)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupKeySet), to_underlying(Fields::kGroupKeySet), offsetof(T, groupKeySet)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupKeySet), &T::groupKeySet, to_underlying(Fields::kGroupKeySet)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9673,8 +16880,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace KeySetWrite.
 namespace KeySetRead {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupKeySetID), to_underlying(Fields::kGroupKeySetID),
+                              offsetof(Type, groupKeySetID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupKeySetID), to_underlying(Fields::kGroupKeySetID), offsetof(T, groupKeySetID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupKeySetID), &T::groupKeySetID, to_underlying(Fields::kGroupKeySetID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9710,8 +16959,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace KeySetRead.
 namespace KeySetReadResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupKeySet), to_underlying(Fields::kGroupKeySet), offsetof(Type, groupKeySet)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupKeySet), to_underlying(Fields::kGroupKeySet), offsetof(T, groupKeySet)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupKeySet), &T::groupKeySet, to_underlying(Fields::kGroupKeySet)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9747,8 +17037,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace KeySetReadResponse.
 namespace KeySetRemove {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupKeySetID), to_underlying(Fields::kGroupKeySetID),
+                              offsetof(Type, groupKeySetID)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupKeySetID), to_underlying(Fields::kGroupKeySetID), offsetof(T, groupKeySetID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupKeySetID), &T::groupKeySetID, to_underlying(Fields::kGroupKeySetID)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9784,8 +17116,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace KeySetRemove.
 namespace KeySetReadAllIndices {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupKeySetIDs), to_underlying(Fields::kGroupKeySetIDs),
+                              offsetof(Type, groupKeySetIDs)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupKeySetIDs), to_underlying(Fields::kGroupKeySetIDs),
+                                  offsetof(T, groupKeySetIDs)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupKeySetIDs), &T::groupKeySetIDs,
+                                        to_underlying(Fields::kGroupKeySetIDs)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9821,8 +17197,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace KeySetReadAllIndices.
 namespace KeySetReadAllIndicesResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::groupKeySetIDs), to_underlying(Fields::kGroupKeySetIDs),
+                              offsetof(Type, groupKeySetIDs)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::groupKeySetIDs), to_underlying(Fields::kGroupKeySetIDs),
+                                  offsetof(T, groupKeySetIDs)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::groupKeySetIDs), &T::groupKeySetIDs,
+                                        to_underlying(Fields::kGroupKeySetIDs)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -9858,6 +17278,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace KeySetReadAllIndicesResponse.
 } // namespace Commands
 
@@ -10138,11 +17559,51 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace StateChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stateValue), to_underlying(Fields::kStateValue), offsetof(Type, stateValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stateValue), to_underlying(Fields::kStateValue), offsetof(T, stateValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stateValue), &T::stateValue, to_underlying(Fields::kStateValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
-    TLV::TLVType outer;
-    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
-    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStateValue)), stateValue));
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+    ReturnErrorOnFailure(DataModel::Encode(writer, TLV::ContextTag(to_underlying(Fields::kStateValue)), stateValue));
     ReturnErrorOnFailure(writer.EndContainer(outer));
     return CHIP_NO_ERROR;
 }
@@ -10173,6 +17634,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StateChange.
 } // namespace Events
 
@@ -10180,6 +17642,26 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace ModeSelect {
 namespace Structs {
 namespace SemanticTag {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::mfgCode), to_underlying(Fields::kMfgCode), offsetof(Type, mfgCode)>(),
+    DataModel::Field<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10221,9 +17703,39 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace SemanticTag
 namespace ModeOptionStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::label), to_underlying(Fields::kLabel), offsetof(Type, label)>(),
+    DataModel::EncodableField<decltype(Type::mode), to_underlying(Fields::kMode), offsetof(Type, mode)>(),
+    DataModel::EncodableField<decltype(Type::semanticTags), to_underlying(Fields::kSemanticTags), offsetof(Type, semanticTags)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::label), &DecodableType::label,
+                                    to_underlying(Fields::kLabel)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::mode), &DecodableType::mode,
+                                    to_underlying(Fields::kMode)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::semanticTags), &DecodableType::semanticTags,
+                                    to_underlying(Fields::kSemanticTags)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10269,12 +17781,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ModeOptionStruct
 } // namespace Structs
 
 namespace Commands {
 namespace ChangeToMode {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::newMode), to_underlying(Fields::kNewMode), offsetof(Type, newMode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::newMode), to_underlying(Fields::kNewMode), offsetof(T, newMode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::newMode), &T::newMode, to_underlying(Fields::kNewMode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10310,6 +17863,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ChangeToMode.
 } // namespace Commands
 
@@ -10366,6 +17920,26 @@ namespace Events {
 namespace DoorLock {
 namespace Structs {
 namespace DlCredential {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::credentialType), to_underlying(Fields::kCredentialType), offsetof(Type, credentialType)>(),
+    DataModel::Field<decltype(Type::credentialIndex), to_underlying(Fields::kCredentialIndex), offsetof(Type, credentialIndex)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10407,12 +17981,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace DlCredential
 } // namespace Structs
 
 namespace Commands {
 namespace LockDoor {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::pinCode), to_underlying(Fields::kPinCode), offsetof(Type, pinCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::pinCode), to_underlying(Fields::kPinCode), offsetof(T, pinCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::pinCode), &T::pinCode, to_underlying(Fields::kPinCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10448,8 +18063,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LockDoor.
 namespace UnlockDoor {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::pinCode), to_underlying(Fields::kPinCode), offsetof(Type, pinCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::pinCode), to_underlying(Fields::kPinCode), offsetof(T, pinCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::pinCode), &T::pinCode, to_underlying(Fields::kPinCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10485,8 +18141,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace UnlockDoor.
 namespace UnlockWithTimeout {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::timeout), to_underlying(Fields::kTimeout), offsetof(Type, timeout)>(),
+    DataModel::EncodableField<decltype(Type::pinCode), to_underlying(Fields::kPinCode), offsetof(Type, pinCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::timeout), to_underlying(Fields::kTimeout), offsetof(T, timeout)>(),
+        DataModel::DecodableField<decltype(T::pinCode), to_underlying(Fields::kPinCode), offsetof(T, pinCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::timeout), &T::timeout, to_underlying(Fields::kTimeout)>(),
+        DataModel::DecodableMemberField<T, decltype(T::pinCode), &T::pinCode, to_underlying(Fields::kPinCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10526,8 +18226,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace UnlockWithTimeout.
 namespace SetWeekDaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(Type, weekDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::daysMask), to_underlying(Fields::kDaysMask), offsetof(Type, daysMask)>(),
+    DataModel::EncodableField<decltype(Type::startHour), to_underlying(Fields::kStartHour), offsetof(Type, startHour)>(),
+    DataModel::EncodableField<decltype(Type::startMinute), to_underlying(Fields::kStartMinute), offsetof(Type, startMinute)>(),
+    DataModel::EncodableField<decltype(Type::endHour), to_underlying(Fields::kEndHour), offsetof(Type, endHour)>(),
+    DataModel::EncodableField<decltype(Type::endMinute), to_underlying(Fields::kEndMinute), offsetof(Type, endMinute)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(T, weekDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::daysMask), to_underlying(Fields::kDaysMask), offsetof(T, daysMask)>(),
+        DataModel::DecodableField<decltype(T::startHour), to_underlying(Fields::kStartHour), offsetof(T, startHour)>(),
+        DataModel::DecodableField<decltype(T::startMinute), to_underlying(Fields::kStartMinute), offsetof(T, startMinute)>(),
+        DataModel::DecodableField<decltype(T::endHour), to_underlying(Fields::kEndHour), offsetof(T, endHour)>(),
+        DataModel::DecodableField<decltype(T::endMinute), to_underlying(Fields::kEndMinute), offsetof(T, endMinute)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::weekDayIndex), &T::weekDayIndex, to_underlying(Fields::kWeekDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::daysMask), &T::daysMask, to_underlying(Fields::kDaysMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::startHour), &T::startHour, to_underlying(Fields::kStartHour)>(),
+        DataModel::DecodableMemberField<T, decltype(T::startMinute), &T::startMinute, to_underlying(Fields::kStartMinute)>(),
+        DataModel::DecodableMemberField<T, decltype(T::endHour), &T::endHour, to_underlying(Fields::kEndHour)>(),
+        DataModel::DecodableMemberField<T, decltype(T::endMinute), &T::endMinute, to_underlying(Fields::kEndMinute)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10587,8 +18346,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetWeekDaySchedule.
 namespace GetWeekDaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(Type, weekDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(T, weekDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::weekDayIndex), &T::weekDayIndex, to_underlying(Fields::kWeekDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10628,8 +18431,70 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetWeekDaySchedule.
 namespace GetWeekDayScheduleResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(Type, weekDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::daysMask), to_underlying(Fields::kDaysMask), offsetof(Type, daysMask)>(),
+    DataModel::EncodableField<decltype(Type::startHour), to_underlying(Fields::kStartHour), offsetof(Type, startHour)>(),
+    DataModel::EncodableField<decltype(Type::startMinute), to_underlying(Fields::kStartMinute), offsetof(Type, startMinute)>(),
+    DataModel::EncodableField<decltype(Type::endHour), to_underlying(Fields::kEndHour), offsetof(Type, endHour)>(),
+    DataModel::EncodableField<decltype(Type::endMinute), to_underlying(Fields::kEndMinute), offsetof(Type, endMinute)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(T, weekDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::daysMask), to_underlying(Fields::kDaysMask), offsetof(T, daysMask)>(),
+        DataModel::DecodableField<decltype(T::startHour), to_underlying(Fields::kStartHour), offsetof(T, startHour)>(),
+        DataModel::DecodableField<decltype(T::startMinute), to_underlying(Fields::kStartMinute), offsetof(T, startMinute)>(),
+        DataModel::DecodableField<decltype(T::endHour), to_underlying(Fields::kEndHour), offsetof(T, endHour)>(),
+        DataModel::DecodableField<decltype(T::endMinute), to_underlying(Fields::kEndMinute), offsetof(T, endMinute)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::weekDayIndex), &T::weekDayIndex, to_underlying(Fields::kWeekDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::daysMask), &T::daysMask, to_underlying(Fields::kDaysMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::startHour), &T::startHour, to_underlying(Fields::kStartHour)>(),
+        DataModel::DecodableMemberField<T, decltype(T::startMinute), &T::startMinute, to_underlying(Fields::kStartMinute)>(),
+        DataModel::DecodableMemberField<T, decltype(T::endHour), &T::endHour, to_underlying(Fields::kEndHour)>(),
+        DataModel::DecodableMemberField<T, decltype(T::endMinute), &T::endMinute, to_underlying(Fields::kEndMinute)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10693,8 +18558,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetWeekDayScheduleResponse.
 namespace ClearWeekDaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(Type, weekDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::weekDayIndex), to_underlying(Fields::kWeekDayIndex), offsetof(T, weekDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::weekDayIndex), &T::weekDayIndex, to_underlying(Fields::kWeekDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10734,8 +18643,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ClearWeekDaySchedule.
 namespace SetYearDaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(Type, yearDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::localStartTime), to_underlying(Fields::kLocalStartTime),
+                              offsetof(Type, localStartTime)>(),
+    DataModel::EncodableField<decltype(Type::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(Type, localEndTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(T, yearDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::localStartTime), to_underlying(Fields::kLocalStartTime),
+                                  offsetof(T, localStartTime)>(),
+        DataModel::DecodableField<decltype(T::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(T, localEndTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::yearDayIndex), &T::yearDayIndex, to_underlying(Fields::kYearDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localStartTime), &T::localStartTime,
+                                        to_underlying(Fields::kLocalStartTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localEndTime), &T::localEndTime, to_underlying(Fields::kLocalEndTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10783,8 +18745,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetYearDaySchedule.
 namespace GetYearDaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(Type, yearDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(T, yearDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::yearDayIndex), &T::yearDayIndex, to_underlying(Fields::kYearDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10824,8 +18830,64 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetYearDaySchedule.
 namespace GetYearDayScheduleResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(Type, yearDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::localStartTime), to_underlying(Fields::kLocalStartTime),
+                              offsetof(Type, localStartTime)>(),
+    DataModel::EncodableField<decltype(Type::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(Type, localEndTime)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(T, yearDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::localStartTime), to_underlying(Fields::kLocalStartTime),
+                                  offsetof(T, localStartTime)>(),
+        DataModel::DecodableField<decltype(T::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(T, localEndTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::yearDayIndex), &T::yearDayIndex, to_underlying(Fields::kYearDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localStartTime), &T::localStartTime,
+                                        to_underlying(Fields::kLocalStartTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localEndTime), &T::localEndTime, to_underlying(Fields::kLocalEndTime)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10877,8 +18939,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetYearDayScheduleResponse.
 namespace ClearYearDaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(Type, yearDayIndex)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::yearDayIndex), to_underlying(Fields::kYearDayIndex), offsetof(T, yearDayIndex)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::yearDayIndex), &T::yearDayIndex, to_underlying(Fields::kYearDayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10918,8 +19024,62 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ClearYearDaySchedule.
 namespace SetHolidaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(Type, holidayIndex)>(),
+    DataModel::EncodableField<decltype(Type::localStartTime), to_underlying(Fields::kLocalStartTime),
+                              offsetof(Type, localStartTime)>(),
+    DataModel::EncodableField<decltype(Type::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(Type, localEndTime)>(),
+    DataModel::EncodableField<decltype(Type::operatingMode), to_underlying(Fields::kOperatingMode),
+                              offsetof(Type, operatingMode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(T, holidayIndex)>(),
+        DataModel::DecodableField<decltype(T::localStartTime), to_underlying(Fields::kLocalStartTime),
+                                  offsetof(T, localStartTime)>(),
+        DataModel::DecodableField<decltype(T::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(T, localEndTime)>(),
+        DataModel::DecodableField<decltype(T::operatingMode), to_underlying(Fields::kOperatingMode), offsetof(T, operatingMode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::holidayIndex), &T::holidayIndex, to_underlying(Fields::kHolidayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localStartTime), &T::localStartTime,
+                                        to_underlying(Fields::kLocalStartTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localEndTime), &T::localEndTime, to_underlying(Fields::kLocalEndTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::operatingMode), &T::operatingMode, to_underlying(Fields::kOperatingMode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -10967,8 +19127,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetHolidaySchedule.
 namespace GetHolidaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(Type, holidayIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(T, holidayIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::holidayIndex), &T::holidayIndex, to_underlying(Fields::kHolidayIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11004,8 +19205,65 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetHolidaySchedule.
 namespace GetHolidayScheduleResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(Type, holidayIndex)>(),
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::localStartTime), to_underlying(Fields::kLocalStartTime),
+                              offsetof(Type, localStartTime)>(),
+    DataModel::EncodableField<decltype(Type::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(Type, localEndTime)>(),
+    DataModel::EncodableField<decltype(Type::operatingMode), to_underlying(Fields::kOperatingMode),
+                              offsetof(Type, operatingMode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(T, holidayIndex)>(),
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::localStartTime), to_underlying(Fields::kLocalStartTime),
+                                  offsetof(T, localStartTime)>(),
+        DataModel::DecodableField<decltype(T::localEndTime), to_underlying(Fields::kLocalEndTime), offsetof(T, localEndTime)>(),
+        DataModel::DecodableField<decltype(T::operatingMode), to_underlying(Fields::kOperatingMode), offsetof(T, operatingMode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::holidayIndex), &T::holidayIndex, to_underlying(Fields::kHolidayIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localStartTime), &T::localStartTime,
+                                        to_underlying(Fields::kLocalStartTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::localEndTime), &T::localEndTime, to_underlying(Fields::kLocalEndTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::operatingMode), &T::operatingMode, to_underlying(Fields::kOperatingMode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11057,8 +19315,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetHolidayScheduleResponse.
 namespace ClearHolidaySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(Type, holidayIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::holidayIndex), to_underlying(Fields::kHolidayIndex), offsetof(T, holidayIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::holidayIndex), &T::holidayIndex, to_underlying(Fields::kHolidayIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11094,8 +19393,71 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ClearHolidaySchedule.
 namespace SetUser {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::operationType), to_underlying(Fields::kOperationType),
+                              offsetof(Type, operationType)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::userName), to_underlying(Fields::kUserName), offsetof(Type, userName)>(),
+    DataModel::EncodableField<decltype(Type::userUniqueId), to_underlying(Fields::kUserUniqueId), offsetof(Type, userUniqueId)>(),
+    DataModel::EncodableField<decltype(Type::userStatus), to_underlying(Fields::kUserStatus), offsetof(Type, userStatus)>(),
+    DataModel::EncodableField<decltype(Type::userType), to_underlying(Fields::kUserType), offsetof(Type, userType)>(),
+    DataModel::EncodableField<decltype(Type::credentialRule), to_underlying(Fields::kCredentialRule),
+                              offsetof(Type, credentialRule)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::operationType), to_underlying(Fields::kOperationType), offsetof(T, operationType)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::userName), to_underlying(Fields::kUserName), offsetof(T, userName)>(),
+        DataModel::DecodableField<decltype(T::userUniqueId), to_underlying(Fields::kUserUniqueId), offsetof(T, userUniqueId)>(),
+        DataModel::DecodableField<decltype(T::userStatus), to_underlying(Fields::kUserStatus), offsetof(T, userStatus)>(),
+        DataModel::DecodableField<decltype(T::userType), to_underlying(Fields::kUserType), offsetof(T, userType)>(),
+        DataModel::DecodableField<decltype(T::credentialRule), to_underlying(Fields::kCredentialRule),
+                                  offsetof(T, credentialRule)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::operationType), &T::operationType, to_underlying(Fields::kOperationType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userName), &T::userName, to_underlying(Fields::kUserName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userUniqueId), &T::userUniqueId, to_underlying(Fields::kUserUniqueId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userStatus), &T::userStatus, to_underlying(Fields::kUserStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userType), &T::userType, to_underlying(Fields::kUserType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentialRule), &T::credentialRule,
+                                        to_underlying(Fields::kCredentialRule)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11155,8 +19517,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetUser.
 namespace GetUser {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11192,8 +19595,86 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetUser.
 namespace GetUserResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::userName), to_underlying(Fields::kUserName), offsetof(Type, userName)>(),
+    DataModel::EncodableField<decltype(Type::userUniqueId), to_underlying(Fields::kUserUniqueId), offsetof(Type, userUniqueId)>(),
+    DataModel::EncodableField<decltype(Type::userStatus), to_underlying(Fields::kUserStatus), offsetof(Type, userStatus)>(),
+    DataModel::EncodableField<decltype(Type::userType), to_underlying(Fields::kUserType), offsetof(Type, userType)>(),
+    DataModel::EncodableField<decltype(Type::credentialRule), to_underlying(Fields::kCredentialRule),
+                              offsetof(Type, credentialRule)>(),
+    DataModel::EncodableField<decltype(Type::credentials), to_underlying(Fields::kCredentials), offsetof(Type, credentials)>(),
+    DataModel::EncodableField<decltype(Type::creatorFabricIndex), to_underlying(Fields::kCreatorFabricIndex),
+                              offsetof(Type, creatorFabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::lastModifiedFabricIndex), to_underlying(Fields::kLastModifiedFabricIndex),
+                              offsetof(Type, lastModifiedFabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::nextUserIndex), to_underlying(Fields::kNextUserIndex),
+                              offsetof(Type, nextUserIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::userName), to_underlying(Fields::kUserName), offsetof(T, userName)>(),
+        DataModel::DecodableField<decltype(T::userUniqueId), to_underlying(Fields::kUserUniqueId), offsetof(T, userUniqueId)>(),
+        DataModel::DecodableField<decltype(T::userStatus), to_underlying(Fields::kUserStatus), offsetof(T, userStatus)>(),
+        DataModel::DecodableField<decltype(T::userType), to_underlying(Fields::kUserType), offsetof(T, userType)>(),
+        DataModel::DecodableField<decltype(T::credentialRule), to_underlying(Fields::kCredentialRule),
+                                  offsetof(T, credentialRule)>(),
+        DataModel::DecodableField<decltype(T::credentials), to_underlying(Fields::kCredentials), offsetof(T, credentials)>(),
+        DataModel::DecodableField<decltype(T::creatorFabricIndex), to_underlying(Fields::kCreatorFabricIndex),
+                                  offsetof(T, creatorFabricIndex)>(),
+        DataModel::DecodableField<decltype(T::lastModifiedFabricIndex), to_underlying(Fields::kLastModifiedFabricIndex),
+                                  offsetof(T, lastModifiedFabricIndex)>(),
+        DataModel::DecodableField<decltype(T::nextUserIndex), to_underlying(Fields::kNextUserIndex), offsetof(T, nextUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userName), &T::userName, to_underlying(Fields::kUserName)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userUniqueId), &T::userUniqueId, to_underlying(Fields::kUserUniqueId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userStatus), &T::userStatus, to_underlying(Fields::kUserStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userType), &T::userType, to_underlying(Fields::kUserType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentialRule), &T::credentialRule,
+                                        to_underlying(Fields::kCredentialRule)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentials), &T::credentials, to_underlying(Fields::kCredentials)>(),
+        DataModel::DecodableMemberField<T, decltype(T::creatorFabricIndex), &T::creatorFabricIndex,
+                                        to_underlying(Fields::kCreatorFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::lastModifiedFabricIndex), &T::lastModifiedFabricIndex,
+                                        to_underlying(Fields::kLastModifiedFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nextUserIndex), &T::nextUserIndex, to_underlying(Fields::kNextUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11267,8 +19748,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetUserResponse.
 namespace ClearUser {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11304,8 +19826,68 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ClearUser.
 namespace SetCredential {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::operationType), to_underlying(Fields::kOperationType),
+                              offsetof(Type, operationType)>(),
+    DataModel::EncodableField<decltype(Type::credential), to_underlying(Fields::kCredential), offsetof(Type, credential)>(),
+    DataModel::EncodableField<decltype(Type::credentialData), to_underlying(Fields::kCredentialData),
+                              offsetof(Type, credentialData)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::userStatus), to_underlying(Fields::kUserStatus), offsetof(Type, userStatus)>(),
+    DataModel::EncodableField<decltype(Type::userType), to_underlying(Fields::kUserType), offsetof(Type, userType)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::operationType), to_underlying(Fields::kOperationType), offsetof(T, operationType)>(),
+        DataModel::DecodableField<decltype(T::credential), to_underlying(Fields::kCredential), offsetof(T, credential)>(),
+        DataModel::DecodableField<decltype(T::credentialData), to_underlying(Fields::kCredentialData),
+                                  offsetof(T, credentialData)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::userStatus), to_underlying(Fields::kUserStatus), offsetof(T, userStatus)>(),
+        DataModel::DecodableField<decltype(T::userType), to_underlying(Fields::kUserType), offsetof(T, userType)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::operationType), &T::operationType, to_underlying(Fields::kOperationType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credential), &T::credential, to_underlying(Fields::kCredential)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentialData), &T::credentialData,
+                                        to_underlying(Fields::kCredentialData)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userStatus), &T::userStatus, to_underlying(Fields::kUserStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userType), &T::userType, to_underlying(Fields::kUserType)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11361,8 +19943,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetCredential.
 namespace SetCredentialResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::nextCredentialIndex), to_underlying(Fields::kNextCredentialIndex),
+                              offsetof(Type, nextCredentialIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::nextCredentialIndex), to_underlying(Fields::kNextCredentialIndex),
+                                  offsetof(T, nextCredentialIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nextCredentialIndex), &T::nextCredentialIndex,
+                                        to_underlying(Fields::kNextCredentialIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11407,8 +20039,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetCredentialResponse.
 namespace GetCredentialStatus {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::credential), to_underlying(Fields::kCredential), offsetof(Type, credential)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::credential), to_underlying(Fields::kCredential), offsetof(T, credential)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::credential), &T::credential, to_underlying(Fields::kCredential)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11444,8 +20117,73 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetCredentialStatus.
 namespace GetCredentialStatusResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::credentialExists), to_underlying(Fields::kCredentialExists),
+                              offsetof(Type, credentialExists)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::creatorFabricIndex), to_underlying(Fields::kCreatorFabricIndex),
+                              offsetof(Type, creatorFabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::lastModifiedFabricIndex), to_underlying(Fields::kLastModifiedFabricIndex),
+                              offsetof(Type, lastModifiedFabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::nextCredentialIndex), to_underlying(Fields::kNextCredentialIndex),
+                              offsetof(Type, nextCredentialIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::credentialExists), to_underlying(Fields::kCredentialExists),
+                                  offsetof(T, credentialExists)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::creatorFabricIndex), to_underlying(Fields::kCreatorFabricIndex),
+                                  offsetof(T, creatorFabricIndex)>(),
+        DataModel::DecodableField<decltype(T::lastModifiedFabricIndex), to_underlying(Fields::kLastModifiedFabricIndex),
+                                  offsetof(T, lastModifiedFabricIndex)>(),
+        DataModel::DecodableField<decltype(T::nextCredentialIndex), to_underlying(Fields::kNextCredentialIndex),
+                                  offsetof(T, nextCredentialIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::credentialExists), &T::credentialExists,
+                                        to_underlying(Fields::kCredentialExists)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::creatorFabricIndex), &T::creatorFabricIndex,
+                                        to_underlying(Fields::kCreatorFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::lastModifiedFabricIndex), &T::lastModifiedFabricIndex,
+                                        to_underlying(Fields::kLastModifiedFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nextCredentialIndex), &T::nextCredentialIndex,
+                                        to_underlying(Fields::kNextCredentialIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11500,8 +20238,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetCredentialStatusResponse.
 namespace ClearCredential {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::credential), to_underlying(Fields::kCredential), offsetof(Type, credential)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::credential), to_underlying(Fields::kCredential), offsetof(T, credential)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::credential), &T::credential, to_underlying(Fields::kCredential)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11537,6 +20316,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ClearCredential.
 } // namespace Commands
 
@@ -11678,6 +20458,46 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace DoorLockAlarm {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::alarmCode), to_underlying(Fields::kAlarmCode), offsetof(Type, alarmCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::alarmCode), to_underlying(Fields::kAlarmCode), offsetof(T, alarmCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::alarmCode), &T::alarmCode, to_underlying(Fields::kAlarmCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11713,8 +20533,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DoorLockAlarm.
 namespace DoorStateChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::doorState), to_underlying(Fields::kDoorState), offsetof(Type, doorState)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::doorState), to_underlying(Fields::kDoorState), offsetof(T, doorState)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::doorState), &T::doorState, to_underlying(Fields::kDoorState)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11750,8 +20611,70 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DoorStateChange.
 namespace LockOperation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::lockOperationType), to_underlying(Fields::kLockOperationType),
+                              offsetof(Type, lockOperationType)>(),
+    DataModel::EncodableField<decltype(Type::operationSource), to_underlying(Fields::kOperationSource),
+                              offsetof(Type, operationSource)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::sourceNode), to_underlying(Fields::kSourceNode), offsetof(Type, sourceNode)>(),
+    DataModel::EncodableField<decltype(Type::credentials), to_underlying(Fields::kCredentials), offsetof(Type, credentials)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::lockOperationType), to_underlying(Fields::kLockOperationType),
+                                  offsetof(T, lockOperationType)>(),
+        DataModel::DecodableField<decltype(T::operationSource), to_underlying(Fields::kOperationSource),
+                                  offsetof(T, operationSource)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::DecodableField<decltype(T::sourceNode), to_underlying(Fields::kSourceNode), offsetof(T, sourceNode)>(),
+        DataModel::DecodableField<decltype(T::credentials), to_underlying(Fields::kCredentials), offsetof(T, credentials)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::lockOperationType), &T::lockOperationType,
+                                        to_underlying(Fields::kLockOperationType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::operationSource), &T::operationSource,
+                                        to_underlying(Fields::kOperationSource)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sourceNode), &T::sourceNode, to_underlying(Fields::kSourceNode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentials), &T::credentials, to_underlying(Fields::kCredentials)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11807,8 +20730,76 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LockOperation.
 namespace LockOperationError {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::lockOperationType), to_underlying(Fields::kLockOperationType),
+                              offsetof(Type, lockOperationType)>(),
+    DataModel::EncodableField<decltype(Type::operationSource), to_underlying(Fields::kOperationSource),
+                              offsetof(Type, operationSource)>(),
+    DataModel::EncodableField<decltype(Type::operationError), to_underlying(Fields::kOperationError),
+                              offsetof(Type, operationError)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::sourceNode), to_underlying(Fields::kSourceNode), offsetof(Type, sourceNode)>(),
+    DataModel::EncodableField<decltype(Type::credentials), to_underlying(Fields::kCredentials), offsetof(Type, credentials)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::lockOperationType), to_underlying(Fields::kLockOperationType),
+                                  offsetof(T, lockOperationType)>(),
+        DataModel::DecodableField<decltype(T::operationSource), to_underlying(Fields::kOperationSource),
+                                  offsetof(T, operationSource)>(),
+        DataModel::DecodableField<decltype(T::operationError), to_underlying(Fields::kOperationError),
+                                  offsetof(T, operationError)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::DecodableField<decltype(T::sourceNode), to_underlying(Fields::kSourceNode), offsetof(T, sourceNode)>(),
+        DataModel::DecodableField<decltype(T::credentials), to_underlying(Fields::kCredentials), offsetof(T, credentials)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::lockOperationType), &T::lockOperationType,
+                                        to_underlying(Fields::kLockOperationType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::operationSource), &T::operationSource,
+                                        to_underlying(Fields::kOperationSource)>(),
+        DataModel::DecodableMemberField<T, decltype(T::operationError), &T::operationError,
+                                        to_underlying(Fields::kOperationError)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sourceNode), &T::sourceNode, to_underlying(Fields::kSourceNode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::credentials), &T::credentials, to_underlying(Fields::kCredentials)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11868,8 +20859,73 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LockOperationError.
 namespace LockUserChange {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::lockDataType), to_underlying(Fields::kLockDataType), offsetof(Type, lockDataType)>(),
+    DataModel::EncodableField<decltype(Type::dataOperationType), to_underlying(Fields::kDataOperationType),
+                              offsetof(Type, dataOperationType)>(),
+    DataModel::EncodableField<decltype(Type::operationSource), to_underlying(Fields::kOperationSource),
+                              offsetof(Type, operationSource)>(),
+    DataModel::EncodableField<decltype(Type::userIndex), to_underlying(Fields::kUserIndex), offsetof(Type, userIndex)>(),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::EncodableField<decltype(Type::sourceNode), to_underlying(Fields::kSourceNode), offsetof(Type, sourceNode)>(),
+    DataModel::EncodableField<decltype(Type::dataIndex), to_underlying(Fields::kDataIndex), offsetof(Type, dataIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::lockDataType), to_underlying(Fields::kLockDataType), offsetof(T, lockDataType)>(),
+        DataModel::DecodableField<decltype(T::dataOperationType), to_underlying(Fields::kDataOperationType),
+                                  offsetof(T, dataOperationType)>(),
+        DataModel::DecodableField<decltype(T::operationSource), to_underlying(Fields::kOperationSource),
+                                  offsetof(T, operationSource)>(),
+        DataModel::DecodableField<decltype(T::userIndex), to_underlying(Fields::kUserIndex), offsetof(T, userIndex)>(),
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::DecodableField<decltype(T::sourceNode), to_underlying(Fields::kSourceNode), offsetof(T, sourceNode)>(),
+        DataModel::DecodableField<decltype(T::dataIndex), to_underlying(Fields::kDataIndex), offsetof(T, dataIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::lockDataType), &T::lockDataType, to_underlying(Fields::kLockDataType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::dataOperationType), &T::dataOperationType,
+                                        to_underlying(Fields::kDataOperationType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::operationSource), &T::operationSource,
+                                        to_underlying(Fields::kOperationSource)>(),
+        DataModel::DecodableMemberField<T, decltype(T::userIndex), &T::userIndex, to_underlying(Fields::kUserIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::sourceNode), &T::sourceNode, to_underlying(Fields::kSourceNode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::dataIndex), &T::dataIndex, to_underlying(Fields::kDataIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11929,6 +20985,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LockUserChange.
 } // namespace Events
 
@@ -11937,6 +20994,43 @@ namespace WindowCovering {
 
 namespace Commands {
 namespace UpOrOpen {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -11968,8 +21062,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace UpOrOpen.
 namespace DownOrClose {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12001,8 +21133,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DownOrClose.
 namespace StopMotion {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12034,8 +21204,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StopMotion.
 namespace GoToLiftValue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::liftValue), to_underlying(Fields::kLiftValue), offsetof(Type, liftValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::liftValue), to_underlying(Fields::kLiftValue), offsetof(T, liftValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::liftValue), &T::liftValue, to_underlying(Fields::kLiftValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12071,8 +21282,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GoToLiftValue.
 namespace GoToLiftPercentage {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::liftPercent100thsValue), to_underlying(Fields::kLiftPercent100thsValue),
+                              offsetof(Type, liftPercent100thsValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::liftPercent100thsValue), to_underlying(Fields::kLiftPercent100thsValue),
+                                  offsetof(T, liftPercent100thsValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::liftPercent100thsValue), &T::liftPercent100thsValue,
+                                        to_underlying(Fields::kLiftPercent100thsValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12109,8 +21364,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GoToLiftPercentage.
 namespace GoToTiltValue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::tiltValue), to_underlying(Fields::kTiltValue), offsetof(Type, tiltValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::tiltValue), to_underlying(Fields::kTiltValue), offsetof(T, tiltValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::tiltValue), &T::tiltValue, to_underlying(Fields::kTiltValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12146,8 +21442,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GoToTiltValue.
 namespace GoToTiltPercentage {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::tiltPercent100thsValue), to_underlying(Fields::kTiltPercent100thsValue),
+                              offsetof(Type, tiltPercent100thsValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::tiltPercent100thsValue), to_underlying(Fields::kTiltPercent100thsValue),
+                                  offsetof(T, tiltPercent100thsValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::tiltPercent100thsValue), &T::tiltPercent100thsValue,
+                                        to_underlying(Fields::kTiltPercent100thsValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12184,6 +21524,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GoToTiltPercentage.
 } // namespace Commands
 
@@ -12289,6 +21630,46 @@ namespace BarrierControl {
 
 namespace Commands {
 namespace BarrierControlGoToPercent {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::percentOpen), to_underlying(Fields::kPercentOpen), offsetof(Type, percentOpen)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::percentOpen), to_underlying(Fields::kPercentOpen), offsetof(T, percentOpen)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::percentOpen), &T::percentOpen, to_underlying(Fields::kPercentOpen)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12324,8 +21705,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace BarrierControlGoToPercent.
 namespace BarrierControlStop {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12357,6 +21776,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace BarrierControlStop.
 } // namespace Commands
 
@@ -12526,6 +21946,43 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace SupplyVoltageLow {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12557,8 +22014,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SupplyVoltageLow.
 namespace SupplyVoltageHigh {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12590,8 +22085,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SupplyVoltageHigh.
 namespace PowerMissingPhase {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12623,8 +22156,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace PowerMissingPhase.
 namespace SystemPressureLow {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12656,8 +22227,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SystemPressureLow.
 namespace SystemPressureHigh {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12689,8 +22298,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SystemPressureHigh.
 namespace DryRunning {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12722,8 +22369,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace DryRunning.
 namespace MotorTemperatureHigh {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12755,8 +22440,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MotorTemperatureHigh.
 namespace PumpMotorFatalFailure {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12788,8 +22511,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace PumpMotorFatalFailure.
 namespace ElectronicTemperatureHigh {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12821,8 +22582,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ElectronicTemperatureHigh.
 namespace PumpBlocked {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12854,8 +22653,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace PumpBlocked.
 namespace SensorFailure {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12887,8 +22724,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SensorFailure.
 namespace ElectronicNonFatalFailure {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12920,8 +22795,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ElectronicNonFatalFailure.
 namespace ElectronicFatalFailure {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12953,8 +22866,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ElectronicFatalFailure.
 namespace GeneralFault {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -12986,8 +22937,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GeneralFault.
 namespace Leakage {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13019,8 +23008,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Leakage.
 namespace AirDetection {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13052,8 +23079,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace AirDetection.
 namespace TurbineOperation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13085,6 +23150,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TurbineOperation.
 } // namespace Events
 
@@ -13092,6 +23158,27 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 namespace Thermostat {
 namespace Structs {
 namespace ThermostatScheduleTransition {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime), offsetof(Type, transitionTime)>(),
+    DataModel::Field<decltype(Type::heatSetpoint), to_underlying(Fields::kHeatSetpoint), offsetof(Type, heatSetpoint)>(),
+    DataModel::Field<decltype(Type::coolSetpoint), to_underlying(Fields::kCoolSetpoint), offsetof(Type, coolSetpoint)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13137,12 +23224,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ThermostatScheduleTransition
 } // namespace Structs
 
 namespace Commands {
 namespace SetpointRaiseLower {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::mode), to_underlying(Fields::kMode), offsetof(Type, mode)>(),
+    DataModel::EncodableField<decltype(Type::amount), to_underlying(Fields::kAmount), offsetof(Type, amount)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::mode), to_underlying(Fields::kMode), offsetof(T, mode)>(),
+        DataModel::DecodableField<decltype(T::amount), to_underlying(Fields::kAmount), offsetof(T, amount)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::mode), &T::mode, to_underlying(Fields::kMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::amount), &T::amount, to_underlying(Fields::kAmount)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13182,8 +23313,69 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetpointRaiseLower.
 namespace GetWeeklyScheduleResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::numberOfTransitionsForSequence),
+                              to_underlying(Fields::kNumberOfTransitionsForSequence),
+                              offsetof(Type, numberOfTransitionsForSequence)>(),
+    DataModel::EncodableField<decltype(Type::dayOfWeekForSequence), to_underlying(Fields::kDayOfWeekForSequence),
+                              offsetof(Type, dayOfWeekForSequence)>(),
+    DataModel::EncodableField<decltype(Type::modeForSequence), to_underlying(Fields::kModeForSequence),
+                              offsetof(Type, modeForSequence)>(),
+    DataModel::EncodableField<decltype(Type::transitions), to_underlying(Fields::kTransitions), offsetof(Type, transitions)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::numberOfTransitionsForSequence),
+                                  to_underlying(Fields::kNumberOfTransitionsForSequence),
+                                  offsetof(T, numberOfTransitionsForSequence)>(),
+        DataModel::DecodableField<decltype(T::dayOfWeekForSequence), to_underlying(Fields::kDayOfWeekForSequence),
+                                  offsetof(T, dayOfWeekForSequence)>(),
+        DataModel::DecodableField<decltype(T::modeForSequence), to_underlying(Fields::kModeForSequence),
+                                  offsetof(T, modeForSequence)>(),
+        DataModel::DecodableField<decltype(T::transitions), to_underlying(Fields::kTransitions), offsetof(T, transitions)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::numberOfTransitionsForSequence), &T::numberOfTransitionsForSequence,
+                                        to_underlying(Fields::kNumberOfTransitionsForSequence)>(),
+        DataModel::DecodableMemberField<T, decltype(T::dayOfWeekForSequence), &T::dayOfWeekForSequence,
+                                        to_underlying(Fields::kDayOfWeekForSequence)>(),
+        DataModel::DecodableMemberField<T, decltype(T::modeForSequence), &T::modeForSequence,
+                                        to_underlying(Fields::kModeForSequence)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitions), &T::transitions, to_underlying(Fields::kTransitions)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13233,8 +23425,69 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetWeeklyScheduleResponse.
 namespace SetWeeklySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::numberOfTransitionsForSequence),
+                              to_underlying(Fields::kNumberOfTransitionsForSequence),
+                              offsetof(Type, numberOfTransitionsForSequence)>(),
+    DataModel::EncodableField<decltype(Type::dayOfWeekForSequence), to_underlying(Fields::kDayOfWeekForSequence),
+                              offsetof(Type, dayOfWeekForSequence)>(),
+    DataModel::EncodableField<decltype(Type::modeForSequence), to_underlying(Fields::kModeForSequence),
+                              offsetof(Type, modeForSequence)>(),
+    DataModel::EncodableField<decltype(Type::transitions), to_underlying(Fields::kTransitions), offsetof(Type, transitions)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::numberOfTransitionsForSequence),
+                                  to_underlying(Fields::kNumberOfTransitionsForSequence),
+                                  offsetof(T, numberOfTransitionsForSequence)>(),
+        DataModel::DecodableField<decltype(T::dayOfWeekForSequence), to_underlying(Fields::kDayOfWeekForSequence),
+                                  offsetof(T, dayOfWeekForSequence)>(),
+        DataModel::DecodableField<decltype(T::modeForSequence), to_underlying(Fields::kModeForSequence),
+                                  offsetof(T, modeForSequence)>(),
+        DataModel::DecodableField<decltype(T::transitions), to_underlying(Fields::kTransitions), offsetof(T, transitions)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::numberOfTransitionsForSequence), &T::numberOfTransitionsForSequence,
+                                        to_underlying(Fields::kNumberOfTransitionsForSequence)>(),
+        DataModel::DecodableMemberField<T, decltype(T::dayOfWeekForSequence), &T::dayOfWeekForSequence,
+                                        to_underlying(Fields::kDayOfWeekForSequence)>(),
+        DataModel::DecodableMemberField<T, decltype(T::modeForSequence), &T::modeForSequence,
+                                        to_underlying(Fields::kModeForSequence)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitions), &T::transitions, to_underlying(Fields::kTransitions)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13284,8 +23537,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SetWeeklySchedule.
 namespace GetWeeklySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::daysToReturn), to_underlying(Fields::kDaysToReturn), offsetof(Type, daysToReturn)>(),
+    DataModel::EncodableField<decltype(Type::modeToReturn), to_underlying(Fields::kModeToReturn), offsetof(Type, modeToReturn)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::daysToReturn), to_underlying(Fields::kDaysToReturn), offsetof(T, daysToReturn)>(),
+        DataModel::DecodableField<decltype(T::modeToReturn), to_underlying(Fields::kModeToReturn), offsetof(T, modeToReturn)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::daysToReturn), &T::daysToReturn, to_underlying(Fields::kDaysToReturn)>(),
+        DataModel::DecodableMemberField<T, decltype(T::modeToReturn), &T::modeToReturn, to_underlying(Fields::kModeToReturn)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13325,8 +23622,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetWeeklySchedule.
 namespace ClearWeeklySchedule {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13358,6 +23693,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ClearWeeklySchedule.
 } // namespace Commands
 
@@ -13660,6 +23996,64 @@ namespace ColorControl {
 
 namespace Commands {
 namespace MoveToHue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::hue), to_underlying(Fields::kHue), offsetof(Type, hue)>(),
+    DataModel::EncodableField<decltype(Type::direction), to_underlying(Fields::kDirection), offsetof(Type, direction)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::hue), to_underlying(Fields::kHue), offsetof(T, hue)>(),
+        DataModel::DecodableField<decltype(T::direction), to_underlying(Fields::kDirection), offsetof(T, direction)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::hue), &T::hue, to_underlying(Fields::kHue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::direction), &T::direction, to_underlying(Fields::kDirection)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13711,8 +24105,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToHue.
 namespace MoveHue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::moveMode), to_underlying(Fields::kMoveMode), offsetof(Type, moveMode)>(),
+    DataModel::EncodableField<decltype(Type::rate), to_underlying(Fields::kRate), offsetof(Type, rate)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::moveMode), to_underlying(Fields::kMoveMode), offsetof(T, moveMode)>(),
+        DataModel::DecodableField<decltype(T::rate), to_underlying(Fields::kRate), offsetof(T, rate)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::moveMode), &T::moveMode, to_underlying(Fields::kMoveMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rate), &T::rate, to_underlying(Fields::kRate)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13760,8 +24207,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveHue.
 namespace StepHue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepMode), to_underlying(Fields::kStepMode), offsetof(Type, stepMode)>(),
+    DataModel::EncodableField<decltype(Type::stepSize), to_underlying(Fields::kStepSize), offsetof(Type, stepSize)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepMode), to_underlying(Fields::kStepMode), offsetof(T, stepMode)>(),
+        DataModel::DecodableField<decltype(T::stepSize), to_underlying(Fields::kStepSize), offsetof(T, stepSize)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepMode), &T::stepMode, to_underlying(Fields::kStepMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepSize), &T::stepSize, to_underlying(Fields::kStepSize)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13813,8 +24319,64 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StepHue.
 namespace MoveToSaturation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::saturation), to_underlying(Fields::kSaturation), offsetof(Type, saturation)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::saturation), to_underlying(Fields::kSaturation), offsetof(T, saturation)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::saturation), &T::saturation, to_underlying(Fields::kSaturation)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13862,8 +24424,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToSaturation.
 namespace MoveSaturation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::moveMode), to_underlying(Fields::kMoveMode), offsetof(Type, moveMode)>(),
+    DataModel::EncodableField<decltype(Type::rate), to_underlying(Fields::kRate), offsetof(Type, rate)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::moveMode), to_underlying(Fields::kMoveMode), offsetof(T, moveMode)>(),
+        DataModel::DecodableField<decltype(T::rate), to_underlying(Fields::kRate), offsetof(T, rate)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::moveMode), &T::moveMode, to_underlying(Fields::kMoveMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rate), &T::rate, to_underlying(Fields::kRate)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13911,8 +24526,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveSaturation.
 namespace StepSaturation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepMode), to_underlying(Fields::kStepMode), offsetof(Type, stepMode)>(),
+    DataModel::EncodableField<decltype(Type::stepSize), to_underlying(Fields::kStepSize), offsetof(Type, stepSize)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepMode), to_underlying(Fields::kStepMode), offsetof(T, stepMode)>(),
+        DataModel::DecodableField<decltype(T::stepSize), to_underlying(Fields::kStepSize), offsetof(T, stepSize)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepMode), &T::stepMode, to_underlying(Fields::kStepMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepSize), &T::stepSize, to_underlying(Fields::kStepSize)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -13964,8 +24638,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StepSaturation.
 namespace MoveToHueAndSaturation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::hue), to_underlying(Fields::kHue), offsetof(Type, hue)>(),
+    DataModel::EncodableField<decltype(Type::saturation), to_underlying(Fields::kSaturation), offsetof(Type, saturation)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::hue), to_underlying(Fields::kHue), offsetof(T, hue)>(),
+        DataModel::DecodableField<decltype(T::saturation), to_underlying(Fields::kSaturation), offsetof(T, saturation)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::hue), &T::hue, to_underlying(Fields::kHue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::saturation), &T::saturation, to_underlying(Fields::kSaturation)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14017,8 +24750,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToHueAndSaturation.
 namespace MoveToColor {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::colorX), to_underlying(Fields::kColorX), offsetof(Type, colorX)>(),
+    DataModel::EncodableField<decltype(Type::colorY), to_underlying(Fields::kColorY), offsetof(Type, colorY)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::colorX), to_underlying(Fields::kColorX), offsetof(T, colorX)>(),
+        DataModel::DecodableField<decltype(T::colorY), to_underlying(Fields::kColorY), offsetof(T, colorY)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::colorX), &T::colorX, to_underlying(Fields::kColorX)>(),
+        DataModel::DecodableMemberField<T, decltype(T::colorY), &T::colorY, to_underlying(Fields::kColorY)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14070,8 +24862,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToColor.
 namespace MoveColor {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::rateX), to_underlying(Fields::kRateX), offsetof(Type, rateX)>(),
+    DataModel::EncodableField<decltype(Type::rateY), to_underlying(Fields::kRateY), offsetof(Type, rateY)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::rateX), to_underlying(Fields::kRateX), offsetof(T, rateX)>(),
+        DataModel::DecodableField<decltype(T::rateY), to_underlying(Fields::kRateY), offsetof(T, rateY)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::rateX), &T::rateX, to_underlying(Fields::kRateX)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rateY), &T::rateY, to_underlying(Fields::kRateY)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14119,8 +24964,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveColor.
 namespace StepColor {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepX), to_underlying(Fields::kStepX), offsetof(Type, stepX)>(),
+    DataModel::EncodableField<decltype(Type::stepY), to_underlying(Fields::kStepY), offsetof(Type, stepY)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepX), to_underlying(Fields::kStepX), offsetof(T, stepX)>(),
+        DataModel::DecodableField<decltype(T::stepY), to_underlying(Fields::kStepY), offsetof(T, stepY)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepX), &T::stepX, to_underlying(Fields::kStepX)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepY), &T::stepY, to_underlying(Fields::kStepY)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14172,8 +25076,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StepColor.
 namespace MoveToColorTemperature {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::colorTemperature), to_underlying(Fields::kColorTemperature),
+                              offsetof(Type, colorTemperature)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::colorTemperature), to_underlying(Fields::kColorTemperature),
+                                  offsetof(T, colorTemperature)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::colorTemperature), &T::colorTemperature,
+                                        to_underlying(Fields::kColorTemperature)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14221,8 +25184,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveToColorTemperature.
 namespace EnhancedMoveToHue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::enhancedHue), to_underlying(Fields::kEnhancedHue), offsetof(Type, enhancedHue)>(),
+    DataModel::EncodableField<decltype(Type::direction), to_underlying(Fields::kDirection), offsetof(Type, direction)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::enhancedHue), to_underlying(Fields::kEnhancedHue), offsetof(T, enhancedHue)>(),
+        DataModel::DecodableField<decltype(T::direction), to_underlying(Fields::kDirection), offsetof(T, direction)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::enhancedHue), &T::enhancedHue, to_underlying(Fields::kEnhancedHue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::direction), &T::direction, to_underlying(Fields::kDirection)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14274,8 +25296,61 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedMoveToHue.
 namespace EnhancedMoveHue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::moveMode), to_underlying(Fields::kMoveMode), offsetof(Type, moveMode)>(),
+    DataModel::EncodableField<decltype(Type::rate), to_underlying(Fields::kRate), offsetof(Type, rate)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::moveMode), to_underlying(Fields::kMoveMode), offsetof(T, moveMode)>(),
+        DataModel::DecodableField<decltype(T::rate), to_underlying(Fields::kRate), offsetof(T, rate)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::moveMode), &T::moveMode, to_underlying(Fields::kMoveMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rate), &T::rate, to_underlying(Fields::kRate)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14323,8 +25398,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedMoveHue.
 namespace EnhancedStepHue {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepMode), to_underlying(Fields::kStepMode), offsetof(Type, stepMode)>(),
+    DataModel::EncodableField<decltype(Type::stepSize), to_underlying(Fields::kStepSize), offsetof(Type, stepSize)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepMode), to_underlying(Fields::kStepMode), offsetof(T, stepMode)>(),
+        DataModel::DecodableField<decltype(T::stepSize), to_underlying(Fields::kStepSize), offsetof(T, stepSize)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepMode), &T::stepMode, to_underlying(Fields::kStepMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepSize), &T::stepSize, to_underlying(Fields::kStepSize)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14376,8 +25510,67 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedStepHue.
 namespace EnhancedMoveToHueAndSaturation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::enhancedHue), to_underlying(Fields::kEnhancedHue), offsetof(Type, enhancedHue)>(),
+    DataModel::EncodableField<decltype(Type::saturation), to_underlying(Fields::kSaturation), offsetof(Type, saturation)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::enhancedHue), to_underlying(Fields::kEnhancedHue), offsetof(T, enhancedHue)>(),
+        DataModel::DecodableField<decltype(T::saturation), to_underlying(Fields::kSaturation), offsetof(T, saturation)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::enhancedHue), &T::enhancedHue, to_underlying(Fields::kEnhancedHue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::saturation), &T::saturation, to_underlying(Fields::kSaturation)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14429,8 +25622,70 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace EnhancedMoveToHueAndSaturation.
 namespace ColorLoopSet {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::updateFlags), to_underlying(Fields::kUpdateFlags), offsetof(Type, updateFlags)>(),
+    DataModel::EncodableField<decltype(Type::action), to_underlying(Fields::kAction), offsetof(Type, action)>(),
+    DataModel::EncodableField<decltype(Type::direction), to_underlying(Fields::kDirection), offsetof(Type, direction)>(),
+    DataModel::EncodableField<decltype(Type::time), to_underlying(Fields::kTime), offsetof(Type, time)>(),
+    DataModel::EncodableField<decltype(Type::startHue), to_underlying(Fields::kStartHue), offsetof(Type, startHue)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::updateFlags), to_underlying(Fields::kUpdateFlags), offsetof(T, updateFlags)>(),
+        DataModel::DecodableField<decltype(T::action), to_underlying(Fields::kAction), offsetof(T, action)>(),
+        DataModel::DecodableField<decltype(T::direction), to_underlying(Fields::kDirection), offsetof(T, direction)>(),
+        DataModel::DecodableField<decltype(T::time), to_underlying(Fields::kTime), offsetof(T, time)>(),
+        DataModel::DecodableField<decltype(T::startHue), to_underlying(Fields::kStartHue), offsetof(T, startHue)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::updateFlags), &T::updateFlags, to_underlying(Fields::kUpdateFlags)>(),
+        DataModel::DecodableMemberField<T, decltype(T::action), &T::action, to_underlying(Fields::kAction)>(),
+        DataModel::DecodableMemberField<T, decltype(T::direction), &T::direction, to_underlying(Fields::kDirection)>(),
+        DataModel::DecodableMemberField<T, decltype(T::time), &T::time, to_underlying(Fields::kTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::startHue), &T::startHue, to_underlying(Fields::kStartHue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14490,8 +25745,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ColorLoopSet.
 namespace StopMoveStep {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14531,8 +25833,73 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StopMoveStep.
 namespace MoveColorTemperature {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::moveMode), to_underlying(Fields::kMoveMode), offsetof(Type, moveMode)>(),
+    DataModel::EncodableField<decltype(Type::rate), to_underlying(Fields::kRate), offsetof(Type, rate)>(),
+    DataModel::EncodableField<decltype(Type::colorTemperatureMinimumMireds), to_underlying(Fields::kColorTemperatureMinimumMireds),
+                              offsetof(Type, colorTemperatureMinimumMireds)>(),
+    DataModel::EncodableField<decltype(Type::colorTemperatureMaximumMireds), to_underlying(Fields::kColorTemperatureMaximumMireds),
+                              offsetof(Type, colorTemperatureMaximumMireds)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::moveMode), to_underlying(Fields::kMoveMode), offsetof(T, moveMode)>(),
+        DataModel::DecodableField<decltype(T::rate), to_underlying(Fields::kRate), offsetof(T, rate)>(),
+        DataModel::DecodableField<decltype(T::colorTemperatureMinimumMireds), to_underlying(Fields::kColorTemperatureMinimumMireds),
+                                  offsetof(T, colorTemperatureMinimumMireds)>(),
+        DataModel::DecodableField<decltype(T::colorTemperatureMaximumMireds), to_underlying(Fields::kColorTemperatureMaximumMireds),
+                                  offsetof(T, colorTemperatureMaximumMireds)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::moveMode), &T::moveMode, to_underlying(Fields::kMoveMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::rate), &T::rate, to_underlying(Fields::kRate)>(),
+        DataModel::DecodableMemberField<T, decltype(T::colorTemperatureMinimumMireds), &T::colorTemperatureMinimumMireds,
+                                        to_underlying(Fields::kColorTemperatureMinimumMireds)>(),
+        DataModel::DecodableMemberField<T, decltype(T::colorTemperatureMaximumMireds), &T::colorTemperatureMaximumMireds,
+                                        to_underlying(Fields::kColorTemperatureMaximumMireds)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14590,8 +25957,79 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace MoveColorTemperature.
 namespace StepColorTemperature {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::stepMode), to_underlying(Fields::kStepMode), offsetof(Type, stepMode)>(),
+    DataModel::EncodableField<decltype(Type::stepSize), to_underlying(Fields::kStepSize), offsetof(Type, stepSize)>(),
+    DataModel::EncodableField<decltype(Type::transitionTime), to_underlying(Fields::kTransitionTime),
+                              offsetof(Type, transitionTime)>(),
+    DataModel::EncodableField<decltype(Type::colorTemperatureMinimumMireds), to_underlying(Fields::kColorTemperatureMinimumMireds),
+                              offsetof(Type, colorTemperatureMinimumMireds)>(),
+    DataModel::EncodableField<decltype(Type::colorTemperatureMaximumMireds), to_underlying(Fields::kColorTemperatureMaximumMireds),
+                              offsetof(Type, colorTemperatureMaximumMireds)>(),
+    DataModel::EncodableField<decltype(Type::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(Type, optionsMask)>(),
+    DataModel::EncodableField<decltype(Type::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                              offsetof(Type, optionsOverride)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::stepMode), to_underlying(Fields::kStepMode), offsetof(T, stepMode)>(),
+        DataModel::DecodableField<decltype(T::stepSize), to_underlying(Fields::kStepSize), offsetof(T, stepSize)>(),
+        DataModel::DecodableField<decltype(T::transitionTime), to_underlying(Fields::kTransitionTime),
+                                  offsetof(T, transitionTime)>(),
+        DataModel::DecodableField<decltype(T::colorTemperatureMinimumMireds), to_underlying(Fields::kColorTemperatureMinimumMireds),
+                                  offsetof(T, colorTemperatureMinimumMireds)>(),
+        DataModel::DecodableField<decltype(T::colorTemperatureMaximumMireds), to_underlying(Fields::kColorTemperatureMaximumMireds),
+                                  offsetof(T, colorTemperatureMaximumMireds)>(),
+        DataModel::DecodableField<decltype(T::optionsMask), to_underlying(Fields::kOptionsMask), offsetof(T, optionsMask)>(),
+        DataModel::DecodableField<decltype(T::optionsOverride), to_underlying(Fields::kOptionsOverride),
+                                  offsetof(T, optionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::stepMode), &T::stepMode, to_underlying(Fields::kStepMode)>(),
+        DataModel::DecodableMemberField<T, decltype(T::stepSize), &T::stepSize, to_underlying(Fields::kStepSize)>(),
+        DataModel::DecodableMemberField<T, decltype(T::transitionTime), &T::transitionTime,
+                                        to_underlying(Fields::kTransitionTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::colorTemperatureMinimumMireds), &T::colorTemperatureMinimumMireds,
+                                        to_underlying(Fields::kColorTemperatureMinimumMireds)>(),
+        DataModel::DecodableMemberField<T, decltype(T::colorTemperatureMaximumMireds), &T::colorTemperatureMaximumMireds,
+                                        to_underlying(Fields::kColorTemperatureMaximumMireds)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsMask), &T::optionsMask, to_underlying(Fields::kOptionsMask)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionsOverride), &T::optionsOverride,
+                                        to_underlying(Fields::kOptionsOverride)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -14653,6 +26091,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StepColorTemperature.
 } // namespace Commands
 
@@ -15302,6 +26741,30 @@ namespace Events {
 namespace Channel {
 namespace Structs {
 namespace ChannelInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::majorNumber), to_underlying(Fields::kMajorNumber), offsetof(Type, majorNumber)>(),
+    DataModel::Field<decltype(Type::minorNumber), to_underlying(Fields::kMinorNumber), offsetof(Type, minorNumber)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::Field<decltype(Type::callSign), to_underlying(Fields::kCallSign), offsetof(Type, callSign)>(),
+    DataModel::Field<decltype(Type::affiliateCallSign), to_underlying(Fields::kAffiliateCallSign),
+                     offsetof(Type, affiliateCallSign)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15355,9 +26818,32 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ChannelInfo
 namespace LineupInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::operatorName), to_underlying(Fields::kOperatorName), offsetof(Type, operatorName)>(),
+    DataModel::Field<decltype(Type::lineupName), to_underlying(Fields::kLineupName), offsetof(Type, lineupName)>(),
+    DataModel::Field<decltype(Type::postalCode), to_underlying(Fields::kPostalCode), offsetof(Type, postalCode)>(),
+    DataModel::Field<decltype(Type::lineupInfoType), to_underlying(Fields::kLineupInfoType), offsetof(Type, lineupInfoType)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15407,12 +26893,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace LineupInfo
 } // namespace Structs
 
 namespace Commands {
 namespace ChangeChannel {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::match), to_underlying(Fields::kMatch), offsetof(Type, match)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::match), to_underlying(Fields::kMatch), offsetof(T, match)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::match), &T::match, to_underlying(Fields::kMatch)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15448,8 +26975,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ChangeChannel.
 namespace ChangeChannelResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15489,8 +27060,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ChangeChannelResponse.
 namespace ChangeChannelByNumber {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::majorNumber), to_underlying(Fields::kMajorNumber), offsetof(Type, majorNumber)>(),
+    DataModel::EncodableField<decltype(Type::minorNumber), to_underlying(Fields::kMinorNumber), offsetof(Type, minorNumber)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::majorNumber), to_underlying(Fields::kMajorNumber), offsetof(T, majorNumber)>(),
+        DataModel::DecodableField<decltype(T::minorNumber), to_underlying(Fields::kMinorNumber), offsetof(T, minorNumber)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::majorNumber), &T::majorNumber, to_underlying(Fields::kMajorNumber)>(),
+        DataModel::DecodableMemberField<T, decltype(T::minorNumber), &T::minorNumber, to_underlying(Fields::kMinorNumber)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15530,8 +27145,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ChangeChannelByNumber.
 namespace SkipChannel {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::count), to_underlying(Fields::kCount), offsetof(Type, count)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::count), to_underlying(Fields::kCount), offsetof(T, count)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::count), &T::count, to_underlying(Fields::kCount)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15567,6 +27223,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SkipChannel.
 } // namespace Commands
 
@@ -15614,6 +27271,26 @@ namespace Events {
 namespace TargetNavigator {
 namespace Structs {
 namespace TargetInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::identifier), to_underlying(Fields::kIdentifier), offsetof(Type, identifier)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15655,12 +27332,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace TargetInfo
 } // namespace Structs
 
 namespace Commands {
 namespace NavigateTarget {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::target), to_underlying(Fields::kTarget), offsetof(Type, target)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::target), to_underlying(Fields::kTarget), offsetof(T, target)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::target), &T::target, to_underlying(Fields::kTarget)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15700,8 +27421,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NavigateTarget.
 namespace NavigateTargetResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15741,6 +27506,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace NavigateTargetResponse.
 } // namespace Commands
 
@@ -15785,6 +27551,26 @@ namespace Events {
 namespace MediaPlayback {
 namespace Structs {
 namespace PlaybackPosition {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::updatedAt), to_underlying(Fields::kUpdatedAt), offsetof(Type, updatedAt)>(),
+    DataModel::Field<decltype(Type::position), to_underlying(Fields::kPosition), offsetof(Type, position)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15826,12 +27612,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace PlaybackPosition
 } // namespace Structs
 
 namespace Commands {
 namespace Play {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15863,8 +27687,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Play.
 namespace Pause {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15896,8 +27758,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Pause.
 namespace StopPlayback {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15929,8 +27829,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StopPlayback.
 namespace StartOver {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15962,8 +27900,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StartOver.
 namespace Previous {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -15995,8 +27971,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Previous.
 namespace Next {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16024,12 +28038,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
         }
     }
 
-    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
-    ReturnErrorOnFailure(reader.ExitContainer(outer));
-    return CHIP_NO_ERROR;
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(outer));
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+} // namespace Next.
+namespace Rewind {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
 }
-} // namespace Next.
-namespace Rewind {
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16061,8 +28113,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Rewind.
 namespace FastForward {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16094,8 +28184,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace FastForward.
 namespace SkipForward {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::deltaPositionMilliseconds), to_underlying(Fields::kDeltaPositionMilliseconds),
+                              offsetof(Type, deltaPositionMilliseconds)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::deltaPositionMilliseconds), to_underlying(Fields::kDeltaPositionMilliseconds),
+                                  offsetof(T, deltaPositionMilliseconds)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::deltaPositionMilliseconds), &T::deltaPositionMilliseconds,
+                                        to_underlying(Fields::kDeltaPositionMilliseconds)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16132,8 +28266,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SkipForward.
 namespace SkipBackward {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::deltaPositionMilliseconds), to_underlying(Fields::kDeltaPositionMilliseconds),
+                              offsetof(Type, deltaPositionMilliseconds)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::deltaPositionMilliseconds), to_underlying(Fields::kDeltaPositionMilliseconds),
+                                  offsetof(T, deltaPositionMilliseconds)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::deltaPositionMilliseconds), &T::deltaPositionMilliseconds,
+                                        to_underlying(Fields::kDeltaPositionMilliseconds)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16170,8 +28348,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SkipBackward.
 namespace PlaybackResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16211,8 +28433,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace PlaybackResponse.
 namespace Seek {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::position), to_underlying(Fields::kPosition), offsetof(Type, position)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::position), to_underlying(Fields::kPosition), offsetof(T, position)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::position), &T::position, to_underlying(Fields::kPosition)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16248,6 +28511,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Seek.
 } // namespace Commands
 
@@ -16307,6 +28571,28 @@ namespace Events {
 namespace MediaInput {
 namespace Structs {
 namespace InputInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::index), to_underlying(Fields::kIndex), offsetof(Type, index)>(),
+    DataModel::Field<decltype(Type::inputType), to_underlying(Fields::kInputType), offsetof(Type, inputType)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::Field<decltype(Type::description), to_underlying(Fields::kDescription), offsetof(Type, description)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16356,12 +28642,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace InputInfo
 } // namespace Structs
 
 namespace Commands {
 namespace SelectInput {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::index), to_underlying(Fields::kIndex), offsetof(Type, index)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::index), to_underlying(Fields::kIndex), offsetof(T, index)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::index), &T::index, to_underlying(Fields::kIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16397,8 +28724,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SelectInput.
 namespace ShowInputStatus {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16430,8 +28795,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace ShowInputStatus.
 namespace HideInputStatus {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16463,8 +28866,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace HideInputStatus.
 namespace RenameInput {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::index), to_underlying(Fields::kIndex), offsetof(Type, index)>(),
+    DataModel::EncodableField<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::index), to_underlying(Fields::kIndex), offsetof(T, index)>(),
+        DataModel::DecodableField<decltype(T::name), to_underlying(Fields::kName), offsetof(T, name)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::index), &T::index, to_underlying(Fields::kIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::name), &T::name, to_underlying(Fields::kName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16504,6 +28951,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RenameInput.
 } // namespace Commands
 
@@ -16549,6 +28997,43 @@ namespace LowPower {
 
 namespace Commands {
 namespace Sleep {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16580,6 +29065,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Sleep.
 } // namespace Commands
 
@@ -16619,6 +29105,46 @@ namespace KeypadInput {
 
 namespace Commands {
 namespace SendKey {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::keyCode), to_underlying(Fields::kKeyCode), offsetof(Type, keyCode)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::keyCode), to_underlying(Fields::kKeyCode), offsetof(T, keyCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::keyCode), &T::keyCode, to_underlying(Fields::kKeyCode)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16654,8 +29180,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SendKey.
 namespace SendKeyResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16691,6 +29258,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SendKeyResponse.
 } // namespace Commands
 
@@ -16729,6 +29297,27 @@ namespace Events {
 namespace ContentLauncher {
 namespace Structs {
 namespace Dimension {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::width), to_underlying(Fields::kWidth), offsetof(Type, width)>(),
+    DataModel::Field<decltype(Type::height), to_underlying(Fields::kHeight), offsetof(Type, height)>(),
+    DataModel::Field<decltype(Type::metric), to_underlying(Fields::kMetric), offsetof(Type, metric)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16774,9 +29363,30 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace Dimension
 namespace AdditionalInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::Field<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16818,9 +29428,40 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace AdditionalInfo
 namespace Parameter {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::EncodableField<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::EncodableField<decltype(Type::externalIDList), to_underlying(Fields::kExternalIDList),
+                              offsetof(Type, externalIDList)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::type), &DecodableType::type,
+                                    to_underlying(Fields::kType)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::value), &DecodableType::value,
+                                    to_underlying(Fields::kValue)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::externalIDList), &DecodableType::externalIDList,
+                                    to_underlying(Fields::kExternalIDList)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16866,9 +29507,34 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace Parameter
 namespace ContentSearch {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::parameterList), to_underlying(Fields::kParameterList),
+                              offsetof(Type, parameterList)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::parameterList), &DecodableType::parameterList,
+                                    to_underlying(Fields::kParameterList)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16906,9 +29572,31 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ContentSearch
 namespace StyleInformation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::imageUrl), to_underlying(Fields::kImageUrl), offsetof(Type, imageUrl)>(),
+    DataModel::Field<decltype(Type::color), to_underlying(Fields::kColor), offsetof(Type, color)>(),
+    DataModel::Field<decltype(Type::size), to_underlying(Fields::kSize), offsetof(Type, size)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -16954,9 +29642,34 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace StyleInformation
 namespace BrandingInformation {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::providerName), to_underlying(Fields::kProviderName), offsetof(Type, providerName)>(),
+    DataModel::Field<decltype(Type::background), to_underlying(Fields::kBackground), offsetof(Type, background)>(),
+    DataModel::Field<decltype(Type::logo), to_underlying(Fields::kLogo), offsetof(Type, logo)>(),
+    DataModel::Field<decltype(Type::progressBar), to_underlying(Fields::kProgressBar), offsetof(Type, progressBar)>(),
+    DataModel::Field<decltype(Type::splash), to_underlying(Fields::kSplash), offsetof(Type, splash)>(),
+    DataModel::Field<decltype(Type::waterMark), to_underlying(Fields::kWaterMark), offsetof(Type, waterMark)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17014,12 +29727,59 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace BrandingInformation
 } // namespace Structs
 
 namespace Commands {
 namespace LaunchContent {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::search), to_underlying(Fields::kSearch), offsetof(Type, search)>(),
+    DataModel::EncodableField<decltype(Type::autoPlay), to_underlying(Fields::kAutoPlay), offsetof(Type, autoPlay)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::search), to_underlying(Fields::kSearch), offsetof(T, search)>(),
+        DataModel::DecodableField<decltype(T::autoPlay), to_underlying(Fields::kAutoPlay), offsetof(T, autoPlay)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::search), &T::search, to_underlying(Fields::kSearch)>(),
+        DataModel::DecodableMemberField<T, decltype(T::autoPlay), &T::autoPlay, to_underlying(Fields::kAutoPlay)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17063,8 +29823,59 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LaunchContent.
 namespace LaunchURL {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::contentURL), to_underlying(Fields::kContentURL), offsetof(Type, contentURL)>(),
+    DataModel::EncodableField<decltype(Type::displayString), to_underlying(Fields::kDisplayString),
+                              offsetof(Type, displayString)>(),
+    DataModel::EncodableField<decltype(Type::brandingInformation), to_underlying(Fields::kBrandingInformation),
+                              offsetof(Type, brandingInformation)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::contentURL), to_underlying(Fields::kContentURL), offsetof(T, contentURL)>(),
+        DataModel::DecodableField<decltype(T::displayString), to_underlying(Fields::kDisplayString), offsetof(T, displayString)>(),
+        DataModel::DecodableField<decltype(T::brandingInformation), to_underlying(Fields::kBrandingInformation),
+                                  offsetof(T, brandingInformation)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::contentURL), &T::contentURL, to_underlying(Fields::kContentURL)>(),
+        DataModel::DecodableMemberField<T, decltype(T::displayString), &T::displayString, to_underlying(Fields::kDisplayString)>(),
+        DataModel::DecodableMemberField<T, decltype(T::brandingInformation), &T::brandingInformation,
+                                        to_underlying(Fields::kBrandingInformation)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17109,8 +29920,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LaunchURL.
 namespace LaunchResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17150,6 +30005,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LaunchResponse.
 } // namespace Commands
 
@@ -17194,6 +30050,27 @@ namespace Events {
 namespace AudioOutput {
 namespace Structs {
 namespace OutputInfo {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::index), to_underlying(Fields::kIndex), offsetof(Type, index)>(),
+    DataModel::Field<decltype(Type::outputType), to_underlying(Fields::kOutputType), offsetof(Type, outputType)>(),
+    DataModel::Field<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17239,12 +30116,53 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace OutputInfo
 } // namespace Structs
 
 namespace Commands {
 namespace SelectOutput {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::index), to_underlying(Fields::kIndex), offsetof(Type, index)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::index), to_underlying(Fields::kIndex), offsetof(T, index)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::index), &T::index, to_underlying(Fields::kIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17280,8 +30198,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SelectOutput.
 namespace RenameOutput {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::index), to_underlying(Fields::kIndex), offsetof(Type, index)>(),
+    DataModel::EncodableField<decltype(Type::name), to_underlying(Fields::kName), offsetof(Type, name)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::index), to_underlying(Fields::kIndex), offsetof(T, index)>(),
+        DataModel::DecodableField<decltype(T::name), to_underlying(Fields::kName), offsetof(T, name)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::index), &T::index, to_underlying(Fields::kIndex)>(),
+        DataModel::DecodableMemberField<T, decltype(T::name), &T::name, to_underlying(Fields::kName)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17321,6 +30283,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace RenameOutput.
 } // namespace Commands
 
@@ -17365,6 +30328,26 @@ namespace Events {
 namespace ApplicationLauncher {
 namespace Structs {
 namespace Application {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::catalogVendorId), to_underlying(Fields::kCatalogVendorId), offsetof(Type, catalogVendorId)>(),
+    DataModel::Field<decltype(Type::applicationId), to_underlying(Fields::kApplicationId), offsetof(Type, applicationId)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17406,9 +30389,30 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace Application
 namespace ApplicationEP {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::application), to_underlying(Fields::kApplication), offsetof(Type, application)>(),
+    DataModel::Field<decltype(Type::endpoint), to_underlying(Fields::kEndpoint), offsetof(Type, endpoint)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17450,12 +30454,56 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ApplicationEP
 } // namespace Structs
 
 namespace Commands {
 namespace LaunchApp {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::application), to_underlying(Fields::kApplication), offsetof(Type, application)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::application), to_underlying(Fields::kApplication), offsetof(T, application)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::application), &T::application, to_underlying(Fields::kApplication)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17495,8 +30543,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LaunchApp.
 namespace StopApp {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::application), to_underlying(Fields::kApplication), offsetof(Type, application)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::application), to_underlying(Fields::kApplication), offsetof(T, application)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::application), &T::application, to_underlying(Fields::kApplication)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17532,8 +30621,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace StopApp.
 namespace HideApp {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::application), to_underlying(Fields::kApplication), offsetof(Type, application)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::application), to_underlying(Fields::kApplication), offsetof(T, application)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::application), &T::application, to_underlying(Fields::kApplication)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17569,8 +30699,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace HideApp.
 namespace LauncherResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::data), to_underlying(Fields::kData), offsetof(Type, data)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::data), to_underlying(Fields::kData), offsetof(T, data)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::data), &T::data, to_underlying(Fields::kData)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17610,6 +30784,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace LauncherResponse.
 } // namespace Commands
 
@@ -17654,6 +30829,26 @@ namespace Events {
 namespace ApplicationBasic {
 namespace Structs {
 namespace ApplicationBasicApplication {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::catalogVendorId), to_underlying(Fields::kCatalogVendorId), offsetof(Type, catalogVendorId)>(),
+    DataModel::Field<decltype(Type::applicationId), to_underlying(Fields::kApplicationId), offsetof(Type, applicationId)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17695,6 +30890,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace ApplicationBasicApplication
 } // namespace Structs
@@ -17762,6 +30958,49 @@ namespace AccountLogin {
 
 namespace Commands {
 namespace GetSetupPIN {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::tempAccountIdentifier), to_underlying(Fields::kTempAccountIdentifier),
+                              offsetof(Type, tempAccountIdentifier)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::tempAccountIdentifier), to_underlying(Fields::kTempAccountIdentifier),
+                                  offsetof(T, tempAccountIdentifier)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::tempAccountIdentifier), &T::tempAccountIdentifier,
+                                        to_underlying(Fields::kTempAccountIdentifier)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17798,8 +31037,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetSetupPIN.
 namespace GetSetupPINResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::setupPIN), to_underlying(Fields::kSetupPIN), offsetof(Type, setupPIN)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::setupPIN), to_underlying(Fields::kSetupPIN), offsetof(T, setupPIN)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::setupPIN), &T::setupPIN, to_underlying(Fields::kSetupPIN)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17835,8 +31115,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetSetupPINResponse.
 namespace Login {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::tempAccountIdentifier), to_underlying(Fields::kTempAccountIdentifier),
+                              offsetof(Type, tempAccountIdentifier)>(),
+    DataModel::EncodableField<decltype(Type::setupPIN), to_underlying(Fields::kSetupPIN), offsetof(Type, setupPIN)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::tempAccountIdentifier), to_underlying(Fields::kTempAccountIdentifier),
+                                  offsetof(T, tempAccountIdentifier)>(),
+        DataModel::DecodableField<decltype(T::setupPIN), to_underlying(Fields::kSetupPIN), offsetof(T, setupPIN)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::tempAccountIdentifier), &T::tempAccountIdentifier,
+                                        to_underlying(Fields::kTempAccountIdentifier)>(),
+        DataModel::DecodableMemberField<T, decltype(T::setupPIN), &T::setupPIN, to_underlying(Fields::kSetupPIN)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17877,8 +31204,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Login.
 namespace Logout {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17910,6 +31275,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Logout.
 } // namespace Commands
 
@@ -17949,6 +31315,64 @@ namespace ElectricalMeasurement {
 
 namespace Commands {
 namespace GetProfileInfoResponseCommand {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::profileCount), to_underlying(Fields::kProfileCount), offsetof(Type, profileCount)>(),
+    DataModel::EncodableField<decltype(Type::profileIntervalPeriod), to_underlying(Fields::kProfileIntervalPeriod),
+                              offsetof(Type, profileIntervalPeriod)>(),
+    DataModel::EncodableField<decltype(Type::maxNumberOfIntervals), to_underlying(Fields::kMaxNumberOfIntervals),
+                              offsetof(Type, maxNumberOfIntervals)>(),
+    DataModel::EncodableField<decltype(Type::listOfAttributes), to_underlying(Fields::kListOfAttributes),
+                              offsetof(Type, listOfAttributes)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::profileCount), to_underlying(Fields::kProfileCount), offsetof(T, profileCount)>(),
+        DataModel::DecodableField<decltype(T::profileIntervalPeriod), to_underlying(Fields::kProfileIntervalPeriod),
+                                  offsetof(T, profileIntervalPeriod)>(),
+        DataModel::DecodableField<decltype(T::maxNumberOfIntervals), to_underlying(Fields::kMaxNumberOfIntervals),
+                                  offsetof(T, maxNumberOfIntervals)>(),
+        DataModel::DecodableField<decltype(T::listOfAttributes), to_underlying(Fields::kListOfAttributes),
+                                  offsetof(T, listOfAttributes)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::profileCount), &T::profileCount, to_underlying(Fields::kProfileCount)>(),
+        DataModel::DecodableMemberField<T, decltype(T::profileIntervalPeriod), &T::profileIntervalPeriod,
+                                        to_underlying(Fields::kProfileIntervalPeriod)>(),
+        DataModel::DecodableMemberField<T, decltype(T::maxNumberOfIntervals), &T::maxNumberOfIntervals,
+                                        to_underlying(Fields::kMaxNumberOfIntervals)>(),
+        DataModel::DecodableMemberField<T, decltype(T::listOfAttributes), &T::listOfAttributes,
+                                        to_underlying(Fields::kListOfAttributes)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -17998,8 +31422,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetProfileInfoResponseCommand.
 namespace GetProfileInfoCommand {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18031,8 +31493,70 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetProfileInfoCommand.
 namespace GetMeasurementProfileResponseCommand {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::startTime), to_underlying(Fields::kStartTime), offsetof(Type, startTime)>(),
+    DataModel::EncodableField<decltype(Type::status), to_underlying(Fields::kStatus), offsetof(Type, status)>(),
+    DataModel::EncodableField<decltype(Type::profileIntervalPeriod), to_underlying(Fields::kProfileIntervalPeriod),
+                              offsetof(Type, profileIntervalPeriod)>(),
+    DataModel::EncodableField<decltype(Type::numberOfIntervalsDelivered), to_underlying(Fields::kNumberOfIntervalsDelivered),
+                              offsetof(Type, numberOfIntervalsDelivered)>(),
+    DataModel::EncodableField<decltype(Type::attributeId), to_underlying(Fields::kAttributeId), offsetof(Type, attributeId)>(),
+    DataModel::EncodableField<decltype(Type::intervals), to_underlying(Fields::kIntervals), offsetof(Type, intervals)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::startTime), to_underlying(Fields::kStartTime), offsetof(T, startTime)>(),
+        DataModel::DecodableField<decltype(T::status), to_underlying(Fields::kStatus), offsetof(T, status)>(),
+        DataModel::DecodableField<decltype(T::profileIntervalPeriod), to_underlying(Fields::kProfileIntervalPeriod),
+                                  offsetof(T, profileIntervalPeriod)>(),
+        DataModel::DecodableField<decltype(T::numberOfIntervalsDelivered), to_underlying(Fields::kNumberOfIntervalsDelivered),
+                                  offsetof(T, numberOfIntervalsDelivered)>(),
+        DataModel::DecodableField<decltype(T::attributeId), to_underlying(Fields::kAttributeId), offsetof(T, attributeId)>(),
+        DataModel::DecodableField<decltype(T::intervals), to_underlying(Fields::kIntervals), offsetof(T, intervals)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::startTime), &T::startTime, to_underlying(Fields::kStartTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::status), &T::status, to_underlying(Fields::kStatus)>(),
+        DataModel::DecodableMemberField<T, decltype(T::profileIntervalPeriod), &T::profileIntervalPeriod,
+                                        to_underlying(Fields::kProfileIntervalPeriod)>(),
+        DataModel::DecodableMemberField<T, decltype(T::numberOfIntervalsDelivered), &T::numberOfIntervalsDelivered,
+                                        to_underlying(Fields::kNumberOfIntervalsDelivered)>(),
+        DataModel::DecodableMemberField<T, decltype(T::attributeId), &T::attributeId, to_underlying(Fields::kAttributeId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::intervals), &T::intervals, to_underlying(Fields::kIntervals)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18090,8 +31614,58 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetMeasurementProfileResponseCommand.
 namespace GetMeasurementProfileCommand {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::attributeId), to_underlying(Fields::kAttributeId), offsetof(Type, attributeId)>(),
+    DataModel::EncodableField<decltype(Type::startTime), to_underlying(Fields::kStartTime), offsetof(Type, startTime)>(),
+    DataModel::EncodableField<decltype(Type::numberOfIntervals), to_underlying(Fields::kNumberOfIntervals),
+                              offsetof(Type, numberOfIntervals)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::attributeId), to_underlying(Fields::kAttributeId), offsetof(T, attributeId)>(),
+        DataModel::DecodableField<decltype(T::startTime), to_underlying(Fields::kStartTime), offsetof(T, startTime)>(),
+        DataModel::DecodableField<decltype(T::numberOfIntervals), to_underlying(Fields::kNumberOfIntervals),
+                                  offsetof(T, numberOfIntervals)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::attributeId), &T::attributeId, to_underlying(Fields::kAttributeId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::startTime), &T::startTime, to_underlying(Fields::kStartTime)>(),
+        DataModel::DecodableMemberField<T, decltype(T::numberOfIntervals), &T::numberOfIntervals,
+                                        to_underlying(Fields::kNumberOfIntervals)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18135,6 +31709,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace GetMeasurementProfileCommand.
 } // namespace Commands
 
@@ -18557,6 +32132,32 @@ namespace Events {
 namespace TestCluster {
 namespace Structs {
 namespace SimpleStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::a), to_underlying(Fields::kA), offsetof(Type, a)>(),
+    DataModel::Field<decltype(Type::b), to_underlying(Fields::kB), offsetof(Type, b)>(),
+    DataModel::Field<decltype(Type::c), to_underlying(Fields::kC), offsetof(Type, c)>(),
+    DataModel::Field<decltype(Type::d), to_underlying(Fields::kD), offsetof(Type, d)>(),
+    DataModel::Field<decltype(Type::e), to_underlying(Fields::kE), offsetof(Type, e)>(),
+    DataModel::Field<decltype(Type::f), to_underlying(Fields::kF), offsetof(Type, f)>(),
+    DataModel::Field<decltype(Type::g), to_underlying(Fields::kG), offsetof(Type, g)>(),
+    DataModel::Field<decltype(Type::h), to_underlying(Fields::kH), offsetof(Type, h)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18622,6 +32223,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace SimpleStruct
 namespace TestFabricScoped {
@@ -18635,6 +32237,62 @@ CHIP_ERROR Type::EncodeForRead(TLV::TLVWriter & writer, TLV::Tag tag, FabricInde
     return DoEncode(writer, tag, MakeOptional(accessingFabricIndex));
 }
 
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::fabricSensitiveInt8u), to_underlying(Fields::kFabricSensitiveInt8u),
+                              offsetof(Type, fabricSensitiveInt8u)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::optionalFabricSensitiveInt8u), to_underlying(Fields::kOptionalFabricSensitiveInt8u),
+                              offsetof(Type, optionalFabricSensitiveInt8u)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::nullableFabricSensitiveInt8u), to_underlying(Fields::kNullableFabricSensitiveInt8u),
+                              offsetof(Type, nullableFabricSensitiveInt8u)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::nullableOptionalFabricSensitiveInt8u),
+                              to_underlying(Fields::kNullableOptionalFabricSensitiveInt8u),
+                              offsetof(Type, nullableOptionalFabricSensitiveInt8u)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::fabricSensitiveCharString), to_underlying(Fields::kFabricSensitiveCharString),
+                              offsetof(Type, fabricSensitiveCharString)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::fabricSensitiveStruct), to_underlying(Fields::kFabricSensitiveStruct),
+                              offsetof(Type, fabricSensitiveStruct)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::fabricSensitiveInt8uList), to_underlying(Fields::kFabricSensitiveInt8uList),
+                              offsetof(Type, fabricSensitiveInt8uList)>(DataModel::FieldDescriptor::kFabricSensitive),
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex),
+                              offsetof(Type, fabricIndex)>(DataModel::FieldDescriptor::kFabricIndex),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricSensitiveInt8u),
+                                    &DecodableType::fabricSensitiveInt8u, to_underlying(Fields::kFabricSensitiveInt8u)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::optionalFabricSensitiveInt8u),
+                                    &DecodableType::optionalFabricSensitiveInt8u,
+                                    to_underlying(Fields::kOptionalFabricSensitiveInt8u)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableFabricSensitiveInt8u),
+                                    &DecodableType::nullableFabricSensitiveInt8u,
+                                    to_underlying(Fields::kNullableFabricSensitiveInt8u)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableOptionalFabricSensitiveInt8u),
+                                    &DecodableType::nullableOptionalFabricSensitiveInt8u,
+                                    to_underlying(Fields::kNullableOptionalFabricSensitiveInt8u)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricSensitiveCharString),
+                                    &DecodableType::fabricSensitiveCharString, to_underlying(Fields::kFabricSensitiveCharString)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricSensitiveStruct),
+                                    &DecodableType::fabricSensitiveStruct, to_underlying(Fields::kFabricSensitiveStruct)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricSensitiveInt8uList),
+                                    &DecodableType::fabricSensitiveInt8uList, to_underlying(Fields::kFabricSensitiveInt8uList)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::fabricIndex), &DecodableType::fabricIndex,
+                                    to_underlying(Fields::kFabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
+{
+    return DataModel::EncodeFabricScopedStruct(writer, tag, this, kFields, accessingFabricIndex, fabricIndex);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::DoEncode(TLV::TLVWriter & writer, TLV::Tag tag, const Optional<FabricIndex> & accessingFabricIndex) const
 {
     bool includeSensitive = !accessingFabricIndex.HasValue() || (accessingFabricIndex.Value() == fabricIndex);
@@ -18733,9 +32391,74 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace TestFabricScoped
 namespace NullablesAndOptionalsStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::nullableInt), to_underlying(Fields::kNullableInt), offsetof(Type, nullableInt)>(),
+    DataModel::EncodableField<decltype(Type::optionalInt), to_underlying(Fields::kOptionalInt), offsetof(Type, optionalInt)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalInt), to_underlying(Fields::kNullableOptionalInt),
+                              offsetof(Type, nullableOptionalInt)>(),
+    DataModel::EncodableField<decltype(Type::nullableString), to_underlying(Fields::kNullableString),
+                              offsetof(Type, nullableString)>(),
+    DataModel::EncodableField<decltype(Type::optionalString), to_underlying(Fields::kOptionalString),
+                              offsetof(Type, optionalString)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalString), to_underlying(Fields::kNullableOptionalString),
+                              offsetof(Type, nullableOptionalString)>(),
+    DataModel::EncodableField<decltype(Type::nullableStruct), to_underlying(Fields::kNullableStruct),
+                              offsetof(Type, nullableStruct)>(),
+    DataModel::EncodableField<decltype(Type::optionalStruct), to_underlying(Fields::kOptionalStruct),
+                              offsetof(Type, optionalStruct)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStruct), to_underlying(Fields::kNullableOptionalStruct),
+                              offsetof(Type, nullableOptionalStruct)>(),
+    DataModel::EncodableField<decltype(Type::nullableList), to_underlying(Fields::kNullableList), offsetof(Type, nullableList)>(),
+    DataModel::EncodableField<decltype(Type::optionalList), to_underlying(Fields::kOptionalList), offsetof(Type, optionalList)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalList), to_underlying(Fields::kNullableOptionalList),
+                              offsetof(Type, nullableOptionalList)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableInt), &DecodableType::nullableInt,
+                                    to_underlying(Fields::kNullableInt)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::optionalInt), &DecodableType::optionalInt,
+                                    to_underlying(Fields::kOptionalInt)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableOptionalInt),
+                                    &DecodableType::nullableOptionalInt, to_underlying(Fields::kNullableOptionalInt)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableString), &DecodableType::nullableString,
+                                    to_underlying(Fields::kNullableString)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::optionalString), &DecodableType::optionalString,
+                                    to_underlying(Fields::kOptionalString)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableOptionalString),
+                                    &DecodableType::nullableOptionalString, to_underlying(Fields::kNullableOptionalString)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableStruct), &DecodableType::nullableStruct,
+                                    to_underlying(Fields::kNullableStruct)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::optionalStruct), &DecodableType::optionalStruct,
+                                    to_underlying(Fields::kOptionalStruct)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableOptionalStruct),
+                                    &DecodableType::nullableOptionalStruct, to_underlying(Fields::kNullableOptionalStruct)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableList), &DecodableType::nullableList,
+                                    to_underlying(Fields::kNullableList)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::optionalList), &DecodableType::optionalList,
+                                    to_underlying(Fields::kOptionalList)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::nullableOptionalList),
+                                    &DecodableType::nullableOptionalList, to_underlying(Fields::kNullableOptionalList)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18821,9 +32544,31 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NullablesAndOptionalsStruct
 namespace NestedStruct {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::a), to_underlying(Fields::kA), offsetof(Type, a)>(),
+    DataModel::Field<decltype(Type::b), to_underlying(Fields::kB), offsetof(Type, b)>(),
+    DataModel::Field<decltype(Type::c), to_underlying(Fields::kC), offsetof(Type, c)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18869,9 +32614,44 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NestedStruct
 namespace NestedStructList {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::a), to_underlying(Fields::kA), offsetof(Type, a)>(),
+    DataModel::EncodableField<decltype(Type::b), to_underlying(Fields::kB), offsetof(Type, b)>(),
+    DataModel::EncodableField<decltype(Type::c), to_underlying(Fields::kC), offsetof(Type, c)>(),
+    DataModel::EncodableField<decltype(Type::d), to_underlying(Fields::kD), offsetof(Type, d)>(),
+    DataModel::EncodableField<decltype(Type::e), to_underlying(Fields::kE), offsetof(Type, e)>(),
+    DataModel::EncodableField<decltype(Type::f), to_underlying(Fields::kF), offsetof(Type, f)>(),
+    DataModel::EncodableField<decltype(Type::g), to_underlying(Fields::kG), offsetof(Type, g)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::a), &DecodableType::a, to_underlying(Fields::kA)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::b), &DecodableType::b, to_underlying(Fields::kB)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::c), &DecodableType::c, to_underlying(Fields::kC)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::d), &DecodableType::d, to_underlying(Fields::kD)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::e), &DecodableType::e, to_underlying(Fields::kE)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::f), &DecodableType::f, to_underlying(Fields::kF)>(),
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::g), &DecodableType::g, to_underlying(Fields::kG)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18933,9 +32713,32 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace NestedStructList
 namespace DoubleNestedStructList {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::a), to_underlying(Fields::kA), offsetof(Type, a)>(),
+    DataModel::kEndOfFields,
+};
+constexpr DataModel::FieldDescriptor kDecodableFields[] = {
+    DataModel::DecodableMemberField<DecodableType, decltype(DecodableType::a), &DecodableType::a, to_underlying(Fields::kA)>(),
+    DataModel::kEndOfFields,
+};
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -18973,9 +32776,30 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace DoubleNestedStructList
 namespace TestListStructOctet {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::Field<decltype(Type::member1), to_underlying(Fields::kMember1), offsetof(Type, member1)>(),
+    DataModel::Field<decltype(Type::member2), to_underlying(Fields::kMember2), offsetof(Type, member2)>(),
+    DataModel::kEndOfFields,
+};
+constexpr const DataModel::FieldDescriptor * kDecodableFields = kFields;
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, kDecodableFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19017,12 +32841,50 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
 
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 
 } // namespace TestListStructOctet
 } // namespace Structs
 
 namespace Commands {
 namespace Test {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19054,8 +32916,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace Test.
 namespace TestSpecificResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::returnValue), to_underlying(Fields::kReturnValue), offsetof(Type, returnValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::returnValue), to_underlying(Fields::kReturnValue), offsetof(T, returnValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::returnValue), &T::returnValue, to_underlying(Fields::kReturnValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19091,8 +32994,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestSpecificResponse.
 namespace TestNotHandled {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19124,8 +33065,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestNotHandled.
 namespace TestAddArgumentsResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::returnValue), to_underlying(Fields::kReturnValue), offsetof(Type, returnValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::returnValue), to_underlying(Fields::kReturnValue), offsetof(T, returnValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::returnValue), &T::returnValue, to_underlying(Fields::kReturnValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19161,8 +33143,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestAddArgumentsResponse.
 namespace TestSpecific {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19194,8 +33214,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestSpecific.
 namespace TestSimpleArgumentResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::returnValue), to_underlying(Fields::kReturnValue), offsetof(Type, returnValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::returnValue), to_underlying(Fields::kReturnValue), offsetof(T, returnValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::returnValue), &T::returnValue, to_underlying(Fields::kReturnValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19231,8 +33292,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestSimpleArgumentResponse.
 namespace TestUnknownCommand {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19264,8 +33363,64 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestUnknownCommand.
 namespace TestStructArrayArgumentResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::EncodableField<decltype(Type::arg3), to_underlying(Fields::kArg3), offsetof(Type, arg3)>(),
+    DataModel::EncodableField<decltype(Type::arg4), to_underlying(Fields::kArg4), offsetof(Type, arg4)>(),
+    DataModel::EncodableField<decltype(Type::arg5), to_underlying(Fields::kArg5), offsetof(Type, arg5)>(),
+    DataModel::EncodableField<decltype(Type::arg6), to_underlying(Fields::kArg6), offsetof(Type, arg6)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::DecodableField<decltype(T::arg3), to_underlying(Fields::kArg3), offsetof(T, arg3)>(),
+        DataModel::DecodableField<decltype(T::arg4), to_underlying(Fields::kArg4), offsetof(T, arg4)>(),
+        DataModel::DecodableField<decltype(T::arg5), to_underlying(Fields::kArg5), offsetof(T, arg5)>(),
+        DataModel::DecodableField<decltype(T::arg6), to_underlying(Fields::kArg6), offsetof(T, arg6)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg3), &T::arg3, to_underlying(Fields::kArg3)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg4), &T::arg4, to_underlying(Fields::kArg4)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg5), &T::arg5, to_underlying(Fields::kArg5)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg6), &T::arg6, to_underlying(Fields::kArg6)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19321,8 +33476,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestStructArrayArgumentResponse.
 namespace TestAddArguments {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19362,8 +33561,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
-} // namespace TestAddArguments.
-namespace TestListInt8UReverseResponse {
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+} // namespace TestAddArguments.
+namespace TestListInt8UReverseResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19399,8 +33639,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestListInt8UReverseResponse.
 namespace TestSimpleArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19436,8 +33717,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestSimpleArgumentRequest.
 namespace TestEnumsResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19477,8 +33802,64 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEnumsResponse.
 namespace TestStructArrayArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::EncodableField<decltype(Type::arg3), to_underlying(Fields::kArg3), offsetof(Type, arg3)>(),
+    DataModel::EncodableField<decltype(Type::arg4), to_underlying(Fields::kArg4), offsetof(Type, arg4)>(),
+    DataModel::EncodableField<decltype(Type::arg5), to_underlying(Fields::kArg5), offsetof(Type, arg5)>(),
+    DataModel::EncodableField<decltype(Type::arg6), to_underlying(Fields::kArg6), offsetof(Type, arg6)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::DecodableField<decltype(T::arg3), to_underlying(Fields::kArg3), offsetof(T, arg3)>(),
+        DataModel::DecodableField<decltype(T::arg4), to_underlying(Fields::kArg4), offsetof(T, arg4)>(),
+        DataModel::DecodableField<decltype(T::arg5), to_underlying(Fields::kArg5), offsetof(T, arg5)>(),
+        DataModel::DecodableField<decltype(T::arg6), to_underlying(Fields::kArg6), offsetof(T, arg6)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg3), &T::arg3, to_underlying(Fields::kArg3)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg4), &T::arg4, to_underlying(Fields::kArg4)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg5), &T::arg5, to_underlying(Fields::kArg5)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg6), &T::arg6, to_underlying(Fields::kArg6)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19534,8 +33915,59 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestStructArrayArgumentRequest.
 namespace TestNullableOptionalResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::wasPresent), to_underlying(Fields::kWasPresent), offsetof(Type, wasPresent)>(),
+    DataModel::EncodableField<decltype(Type::wasNull), to_underlying(Fields::kWasNull), offsetof(Type, wasNull)>(),
+    DataModel::EncodableField<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::EncodableField<decltype(Type::originalValue), to_underlying(Fields::kOriginalValue),
+                              offsetof(Type, originalValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::wasPresent), to_underlying(Fields::kWasPresent), offsetof(T, wasPresent)>(),
+        DataModel::DecodableField<decltype(T::wasNull), to_underlying(Fields::kWasNull), offsetof(T, wasNull)>(),
+        DataModel::DecodableField<decltype(T::value), to_underlying(Fields::kValue), offsetof(T, value)>(),
+        DataModel::DecodableField<decltype(T::originalValue), to_underlying(Fields::kOriginalValue), offsetof(T, originalValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::wasPresent), &T::wasPresent, to_underlying(Fields::kWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::wasNull), &T::wasNull, to_underlying(Fields::kWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::value), &T::value, to_underlying(Fields::kValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::originalValue), &T::originalValue, to_underlying(Fields::kOriginalValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19583,8 +34015,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestNullableOptionalResponse.
 namespace TestStructArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19620,8 +34093,220 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestStructArgumentRequest.
 namespace TestComplexNullableOptionalResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::nullableIntWasNull), to_underlying(Fields::kNullableIntWasNull),
+                              offsetof(Type, nullableIntWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableIntValue), to_underlying(Fields::kNullableIntValue),
+                              offsetof(Type, nullableIntValue)>(),
+    DataModel::EncodableField<decltype(Type::optionalIntWasPresent), to_underlying(Fields::kOptionalIntWasPresent),
+                              offsetof(Type, optionalIntWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::optionalIntValue), to_underlying(Fields::kOptionalIntValue),
+                              offsetof(Type, optionalIntValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalIntWasPresent), to_underlying(Fields::kNullableOptionalIntWasPresent),
+                              offsetof(Type, nullableOptionalIntWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalIntWasNull), to_underlying(Fields::kNullableOptionalIntWasNull),
+                              offsetof(Type, nullableOptionalIntWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalIntValue), to_underlying(Fields::kNullableOptionalIntValue),
+                              offsetof(Type, nullableOptionalIntValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableStringWasNull), to_underlying(Fields::kNullableStringWasNull),
+                              offsetof(Type, nullableStringWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableStringValue), to_underlying(Fields::kNullableStringValue),
+                              offsetof(Type, nullableStringValue)>(),
+    DataModel::EncodableField<decltype(Type::optionalStringWasPresent), to_underlying(Fields::kOptionalStringWasPresent),
+                              offsetof(Type, optionalStringWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::optionalStringValue), to_underlying(Fields::kOptionalStringValue),
+                              offsetof(Type, optionalStringValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStringWasPresent),
+                              to_underlying(Fields::kNullableOptionalStringWasPresent),
+                              offsetof(Type, nullableOptionalStringWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStringWasNull), to_underlying(Fields::kNullableOptionalStringWasNull),
+                              offsetof(Type, nullableOptionalStringWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStringValue), to_underlying(Fields::kNullableOptionalStringValue),
+                              offsetof(Type, nullableOptionalStringValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableStructWasNull), to_underlying(Fields::kNullableStructWasNull),
+                              offsetof(Type, nullableStructWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableStructValue), to_underlying(Fields::kNullableStructValue),
+                              offsetof(Type, nullableStructValue)>(),
+    DataModel::EncodableField<decltype(Type::optionalStructWasPresent), to_underlying(Fields::kOptionalStructWasPresent),
+                              offsetof(Type, optionalStructWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::optionalStructValue), to_underlying(Fields::kOptionalStructValue),
+                              offsetof(Type, optionalStructValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStructWasPresent),
+                              to_underlying(Fields::kNullableOptionalStructWasPresent),
+                              offsetof(Type, nullableOptionalStructWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStructWasNull), to_underlying(Fields::kNullableOptionalStructWasNull),
+                              offsetof(Type, nullableOptionalStructWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStructValue), to_underlying(Fields::kNullableOptionalStructValue),
+                              offsetof(Type, nullableOptionalStructValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableListWasNull), to_underlying(Fields::kNullableListWasNull),
+                              offsetof(Type, nullableListWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableListValue), to_underlying(Fields::kNullableListValue),
+                              offsetof(Type, nullableListValue)>(),
+    DataModel::EncodableField<decltype(Type::optionalListWasPresent), to_underlying(Fields::kOptionalListWasPresent),
+                              offsetof(Type, optionalListWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::optionalListValue), to_underlying(Fields::kOptionalListValue),
+                              offsetof(Type, optionalListValue)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalListWasPresent),
+                              to_underlying(Fields::kNullableOptionalListWasPresent),
+                              offsetof(Type, nullableOptionalListWasPresent)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalListWasNull), to_underlying(Fields::kNullableOptionalListWasNull),
+                              offsetof(Type, nullableOptionalListWasNull)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalListValue), to_underlying(Fields::kNullableOptionalListValue),
+                              offsetof(Type, nullableOptionalListValue)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::nullableIntWasNull), to_underlying(Fields::kNullableIntWasNull),
+                                  offsetof(T, nullableIntWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableIntValue), to_underlying(Fields::kNullableIntValue),
+                                  offsetof(T, nullableIntValue)>(),
+        DataModel::DecodableField<decltype(T::optionalIntWasPresent), to_underlying(Fields::kOptionalIntWasPresent),
+                                  offsetof(T, optionalIntWasPresent)>(),
+        DataModel::DecodableField<decltype(T::optionalIntValue), to_underlying(Fields::kOptionalIntValue),
+                                  offsetof(T, optionalIntValue)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalIntWasPresent), to_underlying(Fields::kNullableOptionalIntWasPresent),
+                                  offsetof(T, nullableOptionalIntWasPresent)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalIntWasNull), to_underlying(Fields::kNullableOptionalIntWasNull),
+                                  offsetof(T, nullableOptionalIntWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalIntValue), to_underlying(Fields::kNullableOptionalIntValue),
+                                  offsetof(T, nullableOptionalIntValue)>(),
+        DataModel::DecodableField<decltype(T::nullableStringWasNull), to_underlying(Fields::kNullableStringWasNull),
+                                  offsetof(T, nullableStringWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableStringValue), to_underlying(Fields::kNullableStringValue),
+                                  offsetof(T, nullableStringValue)>(),
+        DataModel::DecodableField<decltype(T::optionalStringWasPresent), to_underlying(Fields::kOptionalStringWasPresent),
+                                  offsetof(T, optionalStringWasPresent)>(),
+        DataModel::DecodableField<decltype(T::optionalStringValue), to_underlying(Fields::kOptionalStringValue),
+                                  offsetof(T, optionalStringValue)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStringWasPresent),
+                                  to_underlying(Fields::kNullableOptionalStringWasPresent),
+                                  offsetof(T, nullableOptionalStringWasPresent)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStringWasNull), to_underlying(Fields::kNullableOptionalStringWasNull),
+                                  offsetof(T, nullableOptionalStringWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStringValue), to_underlying(Fields::kNullableOptionalStringValue),
+                                  offsetof(T, nullableOptionalStringValue)>(),
+        DataModel::DecodableField<decltype(T::nullableStructWasNull), to_underlying(Fields::kNullableStructWasNull),
+                                  offsetof(T, nullableStructWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableStructValue), to_underlying(Fields::kNullableStructValue),
+                                  offsetof(T, nullableStructValue)>(),
+        DataModel::DecodableField<decltype(T::optionalStructWasPresent), to_underlying(Fields::kOptionalStructWasPresent),
+                                  offsetof(T, optionalStructWasPresent)>(),
+        DataModel::DecodableField<decltype(T::optionalStructValue), to_underlying(Fields::kOptionalStructValue),
+                                  offsetof(T, optionalStructValue)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStructWasPresent),
+                                  to_underlying(Fields::kNullableOptionalStructWasPresent),
+                                  offsetof(T, nullableOptionalStructWasPresent)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStructWasNull), to_underlying(Fields::kNullableOptionalStructWasNull),
+                                  offsetof(T, nullableOptionalStructWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStructValue), to_underlying(Fields::kNullableOptionalStructValue),
+                                  offsetof(T, nullableOptionalStructValue)>(),
+        DataModel::DecodableField<decltype(T::nullableListWasNull), to_underlying(Fields::kNullableListWasNull),
+                                  offsetof(T, nullableListWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableListValue), to_underlying(Fields::kNullableListValue),
+                                  offsetof(T, nullableListValue)>(),
+        DataModel::DecodableField<decltype(T::optionalListWasPresent), to_underlying(Fields::kOptionalListWasPresent),
+                                  offsetof(T, optionalListWasPresent)>(),
+        DataModel::DecodableField<decltype(T::optionalListValue), to_underlying(Fields::kOptionalListValue),
+                                  offsetof(T, optionalListValue)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalListWasPresent),
+                                  to_underlying(Fields::kNullableOptionalListWasPresent),
+                                  offsetof(T, nullableOptionalListWasPresent)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalListWasNull), to_underlying(Fields::kNullableOptionalListWasNull),
+                                  offsetof(T, nullableOptionalListWasNull)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalListValue), to_underlying(Fields::kNullableOptionalListValue),
+                                  offsetof(T, nullableOptionalListValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::nullableIntWasNull), &T::nullableIntWasNull,
+                                        to_underlying(Fields::kNullableIntWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableIntValue), &T::nullableIntValue,
+                                        to_underlying(Fields::kNullableIntValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalIntWasPresent), &T::optionalIntWasPresent,
+                                        to_underlying(Fields::kOptionalIntWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalIntValue), &T::optionalIntValue,
+                                        to_underlying(Fields::kOptionalIntValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalIntWasPresent), &T::nullableOptionalIntWasPresent,
+                                        to_underlying(Fields::kNullableOptionalIntWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalIntWasNull), &T::nullableOptionalIntWasNull,
+                                        to_underlying(Fields::kNullableOptionalIntWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalIntValue), &T::nullableOptionalIntValue,
+                                        to_underlying(Fields::kNullableOptionalIntValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableStringWasNull), &T::nullableStringWasNull,
+                                        to_underlying(Fields::kNullableStringWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableStringValue), &T::nullableStringValue,
+                                        to_underlying(Fields::kNullableStringValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalStringWasPresent), &T::optionalStringWasPresent,
+                                        to_underlying(Fields::kOptionalStringWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalStringValue), &T::optionalStringValue,
+                                        to_underlying(Fields::kOptionalStringValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStringWasPresent), &T::nullableOptionalStringWasPresent,
+                                        to_underlying(Fields::kNullableOptionalStringWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStringWasNull), &T::nullableOptionalStringWasNull,
+                                        to_underlying(Fields::kNullableOptionalStringWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStringValue), &T::nullableOptionalStringValue,
+                                        to_underlying(Fields::kNullableOptionalStringValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableStructWasNull), &T::nullableStructWasNull,
+                                        to_underlying(Fields::kNullableStructWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableStructValue), &T::nullableStructValue,
+                                        to_underlying(Fields::kNullableStructValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalStructWasPresent), &T::optionalStructWasPresent,
+                                        to_underlying(Fields::kOptionalStructWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalStructValue), &T::optionalStructValue,
+                                        to_underlying(Fields::kOptionalStructValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStructWasPresent), &T::nullableOptionalStructWasPresent,
+                                        to_underlying(Fields::kNullableOptionalStructWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStructWasNull), &T::nullableOptionalStructWasNull,
+                                        to_underlying(Fields::kNullableOptionalStructWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStructValue), &T::nullableOptionalStructValue,
+                                        to_underlying(Fields::kNullableOptionalStructValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableListWasNull), &T::nullableListWasNull,
+                                        to_underlying(Fields::kNullableListWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableListValue), &T::nullableListValue,
+                                        to_underlying(Fields::kNullableListValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalListWasPresent), &T::optionalListWasPresent,
+                                        to_underlying(Fields::kOptionalListWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalListValue), &T::optionalListValue,
+                                        to_underlying(Fields::kOptionalListValue)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalListWasPresent), &T::nullableOptionalListWasPresent,
+                                        to_underlying(Fields::kNullableOptionalListWasPresent)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalListWasNull), &T::nullableOptionalListWasNull,
+                                        to_underlying(Fields::kNullableOptionalListWasNull)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalListValue), &T::nullableOptionalListValue,
+                                        to_underlying(Fields::kNullableOptionalListValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19789,8 +34474,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestComplexNullableOptionalResponse.
 namespace TestNestedStructArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19826,8 +34552,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestNestedStructArgumentRequest.
 namespace BooleanResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::value), to_underlying(Fields::kValue), offsetof(T, value)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::value), &T::value, to_underlying(Fields::kValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19863,8 +34630,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace BooleanResponse.
 namespace TestListStructArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19900,8 +34708,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestListStructArgumentRequest.
 namespace SimpleStructResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19937,8 +34786,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SimpleStructResponse.
 namespace TestListInt8UArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -19974,8 +34864,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestListInt8UArgumentRequest.
 namespace TestEmitTestEventResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::value), to_underlying(Fields::kValue), offsetof(T, value)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::value), &T::value, to_underlying(Fields::kValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20011,8 +34942,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEmitTestEventResponse.
 namespace TestNestedStructListArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20048,8 +35020,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestNestedStructListArgumentRequest.
 namespace TestEmitTestFabricScopedEventResponse {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::value), to_underlying(Fields::kValue), offsetof(Type, value)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::value), to_underlying(Fields::kValue), offsetof(T, value)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::value), &T::value, to_underlying(Fields::kValue)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20085,8 +35098,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEmitTestFabricScopedEventResponse.
 namespace TestListNestedStructListArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20122,8 +35176,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestListNestedStructListArgumentRequest.
 namespace TestListInt8UReverseRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20159,8 +35254,52 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestListInt8UReverseRequest.
 namespace TestEnumsRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20200,8 +35339,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEnumsRequest.
 namespace TestNullableOptionalRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20237,8 +35417,106 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestNullableOptionalRequest.
 namespace TestComplexNullableOptionalRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::nullableInt), to_underlying(Fields::kNullableInt), offsetof(Type, nullableInt)>(),
+    DataModel::EncodableField<decltype(Type::optionalInt), to_underlying(Fields::kOptionalInt), offsetof(Type, optionalInt)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalInt), to_underlying(Fields::kNullableOptionalInt),
+                              offsetof(Type, nullableOptionalInt)>(),
+    DataModel::EncodableField<decltype(Type::nullableString), to_underlying(Fields::kNullableString),
+                              offsetof(Type, nullableString)>(),
+    DataModel::EncodableField<decltype(Type::optionalString), to_underlying(Fields::kOptionalString),
+                              offsetof(Type, optionalString)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalString), to_underlying(Fields::kNullableOptionalString),
+                              offsetof(Type, nullableOptionalString)>(),
+    DataModel::EncodableField<decltype(Type::nullableStruct), to_underlying(Fields::kNullableStruct),
+                              offsetof(Type, nullableStruct)>(),
+    DataModel::EncodableField<decltype(Type::optionalStruct), to_underlying(Fields::kOptionalStruct),
+                              offsetof(Type, optionalStruct)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalStruct), to_underlying(Fields::kNullableOptionalStruct),
+                              offsetof(Type, nullableOptionalStruct)>(),
+    DataModel::EncodableField<decltype(Type::nullableList), to_underlying(Fields::kNullableList), offsetof(Type, nullableList)>(),
+    DataModel::EncodableField<decltype(Type::optionalList), to_underlying(Fields::kOptionalList), offsetof(Type, optionalList)>(),
+    DataModel::EncodableField<decltype(Type::nullableOptionalList), to_underlying(Fields::kNullableOptionalList),
+                              offsetof(Type, nullableOptionalList)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::nullableInt), to_underlying(Fields::kNullableInt), offsetof(T, nullableInt)>(),
+        DataModel::DecodableField<decltype(T::optionalInt), to_underlying(Fields::kOptionalInt), offsetof(T, optionalInt)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalInt), to_underlying(Fields::kNullableOptionalInt),
+                                  offsetof(T, nullableOptionalInt)>(),
+        DataModel::DecodableField<decltype(T::nullableString), to_underlying(Fields::kNullableString),
+                                  offsetof(T, nullableString)>(),
+        DataModel::DecodableField<decltype(T::optionalString), to_underlying(Fields::kOptionalString),
+                                  offsetof(T, optionalString)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalString), to_underlying(Fields::kNullableOptionalString),
+                                  offsetof(T, nullableOptionalString)>(),
+        DataModel::DecodableField<decltype(T::nullableStruct), to_underlying(Fields::kNullableStruct),
+                                  offsetof(T, nullableStruct)>(),
+        DataModel::DecodableField<decltype(T::optionalStruct), to_underlying(Fields::kOptionalStruct),
+                                  offsetof(T, optionalStruct)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalStruct), to_underlying(Fields::kNullableOptionalStruct),
+                                  offsetof(T, nullableOptionalStruct)>(),
+        DataModel::DecodableField<decltype(T::nullableList), to_underlying(Fields::kNullableList), offsetof(T, nullableList)>(),
+        DataModel::DecodableField<decltype(T::optionalList), to_underlying(Fields::kOptionalList), offsetof(T, optionalList)>(),
+        DataModel::DecodableField<decltype(T::nullableOptionalList), to_underlying(Fields::kNullableOptionalList),
+                                  offsetof(T, nullableOptionalList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::nullableInt), &T::nullableInt, to_underlying(Fields::kNullableInt)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalInt), &T::optionalInt, to_underlying(Fields::kOptionalInt)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalInt), &T::nullableOptionalInt,
+                                        to_underlying(Fields::kNullableOptionalInt)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableString), &T::nullableString,
+                                        to_underlying(Fields::kNullableString)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalString), &T::optionalString,
+                                        to_underlying(Fields::kOptionalString)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalString), &T::nullableOptionalString,
+                                        to_underlying(Fields::kNullableOptionalString)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableStruct), &T::nullableStruct,
+                                        to_underlying(Fields::kNullableStruct)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalStruct), &T::optionalStruct,
+                                        to_underlying(Fields::kOptionalStruct)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalStruct), &T::nullableOptionalStruct,
+                                        to_underlying(Fields::kNullableOptionalStruct)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableList), &T::nullableList, to_underlying(Fields::kNullableList)>(),
+        DataModel::DecodableMemberField<T, decltype(T::optionalList), &T::optionalList, to_underlying(Fields::kOptionalList)>(),
+        DataModel::DecodableMemberField<T, decltype(T::nullableOptionalList), &T::nullableOptionalList,
+                                        to_underlying(Fields::kNullableOptionalList)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20322,8 +35600,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestComplexNullableOptionalRequest.
 namespace SimpleStructEchoRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20359,8 +35678,46 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace SimpleStructEchoRequest.
 namespace TimedInvokeRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20392,8 +35749,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TimedInvokeRequest.
 namespace TestSimpleOptionalArgumentRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20429,8 +35827,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestSimpleOptionalArgumentRequest.
 namespace TestEmitTestEventRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::EncodableField<decltype(Type::arg3), to_underlying(Fields::kArg3), offsetof(Type, arg3)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::DecodableField<decltype(T::arg3), to_underlying(Fields::kArg3), offsetof(T, arg3)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg3), &T::arg3, to_underlying(Fields::kArg3)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20474,8 +35919,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEmitTestEventRequest.
 namespace TestEmitTestFabricScopedEventRequest {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20511,6 +35997,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEmitTestFabricScopedEventRequest.
 } // namespace Commands
 
@@ -20787,6 +36274,61 @@ CHIP_ERROR TypeInfo::DecodableType::Decode(TLV::TLVReader & reader, const Concre
 
 namespace Events {
 namespace TestEvent {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::arg1), to_underlying(Fields::kArg1), offsetof(Type, arg1)>(),
+    DataModel::EncodableField<decltype(Type::arg2), to_underlying(Fields::kArg2), offsetof(Type, arg2)>(),
+    DataModel::EncodableField<decltype(Type::arg3), to_underlying(Fields::kArg3), offsetof(Type, arg3)>(),
+    DataModel::EncodableField<decltype(Type::arg4), to_underlying(Fields::kArg4), offsetof(Type, arg4)>(),
+    DataModel::EncodableField<decltype(Type::arg5), to_underlying(Fields::kArg5), offsetof(Type, arg5)>(),
+    DataModel::EncodableField<decltype(Type::arg6), to_underlying(Fields::kArg6), offsetof(Type, arg6)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::arg1), to_underlying(Fields::kArg1), offsetof(T, arg1)>(),
+        DataModel::DecodableField<decltype(T::arg2), to_underlying(Fields::kArg2), offsetof(T, arg2)>(),
+        DataModel::DecodableField<decltype(T::arg3), to_underlying(Fields::kArg3), offsetof(T, arg3)>(),
+        DataModel::DecodableField<decltype(T::arg4), to_underlying(Fields::kArg4), offsetof(T, arg4)>(),
+        DataModel::DecodableField<decltype(T::arg5), to_underlying(Fields::kArg5), offsetof(T, arg5)>(),
+        DataModel::DecodableField<decltype(T::arg6), to_underlying(Fields::kArg6), offsetof(T, arg6)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::arg1), &T::arg1, to_underlying(Fields::kArg1)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg2), &T::arg2, to_underlying(Fields::kArg2)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg3), &T::arg3, to_underlying(Fields::kArg3)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg4), &T::arg4, to_underlying(Fields::kArg4)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg5), &T::arg5, to_underlying(Fields::kArg5)>(),
+        DataModel::DecodableMemberField<T, decltype(T::arg6), &T::arg6, to_underlying(Fields::kArg6)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20842,8 +36384,49 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestEvent.
 namespace TestFabricScopedEvent {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(Type, fabricIndex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::fabricIndex), to_underlying(Fields::kFabricIndex), offsetof(T, fabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::fabricIndex), &T::fabricIndex, to_underlying(Fields::kFabricIndex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields, GetFabricIndex());
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20879,6 +36462,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace TestFabricScopedEvent.
 } // namespace Events
 
@@ -20887,6 +36471,64 @@ namespace FaultInjection {
 
 namespace Commands {
 namespace FailAtFault {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::EncodableField<decltype(Type::id), to_underlying(Fields::kId), offsetof(Type, id)>(),
+    DataModel::EncodableField<decltype(Type::numCallsToSkip), to_underlying(Fields::kNumCallsToSkip),
+                              offsetof(Type, numCallsToSkip)>(),
+    DataModel::EncodableField<decltype(Type::numCallsToFail), to_underlying(Fields::kNumCallsToFail),
+                              offsetof(Type, numCallsToFail)>(),
+    DataModel::EncodableField<decltype(Type::takeMutex), to_underlying(Fields::kTakeMutex), offsetof(Type, takeMutex)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::type), to_underlying(Fields::kType), offsetof(T, type)>(),
+        DataModel::DecodableField<decltype(T::id), to_underlying(Fields::kId), offsetof(T, id)>(),
+        DataModel::DecodableField<decltype(T::numCallsToSkip), to_underlying(Fields::kNumCallsToSkip),
+                                  offsetof(T, numCallsToSkip)>(),
+        DataModel::DecodableField<decltype(T::numCallsToFail), to_underlying(Fields::kNumCallsToFail),
+                                  offsetof(T, numCallsToFail)>(),
+        DataModel::DecodableField<decltype(T::takeMutex), to_underlying(Fields::kTakeMutex), offsetof(T, takeMutex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::type), &T::type, to_underlying(Fields::kType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::id), &T::id, to_underlying(Fields::kId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::numCallsToSkip), &T::numCallsToSkip,
+                                        to_underlying(Fields::kNumCallsToSkip)>(),
+        DataModel::DecodableMemberField<T, decltype(T::numCallsToFail), &T::numCallsToFail,
+                                        to_underlying(Fields::kNumCallsToFail)>(),
+        DataModel::DecodableMemberField<T, decltype(T::takeMutex), &T::takeMutex, to_underlying(Fields::kTakeMutex)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20938,8 +36580,55 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace FailAtFault.
 namespace FailRandomlyAtFault {
+#if CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
+namespace {
+constexpr DataModel::FieldDescriptor kFields[] = {
+    DataModel::EncodableField<decltype(Type::type), to_underlying(Fields::kType), offsetof(Type, type)>(),
+    DataModel::EncodableField<decltype(Type::id), to_underlying(Fields::kId), offsetof(Type, id)>(),
+    DataModel::EncodableField<decltype(Type::percentage), to_underlying(Fields::kPercentage), offsetof(Type, percentage)>(),
+    DataModel::kEndOfFields,
+};
+// offsetof is only defined for standard-layout types: the fields of a DecodableType holding a DecodableList are
+// reached through member pointers instead.
+template <typename T, bool = std::is_standard_layout<T>::value>
+struct DecodableFields
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableField<decltype(T::type), to_underlying(Fields::kType), offsetof(T, type)>(),
+        DataModel::DecodableField<decltype(T::id), to_underlying(Fields::kId), offsetof(T, id)>(),
+        DataModel::DecodableField<decltype(T::percentage), to_underlying(Fields::kPercentage), offsetof(T, percentage)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T>
+struct DecodableFields<T, false>
+{
+    static constexpr DataModel::FieldDescriptor kFields[] = {
+        DataModel::DecodableMemberField<T, decltype(T::type), &T::type, to_underlying(Fields::kType)>(),
+        DataModel::DecodableMemberField<T, decltype(T::id), &T::id, to_underlying(Fields::kId)>(),
+        DataModel::DecodableMemberField<T, decltype(T::percentage), &T::percentage, to_underlying(Fields::kPercentage)>(),
+        DataModel::kEndOfFields,
+    };
+};
+template <typename T, bool kStandardLayout>
+constexpr DataModel::FieldDescriptor DecodableFields<T, kStandardLayout>::kFields[];
+template <typename T>
+constexpr DataModel::FieldDescriptor DecodableFields<T, false>::kFields[];
+} // namespace
+
+CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    return DataModel::EncodeStruct(writer, tag, this, kFields);
+}
+
+CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
+{
+    return DataModel::DecodeStruct(reader, this, DecodableFields<DecodableType>::kFields);
+}
+#else
 CHIP_ERROR Type::Encode(TLV::TLVWriter & writer, TLV::Tag tag) const
 {
     TLV::TLVType outer;
@@ -20983,6 +36672,7 @@ CHIP_ERROR DecodableType::Decode(TLV::TLVReader & reader)
     ReturnErrorOnFailure(reader.ExitContainer(outer));
     return CHIP_NO_ERROR;
 }
+#endif // CHIP_CONFIG_CLUSTER_OBJECTS_TABLE_CODEC
 } // namespace FailRandomlyAtFault.
 } // namespace Commands
 